@@ -0,0 +1,450 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+"use strict";
+
+// Generates the kernels and tables of the SEC2 binary curves as C, see
+// include/eccgenerated.h. Unlike index.js this needs no modules, the field
+// arithmetic is done on BigInt polynomials.
+//
+// Usage: node kernels.js [-o dir] curve...
+
+let fs = require("fs");
+let path = require("path");
+
+// SEC2 version 2.0, section 3. Hex strings are big endian.
+const CURVES = {
+    sect163k1: {
+        m: 163, taps: [7, 6, 3], a: "1", b: "1", h: 2,
+        gx: "02FE13C0537BBC11ACAA07D793DE4E6D5E5C94EEE8",
+        gy: "0289070FB05D38FF58321F2E800536D538CCDAA3D9",
+        n: "04000000000000000000020108A2E0CC0D99F8A5EF"
+    },
+    sect233k1: {
+        m: 233, taps: [74], a: "0", b: "1", h: 4,
+        gx: "017232BA853A7E731AF129F22FF4149563A419C26BF50A4C9D6EEFAD6126",
+        gy: "01DB537DECE819B7F70F555A67C427A8CD9BF18AEB9B56E0C11056FAE6A3",
+        n: "8000000000000000000000000000069D5BB915BCD46EFB1AD5F173ABDF"
+    },
+    sect283k1: {
+        m: 283, taps: [12, 7, 5], a: "0", b: "1", h: 4,
+        gx: "0503213F78CA44883F1A3B8162F188E553CD265F23C1567A16876913B0C2AC2458492836",
+        gy: "01CCDA380F1C9E318D90F95D07E5426FE87E45C0E8184698E45962364E34116177DD2259",
+        n: "01FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE9AE2ED07577265DFF7F94451E061E163C61"
+    },
+    sect409k1: {
+        m: 409, taps: [87], a: "0", b: "1", h: 4,
+        gx: "0060F05F658F49C1AD3AB1890F7184210EFD0987E307C84C27ACCFB8F9F67CC2C460189EB5AAAA62EE222EB1B35540CFE9023746",
+        gy: "01E369050B7C4E42ACBA1DACBF04299C3460782F918EA427E6325165E9EA10E3DA5F6C42E9C55215AA9CA27A5863EC48D8E0286B",
+        n: "7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFE5F83B2D4EA20400EC4557D5ED3E3E7CA5B4B5C83B8E01E5FCF"
+    },
+    sect571k1: {
+        m: 571, taps: [10, 5, 2], a: "0", b: "1", h: 4,
+        gx: "026EB7A859923FBC82189631F8103FE4AC9CA2970012D5D46024804801841CA44370958493B205E647DA304DB4CEB08CBBD1BA39494776FB988B47174DCA88C7E2945283A01C8972",
+        gy: "0349DC807F4FBF374F4AEADE3BCA95314DD58CEC9F307A54FFC61EFC006D8A2C9D4979C0AC44AEA74FBEBBB9F772AEDCB620B01A7BA7AF1B320430C8591984F601CD4C143EF1C7A3",
+        n: "020000000000000000000000000000000000000000000000000000000000000000000000131850E1F19A63E4B391A8DB917F4138B630D84BE5D639381E91DEB45CFE778F637C1001"
+    }
+};
+
+// --- GF(2^m) on BigInt polynomials ---
+
+function degree(a) {
+    return a ? a.toString(2).length - 1 : -1;
+}
+
+function pmul(a, b) {
+    let res = 0n;
+    for (let i = 0; b >> BigInt(i); i++) {
+        if ((b >> BigInt(i)) & 1n) {
+            res ^= a << BigInt(i);
+        }
+    }
+    return res;
+}
+
+function field(m, taps) {
+    let f = (1n << BigInt(m)) | 1n;
+    for (let k of taps) {
+        f |= 1n << BigInt(k);
+    }
+
+    // z^m = z^k + ... + 1, folds everything above z^m at once
+    let mask = (1n << BigInt(m)) - 1n;
+    let mod = (a) => {
+        for (let hi = a >> BigInt(m); hi; hi = a >> BigInt(m)) {
+            a = (a & mask) ^ hi;
+            for (let k of taps) {
+                a ^= hi << BigInt(k);
+            }
+        }
+        return a;
+    };
+
+    // Squaring puts a zero bit between the bits
+    let sqr = (a) => mod(BigInt("0b" + a.toString(2).split("").join("0")));
+
+    // Extended Euclid, Hankerson et al, Algorithm 2.48
+    let inv = (a) => {
+        let u = a, v = f, g1 = 1n, g2 = 0n;
+        while (u != 1n) {
+            let j = degree(u) - degree(v);
+            if (j < 0) {
+                [u, v] = [v, u];
+                [g1, g2] = [g2, g1];
+                j = -j;
+            }
+            u ^= v << BigInt(j);
+            g1 ^= g2 << BigInt(j);
+        }
+        return mod(g1);
+    };
+
+    return {
+        m: m,
+        f: f,
+        mul: (a, b) => mod(pmul(a, b)),
+        sqr: sqr,
+        inv: inv
+    };
+}
+
+// Affine points on y^2 + xy = x^3 + ax^2 + b, null is infinity
+function curve(F, a, b) {
+    let dbl = (p) => {
+        if (!p || p.x == 0n) {
+            return null;
+        }
+        let l = p.x ^ F.mul(p.y, F.inv(p.x));
+        let x = F.sqr(l) ^ l ^ a;
+        return { x: x, y: F.sqr(p.x) ^ F.mul(l ^ 1n, x) };
+    };
+
+    let add = (p, q) => {
+        if (!p) {
+            return q;
+        }
+        if (!q) {
+            return p;
+        }
+        if (p.x == q.x) {
+            return p.y == q.y ? dbl(p) : null;
+        }
+        let l = F.mul(p.y ^ q.y, F.inv(p.x ^ q.x));
+        let x = F.sqr(l) ^ l ^ p.x ^ q.x ^ a;
+        return { x: x, y: F.mul(l, p.x ^ x) ^ x ^ p.y };
+    };
+
+    let mul = (k, p) => {
+        let res = null;
+        for (let i = degree(k); i >= 0; i--) {
+            res = dbl(res);
+            if ((k >> BigInt(i)) & 1n) {
+                res = add(res, p);
+            }
+        }
+        return res;
+    };
+
+    let oncurve = (p) => {
+        let lhs = F.sqr(p.y) ^ F.mul(p.x, p.y);
+        let x2 = F.sqr(p.x);
+        return lhs == (F.mul(x2, p.x) ^ F.mul(a, x2) ^ b);
+    };
+
+    return { dbl: dbl, add: add, mul: mul, oncurve: oncurve };
+}
+
+// --- C output ---
+
+function bytes(a, words) {
+    let res = [];
+    for (let i = 0; i < words; i++) {
+        res.push("0x" + Number((a >> BigInt(8 * i)) & 0xFFn).toString(16).toUpperCase().padStart(2, "0"));
+    }
+    return res;
+}
+
+function elem(a, words, indent) {
+    let lines = [];
+    let b = bytes(a, words);
+    for (let i = 0; i < b.length; i += 12) {
+        lines.push(b.slice(i, i + 12).join(", "));
+    }
+    return "{ " + lines.join(",\n" + indent + "  ") + " }";
+}
+
+function polystring(m, taps) {
+    return [`z^${m}`].concat(taps.map(k => `z^${k}`), ["1"]).join(" + ");
+}
+
+// Shifts that fold a byte of |width| bits at bit s of the result, collected
+// per target byte so each target is updated once
+function fold(targets, source, s, width) {
+    let add = (idx, expr) => {
+        targets[idx] = targets[idx] || [];
+        targets[idx].push(expr);
+    };
+    let byte = Math.floor(s / 8);
+    let bit = s % 8;
+    add(byte, bit ? `(${source} << ${bit})` : source);
+    if (bit && 8 - bit < width) {
+        add(byte + 1, `(${source} >> ${8 - bit})`);
+    }
+}
+
+function emitreduce(name, m, taps, words) {
+    let top = m % 8;
+    let out = [];
+
+    out.push(`// Reduction modulo f(z), one byte at a time from the top, unrolled`);
+    out.push(`void eccint_mod_${name}(eccint_t *in, eccint_t *res, const curve_t *curve) {`);
+    out.push(`    eccint_t t;`);
+    out.push(``);
+    for (let i = 2 * words - 1; i >= words; i--) {
+        let targets = {};
+        for (let k of taps.concat([0])) {
+            fold(targets, "t", 8 * i - m + k, 8);
+        }
+        out.push(`    t = in[${i}];`);
+        for (let idx of Object.keys(targets).map(Number).sort((x, y) => x - y)) {
+            out.push(`    in[${idx}] ^= ${targets[idx].join(" ^ ")};`);
+        }
+    }
+
+    // Bits m and up of the top byte
+    let targets = {};
+    for (let k of taps.concat([0])) {
+        fold(targets, "t", k, 8 - top);
+    }
+    out.push(`    t = in[${words - 1}] >> ${top};`);
+    out.push(`    in[${words - 1}] &= 0x${((1 << top) - 1).toString(16).toUpperCase().padStart(2, "0")};`);
+    for (let idx of Object.keys(targets).map(Number).sort((x, y) => x - y)) {
+        out.push(`    in[${idx}] ^= ${targets[idx].join(" ^ ")};`);
+    }
+    out.push(``);
+    out.push(`    eccint_cpy(res, in, curve->words);`);
+    out.push(`}`);
+    return out.join("\n");
+}
+
+function emitsquare(name, words) {
+    return [
+        `// Squaring spreads the bits to the even positions, then reduces`,
+        `static void eccint_square_${name}(const eccint_t *a, eccint_t *res, const curve_t *curve) {`,
+        `    eccint_t wide[${2 * words}];`,
+        ``,
+        `    for (size_t i = 0; i < ${words}; i++) {`,
+        `        wide[2 * i] = ecc_spread[a[i]] & 0xFF;`,
+        `        wide[2 * i + 1] = ecc_spread[a[i]] >> 8;`,
+        `    }`,
+        `    eccint_mod_${name}(wide, res, curve);`,
+        `}`
+    ].join("\n");
+}
+
+// Itoh-Tsujii, a^-1 = (a^(2^(m-1) - 1))^2. b_k = a^(2^k - 1) along the bits
+// of m - 1, b_2k = b_k^(2^k) b_k and b_2k+1 = b_2k^2 a.
+function emitinv(name, m, words) {
+    let n = m - 1;
+    let chain = [1];
+    let out = [];
+    let k = 1;
+
+    for (let i = degree(BigInt(n)) - 1; i >= 0; i--) {
+        out.push(`    // a^(2^${2 * k} - 1)`);
+        out.push(`    eccint_multisquare_${name}(b, ${k}, t, curve);`);
+        out.push(`    eccint_mul_${name}(t, b, b, curve);`);
+        k *= 2;
+        chain.push(k);
+        if ((n >> i) & 1) {
+            out.push(`    // a^(2^${k + 1} - 1)`);
+            out.push(`    eccint_square_${name}(b, t, curve);`);
+            out.push(`    eccint_mul_${name}(t, a, b, curve);`);
+            k++;
+            chain.push(k);
+        }
+    }
+
+    return [
+        `static void eccint_mul_${name}(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {`,
+        `    eccint_t wide[${2 * words}];`,
+        ``,
+        `    eccint_mul(a, b, wide, curve);`,
+        `    eccint_mod_${name}(wide, res, curve);`,
+        `}`,
+        ``,
+        `static void eccint_multisquare_${name}(const eccint_t *a, const size_t k, eccint_t *res, const curve_t *curve) {`,
+        `    eccint_square_${name}(a, res, curve);`,
+        `    for (size_t i = 1; i < k; i++) {`,
+        `        eccint_square_${name}(res, res, curve);`,
+        `    }`,
+        `}`,
+        ``,
+        `// Itoh-Tsujii inversion, a^-1 = (a^(2^${n} - 1))^2 with the exponents 2^k - 1`,
+        `// for k = ${chain.join(", ")}`,
+        `static void eccint_inv_${name}(const eccint_t *a, eccint_t *res, const curve_t *curve) {`,
+        `    eccint_t b[${words}];`,
+        `    eccint_t t[${words}];`,
+        ``,
+        `    eccint_cpy(b, a, ${words});`
+    ].concat(out, [
+        `    eccint_square_${name}(b, res, curve);`,
+        `}`
+    ]).join("\n");
+}
+
+function emitcurve(name) {
+    let c = CURVES[name];
+    let words = Math.ceil(c.m / 8);
+    let F = field(c.m, c.taps);
+    let E = curve(F, BigInt("0x" + c.a), BigInt("0x" + c.b));
+    let G = { x: BigInt("0x" + c.gx), y: BigInt("0x" + c.gy) };
+    let n = BigInt("0x" + c.n);
+    let guard = `__${name.toUpperCase()}_KERNELS_H`;
+
+    if (c.m % 2 == 0 || c.taps[0] + 7 >= c.m) {
+        throw new Error(`${name}: needs odd m and the taps below m - 7`);
+    }
+    if (!E.oncurve(G) || E.mul(n, G) !== null) {
+        throw new Error(`${name}: G is not a point of order n`);
+    }
+    console.error(`Generating ${name}, f(z) = ${polystring(c.m, c.taps)}`);
+
+    // Tr(z^i) and H(z^i) = z^i + z^(4i) + ... + z^(4^((m-1)/2) i)
+    let tracemask = 0n;
+    let halftrace = [];
+    for (let i = 0; i < c.m; i++) {
+        let t = 1n << BigInt(i);
+        let sum = t;
+        let half = t;
+        for (let k = 1; k < c.m; k++) {
+            t = F.sqr(t);
+            sum ^= t;
+            if (k % 2 == 0) {
+                half ^= t;
+            }
+        }
+        tracemask |= (sum & 1n) << BigInt(i);
+        halftrace.push(half);
+    }
+
+    // 2^i P, as ecc_precomp_build
+    let ptable = [G];
+    for (let i = 1; i < 8 * words; i++) {
+        ptable.push(E.dbl(ptable[i - 1]));
+    }
+
+    let out = [];
+    out.push(`/* This Source Code Form is subject to the terms of the Mozilla Public`);
+    out.push(` * License, v. 2.0. If a copy of the MPL was not distributed with this`);
+    out.push(` * file, You can obtain one at http://mozilla.org/MPL/2.0/.`);
+    out.push(` * Portions Copyright (C) Philipp Kewisch, 2016 */`);
+    out.push(``);
+    out.push(`// Generated by contrib/gftable/kernels.js for ${name}, do not edit.`);
+    out.push(`// f(z) = ${polystring(c.m, c.taps)}, ${words} words`);
+    out.push(``);
+    out.push(`#ifndef ${guard}`);
+    out.push(`#define ${guard}`);
+    out.push(``);
+    out.push(`#include "ecctypes.h"`);
+    out.push(`#include "eccmath.h"`);
+    out.push(`#include "eccgenerated.h"`);
+    out.push(`#include "eccspread.h"`);
+    out.push(``);
+    out.push(`#if KEYSIZE < ${words}`);
+    out.push(`#error ${name} needs KEYSIZE=${words} or more`);
+    out.push(`#endif`);
+    out.push(``);
+    out.push(emitreduce(name, c.m, c.taps, words));
+    out.push(``);
+    out.push(emitsquare(name, words));
+    out.push(``);
+    out.push(emitinv(name, c.m, words));
+    out.push(``);
+    out.push(`static const eccint_t eccint_${name}_tracemask[${words}] = ${elem(tracemask, words, "")};`);
+    out.push(``);
+    out.push(`// H(z^i)`);
+    out.push(`static const eccint_t eccint_${name}_halftrace[${c.m}][${words}] = {`);
+    out.push(halftrace.map(h => "    " + elem(h, words, "    ")).join(",\n"));
+    out.push(`};`);
+    out.push(``);
+    out.push(`// 2^i P`);
+    out.push(`static const eccint_point_t eccint_${name}_ptable[${8 * words}] = {`);
+    out.push(ptable.map(p => "    { " + elem(p.x, words, "      ") + ",\n      " + elem(p.y, words, "      ") + ", 0 }").join(",\n"));
+    out.push(`};`);
+    out.push(``);
+    out.push(`static const curve_generated_t ${name}_generated = {`);
+    out.push(`    .square = eccint_square_${name},`);
+    out.push(`    .inv = eccint_inv_${name},`);
+    out.push(`    .tracemask = eccint_${name}_tracemask,`);
+    out.push(`    .halftrace = eccint_${name}_halftrace[0],`);
+    out.push(`    .ptable = eccint_${name}_ptable`);
+    out.push(`};`);
+    out.push(``);
+    out.push(`#endif`);
+    return out.join("\n") + "\n";
+}
+
+function emitspread() {
+    let entries = [];
+    for (let i = 0; i < 256; i++) {
+        let s = 0;
+        for (let bit = 0; bit < 8; bit++) {
+            s |= ((i >> bit) & 1) << (2 * bit);
+        }
+        entries.push("0x" + s.toString(16).toUpperCase().padStart(4, "0"));
+    }
+
+    let lines = [];
+    for (let i = 0; i < entries.length; i += 8) {
+        lines.push("    " + entries.slice(i, i + 8).join(", "));
+    }
+
+    return [
+        `/* This Source Code Form is subject to the terms of the Mozilla Public`,
+        ` * License, v. 2.0. If a copy of the MPL was not distributed with this`,
+        ` * file, You can obtain one at http://mozilla.org/MPL/2.0/.`,
+        ` * Portions Copyright (C) Philipp Kewisch, 2016 */`,
+        ``,
+        `// Generated by contrib/gftable/kernels.js, do not edit.`,
+        ``,
+        `#ifndef __ECCSPREAD_H`,
+        `#define __ECCSPREAD_H`,
+        ``,
+        `#include <stdint.h>`,
+        ``,
+        `// The bits of a byte spread to the even bits, the square of a polynomial`,
+        `static const uint16_t ecc_spread[256] = {`,
+        lines.join(",\n"),
+        `};`,
+        ``,
+        `#endif`
+    ].join("\n") + "\n";
+}
+
+function main(args) {
+    let dir = ".";
+    let names = [];
+
+    for (let i = 0; i < args.length; i++) {
+        if (args[i] == "-o") {
+            dir = args[++i];
+        } else if (CURVES[args[i]]) {
+            names.push(args[i]);
+        } else {
+            console.error(`Usage: node kernels.js [-o dir] curve...`);
+            console.error(`Curves: ${Object.keys(CURVES).join(" ")}`);
+            return 1;
+        }
+    }
+
+    fs.writeFileSync(path.join(dir, "eccspread.h"), emitspread());
+    for (let name of names) {
+        fs.writeFileSync(path.join(dir, `${name}_kernels.h`), emitcurve(name));
+    }
+    return 0;
+}
+
+process.exitCode = main(process.argv.slice(2));
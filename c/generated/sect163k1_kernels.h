@@ -0,0 +1,1196 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+// Generated by contrib/gftable/kernels.js for sect163k1, do not edit.
+// f(z) = z^163 + z^7 + z^6 + z^3 + 1, 21 words
+
+#ifndef __SECT163K1_KERNELS_H
+#define __SECT163K1_KERNELS_H
+
+#include "ecctypes.h"
+#include "eccmath.h"
+#include "eccgenerated.h"
+#include "eccspread.h"
+
+#if KEYSIZE < 21
+#error sect163k1 needs KEYSIZE=21 or more
+#endif
+
+// Reduction modulo f(z), one byte at a time from the top, unrolled
+void eccint_mod_sect163k1(eccint_t *in, eccint_t *res, const curve_t *curve) {
+    eccint_t t;
+
+    t = in[41];
+    in[20] ^= (t << 5);
+    in[21] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[22] ^= (t >> 4) ^ (t >> 5);
+    t = in[40];
+    in[19] ^= (t << 5);
+    in[20] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[21] ^= (t >> 4) ^ (t >> 5);
+    t = in[39];
+    in[18] ^= (t << 5);
+    in[19] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[20] ^= (t >> 4) ^ (t >> 5);
+    t = in[38];
+    in[17] ^= (t << 5);
+    in[18] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[19] ^= (t >> 4) ^ (t >> 5);
+    t = in[37];
+    in[16] ^= (t << 5);
+    in[17] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[18] ^= (t >> 4) ^ (t >> 5);
+    t = in[36];
+    in[15] ^= (t << 5);
+    in[16] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[17] ^= (t >> 4) ^ (t >> 5);
+    t = in[35];
+    in[14] ^= (t << 5);
+    in[15] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[16] ^= (t >> 4) ^ (t >> 5);
+    t = in[34];
+    in[13] ^= (t << 5);
+    in[14] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[15] ^= (t >> 4) ^ (t >> 5);
+    t = in[33];
+    in[12] ^= (t << 5);
+    in[13] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[14] ^= (t >> 4) ^ (t >> 5);
+    t = in[32];
+    in[11] ^= (t << 5);
+    in[12] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[13] ^= (t >> 4) ^ (t >> 5);
+    t = in[31];
+    in[10] ^= (t << 5);
+    in[11] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[12] ^= (t >> 4) ^ (t >> 5);
+    t = in[30];
+    in[9] ^= (t << 5);
+    in[10] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[11] ^= (t >> 4) ^ (t >> 5);
+    t = in[29];
+    in[8] ^= (t << 5);
+    in[9] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[10] ^= (t >> 4) ^ (t >> 5);
+    t = in[28];
+    in[7] ^= (t << 5);
+    in[8] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[9] ^= (t >> 4) ^ (t >> 5);
+    t = in[27];
+    in[6] ^= (t << 5);
+    in[7] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[8] ^= (t >> 4) ^ (t >> 5);
+    t = in[26];
+    in[5] ^= (t << 5);
+    in[6] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[7] ^= (t >> 4) ^ (t >> 5);
+    t = in[25];
+    in[4] ^= (t << 5);
+    in[5] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[6] ^= (t >> 4) ^ (t >> 5);
+    t = in[24];
+    in[3] ^= (t << 5);
+    in[4] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[5] ^= (t >> 4) ^ (t >> 5);
+    t = in[23];
+    in[2] ^= (t << 5);
+    in[3] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[4] ^= (t >> 4) ^ (t >> 5);
+    t = in[22];
+    in[1] ^= (t << 5);
+    in[2] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[3] ^= (t >> 4) ^ (t >> 5);
+    t = in[21];
+    in[0] ^= (t << 5);
+    in[1] ^= (t << 4) ^ (t << 3) ^ t ^ (t >> 3);
+    in[2] ^= (t >> 4) ^ (t >> 5);
+    t = in[20] >> 3;
+    in[20] &= 0x07;
+    in[0] ^= (t << 7) ^ (t << 6) ^ (t << 3) ^ t;
+    in[1] ^= (t >> 1) ^ (t >> 2);
+
+    eccint_cpy(res, in, curve->words);
+}
+
+// Squaring spreads the bits to the even positions, then reduces
+static void eccint_square_sect163k1(const eccint_t *a, eccint_t *res, const curve_t *curve) {
+    eccint_t wide[42];
+
+    for (size_t i = 0; i < 21; i++) {
+        wide[2 * i] = ecc_spread[a[i]] & 0xFF;
+        wide[2 * i + 1] = ecc_spread[a[i]] >> 8;
+    }
+    eccint_mod_sect163k1(wide, res, curve);
+}
+
+static void eccint_mul_sect163k1(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {
+    eccint_t wide[42];
+
+    eccint_mul(a, b, wide, curve);
+    eccint_mod_sect163k1(wide, res, curve);
+}
+
+static void eccint_multisquare_sect163k1(const eccint_t *a, const size_t k, eccint_t *res, const curve_t *curve) {
+    eccint_square_sect163k1(a, res, curve);
+    for (size_t i = 1; i < k; i++) {
+        eccint_square_sect163k1(res, res, curve);
+    }
+}
+
+// Itoh-Tsujii inversion, a^-1 = (a^(2^162 - 1))^2 with the exponents 2^k - 1
+// for k = 1, 2, 4, 5, 10, 20, 40, 80, 81, 162
+static void eccint_inv_sect163k1(const eccint_t *a, eccint_t *res, const curve_t *curve) {
+    eccint_t b[21];
+    eccint_t t[21];
+
+    eccint_cpy(b, a, 21);
+    // a^(2^2 - 1)
+    eccint_multisquare_sect163k1(b, 1, t, curve);
+    eccint_mul_sect163k1(t, b, b, curve);
+    // a^(2^4 - 1)
+    eccint_multisquare_sect163k1(b, 2, t, curve);
+    eccint_mul_sect163k1(t, b, b, curve);
+    // a^(2^5 - 1)
+    eccint_square_sect163k1(b, t, curve);
+    eccint_mul_sect163k1(t, a, b, curve);
+    // a^(2^10 - 1)
+    eccint_multisquare_sect163k1(b, 5, t, curve);
+    eccint_mul_sect163k1(t, b, b, curve);
+    // a^(2^20 - 1)
+    eccint_multisquare_sect163k1(b, 10, t, curve);
+    eccint_mul_sect163k1(t, b, b, curve);
+    // a^(2^40 - 1)
+    eccint_multisquare_sect163k1(b, 20, t, curve);
+    eccint_mul_sect163k1(t, b, b, curve);
+    // a^(2^80 - 1)
+    eccint_multisquare_sect163k1(b, 40, t, curve);
+    eccint_mul_sect163k1(t, b, b, curve);
+    // a^(2^81 - 1)
+    eccint_square_sect163k1(b, t, curve);
+    eccint_mul_sect163k1(t, a, b, curve);
+    // a^(2^162 - 1)
+    eccint_multisquare_sect163k1(b, 81, t, curve);
+    eccint_mul_sect163k1(t, b, b, curve);
+    eccint_square_sect163k1(b, res, curve);
+}
+
+static const eccint_t eccint_sect163k1_tracemask[21] = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00 };
+
+// H(z^i)
+static const eccint_t eccint_sect163k1_halftrace[163][21] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0x8A, 0x50, 0xC5, 0x24, 0x5F, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0x88, 0x50, 0xC5, 0x24, 0x5F, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0x42, 0x33, 0x59, 0x66, 0x53, 0x2E, 0x65, 0x43, 0x11, 0xD4, 0x41, 0xD3,
+      0x1B, 0x99, 0x24, 0x9B, 0x5A, 0x50, 0x6C, 0x43, 0x06 },
+    { 0x8C, 0x50, 0xC5, 0x24, 0x5F, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0x29, 0x58, 0x6B, 0xB7, 0x98, 0x01, 0x8A, 0x7B, 0x6B, 0xAF, 0xC8, 0x0A,
+      0xB3, 0xE1, 0x8A, 0x57, 0x06, 0xD7, 0xD2, 0x20, 0x00 },
+    { 0x4A, 0x33, 0x59, 0x66, 0x53, 0x2E, 0x65, 0x43, 0x11, 0xD4, 0x41, 0xD3,
+      0x1B, 0x99, 0x24, 0x9B, 0x5A, 0x50, 0x6C, 0x43, 0x06 },
+    { 0xAF, 0xE4, 0x4D, 0xA5, 0x18, 0xEC, 0x9D, 0x45, 0x08, 0x87, 0xFC, 0x6C,
+      0xC8, 0x05, 0x08, 0xEA, 0xDE, 0x3E, 0x1E, 0x25, 0x00 },
+    { 0x9C, 0x50, 0xC5, 0x24, 0x5F, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0x11, 0x59, 0x75, 0x85, 0x90, 0xE3, 0xD8, 0x90, 0xF0, 0xF2, 0x75, 0x4B,
+      0x60, 0x68, 0xB9, 0xE6, 0xEF, 0x0E, 0xC7, 0xF2, 0x04 },
+    { 0x09, 0x58, 0x6B, 0xB7, 0x98, 0x01, 0x8A, 0x7B, 0x6B, 0xAF, 0xC8, 0x0A,
+      0xB3, 0xE1, 0x8A, 0x57, 0x06, 0xD7, 0xD2, 0x20, 0x00 },
+    { 0x80, 0x1E, 0x08, 0xF0, 0x3B, 0xC8, 0x62, 0xAF, 0xC9, 0x04, 0x60, 0x93,
+      0x83, 0xC2, 0x05, 0xD0, 0x60, 0x49, 0x10, 0x00, 0x00 },
+    { 0x0A, 0x33, 0x59, 0x66, 0x53, 0x2E, 0x65, 0x43, 0x11, 0xD4, 0x41, 0xD3,
+      0x1B, 0x99, 0x24, 0x9B, 0x5A, 0x50, 0x6C, 0x43, 0x06 },
+    { 0x2C, 0x5B, 0xC8, 0xEA, 0x96, 0xE8, 0x39, 0x9C, 0x2C, 0xF8, 0x75, 0x3A,
+      0x16, 0x83, 0xEE, 0x74, 0xF6, 0xB1, 0xB0, 0x46, 0x06 },
+    { 0x2F, 0xE4, 0x4D, 0xA5, 0x18, 0xEC, 0x9D, 0x45, 0x08, 0x87, 0xFC, 0x6C,
+      0xC8, 0x05, 0x08, 0xEA, 0xDE, 0x3E, 0x1E, 0x25, 0x00 },
+    { 0x02, 0x25, 0x9B, 0x4D, 0x99, 0xE6, 0xF6, 0x17, 0x9B, 0xE6, 0x49, 0x85,
+      0x0C, 0x0F, 0x0C, 0x93, 0x3E, 0x41, 0xFC, 0x47, 0x06 },
+    { 0x9C, 0x51, 0xC5, 0x24, 0x5F, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0xB5, 0x10, 0xFE, 0x9F, 0x02, 0xBB, 0xAE, 0x37, 0x1B, 0x12, 0x68, 0xE3,
+      0x89, 0x63, 0xBE, 0xF5, 0x0C, 0x95, 0xB7, 0xAB, 0x02 },
+    { 0x11, 0x5B, 0x75, 0x85, 0x90, 0xE3, 0xD8, 0x90, 0xF0, 0xF2, 0x75, 0x4B,
+      0x60, 0x68, 0xB9, 0xE6, 0xEF, 0x0E, 0xC7, 0xF2, 0x04 },
+    { 0x39, 0x40, 0x2E, 0x89, 0x6A, 0xAF, 0xB1, 0x9B, 0xC3, 0xC2, 0x6D, 0xEF,
+      0x51, 0x39, 0x9F, 0xAE, 0x36, 0x8C, 0xCB, 0xE8, 0x04 },
+    { 0x09, 0x5C, 0x6B, 0xB7, 0x98, 0x01, 0x8A, 0x7B, 0x6B, 0xAF, 0xC8, 0x0A,
+      0xB3, 0xE1, 0x8A, 0x57, 0x06, 0xD7, 0xD2, 0x20, 0x00 },
+    { 0x3F, 0x25, 0xDF, 0x05, 0xAF, 0x7D, 0xED, 0x44, 0xFE, 0xEE, 0x49, 0x07,
+      0x5C, 0x23, 0x55, 0x41, 0x9A, 0x6D, 0x17, 0xED, 0x04 },
+    { 0x80, 0x16, 0x08, 0xF0, 0x3B, 0xC8, 0x62, 0xAF, 0xC9, 0x04, 0x60, 0x93,
+      0x83, 0xC2, 0x05, 0xD0, 0x60, 0x49, 0x10, 0x00, 0x00 },
+    { 0xB3, 0x75, 0x05, 0xCE, 0x96, 0x44, 0x25, 0x4F, 0xA6, 0x11, 0x4C, 0x3B,
+      0xDF, 0xE6, 0x6B, 0x53, 0xD7, 0xD1, 0xB2, 0xAB, 0x02 },
+    { 0x0A, 0x23, 0x59, 0x66, 0x53, 0x2E, 0x65, 0x43, 0x11, 0xD4, 0x41, 0xD3,
+      0x1B, 0x99, 0x24, 0x9B, 0x5A, 0x50, 0x6C, 0x43, 0x06 },
+    { 0xBF, 0x21, 0x76, 0xE3, 0x8A, 0x0B, 0x97, 0x1D, 0x98, 0xC7, 0x69, 0x26,
+      0x1E, 0x84, 0x0C, 0x0A, 0x25, 0x53, 0x42, 0xF6, 0x04 },
+    { 0x2C, 0x7B, 0xC8, 0xEA, 0x96, 0xE8, 0x39, 0x9C, 0x2C, 0xF8, 0x75, 0x3A,
+      0x16, 0x83, 0xEE, 0x74, 0xF6, 0xB1, 0xB0, 0x46, 0x06 },
+    { 0xA9, 0xD7, 0x4E, 0x08, 0x72, 0xBB, 0x30, 0x0D, 0x41, 0xAC, 0xB8, 0x93,
+      0x50, 0x59, 0x12, 0x63, 0xC9, 0xD2, 0xD7, 0x20, 0x00 },
+    { 0x2F, 0xA4, 0x4D, 0xA5, 0x18, 0xEC, 0x9D, 0x45, 0x08, 0x87, 0xFC, 0x6C,
+      0xC8, 0x05, 0x08, 0xEA, 0xDE, 0x3E, 0x1E, 0x25, 0x00 },
+    { 0x0C, 0x46, 0x12, 0xB0, 0x52, 0x87, 0xBE, 0xF0, 0xC6, 0xDE, 0x65, 0xFF,
+      0x09, 0x4E, 0x8D, 0xE6, 0xAC, 0x45, 0xB1, 0x5D, 0x06 },
+    { 0x02, 0xA5, 0x9B, 0x4D, 0x99, 0xE6, 0xF6, 0x17, 0x9B, 0xE6, 0x49, 0x85,
+      0x0C, 0x0F, 0x0C, 0x93, 0x3E, 0x41, 0xFC, 0x47, 0x06 },
+    { 0xBC, 0x6C, 0xF6, 0x93, 0xEE, 0xB1, 0x89, 0xF2, 0x96, 0xBB, 0xA0, 0xF0,
+      0x23, 0xBA, 0x72, 0xB0, 0xC2, 0xD9, 0xE9, 0x95, 0x02 },
+    { 0x9C, 0x51, 0xC4, 0x24, 0x5F, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0xB3, 0x3D, 0xF1, 0xCA, 0x41, 0x84, 0x5C, 0xD0, 0x9F, 0x3C, 0xCC, 0x8F,
+      0x92, 0xFE, 0xA1, 0x8C, 0x72, 0x30, 0x6F, 0xAE, 0x02 },
+    { 0xB5, 0x10, 0xFC, 0x9F, 0x02, 0xBB, 0xAE, 0x37, 0x1B, 0x12, 0x68, 0xE3,
+      0x89, 0x63, 0xBE, 0xF5, 0x0C, 0x95, 0xB7, 0xAB, 0x02 },
+    { 0x8B, 0x6F, 0xFE, 0x76, 0xCE, 0xD4, 0x62, 0xF0, 0x6A, 0x69, 0xE1, 0x2A,
+      0x04, 0x26, 0xEE, 0xC6, 0xBF, 0xB8, 0xA3, 0x62, 0x06 },
+    { 0x11, 0x5B, 0x71, 0x85, 0x90, 0xE3, 0xD8, 0x90, 0xF0, 0xF2, 0x75, 0x4B,
+      0x60, 0x68, 0xB9, 0xE6, 0xEF, 0x0E, 0xC7, 0xF2, 0x04 },
+    { 0xB3, 0x75, 0x37, 0x2C, 0x2C, 0x7F, 0x50, 0xDE, 0x0D, 0x3D, 0x4C, 0xEF,
+      0x3E, 0xC0, 0xEC, 0x3E, 0x6E, 0x71, 0x6E, 0xAE, 0x02 },
+    { 0x39, 0x40, 0x26, 0x89, 0x6A, 0xAF, 0xB1, 0x9B, 0xC3, 0xC2, 0x6D, 0xEF,
+      0x51, 0x39, 0x9F, 0xAE, 0x36, 0x8C, 0xCB, 0xE8, 0x04 },
+    { 0x1D, 0x1D, 0x63, 0x35, 0xD9, 0xBF, 0x9B, 0xB6, 0xA3, 0x27, 0x10, 0xB4,
+      0xAC, 0xBA, 0x62, 0x92, 0xC7, 0x99, 0x32, 0xAF, 0x02 },
+    { 0x09, 0x5C, 0x7B, 0xB7, 0x98, 0x01, 0x8A, 0x7B, 0x6B, 0xAF, 0xC8, 0x0A,
+      0xB3, 0xE1, 0x8A, 0x57, 0x06, 0xD7, 0xD2, 0x20, 0x00 },
+    { 0x35, 0xB4, 0x88, 0x81, 0x47, 0x70, 0xFD, 0x96, 0x45, 0x16, 0x48, 0x21,
+      0xBF, 0x9C, 0xF6, 0xB7, 0x78, 0x9D, 0xA7, 0xAB, 0x02 },
+    { 0x3F, 0x25, 0xFF, 0x05, 0xAF, 0x7D, 0xED, 0x44, 0xFE, 0xEE, 0x49, 0x07,
+      0x5C, 0x23, 0x55, 0x41, 0x9A, 0x6D, 0x17, 0xED, 0x04 },
+    { 0x85, 0x1E, 0x72, 0x8A, 0x05, 0xBD, 0x2B, 0x17, 0x37, 0x51, 0x8D, 0x50,
+      0x00, 0x67, 0x6F, 0xB3, 0x2D, 0xBC, 0xEE, 0x78, 0x06 },
+    { 0x80, 0x16, 0x48, 0xF0, 0x3B, 0xC8, 0x62, 0xAF, 0xC9, 0x04, 0x60, 0x93,
+      0x83, 0xC2, 0x05, 0xD0, 0x60, 0x49, 0x10, 0x00, 0x00 },
+    { 0x05, 0x1A, 0xC9, 0x80, 0x5F, 0xF0, 0x64, 0x40, 0xC7, 0x78, 0xAD, 0x05,
+      0xFE, 0xFD, 0x7B, 0x6A, 0x87, 0xC3, 0xBB, 0x63, 0x06 },
+    { 0xB3, 0x75, 0x85, 0xCE, 0x96, 0x44, 0x25, 0x4F, 0xA6, 0x11, 0x4C, 0x3B,
+      0xDF, 0xE6, 0x6B, 0x53, 0xD7, 0xD1, 0xB2, 0xAB, 0x02 },
+    { 0xB0, 0xB8, 0x09, 0xF1, 0x23, 0x48, 0xE3, 0x79, 0x4B, 0x6A, 0x85, 0xB7,
+      0x82, 0xA2, 0x88, 0x0D, 0x9F, 0x17, 0x0C, 0xC8, 0x04 },
+    { 0x0A, 0x23, 0x59, 0x67, 0x53, 0x2E, 0x65, 0x43, 0x11, 0xD4, 0x41, 0xD3,
+      0x1B, 0x99, 0x24, 0x9B, 0x5A, 0x50, 0x6C, 0x43, 0x06 },
+    { 0xB6, 0x27, 0x98, 0xCD, 0x90, 0xD9, 0x97, 0x8D, 0xA7, 0x46, 0x61, 0x7A,
+      0xE9, 0xCD, 0xF0, 0xAF, 0x5C, 0x70, 0x48, 0xD3, 0x04 },
+    { 0xBF, 0x21, 0x76, 0xE1, 0x8A, 0x0B, 0x97, 0x1D, 0x98, 0xC7, 0x69, 0x26,
+      0x1E, 0x84, 0x0C, 0x0A, 0x25, 0x53, 0x42, 0xF6, 0x04 },
+    { 0x0F, 0x39, 0x90, 0xE7, 0x0C, 0xDE, 0x11, 0x03, 0xD6, 0xAC, 0xEC, 0xD6,
+      0xE5, 0x65, 0x5F, 0xF1, 0xDD, 0x93, 0xD7, 0x20, 0x00 },
+    { 0x2C, 0x7B, 0xC8, 0xEE, 0x96, 0xE8, 0x39, 0x9C, 0x2C, 0xF8, 0x75, 0x3A,
+      0x16, 0x83, 0xEE, 0x74, 0xF6, 0xB1, 0xB0, 0x46, 0x06 },
+    { 0x9B, 0x26, 0x14, 0x16, 0x1D, 0x1E, 0x7C, 0xCF, 0x7B, 0x07, 0xD4, 0xBF,
+      0xE5, 0x77, 0xF5, 0x1F, 0x2B, 0x70, 0x27, 0xB4, 0x02 },
+    { 0xA9, 0xD7, 0x4E, 0x00, 0x72, 0xBB, 0x30, 0x0D, 0x41, 0xAC, 0xB8, 0x93,
+      0x50, 0x59, 0x12, 0x63, 0xC9, 0xD2, 0xD7, 0x20, 0x00 },
+    { 0x2E, 0xDE, 0x09, 0x80, 0x03, 0xC3, 0x6F, 0x9B, 0xF8, 0x3E, 0x3C, 0x93,
+      0xD2, 0x38, 0xE3, 0x2E, 0x5F, 0x8F, 0xC1, 0x04, 0x00 },
+    { 0x2F, 0xA4, 0x4D, 0xB5, 0x18, 0xEC, 0x9D, 0x45, 0x08, 0x87, 0xFC, 0x6C,
+      0xC8, 0x05, 0x08, 0xEA, 0xDE, 0x3E, 0x1E, 0x25, 0x00 },
+    { 0x08, 0x6E, 0x6B, 0x2D, 0x34, 0x43, 0xAD, 0x42, 0x9B, 0x16, 0x88, 0x11,
+      0x99, 0xDC, 0xBA, 0x05, 0xE8, 0xB1, 0x95, 0x1F, 0x00 },
+    { 0x0C, 0x46, 0x12, 0x90, 0x52, 0x87, 0xBE, 0xF0, 0xC6, 0xDE, 0x65, 0xFF,
+      0x09, 0x4E, 0x8D, 0xE6, 0xAC, 0x45, 0xB1, 0x5D, 0x06 },
+    { 0x1F, 0xF0, 0x8C, 0xAE, 0xEE, 0xAF, 0x67, 0x90, 0xA9, 0xCA, 0xD9, 0xC5,
+      0x71, 0x34, 0xE3, 0x05, 0x02, 0xDD, 0x12, 0xF6, 0x04 },
+    { 0x02, 0xA5, 0x9B, 0x0D, 0x99, 0xE6, 0xF6, 0x17, 0x9B, 0xE6, 0x49, 0x85,
+      0x0C, 0x0F, 0x0C, 0x93, 0x3E, 0x41, 0xFC, 0x47, 0x06 },
+    { 0x82, 0x21, 0x64, 0x04, 0x90, 0xF0, 0x46, 0x34, 0x0D, 0xCC, 0x69, 0x02,
+      0x20, 0xB6, 0xA5, 0x67, 0x0B, 0x2B, 0xAC, 0x5C, 0x06 },
+    { 0xBC, 0x6C, 0xF6, 0x13, 0xEE, 0xB1, 0x89, 0xF2, 0x96, 0xBB, 0xA0, 0xF0,
+      0x23, 0xBA, 0x72, 0xB0, 0xC2, 0xD9, 0xE9, 0x95, 0x02 },
+    { 0xB8, 0x44, 0x3D, 0x84, 0xF0, 0xF8, 0xD4, 0x1D, 0xB5, 0x5F, 0x4D, 0x4A,
+      0x30, 0x32, 0xAB, 0xE5, 0x2F, 0xDC, 0x11, 0xD2, 0x04 },
+    { 0x9C, 0x51, 0xC4, 0x24, 0x5E, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0x2F, 0x7E, 0xBC, 0xCE, 0x3F, 0x12, 0x72, 0xC9, 0x5B, 0xA8, 0x3C, 0x38,
+      0x67, 0xEF, 0xA5, 0xEE, 0xC2, 0x1D, 0x5F, 0x3E, 0x00 },
+    { 0xB3, 0x3D, 0xF1, 0xCA, 0x43, 0x84, 0x5C, 0xD0, 0x9F, 0x3C, 0xCC, 0x8F,
+      0x92, 0xFE, 0xA1, 0x8C, 0x72, 0x30, 0x6F, 0xAE, 0x02 },
+    { 0x84, 0xC4, 0x11, 0x0A, 0xD0, 0x39, 0x15, 0x94, 0x53, 0xC8, 0x4D, 0xC0,
+      0x16, 0x49, 0xEC, 0x25, 0x7F, 0x23, 0xBC, 0x5C, 0x06 },
+    { 0xB5, 0x10, 0xFC, 0x9F, 0x06, 0xBB, 0xAE, 0x37, 0x1B, 0x12, 0x68, 0xE3,
+      0x89, 0x63, 0xBE, 0xF5, 0x0C, 0x95, 0xB7, 0xAB, 0x02 },
+    { 0xB4, 0xA2, 0x08, 0x33, 0xED, 0xE2, 0x53, 0xA3, 0x3E, 0xA8, 0x28, 0x9A,
+      0xD5, 0x09, 0x37, 0x8A, 0x16, 0x74, 0x6D, 0x8A, 0x02 },
+    { 0x8B, 0x6F, 0xFE, 0x76, 0xC6, 0xD4, 0x62, 0xF0, 0x6A, 0x69, 0xE1, 0x2A,
+      0x04, 0x26, 0xEE, 0xC6, 0xBF, 0xB8, 0xA3, 0x62, 0x06 },
+    { 0x83, 0x5B, 0x5A, 0xF9, 0x8D, 0x09, 0xA9, 0x2E, 0x2B, 0x5E, 0xA9, 0x81,
+      0x17, 0x38, 0x1C, 0xF8, 0xC9, 0x37, 0xBA, 0x78, 0x06 },
+    { 0x11, 0x5B, 0x71, 0x85, 0x80, 0xE3, 0xD8, 0x90, 0xF0, 0xF2, 0x75, 0x4B,
+      0x60, 0x68, 0xB9, 0xE6, 0xEF, 0x0E, 0xC7, 0xF2, 0x04 },
+    { 0x36, 0xF9, 0xF2, 0xED, 0x79, 0x47, 0xB4, 0x90, 0x54, 0x40, 0x81, 0xEB,
+      0xBC, 0xDD, 0x64, 0x3B, 0xEA, 0x3D, 0x5C, 0xD3, 0x04 },
+    { 0xB3, 0x75, 0x37, 0x2C, 0x0C, 0x7F, 0x50, 0xDE, 0x0D, 0x3D, 0x4C, 0xEF,
+      0x3E, 0xC0, 0xEC, 0x3E, 0x6E, 0x71, 0x6E, 0xAE, 0x02 },
+    { 0x90, 0xFF, 0x4D, 0xAF, 0x15, 0x29, 0x84, 0x5C, 0xCB, 0x46, 0x55, 0xC1,
+      0xED, 0x16, 0x8C, 0x24, 0x63, 0xB3, 0xD0, 0xCD, 0x04 },
+    { 0x39, 0x40, 0x26, 0x89, 0x2A, 0xAF, 0xB1, 0x9B, 0xC3, 0xC2, 0x6D, 0xEF,
+      0x51, 0x39, 0x9F, 0xAE, 0x36, 0x8C, 0xCB, 0xE8, 0x04 },
+    { 0x24, 0xDD, 0x01, 0x8D, 0xA6, 0x7D, 0xC3, 0xD3, 0x95, 0xFA, 0x7D, 0xC9,
+      0x30, 0x44, 0xE0, 0x35, 0x4B, 0x22, 0x2C, 0x58, 0x06 },
+    { 0x1D, 0x1D, 0x63, 0x35, 0x59, 0xBF, 0x9B, 0xB6, 0xA3, 0x27, 0x10, 0xB4,
+      0xAC, 0xBA, 0x62, 0x92, 0xC7, 0x99, 0x32, 0xAF, 0x02 },
+    { 0x19, 0x15, 0x23, 0x7D, 0x25, 0x47, 0xE8, 0xE8, 0x55, 0xE7, 0xFD, 0xCB,
+      0x2F, 0x31, 0xD2, 0xC7, 0xD8, 0xBB, 0x57, 0xED, 0x04 },
+    { 0x09, 0x5C, 0x7B, 0xB7, 0x98, 0x00, 0x8A, 0x7B, 0x6B, 0xAF, 0xC8, 0x0A,
+      0xB3, 0xE1, 0x8A, 0x57, 0x06, 0xD7, 0xD2, 0x20, 0x00 },
+    { 0x36, 0xA3, 0x1D, 0xBE, 0xB5, 0x2D, 0x40, 0xB2, 0x10, 0x45, 0x41, 0xC1,
+      0x5D, 0x9B, 0xFF, 0xDB, 0xAC, 0xE3, 0xD5, 0xCD, 0x04 },
+    { 0x35, 0xB4, 0x88, 0x81, 0x47, 0x72, 0xFD, 0x96, 0x45, 0x16, 0x48, 0x21,
+      0xBF, 0x9C, 0xF6, 0xB7, 0x78, 0x9D, 0xA7, 0xAB, 0x02 },
+    { 0x10, 0x01, 0x1E, 0x32, 0x08, 0xE2, 0x52, 0xEB, 0x9B, 0x5D, 0xB5, 0x41,
+      0xD3, 0x89, 0x33, 0xB1, 0xE9, 0xD9, 0x15, 0xD2, 0x04 },
+    { 0x3F, 0x25, 0xFF, 0x05, 0xAF, 0x79, 0xED, 0x44, 0xFE, 0xEE, 0x49, 0x07,
+      0x5C, 0x23, 0x55, 0x41, 0x9A, 0x6D, 0x17, 0xED, 0x04 },
+    { 0xA5, 0x03, 0xA3, 0x5D, 0x0E, 0xE9, 0xB3, 0xE7, 0x47, 0x57, 0x9D, 0x30,
+      0xA5, 0x62, 0x64, 0x23, 0xF0, 0x66, 0x62, 0x66, 0x06 },
+    { 0x85, 0x1E, 0x72, 0x8A, 0x05, 0xB5, 0x2B, 0x17, 0x37, 0x51, 0x8D, 0x50,
+      0x00, 0x67, 0x6F, 0xB3, 0x2D, 0xBC, 0xEE, 0x78, 0x06 },
+    { 0x0B, 0xB1, 0xCE, 0x4F, 0xB1, 0x7C, 0x89, 0x4D, 0x2A, 0x63, 0x01, 0x57,
+      0xA2, 0xCC, 0x0A, 0x29, 0x5D, 0xEC, 0x7E, 0x7C, 0x06 },
+    { 0x80, 0x16, 0x48, 0xF0, 0x3B, 0xD8, 0x62, 0xAF, 0xC9, 0x04, 0x60, 0x93,
+      0x83, 0xC2, 0x05, 0xD0, 0x60, 0x49, 0x10, 0x00, 0x00 },
+    { 0xAC, 0x4D, 0x39, 0x3D, 0x9D, 0xB0, 0xA1, 0x6C, 0x5C, 0xFE, 0x15, 0x58,
+      0xB3, 0x86, 0xE5, 0xE4, 0x2B, 0x6B, 0x3C, 0x58, 0x06 },
+    { 0x05, 0x1A, 0xC9, 0x80, 0x5F, 0xD0, 0x64, 0x40, 0xC7, 0x78, 0xAD, 0x05,
+      0xFE, 0xFD, 0x7B, 0x6A, 0x87, 0xC3, 0xBB, 0x63, 0x06 },
+    { 0x2A, 0x0C, 0x98, 0x70, 0x4D, 0x84, 0x7D, 0xB5, 0xBE, 0xF9, 0x11, 0x68,
+      0xDA, 0xFC, 0x78, 0x00, 0x85, 0x27, 0x29, 0x58, 0x06 },
+    { 0xB3, 0x75, 0x85, 0xCE, 0x96, 0x04, 0x25, 0x4F, 0xA6, 0x11, 0x4C, 0x3B,
+      0xDF, 0xE6, 0x6B, 0x53, 0xD7, 0xD1, 0xB2, 0xAB, 0x02 },
+    { 0x91, 0xED, 0x44, 0xD9, 0xCB, 0xCD, 0x54, 0x34, 0xD7, 0xD1, 0x15, 0x5B,
+      0xCC, 0x24, 0x04, 0x52, 0xB3, 0x64, 0x4F, 0xF7, 0x04 },
+    { 0xB0, 0xB8, 0x09, 0xF1, 0x23, 0xC8, 0xE3, 0x79, 0x4B, 0x6A, 0x85, 0xB7,
+      0x82, 0xA2, 0x88, 0x0D, 0x9F, 0x17, 0x0C, 0xC8, 0x04 },
+    { 0xAD, 0x5F, 0xD8, 0x10, 0xA8, 0x62, 0x34, 0xFD, 0x5E, 0x64, 0x55, 0xFA,
+      0x47, 0xCB, 0x01, 0x89, 0x89, 0x36, 0xF3, 0x62, 0x06 },
+    { 0x0A, 0x23, 0x59, 0x67, 0x53, 0x2E, 0x64, 0x43, 0x11, 0xD4, 0x41, 0xD3,
+      0x1B, 0x99, 0x24, 0x9B, 0x5A, 0x50, 0x6C, 0x43, 0x06 },
+    { 0x83, 0x49, 0x1B, 0xA9, 0xAA, 0xDA, 0xC6, 0x80, 0x43, 0x56, 0xE9, 0x13,
+      0xC7, 0x20, 0xBF, 0xD5, 0x96, 0xB1, 0xFB, 0x78, 0x06 },
+    { 0xB6, 0x27, 0x98, 0xCD, 0x90, 0xD9, 0x95, 0x8D, 0xA7, 0x46, 0x61, 0x7A,
+      0xE9, 0xCD, 0xF0, 0xAF, 0x5C, 0x70, 0x48, 0xD3, 0x04 },
+    { 0xB8, 0xBE, 0xAF, 0x7B, 0x4C, 0x76, 0xC3, 0xB9, 0x12, 0x53, 0x8D, 0xE3,
+      0xBE, 0xA0, 0xD2, 0x9E, 0x6B, 0xC4, 0xD8, 0xCC, 0x04 },
+    { 0xBF, 0x21, 0x76, 0xE1, 0x8A, 0x0B, 0x93, 0x1D, 0x98, 0xC7, 0x69, 0x26,
+      0x1E, 0x84, 0x0C, 0x0A, 0x25, 0x53, 0x42, 0xF6, 0x04 },
+    { 0x94, 0x57, 0xD0, 0x7E, 0xBF, 0x76, 0x37, 0xFD, 0x3C, 0xA0, 0xB8, 0x8D,
+      0xF1, 0x82, 0x27, 0xEA, 0x0D, 0xE6, 0x2C, 0x8A, 0x02 },
+    { 0x0F, 0x39, 0x90, 0xE7, 0x0C, 0xDE, 0x19, 0x03, 0xD6, 0xAC, 0xEC, 0xD6,
+      0xE5, 0x65, 0x5F, 0xF1, 0xDD, 0x93, 0xD7, 0x20, 0x00 },
+    { 0x3F, 0x6D, 0x19, 0x68, 0x89, 0x2B, 0x0E, 0xC8, 0xAE, 0xC1, 0xC9, 0x37,
+      0xA8, 0xC8, 0xF8, 0x45, 0x83, 0x4E, 0x56, 0xF6, 0x04 },
+    { 0x2C, 0x7B, 0xC8, 0xEE, 0x96, 0xE8, 0x29, 0x9C, 0x2C, 0xF8, 0x75, 0x3A,
+      0x16, 0x83, 0xEE, 0x74, 0xF6, 0xB1, 0xB0, 0x46, 0x06 },
+    { 0x3D, 0x68, 0x25, 0x06, 0xC6, 0xE6, 0x38, 0xA6, 0xE9, 0x06, 0x80, 0xBD,
+      0x29, 0x0A, 0x63, 0x7B, 0x58, 0xE6, 0xBE, 0xAA, 0x02 },
+    { 0x9B, 0x26, 0x14, 0x16, 0x1D, 0x1E, 0x5C, 0xCF, 0x7B, 0x07, 0xD4, 0xBF,
+      0xE5, 0x77, 0xF5, 0x1F, 0x2B, 0x70, 0x27, 0xB4, 0x02 },
+    { 0xA2, 0xC6, 0xA7, 0x5A, 0x18, 0xA1, 0x32, 0xBC, 0xCA, 0xC8, 0xB9, 0xAB,
+      0x25, 0xA6, 0x7A, 0x71, 0x50, 0xB5, 0x24, 0x42, 0x06 },
+    { 0xA9, 0xD7, 0x4E, 0x00, 0x72, 0xBB, 0x70, 0x0D, 0x41, 0xAC, 0xB8, 0x93,
+      0x50, 0x59, 0x12, 0x63, 0xC9, 0xD2, 0xD7, 0x20, 0x00 },
+    { 0x1C, 0xD5, 0x89, 0x07, 0x2F, 0x05, 0x1E, 0xAD, 0xA5, 0x97, 0x90, 0x9E,
+      0xD8, 0x5A, 0xB9, 0x1F, 0x3A, 0x38, 0x35, 0x90, 0x02 },
+    { 0x2E, 0xDE, 0x09, 0x80, 0x03, 0xC3, 0xEF, 0x9B, 0xF8, 0x3E, 0x3C, 0x93,
+      0xD2, 0x38, 0xE3, 0x2E, 0x5F, 0x8F, 0xC1, 0x04, 0x00 },
+    { 0x3F, 0xDF, 0x37, 0xB9, 0x7C, 0x88, 0xC0, 0x7B, 0xFB, 0xE5, 0x89, 0x82,
+      0xA7, 0x1F, 0x95, 0xD7, 0x70, 0x29, 0xCB, 0xF3, 0x04 },
+    { 0x2F, 0xA4, 0x4D, 0xB5, 0x18, 0xEC, 0x9D, 0x44, 0x08, 0x87, 0xFC, 0x6C,
+      0xC8, 0x05, 0x08, 0xEA, 0xDE, 0x3E, 0x1E, 0x25, 0x00 },
+    { 0x34, 0xB4, 0x3A, 0x0B, 0x98, 0x4A, 0xB9, 0x9E, 0x7E, 0xA2, 0x48, 0x75,
+      0x73, 0xE3, 0xD1, 0x25, 0xF4, 0x20, 0xB0, 0x94, 0x02 },
+    { 0x08, 0x6E, 0x6B, 0x2D, 0x34, 0x43, 0xAD, 0x40, 0x9B, 0x16, 0x88, 0x11,
+      0x99, 0xDC, 0xBA, 0x05, 0xE8, 0xB1, 0x95, 0x1F, 0x00 },
+    { 0x8A, 0x27, 0x2A, 0xBD, 0x63, 0xD5, 0x93, 0x2A, 0x60, 0xDC, 0x61, 0xEE,
+      0x90, 0x72, 0x82, 0xE6, 0x44, 0xD7, 0x2D, 0x43, 0x06 },
+    { 0x0C, 0x46, 0x12, 0x90, 0x52, 0x87, 0xBE, 0xF4, 0xC6, 0xDE, 0x65, 0xFF,
+      0x09, 0x4E, 0x8D, 0xE6, 0xAC, 0x45, 0xB1, 0x5D, 0x06 },
+    { 0x09, 0xEE, 0x0F, 0x6D, 0x7E, 0xB4, 0xA1, 0x95, 0x10, 0xBE, 0x88, 0x13,
+      0xB5, 0x06, 0x52, 0x61, 0x2B, 0xFD, 0xCA, 0x21, 0x00 },
+    { 0x1F, 0xF0, 0x8C, 0xAE, 0xEE, 0xAF, 0x67, 0x98, 0xA9, 0xCA, 0xD9, 0xC5,
+      0x71, 0x34, 0xE3, 0x05, 0x02, 0xDD, 0x12, 0xF6, 0x04 },
+    { 0x8E, 0xF5, 0xBB, 0xA5, 0xBE, 0xC9, 0xA2, 0xCE, 0x3D, 0x32, 0x4C, 0x95,
+      0xA3, 0xAB, 0x67, 0xDA, 0x70, 0x54, 0x90, 0x04, 0x00 },
+    { 0x02, 0xA5, 0x9B, 0x0D, 0x99, 0xE6, 0xF6, 0x07, 0x9B, 0xE6, 0x49, 0x85,
+      0x0C, 0x0F, 0x0C, 0x93, 0x3E, 0x41, 0xFC, 0x47, 0x06 },
+    { 0x0C, 0xBC, 0x7A, 0x2B, 0x69, 0x69, 0x8D, 0x8E, 0x60, 0xF7, 0xA5, 0x8A,
+      0x35, 0xA8, 0x2F, 0xE2, 0x7D, 0xFC, 0x7C, 0x58, 0x06 },
+    { 0x82, 0x21, 0x64, 0x04, 0x90, 0xF0, 0x46, 0x14, 0x0D, 0xCC, 0x69, 0x02,
+      0x20, 0xB6, 0xA5, 0x67, 0x0B, 0x2B, 0xAC, 0x5C, 0x06 },
+    { 0x3C, 0x48, 0x9C, 0x05, 0xCF, 0x37, 0xBC, 0xD0, 0x37, 0x8A, 0x80, 0x4C,
+      0x9E, 0x95, 0xC2, 0x84, 0x68, 0xCD, 0x7C, 0x91, 0x02 },
+    { 0xBC, 0x6C, 0xF6, 0x13, 0xEE, 0xB1, 0x89, 0xB2, 0x96, 0xBB, 0xA0, 0xF0,
+      0x23, 0xBA, 0x72, 0xB0, 0xC2, 0xD9, 0xE9, 0x95, 0x02 },
+    { 0x2F, 0xFE, 0x4A, 0xE7, 0x06, 0xA9, 0x5A, 0x40, 0x71, 0xA0, 0x3C, 0xBE,
+      0x12, 0xB7, 0xFD, 0x3C, 0xF6, 0x5C, 0x86, 0x20, 0x00 },
+    { 0xB8, 0x44, 0x3D, 0x84, 0xF0, 0xF8, 0xD4, 0x9D, 0xB5, 0x5F, 0x4D, 0x4A,
+      0x30, 0x32, 0xAB, 0xE5, 0x2F, 0xDC, 0x11, 0xD2, 0x04 },
+    { 0xAF, 0xDA, 0x12, 0xE5, 0x54, 0x4F, 0xCD, 0xC1, 0x11, 0x83, 0x1C, 0xB6,
+      0x76, 0xB3, 0xBF, 0xF7, 0xD0, 0xF1, 0x96, 0x3B, 0x00 },
+    { 0x9C, 0x51, 0xC4, 0x24, 0x5E, 0x9E, 0x60, 0xD3, 0x4C, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x02 },
+    { 0x80, 0x16, 0x00, 0x44, 0x8B, 0x13, 0x8F, 0x8E, 0x13, 0x2E, 0x60, 0xDB,
+      0xBA, 0xE1, 0x89, 0x3D, 0x07, 0x33, 0x40, 0x1B, 0x00 },
+    { 0x2F, 0x7E, 0xBC, 0xCE, 0x3F, 0x12, 0x72, 0xC9, 0x59, 0xA8, 0x3C, 0x38,
+      0x67, 0xEF, 0xA5, 0xEE, 0xC2, 0x1D, 0x5F, 0x3E, 0x00 },
+    { 0x11, 0xC9, 0x0E, 0x8C, 0x9B, 0x50, 0xBE, 0xD3, 0x56, 0xFE, 0x35, 0x37,
+      0x97, 0xB8, 0x1B, 0x0B, 0xCD, 0xC1, 0x96, 0xF2, 0x04 },
+    { 0xB3, 0x3D, 0xF1, 0xCA, 0x43, 0x84, 0x5C, 0xD0, 0x9B, 0x3C, 0xCC, 0x8F,
+      0x92, 0xFE, 0xA1, 0x8C, 0x72, 0x30, 0x6F, 0xAE, 0x02 },
+    { 0x96, 0x40, 0x8D, 0xF9, 0xB8, 0xF3, 0xA3, 0x31, 0x88, 0x6F, 0xB1, 0x85,
+      0x47, 0xDD, 0x57, 0x6B, 0xED, 0x89, 0x85, 0xD6, 0x04 },
+    { 0x84, 0xC4, 0x11, 0x0A, 0xD0, 0x39, 0x15, 0x94, 0x5B, 0xC8, 0x4D, 0xC0,
+      0x16, 0x49, 0xEC, 0x25, 0x7F, 0x23, 0xBC, 0x5C, 0x06 },
+    { 0xB0, 0xC2, 0xFF, 0xFC, 0xB7, 0x6B, 0xC9, 0xF9, 0xD7, 0x42, 0x45, 0x5C,
+      0x1D, 0xA1, 0xF2, 0x7F, 0x93, 0xAB, 0xC0, 0xCD, 0x04 },
+    { 0xB5, 0x10, 0xFC, 0x9F, 0x06, 0xBB, 0xAE, 0x37, 0x0B, 0x12, 0x68, 0xE3,
+      0x89, 0x63, 0xBE, 0xF5, 0x0C, 0x95, 0xB7, 0xAB, 0x02 },
+    { 0x21, 0xAF, 0xDF, 0x57, 0xD8, 0xD0, 0xAB, 0x36, 0xD9, 0x87, 0x50, 0x45,
+      0xFA, 0xF1, 0x9E, 0xB6, 0xB1, 0xBA, 0x86, 0x3B, 0x00 },
+    { 0xB4, 0xA2, 0x08, 0x33, 0xED, 0xE2, 0x53, 0xA3, 0x1E, 0xA8, 0x28, 0x9A,
+      0xD5, 0x09, 0x37, 0x8A, 0x16, 0x74, 0x6D, 0x8A, 0x02 },
+    { 0x1B, 0x4A, 0xB8, 0x3C, 0x74, 0xE3, 0x3F, 0x28, 0xA4, 0x2D, 0x74, 0xA3,
+      0xF4, 0x58, 0xEB, 0x66, 0x30, 0xD5, 0xEF, 0xB1, 0x02 },
+    { 0x8B, 0x6F, 0xFE, 0x76, 0xC6, 0xD4, 0x62, 0xF0, 0x2A, 0x69, 0xE1, 0x2A,
+      0x04, 0x26, 0xEE, 0xC6, 0xBF, 0xB8, 0xA3, 0x62, 0x06 },
+    { 0x9B, 0x6E, 0xA8, 0xC2, 0xD8, 0x68, 0x6A, 0x07, 0xF4, 0x01, 0x54, 0x63,
+      0xA1, 0x98, 0x94, 0x64, 0xA2, 0xDF, 0xAB, 0xAA, 0x02 },
+    { 0x83, 0x5B, 0x5A, 0xF9, 0x8D, 0x09, 0xA9, 0x2E, 0xAB, 0x5E, 0xA9, 0x81,
+      0x17, 0x38, 0x1C, 0xF8, 0xC9, 0x37, 0xBA, 0x78, 0x06 },
+    { 0x2B, 0x64, 0x1D, 0x0B, 0x8B, 0xCE, 0x95, 0x0A, 0xC8, 0x53, 0x91, 0xE5,
+      0x73, 0xA9, 0x45, 0xB2, 0x82, 0xBF, 0x72, 0x66, 0x06 },
+    { 0x11, 0x5B, 0x71, 0x85, 0x80, 0xE3, 0xD8, 0x90, 0xF0, 0xF3, 0x75, 0x4B,
+      0x60, 0x68, 0xB9, 0xE6, 0xEF, 0x0E, 0xC7, 0xF2, 0x04 },
+    { 0x92, 0x20, 0x32, 0xD8, 0x03, 0x97, 0x09, 0xAD, 0x9B, 0x8C, 0xDC, 0xCB,
+      0x40, 0xC8, 0xA1, 0x57, 0x80, 0x46, 0xF2, 0x8F, 0x02 },
+    { 0x36, 0xF9, 0xF2, 0xED, 0x79, 0x47, 0xB4, 0x90, 0x54, 0x42, 0x81, 0xEB,
+      0xBC, 0xDD, 0x64, 0x3B, 0xEA, 0x3D, 0x5C, 0xD3, 0x04 },
+    { 0x00, 0x00, 0xC8, 0xE2, 0x7E, 0x5B, 0x53, 0xD2, 0xCA, 0x19, 0x00, 0x28,
+      0xAE, 0x09, 0x5E, 0x12, 0x15, 0x2C, 0xC9, 0x1F, 0x00 },
+    { 0xB3, 0x75, 0x37, 0x2C, 0x0C, 0x7F, 0x50, 0xDE, 0x0D, 0x39, 0x4C, 0xEF,
+      0x3E, 0xC0, 0xEC, 0x3E, 0x6E, 0x71, 0x6E, 0xAE, 0x02 },
+    { 0x1C, 0x55, 0x05, 0xF4, 0x0F, 0xE8, 0x59, 0x73, 0x96, 0xB5, 0x90, 0x24,
+      0x7E, 0x08, 0x4D, 0x69, 0xEE, 0x37, 0x9C, 0x95, 0x02 },
+    { 0x90, 0xFF, 0x4D, 0xAF, 0x15, 0x29, 0x84, 0x5C, 0xCB, 0x4E, 0x55, 0xC1,
+      0xED, 0x16, 0x8C, 0x24, 0x63, 0xB3, 0xD0, 0xCD, 0x04 },
+    { 0x3C, 0xC8, 0x22, 0xF0, 0x83, 0x3A, 0x2B, 0x3B, 0xC0, 0xBD, 0x80, 0x02,
+      0x1F, 0x75, 0x32, 0xF2, 0x93, 0x99, 0x7B, 0x95, 0x02 },
+    { 0x39, 0x40, 0x26, 0x89, 0x2A, 0xAF, 0xB1, 0x9B, 0xC3, 0xD2, 0x6D, 0xEF,
+      0x51, 0x39, 0x9F, 0xAE, 0x36, 0x8C, 0xCB, 0xE8, 0x04 },
+    { 0x91, 0x37, 0xA7, 0xBD, 0xE8, 0x48, 0xFC, 0xB5, 0xC1, 0xEA, 0xD5, 0xEB,
+      0x5C, 0x6A, 0xE0, 0xC4, 0xE5, 0x06, 0x62, 0xEF, 0x04 },
+    { 0x24, 0xDD, 0x01, 0x8D, 0xA6, 0x7D, 0xC3, 0xD3, 0x95, 0xDA, 0x7D, 0xC9,
+      0x30, 0x44, 0xE0, 0x35, 0x4B, 0x22, 0x2C, 0x58, 0x06 },
+    { 0x25, 0x15, 0x23, 0x7D, 0x25, 0x47, 0xE8, 0xE8, 0x55, 0x67, 0xFD, 0xCB,
+      0x2F, 0x31, 0xD2, 0xC7, 0xD8, 0xBB, 0x57, 0x6D, 0x06 },
+    { 0x1D, 0x1D, 0x63, 0x35, 0x59, 0xBF, 0x9B, 0xB6, 0xA3, 0x67, 0x10, 0xB4,
+      0xAC, 0xBA, 0x62, 0x92, 0xC7, 0x99, 0x32, 0xAF, 0x02 },
+    { 0x92, 0x50, 0xC5, 0x24, 0x5F, 0x9E, 0x60, 0xD3, 0x4D, 0x91, 0xB0, 0x4D,
+      0x77, 0x99, 0xFE, 0x5D, 0xA6, 0xA3, 0xB9, 0x8E, 0x03 },
+    { 0x19, 0x15, 0x23, 0x7D, 0x25, 0x47, 0xE8, 0xE8, 0x55, 0x67, 0xFD, 0xCB,
+      0x2F, 0x31, 0xD2, 0xC7, 0xD8, 0xBB, 0x57, 0xED, 0x04 },
+    { 0x9C, 0x63, 0x9C, 0x42, 0x0C, 0xB0, 0x05, 0x90, 0x5C, 0x45, 0xF1, 0x9E,
+      0x6C, 0x00, 0xDA, 0xC6, 0xFC, 0xF3, 0xD5, 0xCD, 0x02 },
+    { 0x09, 0x5C, 0x7B, 0xB7, 0x98, 0x00, 0x8A, 0x7B, 0x6B, 0xAF, 0xC9, 0x0A,
+      0xB3, 0xE1, 0x8A, 0x57, 0x06, 0xD7, 0xD2, 0x20, 0x00 },
+    { 0x96, 0xC0, 0x81, 0xFC, 0xB9, 0x9D, 0x45, 0x22, 0x4C, 0x00, 0xB2, 0x5F,
+      0x31, 0x9B, 0x25, 0x1D, 0x50, 0x10, 0x00, 0x00, 0x04 },
+    { 0x36, 0xA3, 0x1D, 0xBE, 0xB5, 0x2D, 0x40, 0xB2, 0x10, 0x45, 0x43, 0xC1,
+      0x5D, 0x9B, 0xFF, 0xDB, 0xAC, 0xE3, 0xD5, 0xCD, 0x04 }
+};
+
+// 2^i P
+static const eccint_point_t eccint_sect163k1_ptable[168] = {
+    { { 0xE8, 0xEE, 0x94, 0x5C, 0x5E, 0x6D, 0x4E, 0xDE, 0x93, 0xD7, 0x07, 0xAA,
+        0xAC, 0x11, 0xBC, 0x7B, 0x53, 0xC0, 0x13, 0xFE, 0x02 },
+      { 0xD9, 0xA3, 0xDA, 0xCC, 0x38, 0xD5, 0x36, 0x05, 0x80, 0x2E, 0x1F, 0x32,
+        0x58, 0xFF, 0x38, 0x5D, 0xB0, 0x0F, 0x07, 0x89, 0x02 }, 0 },
+    { { 0xEB, 0x41, 0x5C, 0x8A, 0x8D, 0x82, 0x7B, 0xA7, 0x42, 0x0B, 0xB0, 0xCF,
+        0xAA, 0x00, 0xE3, 0x8F, 0x73, 0xA2, 0x5C, 0xCB, 0x00 },
+      { 0x6B, 0xFA, 0xFE, 0x5E, 0x51, 0x64, 0x66, 0x69, 0x3A, 0xFA, 0xD5, 0xD3,
+        0xAC, 0x90, 0x5F, 0xB8, 0x9A, 0x9E, 0xC7, 0x29, 0x02 }, 0 },
+    { { 0x78, 0x15, 0xF9, 0xF3, 0x24, 0xDE, 0xFE, 0xAC, 0x6F, 0xE5, 0xC1, 0xCB,
+        0x94, 0xEF, 0x23, 0x25, 0x6E, 0x7E, 0x8C, 0xBA, 0x00 },
+      { 0x0D, 0xDB, 0x91, 0x57, 0x60, 0x2C, 0xEE, 0x8F, 0x9E, 0x7E, 0x15, 0xA0,
+        0xDF, 0x3B, 0xCF, 0x41, 0xBC, 0x6C, 0xF9, 0x10, 0x05 }, 0 },
+    { { 0xA8, 0x7D, 0x28, 0x83, 0xC3, 0xA8, 0xD5, 0xF2, 0x5C, 0x5A, 0x7D, 0x4C,
+        0xCD, 0x15, 0x0B, 0x4C, 0xCC, 0x19, 0x1E, 0xA1, 0x03 },
+      { 0x57, 0x12, 0x8A, 0x73, 0x7D, 0xCA, 0x0A, 0x4D, 0x64, 0xD1, 0xE5, 0xC8,
+        0x37, 0xA2, 0x61, 0xC4, 0x06, 0x13, 0x04, 0x04, 0x02 }, 0 },
+    { { 0x34, 0x31, 0xFE, 0xE4, 0xFA, 0x1D, 0x72, 0xCE, 0x15, 0x9E, 0x8D, 0xE7,
+        0x26, 0xB9, 0x0E, 0x96, 0x36, 0x55, 0xD1, 0xE8, 0x02 },
+      { 0x4B, 0x59, 0x41, 0xCD, 0xF7, 0xA5, 0x3C, 0x61, 0xA7, 0x52, 0xF5, 0x80,
+        0x55, 0xA9, 0x7B, 0x9D, 0xB4, 0x96, 0xA3, 0x5F, 0x05 }, 0 },
+    { { 0xBB, 0x16, 0xF1, 0x35, 0x9C, 0x14, 0x73, 0xE5, 0xF8, 0x63, 0x74, 0xA7,
+        0x0B, 0xE5, 0xBB, 0x9F, 0x42, 0xC7, 0x7D, 0x17, 0x06 },
+      { 0x5A, 0xE5, 0x1F, 0x85, 0xAB, 0xA9, 0xC7, 0xA4, 0xB8, 0x2E, 0xBF, 0xC1,
+        0x22, 0x5A, 0x4D, 0xFE, 0x4E, 0x76, 0x32, 0x52, 0x07 }, 0 },
+    { { 0xE8, 0xC3, 0x8C, 0x13, 0xE6, 0xC5, 0x3C, 0xC3, 0xBD, 0x13, 0x56, 0x0A,
+        0xAC, 0x62, 0x14, 0x8A, 0x16, 0x0A, 0xB9, 0x75, 0x05 },
+      { 0x4A, 0x2C, 0x9E, 0xD0, 0xB0, 0x9F, 0x25, 0xE0, 0xDE, 0xC4, 0x4A, 0x96,
+        0xBF, 0x3D, 0x93, 0x59, 0x56, 0x96, 0x88, 0xA1, 0x07 }, 0 },
+    { { 0xC3, 0xBE, 0x26, 0x63, 0x32, 0xDC, 0x6B, 0x2C, 0x51, 0xD1, 0xB9, 0xA9,
+        0xB3, 0xFF, 0xA3, 0xF2, 0x16, 0xAE, 0x67, 0x85, 0x03 },
+      { 0xAE, 0x70, 0x77, 0x68, 0xBA, 0x7A, 0xE7, 0xE5, 0xC8, 0xB9, 0xEF, 0xEB,
+        0x0F, 0x44, 0x9F, 0xD4, 0x40, 0x55, 0xB3, 0xA0, 0x00 }, 0 },
+    { { 0xB6, 0xEC, 0xBB, 0xD2, 0x79, 0x30, 0xF5, 0xEE, 0x48, 0x70, 0x6C, 0x65,
+        0x57, 0x0B, 0x92, 0x4B, 0x27, 0x24, 0x6A, 0xFE, 0x06 },
+      { 0xFF, 0xB0, 0x36, 0xA5, 0xDE, 0x9B, 0xD4, 0x04, 0xBB, 0x7B, 0x9B, 0x94,
+        0x1C, 0x23, 0x8D, 0xAE, 0x4E, 0xB4, 0xC3, 0x5C, 0x00 }, 0 },
+    { { 0x6C, 0x31, 0x2E, 0x3C, 0xBA, 0xE7, 0xF7, 0x0C, 0xF3, 0x3D, 0x82, 0xFF,
+        0xC5, 0xDA, 0x6D, 0x61, 0x97, 0x95, 0x8E, 0x79, 0x07 },
+      { 0xA0, 0xCF, 0x1D, 0x7C, 0x2F, 0x9E, 0xDD, 0x8B, 0xC7, 0x6D, 0xEF, 0x7D,
+        0xC9, 0x1E, 0x40, 0x94, 0xCB, 0x92, 0x6B, 0x52, 0x01 }, 0 },
+    { { 0x9F, 0x10, 0x22, 0x23, 0xB1, 0xED, 0x56, 0x91, 0x7A, 0x32, 0x44, 0xC3,
+        0x49, 0x4C, 0x15, 0xFD, 0x89, 0x42, 0x6A, 0x5A, 0x00 },
+      { 0xD0, 0xF5, 0xA0, 0x9A, 0x60, 0x95, 0x6E, 0x4B, 0x85, 0xFB, 0x58, 0x4A,
+        0x12, 0xC3, 0xD0, 0xE9, 0x13, 0xE7, 0x00, 0x22, 0x03 }, 0 },
+    { { 0x37, 0x31, 0x2B, 0xA4, 0x6B, 0x4F, 0x57, 0xC5, 0xF9, 0xE3, 0x12, 0xBA,
+        0x4A, 0xB4, 0x31, 0xAC, 0x41, 0x23, 0x61, 0x58, 0x06 },
+      { 0xEA, 0x32, 0x36, 0x35, 0xCF, 0x56, 0x29, 0x92, 0x8D, 0x0B, 0x69, 0x47,
+        0x45, 0xB5, 0x57, 0x72, 0x5C, 0x8D, 0x28, 0xF2, 0x07 }, 0 },
+    { { 0xBA, 0x48, 0x0A, 0xBE, 0x33, 0x5F, 0xDE, 0xBD, 0x0F, 0x75, 0x2A, 0xA3,
+        0x87, 0x96, 0xEB, 0x5F, 0xD6, 0xD9, 0x15, 0x28, 0x03 },
+      { 0x07, 0xED, 0x80, 0x23, 0x2D, 0x1A, 0x4B, 0x07, 0x8B, 0x5A, 0x6F, 0x53,
+        0xBA, 0xF9, 0xCD, 0xF4, 0xEC, 0xFB, 0x02, 0xAC, 0x00 }, 0 },
+    { { 0x6D, 0x10, 0x0C, 0x4F, 0x9C, 0x43, 0xF4, 0xF5, 0x6D, 0xD3, 0xE4, 0xFC,
+        0x1D, 0x1F, 0xAA, 0x9C, 0x4F, 0x99, 0xA1, 0xD4, 0x03 },
+      { 0x9B, 0xDC, 0x52, 0x63, 0x5D, 0xDE, 0x75, 0x74, 0x63, 0xD9, 0x1F, 0x65,
+        0x4D, 0x6A, 0xB9, 0x79, 0xBD, 0x50, 0x32, 0x2D, 0x06 }, 0 },
+    { { 0x86, 0x36, 0x93, 0x39, 0x26, 0xD8, 0xF5, 0x6D, 0xC8, 0x0A, 0x92, 0x68,
+        0xD6, 0x82, 0x2C, 0xFF, 0xC5, 0x64, 0x8B, 0xF9, 0x07 },
+      { 0x21, 0x66, 0x42, 0x20, 0x5C, 0xE2, 0x36, 0xD9, 0x51, 0xAF, 0x72, 0xB4,
+        0x3E, 0x8D, 0x30, 0x6C, 0xE2, 0xB9, 0x78, 0x1A, 0x06 }, 0 },
+    { { 0x2B, 0x3F, 0x77, 0x2C, 0x35, 0x12, 0x5A, 0x06, 0xA0, 0x4F, 0x0B, 0xA6,
+        0x93, 0x95, 0x20, 0xC9, 0xF8, 0x94, 0x16, 0xD4, 0x07 },
+      { 0x16, 0xFF, 0x9E, 0x76, 0x7A, 0x0A, 0x0C, 0xD8, 0xF7, 0xF1, 0x0C, 0x2E,
+        0x7C, 0x1E, 0xA3, 0xAA, 0x3E, 0x82, 0xB6, 0xF8, 0x04 }, 0 },
+    { { 0xF3, 0x38, 0xAD, 0x4A, 0x64, 0x46, 0xA0, 0xE8, 0xBB, 0x06, 0xF9, 0x1C,
+        0xC4, 0x91, 0xDB, 0x53, 0x87, 0xF8, 0x06, 0xC1, 0x05 },
+      { 0xB9, 0x2D, 0x71, 0xED, 0x4C, 0x9D, 0x03, 0xBF, 0xAC, 0x07, 0xF8, 0x04,
+        0xBA, 0x3F, 0xD3, 0xA6, 0xE4, 0xC5, 0x93, 0xAC, 0x06 }, 0 },
+    { { 0xF9, 0xFA, 0x5B, 0xCF, 0x9C, 0xC3, 0xEF, 0xC8, 0x94, 0xCC, 0x56, 0xAE,
+        0xBC, 0x44, 0xD2, 0xAC, 0xF4, 0x69, 0x0B, 0xC5, 0x00 },
+      { 0x49, 0xFD, 0xB1, 0x94, 0xDE, 0x6B, 0x28, 0x1C, 0x9E, 0x7D, 0x1D, 0x2B,
+        0x3B, 0xA4, 0xEE, 0x00, 0xD2, 0xFA, 0xE1, 0xA9, 0x07 }, 0 },
+    { { 0x04, 0x3F, 0x2F, 0x12, 0x4A, 0x53, 0x8A, 0x53, 0x1A, 0x01, 0x8B, 0x48,
+        0x27, 0x98, 0xFC, 0x94, 0x08, 0x5E, 0xDC, 0xE6, 0x07 },
+      { 0xBF, 0x88, 0xF6, 0x6C, 0x37, 0x82, 0xA1, 0x58, 0xC9, 0x3F, 0xC6, 0x1F,
+        0x9D, 0xAF, 0xC2, 0xA4, 0xD9, 0xF5, 0x9B, 0x81, 0x04 }, 0 },
+    { { 0x53, 0x94, 0x08, 0xFC, 0xED, 0x5F, 0xCF, 0xEB, 0xC0, 0x39, 0x50, 0x14,
+        0xDE, 0x68, 0x1F, 0xBD, 0x65, 0x78, 0x8C, 0x8B, 0x06 },
+      { 0xDB, 0xA9, 0xAC, 0xFA, 0xAA, 0xE6, 0x30, 0x4C, 0xD9, 0xA1, 0x57, 0xCC,
+        0x98, 0x6D, 0x4F, 0x98, 0x7C, 0x19, 0x4B, 0x0E, 0x02 }, 0 },
+    { { 0x5D, 0xB8, 0x85, 0xA7, 0xC4, 0x69, 0x14, 0x13, 0x32, 0xB6, 0x3F, 0x2E,
+        0x21, 0x43, 0x49, 0x8E, 0x29, 0x5F, 0xD0, 0x13, 0x04 },
+      { 0x2B, 0x53, 0xEC, 0xDE, 0x70, 0xB5, 0xA9, 0x4E, 0x8B, 0xD7, 0xBC, 0xDF,
+        0x80, 0xF2, 0xB0, 0x2D, 0x22, 0x07, 0xBE, 0x32, 0x03 }, 0 },
+    { { 0xB4, 0x00, 0xEB, 0xB0, 0xF9, 0x24, 0xAE, 0x66, 0xC9, 0x55, 0xB3, 0xE8,
+        0x11, 0x51, 0x68, 0xDD, 0x1C, 0x34, 0x61, 0xE3, 0x00 },
+      { 0x03, 0x66, 0x57, 0x27, 0x7A, 0xE9, 0x8C, 0x5F, 0x90, 0x4D, 0xFF, 0xE9,
+        0x92, 0xDE, 0x3E, 0x1F, 0x42, 0x08, 0x94, 0x01, 0x05 }, 0 },
+    { { 0x3A, 0x3E, 0x98, 0x04, 0xD8, 0x5C, 0xFD, 0xD1, 0x5F, 0x25, 0x9F, 0x06,
+        0x03, 0x21, 0x93, 0x33, 0xFA, 0x1C, 0xAB, 0x67, 0x01 },
+      { 0x11, 0x09, 0x0D, 0x69, 0x35, 0xCC, 0xCA, 0xF9, 0xF0, 0x6A, 0x24, 0xD0,
+        0xE5, 0xFE, 0x67, 0xCA, 0x38, 0x12, 0x6C, 0x6D, 0x05 }, 0 },
+    { { 0xAC, 0x1A, 0x4B, 0xA7, 0xA6, 0x13, 0x97, 0x81, 0x10, 0x04, 0xDE, 0x23,
+        0x69, 0x1D, 0xD3, 0x13, 0x66, 0x1E, 0x42, 0x60, 0x00 },
+      { 0xD5, 0x05, 0xF3, 0xD7, 0xE5, 0xE7, 0x8C, 0x6F, 0xCB, 0x63, 0x3E, 0xA7,
+        0x66, 0xBD, 0x6C, 0x9A, 0xDB, 0x30, 0xDE, 0x07, 0x07 }, 0 },
+    { { 0xB6, 0x65, 0x7C, 0x8B, 0x9F, 0x9F, 0xA9, 0xF8, 0x7F, 0x88, 0xFD, 0x91,
+        0x98, 0x49, 0x9F, 0xD0, 0xC7, 0xA7, 0x0B, 0xA8, 0x03 },
+      { 0x2B, 0x27, 0xDC, 0x39, 0x31, 0x62, 0x78, 0xED, 0xCB, 0xA5, 0x62, 0x9A,
+        0x0C, 0x0E, 0xDD, 0x08, 0x35, 0x08, 0x82, 0x47, 0x04 }, 0 },
+    { { 0x01, 0xDE, 0x54, 0x2A, 0xF0, 0xD2, 0x5D, 0x76, 0xB1, 0xE2, 0xDD, 0x09,
+        0x00, 0x40, 0xEC, 0x92, 0x50, 0x74, 0xB2, 0x0B, 0x01 },
+      { 0x07, 0x19, 0x2C, 0x3C, 0xA2, 0x09, 0xC2, 0x3A, 0x62, 0x93, 0xD3, 0xB6,
+        0x32, 0x3C, 0x16, 0x59, 0x5A, 0xDF, 0xF3, 0xB2, 0x02 }, 0 },
+    { { 0x8D, 0x37, 0x6C, 0xF4, 0x69, 0xB2, 0x97, 0x3C, 0x42, 0xF1, 0x57, 0x80,
+        0xFE, 0x2B, 0x43, 0xDE, 0x34, 0xD2, 0xB1, 0x47, 0x07 },
+      { 0x30, 0x95, 0x00, 0xF3, 0xBE, 0xEB, 0xC1, 0x85, 0xF9, 0xE2, 0xEE, 0x8E,
+        0x09, 0x6B, 0x95, 0x90, 0x02, 0xE1, 0x75, 0x19, 0x05 }, 0 },
+    { { 0x85, 0x38, 0x2E, 0x5A, 0x54, 0x36, 0x6E, 0xB2, 0x2C, 0xEA, 0x56, 0xAF,
+        0x26, 0xEC, 0xDB, 0x69, 0x11, 0xB7, 0x2C, 0x52, 0x06 },
+      { 0x16, 0x02, 0xF7, 0xD3, 0x07, 0x87, 0x5D, 0xF2, 0x29, 0x2E, 0x07, 0x35,
+        0xCD, 0x83, 0x8A, 0xC7, 0x67, 0xBF, 0x25, 0x0B, 0x00 }, 0 },
+    { { 0x7B, 0x95, 0xF4, 0xC2, 0x8E, 0x83, 0x76, 0x87, 0x81, 0xB7, 0xFF, 0x05,
+        0xD1, 0xB2, 0x9D, 0x64, 0x15, 0xB0, 0x85, 0x04, 0x01 },
+      { 0x23, 0x71, 0xAF, 0x97, 0xF0, 0x82, 0xFB, 0x8A, 0xE9, 0xBE, 0xBC, 0xA9,
+        0x05, 0x93, 0x47, 0x5B, 0x32, 0x1B, 0x0C, 0x96, 0x05 }, 0 },
+    { { 0xF0, 0x8C, 0x5E, 0x1D, 0xEA, 0xBD, 0xE7, 0x49, 0x0B, 0x0A, 0x61, 0x2E,
+        0xF9, 0x54, 0x82, 0x91, 0xDE, 0x60, 0x57, 0xB7, 0x00 },
+      { 0xDC, 0x6D, 0x93, 0x9D, 0x87, 0x0D, 0x74, 0x4A, 0x73, 0x0F, 0x6E, 0x1B,
+        0x68, 0xED, 0x07, 0xC9, 0xE6, 0x8B, 0xF1, 0xC3, 0x05 }, 0 },
+    { { 0x18, 0x2F, 0xDC, 0x88, 0x79, 0xCD, 0x3D, 0x78, 0x6E, 0x4E, 0x3C, 0x4A,
+        0x69, 0x42, 0x3C, 0x8E, 0x68, 0x1C, 0x7F, 0xB1, 0x02 },
+      { 0x69, 0x8E, 0xF1, 0x2B, 0x03, 0xE7, 0x72, 0x52, 0x1A, 0x76, 0xFF, 0x0A,
+        0x62, 0x74, 0xCC, 0x5B, 0x34, 0xB7, 0xE8, 0x0D, 0x02 }, 0 },
+    { { 0x5E, 0xED, 0x52, 0x4C, 0x26, 0x67, 0xCA, 0xAB, 0x51, 0x54, 0x77, 0x47,
+        0xF0, 0x21, 0x8D, 0x18, 0xAA, 0x37, 0x1D, 0xF1, 0x06 },
+      { 0xF4, 0x14, 0x3E, 0x4A, 0xAD, 0x7B, 0xC1, 0xA2, 0x07, 0x5D, 0xEE, 0xB8,
+        0x13, 0xD2, 0x8A, 0x09, 0x64, 0xDD, 0x43, 0x1C, 0x00 }, 0 },
+    { { 0x67, 0x83, 0x45, 0x72, 0x18, 0x10, 0xEC, 0x92, 0xAD, 0x5C, 0xD0, 0x52,
+        0xD9, 0xC6, 0xD6, 0x95, 0xE5, 0x9B, 0x75, 0x08, 0x02 },
+      { 0x26, 0xCF, 0x9E, 0xD6, 0xEF, 0x42, 0xBD, 0x74, 0xAE, 0x6D, 0x59, 0x3A,
+        0x78, 0xBC, 0x62, 0x21, 0x26, 0xA8, 0x9E, 0x04, 0x07 }, 0 },
+    { { 0x40, 0xB4, 0x50, 0xB7, 0xE3, 0x11, 0x56, 0xD0, 0xAE, 0x02, 0x4C, 0x5C,
+        0x33, 0x22, 0x36, 0xD1, 0x40, 0xE7, 0xA2, 0x66, 0x05 },
+      { 0x52, 0x31, 0x5F, 0x29, 0xA9, 0xBD, 0xE0, 0xB4, 0xCA, 0xA6, 0x76, 0xD9,
+        0x4B, 0xA0, 0x0D, 0xAB, 0xAA, 0x7B, 0x2B, 0x89, 0x02 }, 0 },
+    { { 0x7B, 0x49, 0x0D, 0x74, 0x40, 0xE3, 0x36, 0x98, 0x20, 0x80, 0xE3, 0xDD,
+        0x9A, 0x49, 0xA0, 0x05, 0x0D, 0x1A, 0x2C, 0x4C, 0x05 },
+      { 0x6E, 0xF9, 0x01, 0x8F, 0x49, 0xE9, 0xD7, 0xA5, 0x8F, 0x50, 0x4F, 0x23,
+        0x99, 0x83, 0x4E, 0xA1, 0xF6, 0x6C, 0xD0, 0x07, 0x03 }, 0 },
+    { { 0xB0, 0x0C, 0x65, 0x31, 0x79, 0x15, 0x66, 0x96, 0xEE, 0x4E, 0xA6, 0x0D,
+        0xE1, 0x09, 0x9A, 0x07, 0x47, 0x84, 0x76, 0x27, 0x01 },
+      { 0x31, 0xE9, 0xC0, 0xC9, 0x6C, 0x6B, 0x13, 0x8B, 0xFC, 0x22, 0x2B, 0x59,
+        0xDE, 0xF9, 0xCC, 0x91, 0x5D, 0x51, 0x6B, 0x25, 0x02 }, 0 },
+    { { 0x00, 0xE8, 0xD7, 0xD7, 0xBB, 0xE0, 0x14, 0x30, 0xD9, 0xD3, 0xF6, 0xC3,
+        0xAD, 0x70, 0x5E, 0x1F, 0x41, 0xD7, 0x01, 0x39, 0x05 },
+      { 0x1A, 0xBD, 0xF1, 0x4A, 0xAD, 0xD0, 0xD5, 0xEB, 0x2D, 0x3C, 0xA9, 0xA5,
+        0x46, 0x77, 0x0B, 0x90, 0x8B, 0x2F, 0x22, 0x8C, 0x01 }, 0 },
+    { { 0x6C, 0x2A, 0xA2, 0x58, 0x9C, 0xFB, 0xCA, 0xE1, 0xDC, 0xC0, 0x6D, 0x62,
+        0x6D, 0x67, 0x9B, 0xE9, 0x12, 0x50, 0xE4, 0xE2, 0x01 },
+      { 0x05, 0x89, 0x1B, 0xC7, 0x7F, 0x81, 0xFC, 0x76, 0x5F, 0xCA, 0x2E, 0x10,
+        0xBB, 0xDE, 0x77, 0x7E, 0x8A, 0x1C, 0x05, 0xC9, 0x01 }, 0 },
+    { { 0xB9, 0x38, 0x91, 0x09, 0xA3, 0x19, 0xBE, 0x18, 0x25, 0x14, 0x7C, 0xDD,
+        0x73, 0xCB, 0xD4, 0x7A, 0xC6, 0xA9, 0x69, 0x5B, 0x03 },
+      { 0x4D, 0xD0, 0xA9, 0x42, 0xF2, 0xB9, 0xB0, 0x17, 0x6A, 0xCE, 0x3D, 0xF1,
+        0xFB, 0xB3, 0x46, 0x1C, 0xEF, 0x5A, 0x9F, 0xEA, 0x02 }, 0 },
+    { { 0xD4, 0x3F, 0x2A, 0x66, 0x50, 0xB5, 0x40, 0x95, 0x21, 0xD7, 0x88, 0xBA,
+        0x9D, 0xD1, 0x24, 0xD7, 0xA3, 0xE5, 0x05, 0x77, 0x03 },
+      { 0x41, 0x24, 0xA1, 0x02, 0xE7, 0xF0, 0x82, 0x72, 0x91, 0x06, 0x46, 0xBB,
+        0x13, 0x30, 0xF3, 0xE1, 0x76, 0x2F, 0x55, 0x61, 0x04 }, 0 },
+    { { 0x5F, 0x33, 0x39, 0x70, 0x27, 0xB4, 0xC6, 0xFB, 0xD7, 0xCD, 0x9A, 0x4D,
+        0x4E, 0x2F, 0xBE, 0x8E, 0x14, 0x28, 0x64, 0x01, 0x06 },
+      { 0xE7, 0xB9, 0x70, 0x6F, 0x14, 0x8A, 0x2A, 0x8D, 0xA0, 0x60, 0xA9, 0x95,
+        0x60, 0x19, 0x33, 0x22, 0xF5, 0x4E, 0x74, 0x80, 0x04 }, 0 },
+    { { 0x10, 0xFE, 0x89, 0x76, 0xC9, 0x88, 0x14, 0x0E, 0xEC, 0xA3, 0x86, 0xBC,
+        0x11, 0x70, 0x65, 0x48, 0xF0, 0xD0, 0x0F, 0x6E, 0x04 },
+      { 0x04, 0xF3, 0x9B, 0xA3, 0x6B, 0xF3, 0x03, 0xDC, 0xC6, 0x3A, 0xBF, 0x40,
+        0x05, 0xAF, 0xC8, 0xBB, 0x37, 0xD7, 0xA9, 0x32, 0x00 }, 0 },
+    { { 0xEF, 0x37, 0x79, 0xC4, 0x6B, 0xDC, 0x9D, 0x9E, 0x0A, 0xFF, 0xF7, 0x0F,
+        0xFE, 0xCE, 0x84, 0x26, 0x2B, 0x87, 0xCA, 0x11, 0x01 },
+      { 0xCA, 0x54, 0xC4, 0x30, 0x72, 0xC2, 0xAA, 0x2A, 0xA6, 0x50, 0x06, 0x98,
+        0x75, 0xF1, 0xEC, 0x45, 0xEA, 0x60, 0x0C, 0xAF, 0x06 }, 0 },
+    { { 0xF6, 0xF2, 0xB2, 0x70, 0x20, 0x89, 0x89, 0xB3, 0xDD, 0xAB, 0x51, 0x3C,
+        0xA2, 0x48, 0x35, 0x3F, 0x38, 0xFA, 0xA6, 0xFA, 0x04 },
+      { 0x49, 0x02, 0x37, 0xAE, 0x65, 0xE2, 0xD3, 0x68, 0x3E, 0x0B, 0x6D, 0x4A,
+        0x69, 0x14, 0x73, 0x12, 0x4B, 0x06, 0x3C, 0x39, 0x03 }, 0 },
+    { { 0x55, 0x00, 0x60, 0x4E, 0x1B, 0x73, 0xC6, 0xB5, 0x59, 0x34, 0xD4, 0xE4,
+        0xB2, 0x1A, 0xED, 0xB8, 0x9D, 0xCF, 0x57, 0x44, 0x01 },
+      { 0xD4, 0xD5, 0xAE, 0x0E, 0x83, 0x61, 0x40, 0xA3, 0x86, 0x99, 0x82, 0x22,
+        0xA6, 0xAE, 0x96, 0x6F, 0xD6, 0x3F, 0x3A, 0x8C, 0x05 }, 0 },
+    { { 0x40, 0xF1, 0x05, 0x56, 0x98, 0x55, 0xC2, 0x23, 0x10, 0x28, 0xC7, 0x78,
+        0xC5, 0xE8, 0xB4, 0xCE, 0xC7, 0x22, 0x08, 0xF6, 0x04 },
+      { 0xF7, 0x40, 0x9D, 0x49, 0x4C, 0xCA, 0x4F, 0xB4, 0x45, 0xCC, 0xB7, 0xA4,
+        0x9B, 0x75, 0x71, 0x7E, 0xB1, 0x63, 0xAE, 0xD2, 0x06 }, 0 },
+    { { 0x37, 0x64, 0x1C, 0x38, 0xEF, 0x25, 0x91, 0x0F, 0x46, 0x11, 0xB4, 0xB8,
+        0x78, 0x2B, 0x65, 0xA5, 0x48, 0x49, 0xDC, 0x17, 0x05 },
+      { 0xAD, 0x54, 0xBC, 0x78, 0x97, 0x84, 0x54, 0xAF, 0x0D, 0xE6, 0x32, 0xEC,
+        0xD6, 0xCD, 0x7B, 0xD2, 0x3D, 0x6C, 0x04, 0x92, 0x00 }, 0 },
+    { { 0x1E, 0x55, 0xE0, 0x09, 0x0C, 0x47, 0x68, 0x4D, 0x6B, 0x5D, 0xAF, 0xC5,
+        0x21, 0x65, 0xD7, 0x75, 0x8A, 0x87, 0xF9, 0xA1, 0x06 },
+      { 0x00, 0x9B, 0x77, 0xBB, 0x56, 0x9B, 0x11, 0xCA, 0x4A, 0x75, 0x71, 0x3E,
+        0x09, 0x3E, 0xE0, 0xE2, 0xDD, 0xB4, 0xF5, 0x9F, 0x01 }, 0 },
+    { { 0x64, 0xF3, 0x8C, 0x04, 0x55, 0x9A, 0xC3, 0xF2, 0x7A, 0x86, 0x52, 0x6F,
+        0x62, 0xBC, 0xE5, 0x50, 0x40, 0xF1, 0x0A, 0x2C, 0x00 },
+      { 0x99, 0x94, 0xE6, 0xA5, 0x90, 0xEB, 0xB9, 0xC0, 0x80, 0x0B, 0x7B, 0x2B,
+        0x11, 0x55, 0x8E, 0xA3, 0xE6, 0x62, 0xB2, 0xDD, 0x06 }, 0 },
+    { { 0x4B, 0xAE, 0xE5, 0xF6, 0x5F, 0x80, 0xE1, 0x87, 0x7E, 0x4B, 0x6D, 0x74,
+        0xA3, 0x52, 0x9A, 0x33, 0x0B, 0xA1, 0x9B, 0x46, 0x00 },
+      { 0x6F, 0x0D, 0xCE, 0xDE, 0x43, 0x5B, 0xEC, 0x2D, 0xBF, 0x78, 0xA9, 0x2B,
+        0xC6, 0x14, 0x0F, 0x3D, 0x65, 0xFE, 0xBB, 0x37, 0x07 }, 0 },
+    { { 0x1C, 0x70, 0x20, 0x9C, 0x26, 0x2D, 0x65, 0x1A, 0xB7, 0xAC, 0x3B, 0xD5,
+        0xEF, 0x95, 0xE5, 0x26, 0xD4, 0x31, 0x75, 0x63, 0x05 },
+      { 0x44, 0xAD, 0x9B, 0x1C, 0x75, 0xD3, 0xC6, 0x8E, 0xEF, 0x31, 0x28, 0xF5,
+        0x2D, 0xB6, 0x85, 0x9E, 0x63, 0x08, 0x27, 0x9A, 0x03 }, 0 },
+    { { 0x7D, 0xBD, 0x14, 0x79, 0x93, 0x72, 0x6A, 0xEA, 0x3C, 0x8D, 0x15, 0xCA,
+        0x20, 0xD6, 0x5D, 0xEF, 0xE5, 0x9D, 0xA9, 0x48, 0x03 },
+      { 0x25, 0x0C, 0x8E, 0x4B, 0x6C, 0x87, 0x2E, 0x3F, 0x75, 0xD8, 0x73, 0x17,
+        0xAC, 0x65, 0xEB, 0x24, 0x4F, 0x82, 0x37, 0x25, 0x02 }, 0 },
+    { { 0xE1, 0x1B, 0xD6, 0xB2, 0x87, 0xF9, 0x89, 0xBD, 0x10, 0xC4, 0x82, 0xEF,
+        0xC5, 0x30, 0x65, 0xC1, 0xE8, 0x20, 0xB0, 0x4E, 0x06 },
+      { 0x6F, 0x50, 0x24, 0xF2, 0x02, 0x6B, 0x66, 0x80, 0xD2, 0x69, 0x7C, 0xDA,
+        0x0F, 0x98, 0xEF, 0x17, 0x1D, 0xAA, 0x34, 0xA4, 0x07 }, 0 },
+    { { 0xBE, 0xF6, 0x7C, 0x46, 0xBC, 0x04, 0x44, 0x82, 0xC4, 0x30, 0xF3, 0x62,
+        0xB7, 0x84, 0x87, 0xEF, 0xDE, 0x35, 0xC8, 0x64, 0x01 },
+      { 0x4F, 0x95, 0x07, 0xEE, 0xA0, 0xB3, 0x4C, 0x57, 0xF8, 0xA2, 0x83, 0xAF,
+        0xF1, 0x76, 0x63, 0x47, 0xC0, 0x22, 0xFA, 0x92, 0x04 }, 0 },
+    { { 0x9D, 0xEB, 0xCF, 0xB3, 0x78, 0xE5, 0x0C, 0xB5, 0x5D, 0x88, 0xDE, 0x2B,
+        0x45, 0xB2, 0xE2, 0x2B, 0xFA, 0x3F, 0xAF, 0xCD, 0x05 },
+      { 0x68, 0x5E, 0x76, 0x8F, 0x20, 0xFA, 0xD0, 0xD0, 0x3F, 0xCF, 0x1E, 0xF0,
+        0x4E, 0xFC, 0x17, 0x93, 0xBD, 0x62, 0xE6, 0x75, 0x00 }, 0 },
+    { { 0x6A, 0x85, 0x66, 0x9F, 0x95, 0x50, 0x91, 0x4A, 0xC6, 0xA3, 0xEF, 0xF6,
+        0x53, 0x49, 0x4A, 0xD0, 0x55, 0xA3, 0x19, 0x3E, 0x03 },
+      { 0x67, 0xC7, 0x15, 0xC5, 0xB9, 0xC5, 0x54, 0x96, 0xAC, 0xA9, 0x3C, 0xB0,
+        0xF3, 0x97, 0x43, 0xC0, 0x18, 0x86, 0x8D, 0x97, 0x01 }, 0 },
+    { { 0xE8, 0x42, 0xC8, 0x83, 0x31, 0xAD, 0xE1, 0x0D, 0x38, 0xA3, 0xBE, 0x57,
+        0xE0, 0x19, 0x72, 0xD8, 0x21, 0x51, 0x3D, 0x7A, 0x06 },
+      { 0x08, 0xC8, 0xE2, 0x22, 0x09, 0x8A, 0xD8, 0xA8, 0xD9, 0x86, 0x70, 0xE6,
+        0xFF, 0x5A, 0x43, 0x9E, 0x8E, 0x54, 0x08, 0x25, 0x04 }, 0 },
+    { { 0xC2, 0x96, 0x64, 0x3A, 0x00, 0x7B, 0x2F, 0xDB, 0xB5, 0xE9, 0x0C, 0x86,
+        0x0A, 0x9C, 0x99, 0x07, 0xD5, 0x36, 0x3A, 0x39, 0x07 },
+      { 0x5A, 0xB6, 0xF7, 0xA6, 0x59, 0x7C, 0x26, 0xC6, 0x84, 0x23, 0x6E, 0xBA,
+        0x22, 0xAC, 0xF5, 0xA4, 0x24, 0x3F, 0x2C, 0xDE, 0x04 }, 0 },
+    { { 0x5F, 0xF7, 0xAD, 0x70, 0x9F, 0xE8, 0x15, 0x0F, 0xEF, 0x64, 0x2A, 0x6C,
+        0xCF, 0x5D, 0xD9, 0x49, 0xD4, 0xCB, 0xB2, 0x80, 0x04 },
+      { 0x41, 0xF6, 0xE4, 0x59, 0xD9, 0x47, 0x79, 0x75, 0xFB, 0x02, 0xEF, 0x87,
+        0x99, 0x88, 0x66, 0xA8, 0x94, 0xD4, 0xD3, 0x99, 0x04 }, 0 },
+    { { 0xAF, 0xAA, 0xA0, 0x36, 0xA5, 0xAF, 0xFE, 0xAA, 0xC7, 0x9C, 0xA5, 0x63,
+        0x97, 0x9D, 0x76, 0xD3, 0xC5, 0x30, 0x6D, 0x10, 0x01 },
+      { 0xE9, 0x9D, 0x6B, 0x09, 0x07, 0x00, 0x1A, 0xA7, 0xF7, 0x28, 0x6E, 0x43,
+        0xA1, 0x2A, 0xFF, 0x87, 0x77, 0x79, 0x32, 0xB0, 0x04 }, 0 },
+    { { 0x12, 0xFC, 0x91, 0x8C, 0xC4, 0x80, 0xCB, 0x8A, 0x68, 0x1A, 0x77, 0x23,
+        0x00, 0x56, 0x07, 0xFE, 0x94, 0x13, 0x99, 0xA1, 0x02 },
+      { 0xDC, 0x65, 0x62, 0xFB, 0xB2, 0xC9, 0x89, 0xBF, 0xA4, 0xBE, 0xB1, 0x72,
+        0xCC, 0xFE, 0x41, 0xA2, 0x55, 0x51, 0x77, 0x2B, 0x01 }, 0 },
+    { { 0xB0, 0x2E, 0x71, 0x1F, 0xF4, 0xF3, 0xCF, 0x27, 0x5E, 0x31, 0x08, 0xE2,
+        0x7C, 0x10, 0xA3, 0xCA, 0x22, 0x0F, 0x0B, 0x33, 0x00 },
+      { 0x8E, 0xBE, 0xC7, 0xDF, 0x6C, 0xEF, 0x3A, 0x5C, 0xC6, 0x3A, 0x5F, 0x24,
+        0xBC, 0x57, 0x59, 0x1B, 0xD6, 0x1E, 0x4A, 0x68, 0x05 }, 0 },
+    { { 0x0C, 0xEC, 0x3F, 0x4C, 0x3E, 0x98, 0x31, 0x70, 0xF7, 0x32, 0xE2, 0xCA,
+        0xD5, 0xD4, 0x6E, 0x29, 0x0D, 0x95, 0x38, 0xA3, 0x05 },
+      { 0x00, 0x81, 0x64, 0x1D, 0xAE, 0xB9, 0xFB, 0xBE, 0x12, 0xD0, 0x06, 0xBA,
+        0xA8, 0x21, 0x0E, 0xFD, 0xC1, 0x78, 0x27, 0xDA, 0x02 }, 0 },
+    { { 0xB9, 0x7F, 0xAB, 0x2F, 0x9B, 0x92, 0xE7, 0x14, 0xE3, 0x1E, 0xF3, 0xB1,
+        0x6C, 0x23, 0x12, 0x6E, 0x88, 0x80, 0x32, 0x43, 0x06 },
+      { 0x44, 0xFB, 0x1A, 0xD3, 0xC2, 0x94, 0xEA, 0xAE, 0xEB, 0xAC, 0xDD, 0x22,
+        0x10, 0x58, 0xF4, 0xF2, 0xCD, 0xA5, 0x38, 0xB3, 0x02 }, 0 },
+    { { 0xD9, 0xF1, 0x7F, 0xD0, 0xF7, 0x3F, 0xB3, 0xDC, 0xC3, 0x04, 0xE8, 0x3C,
+        0x06, 0x9B, 0xDF, 0x0B, 0xBB, 0xA6, 0xB1, 0x10, 0x05 },
+      { 0x07, 0xC3, 0xD9, 0x40, 0x7F, 0xB1, 0x62, 0xCF, 0xB2, 0xC2, 0x8F, 0xD0,
+        0xA2, 0x82, 0x40, 0x92, 0xE7, 0x34, 0xAF, 0x45, 0x04 }, 0 },
+    { { 0xAC, 0xA0, 0xDD, 0x6F, 0x77, 0x18, 0x1D, 0x5B, 0x3C, 0x20, 0xF0, 0xBF,
+        0x3D, 0xF8, 0x4A, 0xE2, 0x8A, 0x41, 0xC6, 0xA4, 0x03 },
+      { 0x26, 0x9D, 0x2A, 0xE3, 0xBA, 0xB6, 0x2C, 0x6F, 0xD9, 0x42, 0x0B, 0x10,
+        0x16, 0xAF, 0xE8, 0x87, 0x66, 0x80, 0x76, 0xFC, 0x05 }, 0 },
+    { { 0xA1, 0xA6, 0xB4, 0xF4, 0x89, 0x3C, 0xF3, 0x4A, 0x98, 0xB5, 0xC8, 0x52,
+        0xEC, 0x0B, 0x57, 0xD8, 0xDC, 0xA2, 0x5F, 0x5A, 0x06 },
+      { 0x6A, 0xFE, 0x71, 0xBF, 0xD6, 0x74, 0x7D, 0x3E, 0xFF, 0x6C, 0xC8, 0xA3,
+        0xC1, 0xCB, 0x31, 0x39, 0xE9, 0xD9, 0xD7, 0xFD, 0x03 }, 0 },
+    { { 0x20, 0x80, 0x10, 0x54, 0xF1, 0x5C, 0xBF, 0x78, 0xCB, 0xB4, 0x1F, 0xBF,
+        0xB1, 0x6C, 0x0D, 0x5B, 0xA3, 0x52, 0xED, 0xAF, 0x06 },
+      { 0x82, 0x0E, 0xEF, 0xBC, 0xAD, 0xD3, 0x52, 0x87, 0xAD, 0x0F, 0xD6, 0x6A,
+        0xAB, 0x58, 0xD6, 0xC9, 0xEA, 0x90, 0x1F, 0x2D, 0x05 }, 0 },
+    { { 0x1C, 0xB9, 0x19, 0x87, 0x9A, 0x7C, 0x32, 0xDC, 0x6C, 0x6A, 0x6A, 0x1E,
+        0x97, 0xDE, 0xAA, 0x09, 0xCE, 0x80, 0xE7, 0xA6, 0x07 },
+      { 0x91, 0x2F, 0x36, 0xC2, 0x6E, 0x9D, 0x3E, 0x98, 0x9F, 0x32, 0x78, 0x63,
+        0xB4, 0x07, 0x66, 0xB0, 0x01, 0xD8, 0x96, 0xC7, 0x00 }, 0 },
+    { { 0x3E, 0x3C, 0xB7, 0x6D, 0x19, 0x86, 0x4A, 0x01, 0xF8, 0xBB, 0xA3, 0x39,
+        0x70, 0xBA, 0xC6, 0x4E, 0xA2, 0xEC, 0x79, 0xE3, 0x00 },
+      { 0x48, 0xE2, 0x8C, 0xCD, 0x43, 0xE0, 0x3D, 0xD7, 0xA6, 0xF2, 0x37, 0x45,
+        0x70, 0xB7, 0x7B, 0xD1, 0x07, 0x18, 0xD3, 0x3F, 0x01 }, 0 },
+    { { 0x8C, 0x79, 0x51, 0xCB, 0xC4, 0xB4, 0x3A, 0xC3, 0xA3, 0x56, 0x4D, 0x15,
+        0x18, 0x9A, 0xE0, 0x35, 0x94, 0xF9, 0x37, 0x70, 0x05 },
+      { 0x78, 0xA6, 0xAD, 0x3E, 0xE8, 0x49, 0xD8, 0x28, 0xE7, 0x0E, 0x97, 0xF3,
+        0x0D, 0xE7, 0x06, 0x4D, 0xF4, 0x76, 0xEC, 0x5D, 0x07 }, 0 },
+    { { 0x91, 0x7B, 0xD2, 0x2B, 0x7C, 0xF6, 0x03, 0x63, 0x99, 0xB4, 0xE9, 0x73,
+        0x2B, 0x41, 0x84, 0xE5, 0xBA, 0x30, 0x24, 0x17, 0x03 },
+      { 0x75, 0x22, 0xCE, 0x8D, 0x4C, 0xF4, 0x98, 0x93, 0x68, 0xA1, 0x0E, 0x14,
+        0xC5, 0x3D, 0x2A, 0x42, 0x5F, 0x09, 0x00, 0xF8, 0x04 }, 0 },
+    { { 0x12, 0xEA, 0xE3, 0x91, 0x96, 0xC6, 0x9C, 0xA1, 0x3B, 0xB2, 0xBB, 0x97,
+        0x65, 0xD1, 0x73, 0x7F, 0x69, 0xA7, 0x3C, 0xA6, 0x04 },
+      { 0x7C, 0x8C, 0xE0, 0x96, 0x5F, 0xD4, 0x39, 0x40, 0xFA, 0x57, 0xA9, 0x50,
+        0x8F, 0x35, 0x32, 0x25, 0x2C, 0xA1, 0x09, 0x34, 0x01 }, 0 },
+    { { 0xAA, 0x2D, 0xD3, 0xA8, 0xD7, 0x9B, 0xD6, 0xED, 0xCF, 0x8F, 0x2F, 0x3A,
+        0xF3, 0xF5, 0x77, 0x8A, 0x3E, 0xE7, 0xC8, 0xBE, 0x03 },
+      { 0x79, 0xF8, 0x74, 0x06, 0x21, 0x32, 0x44, 0x8C, 0xE8, 0x3C, 0xA0, 0x79,
+        0xA6, 0xF3, 0xEA, 0x36, 0xC4, 0x24, 0xB2, 0xB1, 0x01 }, 0 },
+    { { 0xF3, 0x50, 0x46, 0xD2, 0x2D, 0x70, 0xF4, 0x0F, 0x33, 0x1C, 0x72, 0x4D,
+        0xF8, 0xA4, 0x7E, 0x4C, 0x8F, 0xA0, 0x2D, 0xD1, 0x01 },
+      { 0x86, 0x23, 0x2F, 0xD5, 0xAB, 0x90, 0x52, 0xEE, 0x3D, 0x29, 0x06, 0x1C,
+        0x57, 0xEE, 0x73, 0xF8, 0xB9, 0xC6, 0x75, 0xE9, 0x06 }, 0 },
+    { { 0x48, 0x22, 0x9C, 0x5E, 0xDA, 0x6F, 0xEA, 0x1F, 0x6C, 0x4E, 0xCA, 0xB6,
+        0x42, 0xE0, 0xCC, 0x99, 0xD6, 0xBA, 0xDE, 0xFD, 0x06 },
+      { 0xF0, 0xE5, 0x6D, 0x04, 0x1D, 0x08, 0x3E, 0x43, 0x39, 0xF7, 0xC5, 0xE5,
+        0x2C, 0x9A, 0x0A, 0xC5, 0x74, 0x7D, 0xB7, 0x22, 0x06 }, 0 },
+    { { 0x54, 0x55, 0x01, 0x9C, 0x90, 0x55, 0xD5, 0x41, 0xF4, 0xF3, 0x29, 0x91,
+        0xD8, 0x18, 0x7C, 0xB3, 0x57, 0x42, 0xE6, 0x36, 0x01 },
+      { 0x5C, 0xB0, 0x15, 0x73, 0x23, 0x5E, 0x28, 0xD0, 0x0A, 0x51, 0x43, 0x43,
+        0xA7, 0x30, 0xE6, 0xC2, 0x6E, 0x0F, 0x48, 0x75, 0x01 }, 0 },
+    { { 0x1E, 0xD4, 0x1D, 0xD8, 0x2B, 0x77, 0x2C, 0xF5, 0x7F, 0xBD, 0xB5, 0x9B,
+        0x0C, 0xFC, 0xCA, 0x28, 0xDF, 0x4A, 0x39, 0x75, 0x00 },
+      { 0xC7, 0xC1, 0xC8, 0x61, 0xA4, 0x03, 0x24, 0xB1, 0xD2, 0x90, 0xDA, 0x24,
+        0xEF, 0x28, 0x3A, 0x73, 0x62, 0x3D, 0x05, 0x04, 0x06 }, 0 },
+    { { 0xDF, 0x62, 0x70, 0xB2, 0x91, 0xF8, 0x1C, 0x74, 0x2E, 0x77, 0x5E, 0x98,
+        0xC7, 0xBD, 0x69, 0x31, 0x18, 0x01, 0x50, 0x93, 0x01 },
+      { 0xD9, 0x2D, 0x6D, 0x7D, 0x9D, 0xA4, 0x6F, 0xBC, 0x79, 0x0B, 0xE0, 0x96,
+        0xD1, 0x82, 0x80, 0x33, 0xC5, 0xD8, 0xB9, 0x1B, 0x00 }, 0 },
+    { { 0x71, 0xD8, 0xDE, 0x8A, 0x64, 0x98, 0xDC, 0x1D, 0xE9, 0x40, 0x1A, 0xCF,
+        0x2E, 0x9F, 0xD1, 0x5C, 0xF5, 0xB2, 0xF2, 0x90, 0x01 },
+      { 0xFF, 0xE1, 0x64, 0x2A, 0x3C, 0x46, 0xBD, 0x6D, 0xC7, 0xD7, 0x84, 0x04,
+        0xFC, 0x12, 0xA9, 0xF0, 0x4B, 0x9B, 0xBA, 0x3B, 0x04 }, 0 },
+    { { 0x93, 0xA6, 0xA5, 0xC2, 0x5E, 0xC4, 0xF8, 0x1D, 0x8A, 0x74, 0x67, 0x9F,
+        0x82, 0x05, 0x72, 0x45, 0x1B, 0x3D, 0x75, 0x11, 0x01 },
+      { 0xF3, 0x8D, 0x13, 0xCE, 0xEA, 0x98, 0x01, 0x47, 0x50, 0x66, 0x8C, 0x31,
+        0x87, 0x5A, 0xB5, 0xA4, 0x35, 0x74, 0x2C, 0x48, 0x00 }, 0 },
+    { { 0x6C, 0x24, 0x40, 0x75, 0xB4, 0xFA, 0xFA, 0xB7, 0x33, 0xAB, 0x14, 0x23,
+        0x2F, 0xC1, 0x1F, 0xE9, 0x8A, 0x8C, 0x9C, 0xBA, 0x04 },
+      { 0x6C, 0xB7, 0xA9, 0xCC, 0xE2, 0x3E, 0x77, 0xE2, 0x5F, 0x58, 0xA4, 0xB2,
+        0xC9, 0x7D, 0x4A, 0x64, 0xD2, 0xAD, 0x2E, 0x8C, 0x02 }, 0 },
+    { { 0xCC, 0x85, 0x91, 0xA5, 0x9D, 0xD0, 0x1D, 0xF5, 0x3F, 0xAA, 0x34, 0xE0,
+        0xCA, 0x84, 0xAD, 0x54, 0xE9, 0xFD, 0x33, 0xB9, 0x04 },
+      { 0xDA, 0xE5, 0x0D, 0xF6, 0xF1, 0x04, 0x43, 0xC4, 0x46, 0x44, 0xD2, 0xAB,
+        0x36, 0xB8, 0xD4, 0xDA, 0x44, 0x7C, 0xAE, 0x21, 0x01 }, 0 },
+    { { 0x81, 0x25, 0x3B, 0xDA, 0xF8, 0x26, 0x44, 0xA8, 0xDB, 0xB3, 0xD6, 0xD1,
+        0x64, 0xCA, 0xB1, 0xC9, 0xDB, 0x31, 0xB5, 0xDD, 0x04 },
+      { 0xA7, 0x7C, 0xDB, 0x45, 0xA0, 0x21, 0x86, 0xD8, 0x96, 0x1D, 0x75, 0x0D,
+        0x7A, 0x24, 0x6A, 0x45, 0x5D, 0xC1, 0x5A, 0xC5, 0x07 }, 0 },
+    { { 0x3E, 0xC8, 0xB5, 0xD3, 0xE4, 0x75, 0x52, 0xD7, 0xAB, 0x03, 0xEC, 0x0A,
+        0xA3, 0xFC, 0x04, 0x0C, 0x01, 0x01, 0x9B, 0x6D, 0x04 },
+      { 0xD4, 0x74, 0x8E, 0xB1, 0x50, 0xC6, 0x63, 0x28, 0xA9, 0x1F, 0xDC, 0x1D,
+        0xDB, 0x1F, 0xCF, 0x5B, 0x03, 0xA7, 0xE5, 0x0F, 0x05 }, 0 },
+    { { 0x21, 0xE9, 0x91, 0x9C, 0x0F, 0x53, 0xF4, 0xB8, 0xC3, 0x84, 0xDF, 0xA2,
+        0x66, 0xC8, 0x8E, 0x4B, 0x81, 0xE8, 0x91, 0x92, 0x03 },
+      { 0x4C, 0xD1, 0x7E, 0xEC, 0x5E, 0x94, 0xA0, 0x17, 0x1C, 0x7E, 0x1D, 0xE8,
+        0x1E, 0xF4, 0x61, 0xE0, 0x95, 0x4E, 0xBA, 0x57, 0x05 }, 0 },
+    { { 0xAD, 0xFA, 0x26, 0xB3, 0xD3, 0xB8, 0x5B, 0xD0, 0xFF, 0x32, 0x9C, 0xC6,
+        0x98, 0xC1, 0x95, 0xC3, 0x3E, 0xB1, 0x3B, 0x1A, 0x02 },
+      { 0x7D, 0x98, 0xAA, 0x22, 0x62, 0x3E, 0x15, 0xA0, 0xA9, 0x5B, 0x5A, 0xA7,
+        0x1D, 0x51, 0x78, 0x49, 0x58, 0x63, 0xF5, 0x72, 0x02 }, 0 },
+    { { 0x6A, 0x28, 0x31, 0xB6, 0x31, 0x36, 0x45, 0x3B, 0x46, 0xF0, 0xD9, 0x7C,
+        0x7F, 0x64, 0xF8, 0x7A, 0x58, 0xB2, 0xD5, 0xA6, 0x01 },
+      { 0xB0, 0x6C, 0x62, 0x36, 0xD5, 0x5E, 0xBC, 0x8D, 0xA1, 0x20, 0x79, 0x48,
+        0x9E, 0x1C, 0x9E, 0x41, 0x27, 0x80, 0x9E, 0x77, 0x01 }, 0 },
+    { { 0x19, 0xD9, 0xB7, 0x1F, 0x49, 0x13, 0xDF, 0xFB, 0xB8, 0x64, 0xD5, 0x2B,
+        0xAB, 0x95, 0x99, 0xE9, 0x4E, 0xD2, 0xCB, 0x41, 0x04 },
+      { 0xDF, 0xFB, 0xAC, 0x59, 0x7E, 0xD4, 0x1A, 0xF5, 0xF1, 0x37, 0xC8, 0xF2,
+        0xF6, 0x5A, 0x53, 0x8F, 0x3B, 0x7E, 0x0C, 0xB1, 0x05 }, 0 },
+    { { 0xA9, 0x8F, 0xA1, 0xDF, 0x77, 0x13, 0x34, 0xBF, 0x4A, 0x6C, 0x8D, 0x7A,
+        0x9C, 0xF7, 0xBB, 0xF1, 0x25, 0x14, 0x2F, 0xDE, 0x07 },
+      { 0xDD, 0xC7, 0x5D, 0x4F, 0x56, 0x58, 0x4F, 0x41, 0x60, 0x50, 0x96, 0x1B,
+        0x43, 0x4F, 0x13, 0xE4, 0xDE, 0xD4, 0x90, 0xDE, 0x00 }, 0 },
+    { { 0xB0, 0xB3, 0x97, 0xCB, 0x98, 0xBB, 0xA3, 0xC7, 0xB3, 0x59, 0x81, 0xF0,
+        0x9B, 0x1E, 0x23, 0x64, 0xFC, 0x2E, 0xF8, 0x2D, 0x06 },
+      { 0x32, 0x21, 0x87, 0x5C, 0x0D, 0xA5, 0x10, 0x5D, 0xAD, 0x1A, 0x9E, 0x85,
+        0x6F, 0x47, 0xE3, 0xF0, 0x6B, 0x58, 0x78, 0x4E, 0x03 }, 0 },
+    { { 0x19, 0x7E, 0x48, 0x9E, 0xC4, 0xFC, 0x00, 0x3A, 0xBA, 0xC2, 0xEA, 0x8E,
+        0x14, 0xB7, 0x17, 0x24, 0x52, 0x2E, 0x9F, 0x15, 0x04 },
+      { 0x74, 0x86, 0xC1, 0xF2, 0x5C, 0xE7, 0x90, 0xF7, 0x48, 0x9D, 0x08, 0x85,
+        0xB6, 0x42, 0x35, 0xD7, 0xA9, 0x0E, 0x00, 0x2F, 0x02 }, 0 },
+    { { 0xD1, 0x63, 0x4B, 0x68, 0x7C, 0x44, 0xBF, 0x19, 0xCA, 0x67, 0x67, 0xC0,
+        0xFB, 0xE6, 0x41, 0x83, 0x33, 0xE1, 0xE5, 0x8B, 0x00 },
+      { 0x8C, 0x26, 0x23, 0x8E, 0x98, 0x11, 0xA4, 0xF9, 0x35, 0x9B, 0x5E, 0xBF,
+        0x74, 0xB5, 0x26, 0xA5, 0xDD, 0x77, 0xBA, 0x3B, 0x03 }, 0 },
+    { { 0xDF, 0x30, 0x04, 0xB0, 0x1C, 0x80, 0xBB, 0x42, 0xCE, 0x98, 0xC1, 0x40,
+        0x3F, 0xD5, 0x8C, 0xB5, 0xA2, 0x0F, 0xCF, 0x8D, 0x04 },
+      { 0xEF, 0xC4, 0x96, 0x32, 0xEB, 0x29, 0xF2, 0x4E, 0xDB, 0xBE, 0xF0, 0x92,
+        0xC4, 0xE6, 0x9B, 0x2A, 0x30, 0x6B, 0x10, 0x36, 0x00 }, 0 },
+    { { 0xAD, 0x15, 0xA2, 0x13, 0x14, 0x90, 0x85, 0xAD, 0x2A, 0x44, 0xFB, 0x59,
+        0x5A, 0x22, 0x3B, 0xA5, 0x19, 0xF0, 0x08, 0x43, 0x06 },
+      { 0x8E, 0x0F, 0x7C, 0x56, 0x62, 0xAB, 0x5C, 0x4A, 0x41, 0xF6, 0xA1, 0x03,
+        0x23, 0xEC, 0x06, 0xBC, 0x12, 0xD9, 0x1A, 0x95, 0x03 }, 0 },
+    { { 0x17, 0xB4, 0x1D, 0xF4, 0x21, 0x3F, 0x01, 0x55, 0x08, 0x14, 0x66, 0xCA,
+        0x9F, 0x6E, 0xD1, 0xD0, 0xE6, 0xBA, 0xC0, 0xD4, 0x05 },
+      { 0xA6, 0x2B, 0x9E, 0x75, 0x76, 0xA9, 0xB6, 0xA2, 0x45, 0x4B, 0x11, 0xE5,
+        0x02, 0x8E, 0xC8, 0x5A, 0xDE, 0x69, 0x9C, 0xD4, 0x07 }, 0 },
+    { { 0xB1, 0x8B, 0x06, 0xAE, 0xAC, 0x13, 0x19, 0xCD, 0x2F, 0x5A, 0x69, 0x1B,
+        0x0C, 0x98, 0xAF, 0x06, 0x60, 0x14, 0x89, 0x8E, 0x02 },
+      { 0xD6, 0x0E, 0xF6, 0xCC, 0x51, 0x68, 0x3E, 0xDF, 0x71, 0xCB, 0x36, 0x4B,
+        0xFA, 0x4C, 0x1B, 0x17, 0x43, 0xD0, 0xCD, 0x8F, 0x02 }, 0 },
+    { { 0xDE, 0x44, 0x16, 0x90, 0x5F, 0xF0, 0xB3, 0x44, 0xD3, 0x34, 0xDA, 0x82,
+        0x9F, 0x3B, 0x8C, 0x98, 0xAE, 0x3B, 0xA0, 0x23, 0x02 },
+      { 0xBF, 0xBA, 0x5C, 0x7C, 0xEB, 0xE4, 0xA8, 0x0E, 0xCD, 0xEC, 0xEA, 0x58,
+        0xA6, 0xA0, 0x68, 0x25, 0xFA, 0x76, 0x3A, 0xC4, 0x07 }, 0 },
+    { { 0x95, 0x3F, 0x53, 0xB4, 0xED, 0x9D, 0x2B, 0xD3, 0xFA, 0x6B, 0xAB, 0x8E,
+        0x17, 0xF3, 0xD1, 0x62, 0x1D, 0xC7, 0x9A, 0x9B, 0x05 },
+      { 0xA9, 0x33, 0xA6, 0xF3, 0x95, 0x19, 0xE4, 0x2B, 0x3F, 0x7F, 0x3E, 0xEB,
+        0xFA, 0x74, 0xC1, 0x95, 0x60, 0xD1, 0xC7, 0xD5, 0x02 }, 0 },
+    { { 0x47, 0xE4, 0x89, 0x10, 0xB1, 0xF5, 0xDA, 0x3C, 0xB1, 0xAC, 0x6E, 0x06,
+        0xF4, 0x05, 0x79, 0xA4, 0x40, 0x3C, 0xAE, 0x4F, 0x02 },
+      { 0x6D, 0x77, 0xC9, 0x14, 0x2A, 0xAC, 0xBA, 0xCE, 0xCD, 0x3D, 0x68, 0x40,
+        0xC2, 0x09, 0x62, 0x45, 0xEC, 0xB4, 0x56, 0x00, 0x01 }, 0 },
+    { { 0x02, 0xC6, 0x35, 0xDC, 0xE7, 0xC6, 0x0E, 0x4E, 0x94, 0x5C, 0xE3, 0x12,
+        0xFF, 0x13, 0x49, 0x98, 0x76, 0xB4, 0x21, 0x77, 0x01 },
+      { 0x8F, 0x2E, 0x2C, 0x09, 0x40, 0x73, 0xB7, 0x28, 0x23, 0x9A, 0xDD, 0xE3,
+        0x57, 0x32, 0x17, 0x5C, 0x4F, 0x79, 0xEE, 0x96, 0x00 }, 0 },
+    { { 0x21, 0x0E, 0xC1, 0xF5, 0x56, 0x16, 0x79, 0xEF, 0x93, 0xE3, 0x55, 0xF2,
+        0x7D, 0xFC, 0x8A, 0x62, 0x2E, 0xFC, 0x7D, 0x10, 0x04 },
+      { 0x64, 0xF3, 0xAE, 0x44, 0xD1, 0xDF, 0x3A, 0x89, 0x39, 0x45, 0xEF, 0xDC,
+        0xA9, 0x0C, 0x5F, 0xEA, 0xBC, 0x2E, 0xBD, 0x6F, 0x07 }, 0 },
+    { { 0x5A, 0xE7, 0xB8, 0x27, 0xB6, 0xEB, 0x05, 0xBE, 0xB1, 0x24, 0x90, 0x96,
+        0x98, 0xCC, 0xEC, 0xDD, 0xDA, 0x1A, 0x7F, 0x3C, 0x02 },
+      { 0xBE, 0x1C, 0x98, 0xD9, 0x55, 0xA3, 0xFD, 0x10, 0xD9, 0x4A, 0x44, 0x62,
+        0xD1, 0x58, 0x2B, 0xCA, 0xD0, 0x63, 0x8E, 0x8E, 0x01 }, 0 },
+    { { 0xC2, 0xFE, 0xBA, 0xB4, 0xFA, 0x1C, 0x16, 0x49, 0x13, 0x8E, 0x54, 0xEE,
+        0xE2, 0x19, 0x6E, 0x82, 0x12, 0xC5, 0xE9, 0xB7, 0x00 },
+      { 0x9D, 0xEE, 0x8D, 0x3C, 0x4A, 0x15, 0x7A, 0xFB, 0xD7, 0x38, 0x23, 0xB2,
+        0xB0, 0x92, 0x40, 0x7A, 0xAF, 0x08, 0x24, 0x37, 0x03 }, 0 },
+    { { 0x74, 0xCB, 0xB6, 0x28, 0xA1, 0x90, 0xD6, 0xB4, 0xCA, 0x6D, 0x69, 0x35,
+        0xEE, 0x55, 0x81, 0x37, 0x36, 0x0D, 0x92, 0x7C, 0x03 },
+      { 0xC9, 0x8D, 0x62, 0x2B, 0xB8, 0xCA, 0x2A, 0x14, 0x1B, 0x9B, 0x3D, 0x2B,
+        0xBF, 0xBC, 0xF3, 0x21, 0x45, 0x4F, 0x68, 0xAA, 0x05 }, 0 },
+    { { 0xD3, 0x29, 0xE0, 0x75, 0x55, 0xDE, 0x0E, 0xE0, 0x1B, 0x96, 0x74, 0xFA,
+        0x52, 0x92, 0xE7, 0x4B, 0xF4, 0x2E, 0x4F, 0x0B, 0x07 },
+      { 0xF8, 0x28, 0xF5, 0x52, 0x5A, 0x5B, 0xB0, 0x45, 0x27, 0x8D, 0x00, 0x3C,
+        0x2D, 0x68, 0xFF, 0xE1, 0x40, 0x5B, 0x5D, 0xB1, 0x00 }, 0 },
+    { { 0x9C, 0xA4, 0xC7, 0x9F, 0x64, 0x8E, 0x46, 0x64, 0x96, 0xB5, 0x23, 0x5F,
+        0x6B, 0xA6, 0xC4, 0x6F, 0x0B, 0xBC, 0xAC, 0xFE, 0x07 },
+      { 0x94, 0x30, 0xCF, 0x81, 0xC3, 0x12, 0x44, 0x15, 0xED, 0xC2, 0xD6, 0x00,
+        0x20, 0xA6, 0x91, 0x15, 0xF1, 0x67, 0xB4, 0xC2, 0x03 }, 0 },
+    { { 0x5D, 0x70, 0x31, 0xFC, 0x0A, 0x47, 0x42, 0x27, 0x61, 0x00, 0xD0, 0xC4,
+        0xAC, 0x0A, 0xB9, 0x62, 0x4A, 0x80, 0x99, 0x0A, 0x05 },
+      { 0x1F, 0x18, 0x0B, 0xC8, 0x8E, 0x0D, 0xE9, 0xF0, 0xD7, 0xFD, 0x56, 0xEE,
+        0x8E, 0x08, 0x66, 0xD1, 0x8A, 0x50, 0x7E, 0xAA, 0x07 }, 0 },
+    { { 0x12, 0x8D, 0xE8, 0x0E, 0xB3, 0xA6, 0xD5, 0xB2, 0x2E, 0x2B, 0x5C, 0xF4,
+        0xCA, 0xD0, 0x96, 0x79, 0x28, 0x83, 0x0A, 0xBB, 0x07 },
+      { 0xD8, 0xBB, 0x3C, 0xAC, 0x62, 0x39, 0xB5, 0xD7, 0x7D, 0x0D, 0x7A, 0x11,
+        0x6F, 0xD5, 0x1B, 0xAC, 0xB1, 0x70, 0x40, 0x67, 0x07 }, 0 },
+    { { 0x68, 0xEE, 0x27, 0xCD, 0x3F, 0x63, 0x72, 0x00, 0x98, 0xFA, 0x44, 0xD4,
+        0x7A, 0xE1, 0xB3, 0x17, 0xE9, 0x0D, 0xD9, 0x7E, 0x05 },
+      { 0x3A, 0xC7, 0xA0, 0x87, 0x77, 0x5C, 0xEA, 0xE7, 0xCE, 0x9D, 0x32, 0x3B,
+        0x0D, 0x46, 0x5A, 0xEC, 0x33, 0xEF, 0x2E, 0x3C, 0x02 }, 0 },
+    { { 0x32, 0x17, 0xA2, 0x50, 0xC3, 0x44, 0xAB, 0xC5, 0x6C, 0xF3, 0xCD, 0x95,
+        0xA8, 0x22, 0xB5, 0x87, 0x18, 0xB2, 0xF3, 0x31, 0x01 },
+      { 0x9F, 0x0F, 0x06, 0x1C, 0xB9, 0x43, 0xCF, 0x0E, 0x27, 0x0E, 0x02, 0x49,
+        0x9B, 0xB2, 0x7C, 0x0B, 0x38, 0x41, 0x5D, 0xF9, 0x04 }, 0 },
+    { { 0x41, 0xB1, 0xDB, 0xF5, 0x10, 0xD3, 0x93, 0x6C, 0x9D, 0x13, 0xAE, 0xCC,
+        0x59, 0xA4, 0x05, 0x91, 0x90, 0x4B, 0x74, 0x48, 0x06 },
+      { 0x08, 0xBB, 0xC3, 0x28, 0x1C, 0x78, 0x42, 0x69, 0x42, 0x09, 0x8D, 0x65,
+        0x12, 0x3C, 0xE4, 0xF8, 0xA7, 0x2D, 0xEF, 0xA1, 0x06 }, 0 },
+    { { 0xBD, 0x6E, 0x72, 0xD1, 0x10, 0xFF, 0x32, 0x67, 0x23, 0xC8, 0x92, 0xF1,
+        0xB9, 0x9E, 0xB9, 0x4B, 0xF4, 0x6D, 0xDD, 0x84, 0x01 },
+      { 0xC5, 0x62, 0xB6, 0x56, 0x81, 0x9C, 0xEE, 0xD9, 0xD9, 0x8D, 0xAF, 0x0F,
+        0xA5, 0x70, 0xCA, 0xB5, 0xBE, 0x2C, 0x1B, 0x81, 0x00 }, 0 },
+    { { 0x19, 0x91, 0xF0, 0x2B, 0x90, 0x4C, 0x08, 0x71, 0xBE, 0xE6, 0x54, 0x83,
+        0xF5, 0xC6, 0x4E, 0x61, 0xDC, 0xE6, 0xD1, 0x85, 0x04 },
+      { 0x9D, 0x1C, 0x59, 0x22, 0x34, 0x3C, 0xAD, 0x98, 0x6A, 0xE1, 0x96, 0x61,
+        0x52, 0xAA, 0x97, 0x32, 0x8D, 0x78, 0xA4, 0x09, 0x00 }, 0 },
+    { { 0xE0, 0xE5, 0xC1, 0xF7, 0xC0, 0x00, 0xFB, 0xD6, 0x53, 0x9C, 0x1B, 0xF9,
+        0xF7, 0xF6, 0xCD, 0x02, 0x5D, 0x1E, 0xFA, 0xE6, 0x01 },
+      { 0x11, 0x88, 0x1A, 0x48, 0x6A, 0x69, 0xED, 0x41, 0x04, 0xC8, 0x83, 0xDF,
+        0x67, 0x6D, 0x2D, 0xD0, 0x78, 0xB2, 0x93, 0xEA, 0x06 }, 0 },
+    { { 0x10, 0x37, 0x3B, 0xE6, 0x78, 0x27, 0xE8, 0x8B, 0x2C, 0x71, 0xE7, 0xC9,
+        0x8E, 0xFF, 0xD5, 0xC6, 0xBC, 0x80, 0x5F, 0xE6, 0x02 },
+      { 0x13, 0x64, 0xDC, 0x17, 0xCD, 0x78, 0x9D, 0xF9, 0x1C, 0x1C, 0xF1, 0x32,
+        0x36, 0x26, 0x51, 0x3B, 0x5B, 0x5B, 0x91, 0x47, 0x07 }, 0 },
+    { { 0x41, 0xA1, 0x07, 0x41, 0x03, 0x9B, 0x7A, 0xCD, 0xFD, 0x51, 0x3B, 0x05,
+        0xDB, 0x88, 0xD7, 0x0A, 0x79, 0x0E, 0x0A, 0x55, 0x01 },
+      { 0x0F, 0xAA, 0xEB, 0xC0, 0x2F, 0xC1, 0x20, 0x68, 0x6A, 0xB6, 0xEA, 0xD2,
+        0x5C, 0xB3, 0x9A, 0x55, 0x68, 0xF9, 0x5E, 0x92, 0x02 }, 0 },
+    { { 0x17, 0x27, 0x47, 0x0B, 0x94, 0x6F, 0xA2, 0x06, 0x46, 0xAA, 0x3C, 0xA3,
+        0x1B, 0x4D, 0x56, 0x75, 0x11, 0xC7, 0x6E, 0x50, 0x06 },
+      { 0x1D, 0x85, 0x8E, 0xA3, 0x9F, 0x05, 0x3E, 0x34, 0xA8, 0xF1, 0xCD, 0x73,
+        0x9F, 0xCD, 0xAF, 0x69, 0x6D, 0x36, 0x0E, 0x8A, 0x02 }, 0 },
+    { { 0x69, 0xD7, 0x3B, 0x7C, 0x59, 0x01, 0xF5, 0x47, 0x4A, 0x06, 0x34, 0x9B,
+        0x78, 0x2D, 0x4F, 0x6B, 0x3D, 0xF7, 0x31, 0xC0, 0x00 },
+      { 0x9A, 0x9F, 0x54, 0xFB, 0x90, 0x76, 0x36, 0x50, 0x9D, 0xDD, 0x19, 0x9E,
+        0x45, 0x59, 0x3E, 0x21, 0x54, 0x75, 0x35, 0xEC, 0x02 }, 0 },
+    { { 0x11, 0x4B, 0xEE, 0x2D, 0x5E, 0x07, 0x75, 0x46, 0xFD, 0x84, 0xA5, 0xD0,
+        0x8B, 0xF2, 0x0D, 0x36, 0x6E, 0x25, 0x3E, 0x88, 0x05 },
+      { 0xBD, 0x9A, 0x41, 0x45, 0x60, 0x92, 0xC3, 0x16, 0xB6, 0x53, 0xB5, 0x05,
+        0x39, 0xD9, 0x02, 0x6C, 0x2F, 0x6A, 0x23, 0xE4, 0x00 }, 0 },
+    { { 0x01, 0x13, 0x5E, 0x0E, 0x30, 0xE8, 0xAE, 0x05, 0x2C, 0x90, 0xF4, 0x5B,
+        0xAB, 0x31, 0xCC, 0x37, 0x10, 0xDD, 0x0A, 0x03, 0x07 },
+      { 0xCF, 0x25, 0xDA, 0xD9, 0x2D, 0x6C, 0xC8, 0x81, 0xBE, 0x4C, 0x34, 0x55,
+        0xD8, 0xF8, 0xEB, 0xEA, 0xCE, 0x8D, 0xB0, 0xB5, 0x02 }, 0 },
+    { { 0x1A, 0xB3, 0x7E, 0x1D, 0xCC, 0x44, 0x26, 0xA7, 0xA9, 0xA8, 0xFA, 0x3B,
+        0xAE, 0x6D, 0xEA, 0x58, 0x23, 0xC3, 0x69, 0x37, 0x00 },
+      { 0xCB, 0x00, 0xDB, 0x1B, 0x17, 0xC8, 0xA8, 0xCD, 0x91, 0xC5, 0x51, 0x1A,
+        0x94, 0x7D, 0x74, 0xB7, 0xA5, 0xBF, 0x59, 0xCF, 0x07 }, 0 },
+    { { 0xC7, 0xE1, 0xA1, 0x96, 0x7D, 0x8B, 0xEA, 0x84, 0xFD, 0xE3, 0x35, 0x7B,
+        0xC2, 0xDB, 0x6D, 0x87, 0x02, 0xEF, 0x7A, 0x43, 0x00 },
+      { 0x22, 0x70, 0x5C, 0x06, 0xCC, 0xA6, 0x1F, 0xEF, 0xFF, 0x0E, 0x66, 0x8C,
+        0x7E, 0x95, 0xCE, 0xFD, 0xDC, 0xD2, 0xE5, 0xD8, 0x02 }, 0 },
+    { { 0x70, 0xE1, 0x1C, 0x32, 0x86, 0x50, 0xBE, 0xF8, 0xDF, 0x09, 0xCF, 0x16,
+        0x0A, 0xD8, 0xFA, 0xB6, 0x72, 0x8D, 0x59, 0xB6, 0x05 },
+      { 0xFD, 0x52, 0x02, 0xD1, 0x27, 0x83, 0x35, 0x91, 0x63, 0xED, 0xAB, 0x72,
+        0x0D, 0x9E, 0x8E, 0x81, 0x76, 0x01, 0xA6, 0x9B, 0x04 }, 0 },
+    { { 0xCB, 0x52, 0x11, 0xD6, 0x09, 0x9C, 0x5C, 0x1C, 0xBE, 0x00, 0xE9, 0xF7,
+        0xFB, 0xC4, 0x4D, 0x50, 0x91, 0x74, 0x06, 0x86, 0x06 },
+      { 0xA2, 0x9B, 0x05, 0xF4, 0xEE, 0xFC, 0x08, 0x44, 0x57, 0x0E, 0xD4, 0x7E,
+        0x0B, 0xF1, 0xE6, 0x41, 0x04, 0x03, 0x07, 0x01, 0x03 }, 0 },
+    { { 0xEF, 0x92, 0xCC, 0xE9, 0x2B, 0x95, 0x63, 0xAC, 0xED, 0x92, 0x79, 0xCA,
+        0xF0, 0xD2, 0x69, 0x24, 0xA3, 0x8D, 0xB3, 0xCF, 0x03 },
+      { 0xDC, 0xB0, 0x6E, 0x3E, 0x01, 0xE8, 0x06, 0xC1, 0x60, 0x8B, 0x90, 0xE2,
+        0x43, 0xC0, 0x29, 0x22, 0x6D, 0x71, 0x13, 0x80, 0x05 }, 0 },
+    { { 0x41, 0x48, 0x81, 0xA4, 0x42, 0xD5, 0x00, 0x0F, 0x56, 0x66, 0xFF, 0xFD,
+        0x1B, 0x52, 0x56, 0xE0, 0xE8, 0xDA, 0x11, 0x5E, 0x02 },
+      { 0x53, 0x18, 0x3D, 0x22, 0xCD, 0x2A, 0xBE, 0xFD, 0x8F, 0x3F, 0x66, 0x3D,
+        0x70, 0xAF, 0xF9, 0xCB, 0x25, 0x28, 0xDC, 0x22, 0x04 }, 0 },
+    { { 0xA1, 0xC7, 0x65, 0x0E, 0xE0, 0xCA, 0x57, 0x56, 0xCE, 0xB4, 0xAD, 0x55,
+        0xA5, 0x72, 0x5F, 0x99, 0x06, 0x91, 0x15, 0x06, 0x00 },
+      { 0xC5, 0xD2, 0xB6, 0x29, 0xE6, 0x33, 0x2C, 0x0D, 0xCF, 0xE2, 0xCC, 0xEB,
+        0xED, 0xAF, 0x6E, 0x57, 0xCA, 0x02, 0x85, 0x61, 0x07 }, 0 },
+    { { 0x66, 0x33, 0x04, 0xC2, 0x8C, 0x86, 0xD4, 0x1B, 0x21, 0x38, 0x6B, 0xC7,
+        0xFA, 0x3C, 0xCF, 0xFE, 0x71, 0xFB, 0xAE, 0x38, 0x07 },
+      { 0xCF, 0xDC, 0xFB, 0xCA, 0xE6, 0x29, 0x9E, 0x85, 0x56, 0x27, 0x35, 0x16,
+        0x89, 0xE7, 0x80, 0x95, 0x92, 0x3F, 0xEB, 0xFE, 0x06 }, 0 },
+    { { 0x5B, 0x19, 0x5A, 0x24, 0x93, 0xA3, 0x0A, 0xE6, 0x6D, 0x15, 0xA6, 0x0D,
+        0xD6, 0x66, 0x93, 0x9E, 0x25, 0xE4, 0x55, 0x82, 0x06 },
+      { 0x5F, 0xAF, 0x93, 0x57, 0x88, 0xFB, 0x9E, 0x88, 0xC0, 0x1A, 0x22, 0xCD,
+        0x15, 0x4B, 0xC9, 0xD8, 0x54, 0xF6, 0x3C, 0x36, 0x00 }, 0 },
+    { { 0x6D, 0x8E, 0x85, 0xC9, 0x39, 0x1D, 0xFF, 0x73, 0x33, 0x7C, 0xD0, 0xE2,
+        0xE4, 0xA6, 0x2D, 0x64, 0x84, 0xDA, 0xEC, 0x46, 0x07 },
+      { 0x4C, 0x89, 0xC7, 0xDD, 0x26, 0x7D, 0x14, 0x97, 0xF5, 0xD2, 0xC5, 0xA3,
+        0x1D, 0xE8, 0x3F, 0x02, 0x58, 0x62, 0x3C, 0xEA, 0x05 }, 0 },
+    { { 0x5A, 0x93, 0x4E, 0x72, 0x6A, 0xB6, 0x41, 0x54, 0x80, 0xA4, 0x17, 0x17,
+        0xD9, 0x8B, 0x8A, 0x7A, 0x0C, 0x91, 0x31, 0xEC, 0x02 },
+      { 0x39, 0xAC, 0x4C, 0x4F, 0x4C, 0x7C, 0xA4, 0x07, 0xA8, 0x15, 0x74, 0xF8,
+        0x83, 0x63, 0xC0, 0x6A, 0xA4, 0x95, 0x27, 0x42, 0x07 }, 0 },
+    { { 0x73, 0x7F, 0x45, 0xDD, 0xCF, 0x93, 0x5A, 0x73, 0xEA, 0xFB, 0x2A, 0x21,
+        0xE4, 0xD7, 0x10, 0x04, 0x76, 0x2A, 0x9C, 0x13, 0x04 },
+      { 0xFD, 0xB5, 0x4E, 0x35, 0xA2, 0xB8, 0x1B, 0xF4, 0xF8, 0x14, 0x8B, 0xCA,
+        0xD2, 0x49, 0x6B, 0x57, 0xE9, 0x4C, 0x87, 0x26, 0x01 }, 0 },
+    { { 0xBF, 0xFD, 0x91, 0xEE, 0x9E, 0x3C, 0x2D, 0x58, 0xF7, 0x0A, 0x0C, 0x9F,
+        0x98, 0xD6, 0x1A, 0xA7, 0xDB, 0x55, 0x76, 0x86, 0x02 },
+      { 0xB0, 0x39, 0x9B, 0x76, 0x8A, 0xCC, 0xBD, 0xCF, 0xDC, 0xD1, 0x32, 0x86,
+        0xAF, 0xE2, 0xD3, 0xBF, 0x69, 0x61, 0x98, 0x90, 0x00 }, 0 },
+    { { 0x49, 0x4E, 0x84, 0x72, 0x35, 0xD5, 0x45, 0xAB, 0xEC, 0xD9, 0x44, 0x53,
+        0xF3, 0x1B, 0x2A, 0xAE, 0x52, 0x86, 0x90, 0xC9, 0x05 },
+      { 0xD8, 0x54, 0x1F, 0xDD, 0x97, 0x90, 0x68, 0x2C, 0xEA, 0x6E, 0x27, 0xAD,
+        0xEF, 0x1A, 0x5B, 0x8C, 0x28, 0xE3, 0xC0, 0x8C, 0x03 }, 0 },
+    { { 0x60, 0xFC, 0x4A, 0xF8, 0xA6, 0xA5, 0x54, 0x4B, 0x1C, 0x23, 0xA2, 0x05,
+        0x04, 0x15, 0x77, 0x5B, 0xD9, 0x89, 0x64, 0xEA, 0x00 },
+      { 0x15, 0xCF, 0x54, 0x48, 0x05, 0x53, 0x68, 0xF7, 0x59, 0x8A, 0x35, 0x99,
+        0x27, 0xC1, 0x1E, 0xED, 0x83, 0xF8, 0xEA, 0xF6, 0x04 }, 0 },
+    { { 0x30, 0xC9, 0x27, 0xBD, 0x6D, 0x77, 0x36, 0x45, 0x41, 0xA6, 0x52, 0xB3,
+        0x22, 0x25, 0x42, 0x79, 0xE0, 0xA8, 0x51, 0xE9, 0x00 },
+      { 0x50, 0x21, 0x11, 0x7B, 0xE4, 0xAF, 0xF2, 0xFF, 0x2D, 0x6D, 0x34, 0x00,
+        0x8A, 0x42, 0x60, 0x44, 0xCC, 0x82, 0x2F, 0x6A, 0x05 }, 0 },
+    { { 0x18, 0x90, 0xAE, 0x35, 0xC1, 0x39, 0xB0, 0xAF, 0x46, 0xE8, 0x57, 0x32,
+        0x68, 0xCD, 0x84, 0x0A, 0x5C, 0x6F, 0xA2, 0xED, 0x05 },
+      { 0xD7, 0xCE, 0x4D, 0x88, 0xA3, 0xD8, 0x41, 0x93, 0xA4, 0x64, 0xC2, 0x08,
+        0x9D, 0x75, 0x75, 0x1F, 0x1A, 0x2D, 0x7A, 0xEF, 0x05 }, 0 },
+    { { 0x9A, 0x4D, 0x93, 0x20, 0xB0, 0x3A, 0x42, 0x3C, 0x8E, 0x21, 0xE3, 0x29,
+        0x9A, 0xD0, 0x35, 0xA6, 0x15, 0xB5, 0x3D, 0x2D, 0x02 },
+      { 0x05, 0x75, 0x0A, 0xAD, 0x54, 0x59, 0xE2, 0xAA, 0x92, 0xCD, 0xAA, 0xA7,
+        0xB2, 0x09, 0xC8, 0x19, 0xB2, 0x10, 0x54, 0x1C, 0x05 }, 0 },
+    { { 0xFD, 0x5F, 0x63, 0x69, 0x7D, 0x66, 0x9B, 0xF1, 0x21, 0x2C, 0x8F, 0x2B,
+        0xF4, 0x58, 0xCB, 0x2C, 0x59, 0x83, 0x75, 0x19, 0x03 },
+      { 0x47, 0xCF, 0xC5, 0x37, 0xE1, 0xC9, 0xB1, 0x8E, 0x32, 0x64, 0x31, 0x9F,
+        0x1C, 0x06, 0xD0, 0x23, 0x37, 0xBD, 0x10, 0x05, 0x01 }, 0 },
+    { { 0x37, 0x49, 0xE0, 0x2E, 0x2E, 0x67, 0x7F, 0xD5, 0x58, 0xBF, 0x82, 0x72,
+        0xB8, 0x93, 0x30, 0x61, 0x7A, 0x84, 0xF9, 0x53, 0x06 },
+      { 0x14, 0xF0, 0x3E, 0xDF, 0x01, 0x42, 0x95, 0xAA, 0x95, 0x70, 0x90, 0xFA,
+        0x2C, 0x90, 0xFD, 0x4F, 0x34, 0xDD, 0x06, 0xFC, 0x02 }, 0 },
+    { { 0x7B, 0xD3, 0x46, 0x38, 0x92, 0x5D, 0x3C, 0x80, 0xDD, 0x61, 0x43, 0x81,
+        0x81, 0x76, 0xBC, 0x6C, 0x7E, 0xF3, 0x1B, 0x53, 0x05 },
+      { 0x08, 0x34, 0x2D, 0xA5, 0x4A, 0x5D, 0x9D, 0xD0, 0x81, 0xAF, 0x9C, 0x7E,
+        0xC9, 0x66, 0x55, 0xF4, 0xDA, 0x4C, 0xE1, 0x70, 0x01 }, 0 },
+    { { 0x92, 0xDB, 0x97, 0x06, 0xEA, 0x15, 0xD8, 0xF8, 0xD1, 0xA8, 0x17, 0x2F,
+        0xD9, 0x9D, 0x19, 0x38, 0xCB, 0xAA, 0xDC, 0xE6, 0x00 },
+      { 0x9D, 0x25, 0xD5, 0x3E, 0x54, 0x0E, 0x01, 0x9C, 0xF4, 0x18, 0x8A, 0x23,
+        0xF6, 0xC4, 0x87, 0xE3, 0x1F, 0x8B, 0x18, 0x8C, 0x02 }, 0 },
+    { { 0x79, 0xD2, 0x02, 0x8D, 0x4F, 0xF4, 0x67, 0xE1, 0x75, 0x9D, 0x9A, 0xE7,
+        0x33, 0x81, 0x1D, 0x57, 0x09, 0xB0, 0x44, 0x90, 0x07 },
+      { 0x10, 0xC8, 0x1D, 0xD6, 0x89, 0x38, 0x57, 0xCC, 0x8F, 0xAF, 0x32, 0xBE,
+        0xBA, 0x6E, 0x5C, 0x88, 0xD7, 0x0E, 0x0A, 0xD0, 0x02 }, 0 },
+    { { 0x0E, 0x09, 0xC1, 0x2F, 0xB4, 0x10, 0x41, 0x93, 0x8B, 0x49, 0x04, 0x11,
+        0x09, 0x21, 0x99, 0x81, 0xE4, 0x7E, 0x5E, 0xAD, 0x05 },
+      { 0x6D, 0x71, 0x03, 0xF6, 0x93, 0xCB, 0x2D, 0xDC, 0x6C, 0x36, 0x20, 0xA3,
+        0xB4, 0x16, 0xF9, 0x83, 0x11, 0xF5, 0xFB, 0x58, 0x05 }, 0 },
+    { { 0x07, 0x54, 0xE3, 0x01, 0xA4, 0x1D, 0x0C, 0x9D, 0xAC, 0x95, 0x84, 0x2B,
+        0x73, 0x47, 0xDD, 0xB6, 0xB9, 0xA0, 0x65, 0x0C, 0x02 },
+      { 0x00, 0x8B, 0x92, 0x54, 0x2B, 0x1F, 0xCF, 0x45, 0x2A, 0x13, 0xBB, 0xDC,
+        0x38, 0x7A, 0xBF, 0xD8, 0x78, 0xFD, 0x93, 0x79, 0x00 }, 0 },
+    { { 0x7A, 0xB3, 0xE2, 0x13, 0x69, 0x84, 0xFF, 0x03, 0x2D, 0xBB, 0xEF, 0xCA,
+        0x9B, 0x50, 0x39, 0xCD, 0xA8, 0x75, 0x6F, 0xAD, 0x02 },
+      { 0x82, 0xDD, 0xBA, 0xB6, 0xC7, 0xBB, 0xAF, 0xB6, 0x84, 0x9F, 0x95, 0xE8,
+        0x79, 0x26, 0xB6, 0x5D, 0x7C, 0x15, 0x4C, 0x70, 0x04 }, 0 },
+    { { 0x39, 0x6D, 0xA3, 0x63, 0x3D, 0xA8, 0xC5, 0x46, 0x3F, 0x7A, 0xB8, 0xC3,
+        0x42, 0x13, 0xAF, 0x51, 0xFC, 0x31, 0xA0, 0x4E, 0x07 },
+      { 0x18, 0x7C, 0xD7, 0x0E, 0x9E, 0x76, 0x6E, 0xE2, 0x77, 0x0C, 0xFA, 0x73,
+        0x56, 0x60, 0xA8, 0x8A, 0xC7, 0x61, 0xFB, 0x0F, 0x01 }, 0 },
+    { { 0xE5, 0xED, 0x03, 0x8E, 0x81, 0xA2, 0xB8, 0x37, 0xB3, 0x35, 0xFE, 0xD4,
+        0x14, 0xF5, 0x16, 0xD5, 0x10, 0x9E, 0xEE, 0x42, 0x03 },
+      { 0x4D, 0xAE, 0x21, 0x6C, 0x26, 0x85, 0xB3, 0xA2, 0x94, 0x27, 0x40, 0x28,
+        0x33, 0x90, 0x2D, 0xE8, 0x9C, 0x59, 0x3F, 0x0F, 0x04 }, 0 },
+    { { 0x6D, 0x58, 0x96, 0x06, 0xAD, 0x01, 0x9F, 0x3D, 0x2D, 0xF0, 0xBF, 0x68,
+        0x62, 0x14, 0x8D, 0x93, 0x71, 0x97, 0xA1, 0x40, 0x07 },
+      { 0x95, 0x10, 0xFA, 0x98, 0x34, 0x27, 0xDC, 0xA3, 0x38, 0x27, 0x63, 0xB9,
+        0xEA, 0xD4, 0x94, 0x18, 0xE5, 0x2C, 0xF0, 0xF3, 0x00 }, 0 },
+    { { 0x66, 0x0C, 0xB5, 0x3C, 0xF4, 0x9F, 0x75, 0x1E, 0x2C, 0x19, 0x26, 0xFA,
+        0x26, 0x44, 0xA9, 0x43, 0xF2, 0x28, 0xC8, 0xAF, 0x02 },
+      { 0x75, 0x1C, 0xB3, 0x97, 0x89, 0x98, 0x67, 0x34, 0x98, 0x17, 0x72, 0xD8,
+        0x7B, 0x70, 0x2F, 0xFA, 0xDF, 0x07, 0xD6, 0xDC, 0x02 }, 0 },
+    { { 0x27, 0x97, 0x7E, 0x65, 0xAA, 0x58, 0xCB, 0x23, 0xF1, 0x9A, 0x5C, 0xD9,
+        0x15, 0x4E, 0x22, 0xB7, 0xAC, 0x28, 0xB4, 0x13, 0x06 },
+      { 0xC9, 0xD3, 0x8B, 0x22, 0x49, 0x42, 0xF3, 0x42, 0x65, 0xD4, 0xC5, 0x1C,
+        0x83, 0xB4, 0x62, 0x47, 0xBC, 0x8B, 0x4B, 0xA6, 0x07 }, 0 },
+    { { 0x67, 0x11, 0x6B, 0x1B, 0x31, 0x5F, 0xBE, 0xE4, 0x95, 0x16, 0x05, 0x5A,
+        0xF7, 0x80, 0x46, 0x49, 0x8C, 0xC4, 0x60, 0x8C, 0x01 },
+      { 0x4D, 0x95, 0x4E, 0x60, 0x27, 0xB5, 0x03, 0xB2, 0x0A, 0x79, 0xA3, 0x1A,
+        0xDE, 0x9E, 0x5D, 0xFC, 0xB5, 0xC9, 0x43, 0xF5, 0x04 }, 0 },
+    { { 0xEF, 0xC1, 0xCF, 0x3C, 0xE3, 0x3D, 0xC6, 0x2C, 0x68, 0x0D, 0x8A, 0xFC,
+        0xC4, 0xDE, 0x1D, 0xCC, 0x12, 0x39, 0x1D, 0xCD, 0x05 },
+      { 0xDF, 0x9F, 0x1A, 0x01, 0xD3, 0x97, 0xDC, 0x76, 0xE0, 0x4E, 0xCA, 0xB0,
+        0x38, 0xB8, 0xBB, 0x57, 0xB9, 0x8C, 0x5D, 0xD9, 0x00 }, 0 },
+    { { 0xBF, 0x54, 0xC8, 0x0A, 0xA4, 0x15, 0x7B, 0xB3, 0x89, 0xA5, 0x7D, 0x3A,
+        0xFC, 0xD0, 0xFF, 0x9B, 0xB7, 0xCC, 0x9D, 0x1A, 0x07 },
+      { 0x2A, 0x7B, 0x46, 0xE8, 0x26, 0xCB, 0x54, 0x02, 0x5B, 0x2A, 0xD1, 0xB2,
+        0xEE, 0xAD, 0xD4, 0x14, 0x0B, 0x05, 0x3B, 0x37, 0x06 }, 0 },
+    { { 0x9D, 0xF3, 0xDA, 0xF8, 0x1E, 0x66, 0xEA, 0x71, 0xEB, 0x2A, 0x27, 0x5B,
+        0xBE, 0xD1, 0xD1, 0x1C, 0xE8, 0x60, 0x90, 0x00, 0x01 },
+      { 0xE7, 0x74, 0x4A, 0x18, 0x01, 0x3D, 0x1D, 0x70, 0x00, 0xA4, 0x41, 0x45,
+        0x70, 0xE0, 0x54, 0x6F, 0x5F, 0x4E, 0xF1, 0x86, 0x04 }, 0 },
+    { { 0xF7, 0x8A, 0xEA, 0xEC, 0x9B, 0xFB, 0xD1, 0x86, 0x92, 0xCD, 0xD5, 0xB5,
+        0xFF, 0xE6, 0x75, 0x8D, 0x69, 0xF2, 0xFA, 0x13, 0x06 },
+      { 0x5E, 0x58, 0x3D, 0x24, 0x56, 0xD3, 0xF7, 0x31, 0x43, 0x82, 0x88, 0x98,
+        0x53, 0xF1, 0x4C, 0x7D, 0x77, 0x0E, 0x77, 0x43, 0x03 }, 0 },
+    { { 0x4A, 0xBC, 0x30, 0x6A, 0xC8, 0xEC, 0x32, 0xE3, 0x0A, 0xA4, 0x4D, 0x9E,
+        0x84, 0x32, 0xE2, 0xB8, 0xB4, 0xDC, 0x2C, 0xF1, 0x04 },
+      { 0x1E, 0xFF, 0xB4, 0x05, 0x26, 0x21, 0xA5, 0x68, 0x28, 0x85, 0x4F, 0x52,
+        0x68, 0x8D, 0x85, 0x13, 0x67, 0x58, 0x7A, 0xD6, 0x07 }, 0 },
+    { { 0x1E, 0x77, 0xC4, 0x0C, 0x77, 0x36, 0xB5, 0x3E, 0x50, 0xB7, 0x2E, 0x6B,
+        0x08, 0xE8, 0xF6, 0x14, 0x58, 0x2E, 0xC3, 0xEC, 0x00 },
+      { 0x6E, 0x1B, 0x39, 0x97, 0x1B, 0xBD, 0x90, 0xFD, 0x44, 0x77, 0x20, 0xB7,
+        0x12, 0xD3, 0x19, 0xDA, 0xAD, 0x37, 0x19, 0xC1, 0x02 }, 0 },
+    { { 0x28, 0x93, 0x4D, 0x2E, 0xC4, 0xFB, 0xA8, 0xA9, 0xD7, 0xE1, 0x48, 0x15,
+        0x60, 0x11, 0xF9, 0x15, 0xF9, 0xBB, 0x09, 0xE7, 0x04 },
+      { 0x4B, 0x10, 0x4A, 0xF3, 0x5D, 0x8A, 0xF1, 0x12, 0x73, 0x0F, 0x0D, 0xF4,
+        0x3E, 0x12, 0x8F, 0x6D, 0x7C, 0x5D, 0x1A, 0xBC, 0x07 }, 0 },
+    { { 0xDE, 0x98, 0x51, 0x57, 0x46, 0xEC, 0x8D, 0xB8, 0xAF, 0xC4, 0x9C, 0xB2,
+        0x68, 0x34, 0x3D, 0x11, 0xB5, 0x43, 0xE5, 0x70, 0x04 },
+      { 0x4A, 0x15, 0x32, 0xFF, 0x56, 0x9C, 0x9A, 0xB6, 0xB0, 0xA0, 0x05, 0x7D,
+        0xB5, 0x51, 0x3B, 0xB7, 0x13, 0x9B, 0xA6, 0x15, 0x04 }, 0 },
+    { { 0x73, 0x97, 0x38, 0x65, 0x17, 0xE8, 0x4C, 0x5F, 0x50, 0x42, 0x1D, 0xFC,
+        0x72, 0xF7, 0xD5, 0xBE, 0x77, 0xB8, 0xCF, 0x8C, 0x00 },
+      { 0xC6, 0x96, 0x46, 0x3E, 0xB4, 0x99, 0xB6, 0xD2, 0x58, 0x68, 0x05, 0x83,
+        0xDB, 0xCD, 0x99, 0x03, 0xD0, 0x97, 0xBD, 0x43, 0x03 }, 0 },
+    { { 0x07, 0xF2, 0xDC, 0x26, 0xD9, 0x20, 0x0F, 0x27, 0x4F, 0x50, 0xFF, 0x08,
+        0x81, 0xDC, 0xFE, 0x2D, 0x0F, 0x2C, 0x2B, 0x5D, 0x07 },
+      { 0x29, 0x3E, 0x39, 0x13, 0xFF, 0x9F, 0xCD, 0x40, 0x9C, 0x8A, 0x41, 0x7A,
+        0x40, 0xC4, 0xE0, 0xE6, 0x5B, 0xC0, 0x92, 0xD7, 0x02 }, 0 },
+    { { 0xD3, 0x62, 0xBC, 0x34, 0xEF, 0xC5, 0xB1, 0x22, 0xEC, 0xF7, 0x57, 0x74,
+        0x7F, 0x1A, 0x58, 0x15, 0x08, 0x1E, 0x4C, 0xCA, 0x00 },
+      { 0x7B, 0xB1, 0x08, 0xC6, 0xBA, 0xD5, 0xDB, 0x60, 0x13, 0xD8, 0xEB, 0x82,
+        0x67, 0xA7, 0x26, 0x08, 0xD0, 0xD5, 0xC7, 0xA2, 0x04 }, 0 },
+    { { 0x8B, 0xC1, 0xBB, 0x08, 0x78, 0x28, 0xF1, 0x66, 0x5F, 0x14, 0xC9, 0x5E,
+        0xED, 0xE7, 0xF7, 0x07, 0xC0, 0x3A, 0x51, 0x94, 0x00 },
+      { 0xDC, 0x61, 0x4A, 0x6F, 0x08, 0xDF, 0xFF, 0xE7, 0x65, 0x73, 0xF3, 0x92,
+        0x3B, 0x6C, 0x53, 0xDC, 0x98, 0xBB, 0x29, 0x90, 0x05 }, 0 },
+    { { 0x0F, 0x17, 0xC7, 0x22, 0xF7, 0xFC, 0x3C, 0x1C, 0xD7, 0x9E, 0x59, 0xBD,
+        0x4A, 0x7B, 0x8F, 0x65, 0x19, 0x97, 0xEA, 0x0F, 0x04 },
+      { 0xCA, 0x32, 0x6B, 0xDE, 0x55, 0xE1, 0x58, 0x57, 0x88, 0xDC, 0x8A, 0x8B,
+        0xFD, 0x03, 0x4F, 0xF2, 0x72, 0x73, 0x5B, 0xF8, 0x05 }, 0 },
+    { { 0x5F, 0xD9, 0xEC, 0xBD, 0x55, 0xF1, 0xE1, 0xDB, 0x70, 0xA3, 0x5E, 0x62,
+        0xA0, 0xA6, 0x4B, 0xCE, 0x2E, 0x07, 0x1E, 0xDA, 0x07 },
+      { 0x70, 0xDD, 0xC6, 0x3C, 0x9A, 0xBC, 0x5A, 0x07, 0xB4, 0x65, 0xC1, 0xF3,
+        0xB2, 0x37, 0x2F, 0x36, 0x64, 0x42, 0x9F, 0x7A, 0x07 }, 0 },
+    { { 0xF7, 0x55, 0xB3, 0x5B, 0xE9, 0xAB, 0x6F, 0x44, 0xAE, 0x73, 0xE1, 0x12,
+        0x27, 0xBF, 0xD5, 0x17, 0x4A, 0xD8, 0xC6, 0x06, 0x05 },
+      { 0xB6, 0x2F, 0x53, 0x03, 0xCC, 0x54, 0xF2, 0x54, 0x38, 0x3C, 0x80, 0xD9,
+        0xC5, 0xF4, 0xAB, 0x15, 0x6F, 0x02, 0x3D, 0xC4, 0x02 }, 0 }
+};
+
+static const curve_generated_t sect163k1_generated = {
+    .square = eccint_square_sect163k1,
+    .inv = eccint_inv_sect163k1,
+    .tracemask = eccint_sect163k1_tracemask,
+    .halftrace = eccint_sect163k1_halftrace[0],
+    .ptable = eccint_sect163k1_ptable
+};
+
+#endif
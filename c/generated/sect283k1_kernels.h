@@ -0,0 +1,2879 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+// Generated by contrib/gftable/kernels.js for sect283k1, do not edit.
+// f(z) = z^283 + z^12 + z^7 + z^5 + 1, 36 words
+
+#ifndef __SECT283K1_KERNELS_H
+#define __SECT283K1_KERNELS_H
+
+#include "ecctypes.h"
+#include "eccmath.h"
+#include "eccgenerated.h"
+#include "eccspread.h"
+
+#if KEYSIZE < 36
+#error sect283k1 needs KEYSIZE=36 or more
+#endif
+
+// Reduction modulo f(z), one byte at a time from the top, unrolled
+void eccint_mod_sect283k1(eccint_t *in, eccint_t *res, const curve_t *curve) {
+    eccint_t t;
+
+    t = in[71];
+    in[35] ^= (t << 5);
+    in[36] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[37] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[38] ^= (t >> 7);
+    t = in[70];
+    in[34] ^= (t << 5);
+    in[35] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[36] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[37] ^= (t >> 7);
+    t = in[69];
+    in[33] ^= (t << 5);
+    in[34] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[35] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[36] ^= (t >> 7);
+    t = in[68];
+    in[32] ^= (t << 5);
+    in[33] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[34] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[35] ^= (t >> 7);
+    t = in[67];
+    in[31] ^= (t << 5);
+    in[32] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[33] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[34] ^= (t >> 7);
+    t = in[66];
+    in[30] ^= (t << 5);
+    in[31] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[32] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[33] ^= (t >> 7);
+    t = in[65];
+    in[29] ^= (t << 5);
+    in[30] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[31] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[32] ^= (t >> 7);
+    t = in[64];
+    in[28] ^= (t << 5);
+    in[29] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[30] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[31] ^= (t >> 7);
+    t = in[63];
+    in[27] ^= (t << 5);
+    in[28] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[29] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[30] ^= (t >> 7);
+    t = in[62];
+    in[26] ^= (t << 5);
+    in[27] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[28] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[29] ^= (t >> 7);
+    t = in[61];
+    in[25] ^= (t << 5);
+    in[26] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[27] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[28] ^= (t >> 7);
+    t = in[60];
+    in[24] ^= (t << 5);
+    in[25] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[26] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[27] ^= (t >> 7);
+    t = in[59];
+    in[23] ^= (t << 5);
+    in[24] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[25] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[26] ^= (t >> 7);
+    t = in[58];
+    in[22] ^= (t << 5);
+    in[23] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[24] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[25] ^= (t >> 7);
+    t = in[57];
+    in[21] ^= (t << 5);
+    in[22] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[23] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[24] ^= (t >> 7);
+    t = in[56];
+    in[20] ^= (t << 5);
+    in[21] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[22] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[23] ^= (t >> 7);
+    t = in[55];
+    in[19] ^= (t << 5);
+    in[20] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[21] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[22] ^= (t >> 7);
+    t = in[54];
+    in[18] ^= (t << 5);
+    in[19] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[20] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[21] ^= (t >> 7);
+    t = in[53];
+    in[17] ^= (t << 5);
+    in[18] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[19] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[20] ^= (t >> 7);
+    t = in[52];
+    in[16] ^= (t << 5);
+    in[17] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[18] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[19] ^= (t >> 7);
+    t = in[51];
+    in[15] ^= (t << 5);
+    in[16] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[17] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[18] ^= (t >> 7);
+    t = in[50];
+    in[14] ^= (t << 5);
+    in[15] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[16] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[17] ^= (t >> 7);
+    t = in[49];
+    in[13] ^= (t << 5);
+    in[14] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[15] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[16] ^= (t >> 7);
+    t = in[48];
+    in[12] ^= (t << 5);
+    in[13] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[14] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[15] ^= (t >> 7);
+    t = in[47];
+    in[11] ^= (t << 5);
+    in[12] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[13] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[14] ^= (t >> 7);
+    t = in[46];
+    in[10] ^= (t << 5);
+    in[11] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[12] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[13] ^= (t >> 7);
+    t = in[45];
+    in[9] ^= (t << 5);
+    in[10] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[11] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[12] ^= (t >> 7);
+    t = in[44];
+    in[8] ^= (t << 5);
+    in[9] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[10] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[11] ^= (t >> 7);
+    t = in[43];
+    in[7] ^= (t << 5);
+    in[8] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[9] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[10] ^= (t >> 7);
+    t = in[42];
+    in[6] ^= (t << 5);
+    in[7] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[8] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[9] ^= (t >> 7);
+    t = in[41];
+    in[5] ^= (t << 5);
+    in[6] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[7] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[8] ^= (t >> 7);
+    t = in[40];
+    in[4] ^= (t << 5);
+    in[5] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[6] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[7] ^= (t >> 7);
+    t = in[39];
+    in[3] ^= (t << 5);
+    in[4] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[5] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[6] ^= (t >> 7);
+    t = in[38];
+    in[2] ^= (t << 5);
+    in[3] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[4] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[5] ^= (t >> 7);
+    t = in[37];
+    in[1] ^= (t << 5);
+    in[2] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[3] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[4] ^= (t >> 7);
+    t = in[36];
+    in[0] ^= (t << 5);
+    in[1] ^= (t << 4) ^ (t << 2) ^ (t >> 3);
+    in[2] ^= (t << 1) ^ (t >> 4) ^ (t >> 6);
+    in[3] ^= (t >> 7);
+    t = in[35] >> 3;
+    in[35] &= 0x07;
+    in[0] ^= (t << 7) ^ (t << 5) ^ t;
+    in[1] ^= (t << 4) ^ (t >> 1) ^ (t >> 3);
+    in[2] ^= (t >> 4);
+
+    eccint_cpy(res, in, curve->words);
+}
+
+// Squaring spreads the bits to the even positions, then reduces
+static void eccint_square_sect283k1(const eccint_t *a, eccint_t *res, const curve_t *curve) {
+    eccint_t wide[72];
+
+    for (size_t i = 0; i < 36; i++) {
+        wide[2 * i] = ecc_spread[a[i]] & 0xFF;
+        wide[2 * i + 1] = ecc_spread[a[i]] >> 8;
+    }
+    eccint_mod_sect283k1(wide, res, curve);
+}
+
+static void eccint_mul_sect283k1(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {
+    eccint_t wide[72];
+
+    eccint_mul(a, b, wide, curve);
+    eccint_mod_sect283k1(wide, res, curve);
+}
+
+static void eccint_multisquare_sect283k1(const eccint_t *a, const size_t k, eccint_t *res, const curve_t *curve) {
+    eccint_square_sect283k1(a, res, curve);
+    for (size_t i = 1; i < k; i++) {
+        eccint_square_sect283k1(res, res, curve);
+    }
+}
+
+// Itoh-Tsujii inversion, a^-1 = (a^(2^282 - 1))^2 with the exponents 2^k - 1
+// for k = 1, 2, 4, 8, 16, 17, 34, 35, 70, 140, 141, 282
+static void eccint_inv_sect283k1(const eccint_t *a, eccint_t *res, const curve_t *curve) {
+    eccint_t b[36];
+    eccint_t t[36];
+
+    eccint_cpy(b, a, 36);
+    // a^(2^2 - 1)
+    eccint_multisquare_sect283k1(b, 1, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    // a^(2^4 - 1)
+    eccint_multisquare_sect283k1(b, 2, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    // a^(2^8 - 1)
+    eccint_multisquare_sect283k1(b, 4, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    // a^(2^16 - 1)
+    eccint_multisquare_sect283k1(b, 8, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    // a^(2^17 - 1)
+    eccint_square_sect283k1(b, t, curve);
+    eccint_mul_sect283k1(t, a, b, curve);
+    // a^(2^34 - 1)
+    eccint_multisquare_sect283k1(b, 17, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    // a^(2^35 - 1)
+    eccint_square_sect283k1(b, t, curve);
+    eccint_mul_sect283k1(t, a, b, curve);
+    // a^(2^70 - 1)
+    eccint_multisquare_sect283k1(b, 35, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    // a^(2^140 - 1)
+    eccint_multisquare_sect283k1(b, 70, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    // a^(2^141 - 1)
+    eccint_square_sect283k1(b, t, curve);
+    eccint_mul_sect283k1(t, a, b, curve);
+    // a^(2^282 - 1)
+    eccint_multisquare_sect283k1(b, 141, t, curve);
+    eccint_mul_sect283k1(t, b, b, curve);
+    eccint_square_sect283k1(b, res, curve);
+}
+
+static const eccint_t eccint_sect283k1_tracemask[36] = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00 };
+
+// H(z^i)
+static const eccint_t eccint_sect283k1_halftrace[283][36] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+      0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+    { 0xD1, 0xC5, 0x54, 0xB8, 0xB2, 0xF0, 0x1C, 0x0C, 0xD6, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0xD3, 0xC5, 0x54, 0xB8, 0xB2, 0xF0, 0x1C, 0x0C, 0xD6, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0x3F, 0x91, 0x3B, 0xBA, 0xB5, 0x86, 0xA8, 0x86, 0xBE, 0x93, 0xEF, 0xFF,
+      0x1F, 0xF3, 0xA4, 0xC7, 0xB6, 0x80, 0x81, 0x5D, 0xB0, 0x0B, 0xA5, 0x56,
+      0x61, 0xBF, 0x0C, 0x49, 0x5D, 0x10, 0xF9, 0x36, 0xCD, 0xA4, 0x1B, 0x02 },
+    { 0xD7, 0xC5, 0x54, 0xB8, 0xB2, 0xF0, 0x1C, 0x0C, 0xD6, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0xB7, 0x1C, 0x54, 0x04, 0xE8, 0x1A, 0x63, 0x4F, 0x73, 0x17, 0xD4, 0xDD,
+      0xFB, 0x91, 0xBA, 0x4A, 0xAD, 0x33, 0x82, 0xA0, 0xA7, 0x64, 0x1C, 0xAD,
+      0xC8, 0xFD, 0x68, 0x68, 0xC9, 0x0A, 0xB8, 0x77, 0x53, 0x83, 0x04, 0x01 },
+    { 0x37, 0x91, 0x3B, 0xBA, 0xB5, 0x86, 0xA8, 0x86, 0xBE, 0x93, 0xEF, 0xFF,
+      0x1F, 0xF3, 0xA4, 0xC7, 0xB6, 0x80, 0x81, 0x5D, 0xB0, 0x0B, 0xA5, 0x56,
+      0x61, 0xBF, 0x0C, 0x49, 0x5D, 0x10, 0xF9, 0x36, 0xCD, 0xA4, 0x1B, 0x02 },
+    { 0xA5, 0x26, 0xBD, 0x86, 0xCE, 0x2B, 0x0F, 0xF0, 0xB1, 0xAF, 0xF9, 0x80,
+      0xAE, 0x78, 0xF6, 0x9F, 0x92, 0x80, 0x3E, 0xE8, 0xE4, 0x49, 0xED, 0xD8,
+      0x2D, 0x64, 0x3B, 0xF7, 0x36, 0x26, 0xD8, 0x83, 0xF5, 0xDB, 0xD9, 0x04 },
+    { 0xC7, 0xC5, 0x54, 0xB8, 0xB2, 0xF0, 0x1C, 0x0C, 0xD6, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0x15, 0x1D, 0x24, 0x0B, 0x15, 0x36, 0x78, 0x68, 0x01, 0x6F, 0x27, 0x6E,
+      0x61, 0x95, 0x30, 0x28, 0x3F, 0xB3, 0xEB, 0xF7, 0xE9, 0xE3, 0x64, 0x04,
+      0x20, 0x91, 0x91, 0x53, 0xE3, 0x79, 0xFF, 0x39, 0x95, 0xBE, 0x51, 0x04 },
+    { 0x97, 0x1C, 0x54, 0x04, 0xE8, 0x1A, 0x63, 0x4F, 0x73, 0x17, 0xD4, 0xDD,
+      0xFB, 0x91, 0xBA, 0x4A, 0xAD, 0x33, 0x82, 0xA0, 0xA7, 0x64, 0x1C, 0xAD,
+      0xC8, 0xFD, 0x68, 0x68, 0xC9, 0x0A, 0xB8, 0x77, 0x53, 0x83, 0x04, 0x01 },
+    { 0xDC, 0xDD, 0x84, 0xFD, 0x95, 0x68, 0x0A, 0x23, 0xA3, 0x4B, 0x2F, 0x7C,
+      0x9B, 0x62, 0x1D, 0x0D, 0x99, 0x51, 0x34, 0xF7, 0x27, 0x1D, 0xC8, 0x2B,
+      0x9C, 0x6F, 0x59, 0xA3, 0xE1, 0x26, 0x57, 0x61, 0x8F, 0x33, 0x5A, 0x02 },
+    { 0x77, 0x91, 0x3B, 0xBA, 0xB5, 0x86, 0xA8, 0x86, 0xBE, 0x93, 0xEF, 0xFF,
+      0x1F, 0xF3, 0xA4, 0xC7, 0xB6, 0x80, 0x81, 0x5D, 0xB0, 0x0B, 0xA5, 0x56,
+      0x61, 0xBF, 0x0C, 0x49, 0x5D, 0x10, 0xF9, 0x36, 0xCD, 0xA4, 0x1B, 0x02 },
+    { 0xDE, 0x42, 0x4C, 0x97, 0xF0, 0x54, 0xBF, 0xA5, 0x84, 0x2B, 0x82, 0x8F,
+      0x60, 0xE2, 0xAD, 0x8F, 0xB7, 0xD1, 0x6F, 0xFF, 0xFC, 0x0C, 0x1D, 0x69,
+      0x6F, 0x74, 0x7E, 0x22, 0x43, 0xC8, 0x23, 0x1D, 0xAF, 0x62, 0x0F, 0x07 },
+    { 0x25, 0x26, 0xBD, 0x86, 0xCE, 0x2B, 0x0F, 0xF0, 0xB1, 0xAF, 0xF9, 0x80,
+      0xAE, 0x78, 0xF6, 0x9F, 0x92, 0x80, 0x3E, 0xE8, 0xE4, 0x49, 0xED, 0xD8,
+      0x2D, 0x64, 0x3B, 0xF7, 0x36, 0x26, 0xD8, 0x83, 0xF5, 0xDB, 0xD9, 0x04 },
+    { 0x38, 0x3E, 0x9C, 0xE3, 0x93, 0xCE, 0x85, 0xCE, 0x51, 0x20, 0xF5, 0x08,
+      0x9C, 0xE0, 0xFA, 0x70, 0x3D, 0xC0, 0xC9, 0x44, 0xFF, 0x51, 0x04, 0x0A,
+      0xF0, 0x6F, 0x3A, 0xCC, 0x30, 0x00, 0x1F, 0xAE, 0x6A, 0x66, 0x8C, 0x01 },
+    { 0xC7, 0xC4, 0x54, 0xB8, 0xB2, 0xF0, 0x1C, 0x0C, 0xD6, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0x42, 0x8E, 0x1B, 0xB1, 0xB0, 0xB0, 0xD0, 0xEE, 0xBF, 0xFD, 0xC8, 0x91,
+      0x7E, 0x66, 0x94, 0xEF, 0x89, 0x33, 0x6B, 0xAA, 0x59, 0xE8, 0xC1, 0x52,
+      0x41, 0x2E, 0x9D, 0x1A, 0xBE, 0x69, 0x06, 0x0F, 0x58, 0x1A, 0x4A, 0x06 },
+    { 0x15, 0x1F, 0x24, 0x0B, 0x15, 0x36, 0x78, 0x68, 0x01, 0x6F, 0x27, 0x6E,
+      0x61, 0x95, 0x30, 0x28, 0x3F, 0xB3, 0xEB, 0xF7, 0xE9, 0xE3, 0x64, 0x04,
+      0x20, 0x91, 0x91, 0x53, 0xE3, 0x79, 0xFF, 0x39, 0x95, 0xBE, 0x51, 0x04 },
+    { 0x8D, 0xE7, 0xB9, 0x46, 0x2A, 0xC4, 0x12, 0xD1, 0xEE, 0x22, 0xED, 0xC9,
+      0x0E, 0x24, 0x65, 0xE7, 0x75, 0xD1, 0x04, 0x46, 0x70, 0xFC, 0xA8, 0x81,
+      0x30, 0x79, 0xFF, 0xFB, 0x47, 0xB2, 0xB5, 0xD2, 0x00, 0xE7, 0xCD, 0x01 },
+    { 0x97, 0x18, 0x54, 0x04, 0xE8, 0x1A, 0x63, 0x4F, 0x73, 0x17, 0xD4, 0xDD,
+      0xFB, 0x91, 0xBA, 0x4A, 0xAD, 0x33, 0x82, 0xA0, 0xA7, 0x64, 0x1C, 0xAD,
+      0xC8, 0xFD, 0x68, 0x68, 0xC9, 0x0A, 0xB8, 0x77, 0x53, 0x83, 0x04, 0x01 },
+    { 0xD6, 0xCB, 0x9B, 0x9B, 0x05, 0x6D, 0x38, 0xEA, 0x26, 0x07, 0x09, 0xD3,
+      0x8E, 0x9D, 0x9D, 0x38, 0xAA, 0x80, 0x4E, 0x3C, 0x57, 0x68, 0x5F, 0x33,
+      0x26, 0x13, 0x27, 0x11, 0xDC, 0xA3, 0x2D, 0x0A, 0xB4, 0x20, 0x1B, 0x02 },
+    { 0xDC, 0xD5, 0x84, 0xFD, 0x95, 0x68, 0x0A, 0x23, 0xA3, 0x4B, 0x2F, 0x7C,
+      0x9B, 0x62, 0x1D, 0x0D, 0x99, 0x51, 0x34, 0xF7, 0x27, 0x1D, 0xC8, 0x2B,
+      0x9C, 0x6F, 0x59, 0xA3, 0xE1, 0x26, 0x57, 0x61, 0x8F, 0x33, 0x5A, 0x02 },
+    { 0x9C, 0x45, 0x01, 0x4E, 0x65, 0xF1, 0xC6, 0x8E, 0xC6, 0x34, 0x72, 0xD0,
+      0xD3, 0xD1, 0x10, 0x28, 0xA1, 0x22, 0x0C, 0x4D, 0xE2, 0xD6, 0xA7, 0x48,
+      0x30, 0x14, 0x12, 0x4C, 0x74, 0x96, 0x64, 0x51, 0x71, 0x5D, 0x5E, 0x03 },
+    { 0x77, 0x81, 0x3B, 0xBA, 0xB5, 0x86, 0xA8, 0x86, 0xBE, 0x93, 0xEF, 0xFF,
+      0x1F, 0xF3, 0xA4, 0xC7, 0xB6, 0x80, 0x81, 0x5D, 0xB0, 0x0B, 0xA5, 0x56,
+      0x61, 0xBF, 0x0C, 0x49, 0x5D, 0x10, 0xF9, 0x36, 0xCD, 0xA4, 0x1B, 0x02 },
+    { 0x51, 0x78, 0x95, 0x89, 0x6B, 0x78, 0x65, 0xB5, 0xF1, 0xB5, 0x7F, 0xFD,
+      0x79, 0x29, 0x3E, 0x04, 0xD3, 0x80, 0x3C, 0xA1, 0x71, 0x6D, 0xE8, 0x43,
+      0x89, 0xA3, 0x0A, 0xF3, 0xE5, 0x3E, 0xB9, 0x9A, 0xF9, 0xD1, 0x97, 0x03 },
+    { 0xDE, 0x62, 0x4C, 0x97, 0xF0, 0x54, 0xBF, 0xA5, 0x84, 0x2B, 0x82, 0x8F,
+      0x60, 0xE2, 0xAD, 0x8F, 0xB7, 0xD1, 0x6F, 0xFF, 0xFC, 0x0C, 0x1D, 0x69,
+      0x6F, 0x74, 0x7E, 0x22, 0x43, 0xC8, 0x23, 0x1D, 0xAF, 0x62, 0x0F, 0x07 },
+    { 0x56, 0x90, 0xE4, 0x27, 0xEC, 0x1B, 0xCC, 0x65, 0x3B, 0x9A, 0x17, 0x2C,
+      0xFE, 0xD0, 0xAB, 0x5C, 0x03, 0x40, 0x30, 0x53, 0x5B, 0xC4, 0x5C, 0x0F,
+      0xE0, 0xB3, 0x2C, 0x4E, 0x73, 0x10, 0x73, 0x11, 0x05, 0x00, 0x00, 0x00 },
+    { 0x25, 0x66, 0xBD, 0x86, 0xCE, 0x2B, 0x0F, 0xF0, 0xB1, 0xAF, 0xF9, 0x80,
+      0xAE, 0x78, 0xF6, 0x9F, 0x92, 0x80, 0x3E, 0xE8, 0xE4, 0x49, 0xED, 0xD8,
+      0x2D, 0x64, 0x3B, 0xF7, 0x36, 0x26, 0xD8, 0x83, 0xF5, 0xDB, 0xD9, 0x04 },
+    { 0x70, 0x8A, 0xFE, 0x59, 0xD5, 0x3C, 0x8A, 0x93, 0x0E, 0x2D, 0x80, 0xF0,
+      0x3F, 0xAF, 0xB8, 0x96, 0x5C, 0x80, 0x89, 0x79, 0xC4, 0x17, 0x5D, 0xA5,
+      0x94, 0x02, 0xA0, 0xB2, 0x2A, 0xBA, 0x28, 0xBD, 0x12, 0x3D, 0x97, 0x03 },
+    { 0x38, 0xBE, 0x9C, 0xE3, 0x93, 0xCE, 0x85, 0xCE, 0x51, 0x20, 0xF5, 0x08,
+      0x9C, 0xE0, 0xFA, 0x70, 0x3D, 0xC0, 0xC9, 0x44, 0xFF, 0x51, 0x04, 0x0A,
+      0xF0, 0x6F, 0x3A, 0xCC, 0x30, 0x00, 0x1F, 0xAE, 0x6A, 0x66, 0x8C, 0x01 },
+    { 0x8C, 0x88, 0x3A, 0xCB, 0x92, 0x5E, 0x96, 0x76, 0xFC, 0x20, 0x1F, 0x43,
+      0x19, 0xDB, 0xE8, 0x15, 0x9F, 0xB3, 0x89, 0xAF, 0x25, 0x5F, 0xC4, 0xF5,
+      0xD1, 0x37, 0x7B, 0x20, 0x45, 0xE3, 0x6E, 0x8A, 0x56, 0x78, 0xC6, 0x07 },
+    { 0xC7, 0xC4, 0x55, 0xB8, 0xB2, 0xF0, 0x1C, 0x0C, 0xD6, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0xA0, 0x28, 0xDB, 0xCC, 0x51, 0xD6, 0x9A, 0x6E, 0xFD, 0xB1, 0x9F, 0x15,
+      0x4E, 0x23, 0xA3, 0xCF, 0xFA, 0x00, 0x1B, 0x6C, 0x3F, 0xD1, 0x07, 0x03,
+      0x54, 0x7A, 0x9D, 0x3F, 0xEE, 0xFF, 0x63, 0x46, 0xEE, 0x7E, 0x00, 0x00 },
+    { 0x42, 0x8E, 0x19, 0xB1, 0xB0, 0xB0, 0xD0, 0xEE, 0xBF, 0xFD, 0xC8, 0x91,
+      0x7E, 0x66, 0x94, 0xEF, 0x89, 0x33, 0x6B, 0xAA, 0x59, 0xE8, 0xC1, 0x52,
+      0x41, 0x2E, 0x9D, 0x1A, 0xBE, 0x69, 0x06, 0x0F, 0x58, 0x1A, 0x4A, 0x06 },
+    { 0x39, 0x79, 0x5C, 0x3C, 0xDD, 0xD3, 0xA9, 0x12, 0x4F, 0xFE, 0x3C, 0x50,
+      0x32, 0x49, 0x54, 0x29, 0x2B, 0xA2, 0xBC, 0xF7, 0x5B, 0x91, 0x98, 0xA7,
+      0x20, 0xD0, 0xC1, 0x07, 0xE1, 0x8E, 0x82, 0xA6, 0xC6, 0x87, 0x87, 0x07 },
+    { 0x15, 0x1F, 0x20, 0x0B, 0x15, 0x36, 0x78, 0x68, 0x01, 0x6F, 0x27, 0x6E,
+      0x61, 0x95, 0x30, 0x28, 0x3F, 0xB3, 0xEB, 0xF7, 0xE9, 0xE3, 0x64, 0x04,
+      0x20, 0x91, 0x91, 0x53, 0xE3, 0x79, 0xFF, 0x39, 0x95, 0xBE, 0x51, 0x04 },
+    { 0x0D, 0x3D, 0xA9, 0x11, 0x46, 0x00, 0xC1, 0x37, 0x07, 0xE2, 0x0E, 0xC1,
+      0x83, 0xCF, 0x19, 0xE9, 0xF6, 0xD1, 0x2A, 0x09, 0xC3, 0xE6, 0x8D, 0x83,
+      0x0E, 0xBB, 0x8D, 0xEA, 0x8C, 0x85, 0xDD, 0xC9, 0x90, 0x8E, 0xCD, 0x01 },
+    { 0x8D, 0xE7, 0xB1, 0x46, 0x2A, 0xC4, 0x12, 0xD1, 0xEE, 0x22, 0xED, 0xC9,
+      0x0E, 0x24, 0x65, 0xE7, 0x75, 0xD1, 0x04, 0x46, 0x70, 0xFC, 0xA8, 0x81,
+      0x30, 0x79, 0xFF, 0xFB, 0x47, 0xB2, 0xB5, 0xD2, 0x00, 0xE7, 0xCD, 0x01 },
+    { 0xEF, 0x5C, 0x61, 0xCD, 0x5F, 0x25, 0xD8, 0xFE, 0x55, 0xDB, 0x2F, 0x32,
+      0xB4, 0x9E, 0x17, 0x22, 0x1A, 0x80, 0xEF, 0x52, 0x06, 0xFF, 0x13, 0x51,
+      0xBB, 0x7A, 0x7E, 0x58, 0xEA, 0x7A, 0x81, 0xA9, 0x75, 0xE7, 0x8C, 0x01 },
+    { 0x97, 0x18, 0x44, 0x04, 0xE8, 0x1A, 0x63, 0x4F, 0x73, 0x17, 0xD4, 0xDD,
+      0xFB, 0x91, 0xBA, 0x4A, 0xAD, 0x33, 0x82, 0xA0, 0xA7, 0x64, 0x1C, 0xAD,
+      0xC8, 0xFD, 0x68, 0x68, 0xC9, 0x0A, 0xB8, 0x77, 0x53, 0x83, 0x04, 0x01 },
+    { 0xC8, 0x47, 0xA6, 0x2E, 0xAF, 0x9F, 0xFA, 0xEB, 0xE5, 0x24, 0x40, 0x3D,
+      0x94, 0xC2, 0x0B, 0x73, 0xF0, 0x80, 0xE6, 0x66, 0x72, 0xE3, 0xEB, 0xA2,
+      0x4E, 0xC7, 0xD2, 0xA3, 0x9D, 0xD0, 0x50, 0x22, 0xAA, 0x7E, 0x00, 0x00 },
+    { 0xD6, 0xCB, 0xBB, 0x9B, 0x05, 0x6D, 0x38, 0xEA, 0x26, 0x07, 0x09, 0xD3,
+      0x8E, 0x9D, 0x9D, 0x38, 0xAA, 0x80, 0x4E, 0x3C, 0x57, 0x68, 0x5F, 0x33,
+      0x26, 0x13, 0x27, 0x11, 0xDC, 0xA3, 0x2D, 0x0A, 0xB4, 0x20, 0x1B, 0x02 },
+    { 0x7D, 0x9A, 0xF1, 0x92, 0xCD, 0xA7, 0x2A, 0xD6, 0xB2, 0x04, 0x71, 0xB5,
+      0x5E, 0xC7, 0xF4, 0xDB, 0x74, 0x33, 0xAA, 0xCD, 0x8D, 0xC6, 0xB2, 0x9D,
+      0xC3, 0xDF, 0x62, 0x73, 0xFA, 0x15, 0xAB, 0x3F, 0xCC, 0xAC, 0x51, 0x04 },
+    { 0xDC, 0xD5, 0xC4, 0xFD, 0x95, 0x68, 0x0A, 0x23, 0xA3, 0x4B, 0x2F, 0x7C,
+      0x9B, 0x62, 0x1D, 0x0D, 0x99, 0x51, 0x34, 0xF7, 0x27, 0x1D, 0xC8, 0x2B,
+      0x9C, 0x6F, 0x59, 0xA3, 0xE1, 0x26, 0x57, 0x61, 0x8F, 0x33, 0x5A, 0x02 },
+    { 0x6D, 0x5A, 0x78, 0xF1, 0xE2, 0xDC, 0xBA, 0x81, 0x9D, 0x14, 0x13, 0x2E,
+      0xEA, 0xC0, 0x01, 0xAA, 0x19, 0xC0, 0x36, 0x7C, 0xE4, 0x1A, 0x44, 0x8D,
+      0x00, 0xBC, 0x8F, 0xBA, 0x61, 0x30, 0xF4, 0xC3, 0x61, 0xFF, 0xC2, 0x06 },
+    { 0x9C, 0x45, 0x81, 0x4E, 0x65, 0xF1, 0xC6, 0x8E, 0xC6, 0x34, 0x72, 0xD0,
+      0xD3, 0xD1, 0x10, 0x28, 0xA1, 0x22, 0x0C, 0x4D, 0xE2, 0xD6, 0xA7, 0x48,
+      0x30, 0x14, 0x12, 0x4C, 0x74, 0x96, 0x64, 0x51, 0x71, 0x5D, 0x5E, 0x03 },
+    { 0x3B, 0x89, 0x26, 0xB0, 0xD8, 0x7E, 0x44, 0x6A, 0x24, 0xEF, 0xD0, 0x4E,
+      0xA4, 0xDB, 0xCB, 0x34, 0x4E, 0x40, 0xF2, 0xCD, 0x4D, 0xCF, 0x8E, 0x6D,
+      0xF4, 0x2F, 0x8B, 0xC9, 0x5E, 0x4D, 0xCC, 0x99, 0x2E, 0xA1, 0xD9, 0x04 },
+    { 0x77, 0x81, 0x3B, 0xBB, 0xB5, 0x86, 0xA8, 0x86, 0xBE, 0x93, 0xEF, 0xFF,
+      0x1F, 0xF3, 0xA4, 0xC7, 0xB6, 0x80, 0x81, 0x5D, 0xB0, 0x0B, 0xA5, 0x56,
+      0x61, 0xBF, 0x0C, 0x49, 0x5D, 0x10, 0xF9, 0x36, 0xCD, 0xA4, 0x1B, 0x02 },
+    { 0x90, 0x3B, 0x92, 0x73, 0x3E, 0x1E, 0x90, 0xB1, 0xF1, 0xB9, 0xFD, 0xB3,
+      0x6D, 0xA1, 0x23, 0x96, 0x68, 0x33, 0xD2, 0x62, 0x15, 0xF7, 0x06, 0x36,
+      0x7C, 0x3A, 0x9B, 0x30, 0x78, 0x0A, 0x1F, 0xD5, 0xF8, 0x1E, 0x88, 0x00 },
+    { 0x51, 0x78, 0x95, 0x8B, 0x6B, 0x78, 0x65, 0xB5, 0xF1, 0xB5, 0x7F, 0xFD,
+      0x79, 0x29, 0x3E, 0x04, 0xD3, 0x80, 0x3C, 0xA1, 0x71, 0x6D, 0xE8, 0x43,
+      0x89, 0xA3, 0x0A, 0xF3, 0xE5, 0x3E, 0xB9, 0x9A, 0xF9, 0xD1, 0x97, 0x03 },
+    { 0x90, 0x5C, 0xFC, 0x62, 0x92, 0x63, 0x5D, 0x4F, 0x95, 0x46, 0xF5, 0xD0,
+      0x8E, 0xDB, 0xCE, 0x78, 0x21, 0x51, 0x57, 0xC2, 0xA6, 0x65, 0xDF, 0xD4,
+      0x1B, 0x1C, 0xC6, 0x15, 0x56, 0x37, 0x05, 0x83, 0x34, 0x69, 0x83, 0x06 },
+    { 0xDE, 0x62, 0x4C, 0x93, 0xF0, 0x54, 0xBF, 0xA5, 0x84, 0x2B, 0x82, 0x8F,
+      0x60, 0xE2, 0xAD, 0x8F, 0xB7, 0xD1, 0x6F, 0xFF, 0xFC, 0x0C, 0x1D, 0x69,
+      0x6F, 0x74, 0x7E, 0x22, 0x43, 0xC8, 0x23, 0x1D, 0xAF, 0x62, 0x0F, 0x07 },
+    { 0x97, 0x5E, 0x4B, 0xA5, 0x0E, 0x67, 0xF0, 0x29, 0xB9, 0x9D, 0x56, 0x84,
+      0xF4, 0xF0, 0x50, 0xB4, 0x0C, 0x91, 0x27, 0xB9, 0xBA, 0xB4, 0xC6, 0x51,
+      0xE7, 0xC9, 0xD2, 0x8D, 0x50, 0xD6, 0xDE, 0x5D, 0x33, 0xC6, 0x14, 0x05 },
+    { 0x56, 0x90, 0xE4, 0x2F, 0xEC, 0x1B, 0xCC, 0x65, 0x3B, 0x9A, 0x17, 0x2C,
+      0xFE, 0xD0, 0xAB, 0x5C, 0x03, 0x40, 0x30, 0x53, 0x5B, 0xC4, 0x5C, 0x0F,
+      0xE0, 0xB3, 0x2C, 0x4E, 0x73, 0x10, 0x73, 0x11, 0x05, 0x00, 0x00, 0x00 },
+    { 0x0C, 0xBD, 0x13, 0x73, 0x54, 0xB8, 0xB3, 0x2B, 0xE9, 0x83, 0xB4, 0x0A,
+      0xB6, 0x7E, 0xEC, 0xD4, 0x11, 0xD1, 0xCA, 0xA6, 0x11, 0xD9, 0x51, 0x9B,
+      0xF9, 0x5D, 0x37, 0xFB, 0x96, 0xC9, 0x39, 0xB3, 0x06, 0x74, 0xCD, 0x01 },
+    { 0x25, 0x66, 0xBD, 0x96, 0xCE, 0x2B, 0x0F, 0xF0, 0xB1, 0xAF, 0xF9, 0x80,
+      0xAE, 0x78, 0xF6, 0x9F, 0x92, 0x80, 0x3E, 0xE8, 0xE4, 0x49, 0xED, 0xD8,
+      0x2D, 0x64, 0x3B, 0xF7, 0x36, 0x26, 0xD8, 0x83, 0xF5, 0xDB, 0xD9, 0x04 },
+    { 0x2A, 0x07, 0x07, 0xC7, 0xD6, 0x6D, 0x9A, 0x7A, 0x0D, 0xAE, 0xAA, 0x61,
+      0x67, 0xC9, 0x99, 0x52, 0x8D, 0x11, 0x83, 0x44, 0x0B, 0x98, 0x5A, 0x05,
+      0xA8, 0xAC, 0x29, 0xC8, 0x5A, 0x16, 0x3E, 0x66, 0x9D, 0x32, 0x5A, 0x02 },
+    { 0x70, 0x8A, 0xFE, 0x79, 0xD5, 0x3C, 0x8A, 0x93, 0x0E, 0x2D, 0x80, 0xF0,
+      0x3F, 0xAF, 0xB8, 0x96, 0x5C, 0x80, 0x89, 0x79, 0xC4, 0x17, 0x5D, 0xA5,
+      0x94, 0x02, 0xA0, 0xB2, 0x2A, 0xBA, 0x28, 0xBD, 0x12, 0x3D, 0x97, 0x03 },
+    { 0xA2, 0xB3, 0x28, 0xC5, 0x72, 0x11, 0x02, 0x82, 0x1B, 0xAE, 0x78, 0x81,
+      0xD9, 0x8D, 0xAC, 0x63, 0x68, 0x22, 0xF9, 0x9F, 0xE6, 0x95, 0xD9, 0x57,
+      0x7F, 0x88, 0x77, 0xF2, 0x5F, 0x91, 0x0D, 0x76, 0xFD, 0x6B, 0x45, 0x01 },
+    { 0x38, 0xBE, 0x9C, 0xA3, 0x93, 0xCE, 0x85, 0xCE, 0x51, 0x20, 0xF5, 0x08,
+      0x9C, 0xE0, 0xFA, 0x70, 0x3D, 0xC0, 0xC9, 0x44, 0xFF, 0x51, 0x04, 0x0A,
+      0xF0, 0x6F, 0x3A, 0xCC, 0x30, 0x00, 0x1F, 0xAE, 0x6A, 0x66, 0x8C, 0x01 },
+    { 0xBE, 0x08, 0x65, 0x41, 0x46, 0x49, 0x33, 0x28, 0xB0, 0xFF, 0x93, 0xED,
+      0x73, 0x9F, 0xDB, 0x83, 0x08, 0xA2, 0xAA, 0xAB, 0xE2, 0x71, 0xA3, 0xD2,
+      0x99, 0x80, 0xD4, 0xCA, 0x21, 0x6F, 0x79, 0x30, 0xD1, 0x65, 0x0B, 0x06 },
+    { 0x8C, 0x88, 0x3A, 0x4B, 0x92, 0x5E, 0x96, 0x76, 0xFC, 0x20, 0x1F, 0x43,
+      0x19, 0xDB, 0xE8, 0x15, 0x9F, 0xB3, 0x89, 0xAF, 0x25, 0x5F, 0xC4, 0xF5,
+      0xD1, 0x37, 0x7B, 0x20, 0x45, 0xE3, 0x6E, 0x8A, 0x56, 0x78, 0xC6, 0x07 },
+    { 0xE8, 0x34, 0x8A, 0xBF, 0xA4, 0x4F, 0x67, 0xB2, 0x36, 0x94, 0x2D, 0x4E,
+      0xD4, 0xBB, 0xFA, 0x2F, 0x29, 0x40, 0x03, 0xBE, 0x60, 0x0D, 0x22, 0x45,
+      0x2F, 0x94, 0x64, 0x65, 0x50, 0x95, 0x04, 0x10, 0x24, 0x49, 0x1B, 0x02 },
+    { 0xC7, 0xC4, 0x55, 0xB8, 0xB3, 0xF0, 0x1C, 0x0C, 0xD6, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0x09, 0xA1, 0x92, 0xE4, 0x4D, 0xFC, 0xC7, 0x9E, 0xC0, 0x97, 0x3A, 0xAF,
+      0xD9, 0x22, 0x8F, 0x6A, 0xC7, 0x51, 0x29, 0xB8, 0xD6, 0x9B, 0xC0, 0xCD,
+      0xA5, 0xB7, 0x6F, 0xE2, 0x96, 0xCF, 0xC4, 0x44, 0xFF, 0xBD, 0x14, 0x05 },
+    { 0xA0, 0x28, 0xDB, 0xCC, 0x53, 0xD6, 0x9A, 0x6E, 0xFD, 0xB1, 0x9F, 0x15,
+      0x4E, 0x23, 0xA3, 0xCF, 0xFA, 0x00, 0x1B, 0x6C, 0x3F, 0xD1, 0x07, 0x03,
+      0x54, 0x7A, 0x9D, 0x3F, 0xEE, 0xFF, 0x63, 0x46, 0xEE, 0x7E, 0x00, 0x00 },
+    { 0xA1, 0x46, 0x0D, 0xAC, 0xBF, 0x89, 0xDB, 0x80, 0xCD, 0x53, 0x81, 0xB1,
+      0x95, 0x04, 0xBF, 0x3F, 0x18, 0xA2, 0x26, 0xB1, 0x07, 0xE3, 0xBE, 0x5D,
+      0x95, 0x3A, 0xFA, 0x8F, 0x17, 0x8E, 0xBD, 0x40, 0xBC, 0xAC, 0x10, 0x04 },
+    { 0x42, 0x8E, 0x19, 0xB1, 0xB4, 0xB0, 0xD0, 0xEE, 0xBF, 0xFD, 0xC8, 0x91,
+      0x7E, 0x66, 0x94, 0xEF, 0x89, 0x33, 0x6B, 0xAA, 0x59, 0xE8, 0xC1, 0x52,
+      0x41, 0x2E, 0x9D, 0x1A, 0xBE, 0x69, 0x06, 0x0F, 0x58, 0x1A, 0x4A, 0x06 },
+    { 0xE8, 0xD2, 0x8B, 0xD4, 0xE8, 0x33, 0xBD, 0x0F, 0x6E, 0x95, 0x45, 0xE3,
+      0xBA, 0x99, 0x8E, 0x2B, 0xF1, 0xE2, 0x56, 0x77, 0x0A, 0x8D, 0xC3, 0xC4,
+      0x5A, 0x08, 0x35, 0x99, 0xCE, 0x91, 0x2C, 0x62, 0x3A, 0x1B, 0x0B, 0x06 },
+    { 0x39, 0x79, 0x5C, 0x3C, 0xD5, 0xD3, 0xA9, 0x12, 0x4F, 0xFE, 0x3C, 0x50,
+      0x32, 0x49, 0x54, 0x29, 0x2B, 0xA2, 0xBC, 0xF7, 0x5B, 0x91, 0x98, 0xA7,
+      0x20, 0xD0, 0xC1, 0x07, 0xE1, 0x8E, 0x82, 0xA6, 0xC6, 0x87, 0x87, 0x07 },
+    { 0xFF, 0xD3, 0x77, 0x2D, 0x45, 0xD2, 0x17, 0x23, 0xBA, 0xB8, 0x6D, 0x70,
+      0x7F, 0x11, 0x09, 0x48, 0x01, 0x11, 0xEE, 0xA2, 0x4C, 0x07, 0xB8, 0x3F,
+      0x0E, 0xCB, 0x72, 0x6B, 0x1E, 0xD8, 0xDA, 0x2B, 0x62, 0xC6, 0x14, 0x05 },
+    { 0x15, 0x1F, 0x20, 0x0B, 0x05, 0x36, 0x78, 0x68, 0x01, 0x6F, 0x27, 0x6E,
+      0x61, 0x95, 0x30, 0x28, 0x3F, 0xB3, 0xEB, 0xF7, 0xE9, 0xE3, 0x64, 0x04,
+      0x20, 0x91, 0x91, 0x53, 0xE3, 0x79, 0xFF, 0x39, 0x95, 0xBE, 0x51, 0x04 },
+    { 0x21, 0x34, 0x56, 0xAE, 0x6C, 0x80, 0x53, 0x7E, 0x40, 0xB7, 0xF5, 0xDC,
+      0x1D, 0x1D, 0x18, 0x78, 0x0F, 0xA2, 0x70, 0xA0, 0x09, 0x9E, 0xD7, 0x1E,
+      0x4F, 0x0B, 0xB6, 0x9C, 0x8B, 0xEC, 0xB7, 0x46, 0xAB, 0xAD, 0x10, 0x04 },
+    { 0x0D, 0x3D, 0xA9, 0x11, 0x66, 0x00, 0xC1, 0x37, 0x07, 0xE2, 0x0E, 0xC1,
+      0x83, 0xCF, 0x19, 0xE9, 0xF6, 0xD1, 0x2A, 0x09, 0xC3, 0xE6, 0x8D, 0x83,
+      0x0E, 0xBB, 0x8D, 0xEA, 0x8C, 0x85, 0xDD, 0xC9, 0x90, 0x8E, 0xCD, 0x01 },
+    { 0x99, 0x50, 0x5A, 0xAF, 0x45, 0x62, 0xF8, 0xD8, 0xAC, 0x00, 0x88, 0xE2,
+      0xC5, 0x58, 0x95, 0xB3, 0xFA, 0x62, 0x17, 0x79, 0x0A, 0xE9, 0xF1, 0x8A,
+      0x28, 0xFC, 0x68, 0x42, 0x28, 0xE5, 0x80, 0xE5, 0x08, 0xB0, 0x9C, 0x05 },
+    { 0x8D, 0xE7, 0xB1, 0x46, 0x6A, 0xC4, 0x12, 0xD1, 0xEE, 0x22, 0xED, 0xC9,
+      0x0E, 0x24, 0x65, 0xE7, 0x75, 0xD1, 0x04, 0x46, 0x70, 0xFC, 0xA8, 0x81,
+      0x30, 0x79, 0xFF, 0xFB, 0x47, 0xB2, 0xB5, 0xD2, 0x00, 0xE7, 0xCD, 0x01 },
+    { 0xA3, 0x3F, 0xF5, 0xC3, 0x0C, 0x46, 0x3D, 0x40, 0x71, 0x25, 0xA6, 0xD5,
+      0x3A, 0x6B, 0x9E, 0x6A, 0x10, 0x80, 0x30, 0x6B, 0x1E, 0x86, 0x60, 0x3B,
+      0x13, 0x9A, 0x86, 0xFC, 0xDB, 0xAB, 0xC6, 0x0B, 0x7C, 0xD1, 0x55, 0x05 },
+    { 0xEF, 0x5C, 0x61, 0xCD, 0xDF, 0x25, 0xD8, 0xFE, 0x55, 0xDB, 0x2F, 0x32,
+      0xB4, 0x9E, 0x17, 0x22, 0x1A, 0x80, 0xEF, 0x52, 0x06, 0xFF, 0x13, 0x51,
+      0xBB, 0x7A, 0x7E, 0x58, 0xEA, 0x7A, 0x81, 0xA9, 0x75, 0xE7, 0x8C, 0x01 },
+    { 0xD7, 0x8D, 0x56, 0x7F, 0x71, 0xD4, 0x51, 0x71, 0xFD, 0x10, 0xB5, 0x2F,
+      0x51, 0x56, 0x7D, 0xC8, 0x3B, 0x22, 0xAB, 0xB6, 0x0C, 0x53, 0xF7, 0xA2,
+      0xAC, 0x42, 0x85, 0x16, 0x01, 0x77, 0x9A, 0x20, 0xDC, 0xE5, 0x0B, 0x06 },
+    { 0x97, 0x18, 0x44, 0x04, 0xE8, 0x1B, 0x63, 0x4F, 0x73, 0x17, 0xD4, 0xDD,
+      0xFB, 0x91, 0xBA, 0x4A, 0xAD, 0x33, 0x82, 0xA0, 0xA7, 0x64, 0x1C, 0xAD,
+      0xC8, 0xFD, 0x68, 0x68, 0xC9, 0x0A, 0xB8, 0x77, 0x53, 0x83, 0x04, 0x01 },
+    { 0xB4, 0xDD, 0x57, 0x7E, 0x71, 0x8F, 0x64, 0xCA, 0x24, 0x1E, 0x89, 0x96,
+      0xAC, 0x10, 0xEF, 0x28, 0xEB, 0xB3, 0x4C, 0xCF, 0x9E, 0x8A, 0x2F, 0xED,
+      0xF8, 0xA5, 0x1E, 0x2B, 0xE4, 0x80, 0x13, 0x18, 0x25, 0x41, 0x51, 0x04 },
+    { 0xC8, 0x47, 0xA6, 0x2E, 0xAF, 0x9D, 0xFA, 0xEB, 0xE5, 0x24, 0x40, 0x3D,
+      0x94, 0xC2, 0x0B, 0x73, 0xF0, 0x80, 0xE6, 0x66, 0x72, 0xE3, 0xEB, 0xA2,
+      0x4E, 0xC7, 0xD2, 0xA3, 0x9D, 0xD0, 0x50, 0x22, 0xAA, 0x7E, 0x00, 0x00 },
+    { 0x5D, 0xC5, 0xAE, 0x8B, 0x5A, 0x67, 0x60, 0x0C, 0xCB, 0x73, 0x88, 0xF2,
+      0x4E, 0x96, 0xA5, 0xD6, 0xF1, 0x51, 0x76, 0x72, 0x08, 0x0B, 0x14, 0x33,
+      0x28, 0x6D, 0x58, 0x43, 0x1C, 0x53, 0xCD, 0x77, 0xD9, 0xA0, 0x5A, 0x02 },
+    { 0xD6, 0xCB, 0xBB, 0x9B, 0x05, 0x69, 0x38, 0xEA, 0x26, 0x07, 0x09, 0xD3,
+      0x8E, 0x9D, 0x9D, 0x38, 0xAA, 0x80, 0x4E, 0x3C, 0x57, 0x68, 0x5F, 0x33,
+      0x26, 0x13, 0x27, 0x11, 0xDC, 0xA3, 0x2D, 0x0A, 0xB4, 0x20, 0x1B, 0x02 },
+    { 0x89, 0x99, 0xE3, 0xE0, 0x1F, 0xF0, 0xAD, 0x0F, 0x49, 0x69, 0xF2, 0x20,
+      0x98, 0xE6, 0xBC, 0x9B, 0xEB, 0x51, 0xB3, 0x1F, 0x77, 0x12, 0x5C, 0xC5,
+      0x47, 0x7E, 0x5C, 0x58, 0x53, 0x74, 0xC1, 0x78, 0x8E, 0xB9, 0x14, 0x05 },
+    { 0x7D, 0x9A, 0xF1, 0x92, 0xCD, 0xAF, 0x2A, 0xD6, 0xB2, 0x04, 0x71, 0xB5,
+      0x5E, 0xC7, 0xF4, 0xDB, 0x74, 0x33, 0xAA, 0xCD, 0x8D, 0xC6, 0xB2, 0x9D,
+      0xC3, 0xDF, 0x62, 0x73, 0xFA, 0x15, 0xAB, 0x3F, 0xCC, 0xAC, 0x51, 0x04 },
+    { 0x86, 0xF8, 0x1B, 0x10, 0x91, 0x5F, 0x2B, 0xA4, 0xFF, 0x23, 0x07, 0x44,
+      0xB0, 0x95, 0x75, 0x01, 0xC3, 0xC0, 0x4E, 0xD3, 0x7A, 0x2F, 0x5C, 0x55,
+      0xB6, 0x6C, 0xB9, 0x4A, 0x4F, 0x93, 0x7F, 0xD0, 0xD0, 0x55, 0x97, 0x03 },
+    { 0xDC, 0xD5, 0xC4, 0xFD, 0x95, 0x78, 0x0A, 0x23, 0xA3, 0x4B, 0x2F, 0x7C,
+      0x9B, 0x62, 0x1D, 0x0D, 0x99, 0x51, 0x34, 0xF7, 0x27, 0x1D, 0xC8, 0x2B,
+      0x9C, 0x6F, 0x59, 0xA3, 0xE1, 0x26, 0x57, 0x61, 0x8F, 0x33, 0x5A, 0x02 },
+    { 0xD0, 0xE9, 0x90, 0x87, 0x44, 0x4E, 0x45, 0xC0, 0x2F, 0x12, 0xFC, 0x11,
+      0xCA, 0xF4, 0x09, 0x8B, 0x53, 0x40, 0xAE, 0x4D, 0xDF, 0x17, 0x80, 0x27,
+      0x7B, 0xF2, 0xFC, 0xF4, 0xFB, 0xE8, 0x4F, 0xE0, 0x03, 0x70, 0x8C, 0x01 },
+    { 0x6D, 0x5A, 0x78, 0xF1, 0xE2, 0xFC, 0xBA, 0x81, 0x9D, 0x14, 0x13, 0x2E,
+      0xEA, 0xC0, 0x01, 0xAA, 0x19, 0xC0, 0x36, 0x7C, 0xE4, 0x1A, 0x44, 0x8D,
+      0x00, 0xBC, 0x8F, 0xBA, 0x61, 0x30, 0xF4, 0xC3, 0x61, 0xFF, 0xC2, 0x06 },
+    { 0xF0, 0x33, 0x8A, 0x75, 0xB2, 0x40, 0xF6, 0x28, 0x61, 0x20, 0x2A, 0xC6,
+      0xE2, 0x1F, 0x83, 0x49, 0xBA, 0x40, 0x03, 0xD2, 0xB7, 0xB6, 0xFC, 0xD2,
+      0xBB, 0xE4, 0xFA, 0xDA, 0xC1, 0x17, 0x76, 0xB2, 0xEA, 0x0F, 0x8C, 0x01 },
+    { 0x9C, 0x45, 0x81, 0x4E, 0x65, 0xB1, 0xC6, 0x8E, 0xC6, 0x34, 0x72, 0xD0,
+      0xD3, 0xD1, 0x10, 0x28, 0xA1, 0x22, 0x0C, 0x4D, 0xE2, 0xD6, 0xA7, 0x48,
+      0x30, 0x14, 0x12, 0x4C, 0x74, 0x96, 0x64, 0x51, 0x71, 0x5D, 0x5E, 0x03 },
+    { 0xE5, 0xA1, 0xE8, 0x64, 0x9B, 0x18, 0xB2, 0x17, 0x54, 0x71, 0xFD, 0x91,
+      0x8B, 0xAA, 0x85, 0xB7, 0xBC, 0x91, 0xD1, 0x27, 0x83, 0xE7, 0xE9, 0x89,
+      0x1C, 0xF1, 0xDF, 0x21, 0x3E, 0xA4, 0x99, 0xF4, 0x8C, 0xD1, 0xD6, 0x03 },
+    { 0x3B, 0x89, 0x26, 0xB0, 0xD8, 0xFE, 0x44, 0x6A, 0x24, 0xEF, 0xD0, 0x4E,
+      0xA4, 0xDB, 0xCB, 0x34, 0x4E, 0x40, 0xF2, 0xCD, 0x4D, 0xCF, 0x8E, 0x6D,
+      0xF4, 0x2F, 0x8B, 0xC9, 0x5E, 0x4D, 0xCC, 0x99, 0x2E, 0xA1, 0xD9, 0x04 },
+    { 0x43, 0x44, 0xE3, 0x45, 0x55, 0x13, 0x0F, 0xD0, 0xA2, 0x22, 0x89, 0x57,
+      0x06, 0x9C, 0x30, 0x2E, 0x45, 0x33, 0x87, 0xA2, 0xEC, 0x9B, 0xF1, 0xDA,
+      0x9E, 0xBA, 0xFA, 0x88, 0x4D, 0xFC, 0x81, 0x4B, 0xAA, 0xE4, 0x4A, 0x06 },
+    { 0x77, 0x81, 0x3B, 0xBB, 0xB5, 0x86, 0xA9, 0x86, 0xBE, 0x93, 0xEF, 0xFF,
+      0x1F, 0xF3, 0xA4, 0xC7, 0xB6, 0x80, 0x81, 0x5D, 0xB0, 0x0B, 0xA5, 0x56,
+      0x61, 0xBF, 0x0C, 0x49, 0x5D, 0x10, 0xF9, 0x36, 0xCD, 0xA4, 0x1B, 0x02 },
+    { 0xE4, 0xC3, 0x9B, 0x11, 0xFD, 0x0C, 0x17, 0x8E, 0xD4, 0x7D, 0xE1, 0x1E,
+      0x72, 0x26, 0xBD, 0x31, 0xF2, 0x91, 0x85, 0x63, 0x93, 0x08, 0x18, 0x49,
+      0x47, 0xC2, 0xD3, 0xE2, 0x32, 0x44, 0x35, 0xBB, 0xEF, 0x46, 0xD6, 0x03 },
+    { 0x90, 0x3B, 0x92, 0x73, 0x3E, 0x1E, 0x92, 0xB1, 0xF1, 0xB9, 0xFD, 0xB3,
+      0x6D, 0xA1, 0x23, 0x96, 0x68, 0x33, 0xD2, 0x62, 0x15, 0xF7, 0x06, 0x36,
+      0x7C, 0x3A, 0x9B, 0x30, 0x78, 0x0A, 0x1F, 0xD5, 0xF8, 0x1E, 0x88, 0x00 },
+    { 0xBC, 0x13, 0xC6, 0xC2, 0xDC, 0x81, 0x2A, 0xEF, 0xC8, 0xC7, 0xB1, 0xEF,
+      0xDD, 0xAE, 0x94, 0x34, 0x9A, 0x80, 0x68, 0xBC, 0x8D, 0x1E, 0x61, 0xE7,
+      0xC7, 0x23, 0x2A, 0x73, 0x92, 0x11, 0x52, 0x01, 0xC2, 0x70, 0x4E, 0x07 },
+    { 0x51, 0x78, 0x95, 0x8B, 0x6B, 0x78, 0x61, 0xB5, 0xF1, 0xB5, 0x7F, 0xFD,
+      0x79, 0x29, 0x3E, 0x04, 0xD3, 0x80, 0x3C, 0xA1, 0x71, 0x6D, 0xE8, 0x43,
+      0x89, 0xA3, 0x0A, 0xF3, 0xE5, 0x3E, 0xB9, 0x9A, 0xF9, 0xD1, 0x97, 0x03 },
+    { 0x79, 0x40, 0x65, 0xE8, 0xB2, 0x2E, 0x1A, 0x3B, 0xE1, 0x1F, 0x3E, 0x11,
+      0xFA, 0x76, 0xE3, 0xCF, 0x17, 0x11, 0x0C, 0xFA, 0xA1, 0x34, 0x42, 0x91,
+      0xF2, 0x93, 0xA4, 0x55, 0xC6, 0x11, 0xE3, 0xBB, 0x6C, 0xA4, 0x98, 0x04 },
+    { 0x90, 0x5C, 0xFC, 0x62, 0x92, 0x63, 0x55, 0x4F, 0x95, 0x46, 0xF5, 0xD0,
+      0x8E, 0xDB, 0xCE, 0x78, 0x21, 0x51, 0x57, 0xC2, 0xA6, 0x65, 0xDF, 0xD4,
+      0x1B, 0x1C, 0xC6, 0x15, 0x56, 0x37, 0x05, 0x83, 0x34, 0x69, 0x83, 0x06 },
+    { 0x51, 0xF0, 0xEA, 0x49, 0x24, 0x69, 0x46, 0x0A, 0xBC, 0x8C, 0x56, 0xA7,
+      0x82, 0xF0, 0xCB, 0xE2, 0x3D, 0x80, 0xD4, 0xBE, 0xF6, 0xF1, 0x97, 0x11,
+      0xF4, 0x4B, 0xF3, 0xC2, 0x83, 0xA2, 0xA7, 0xCE, 0x05, 0xAE, 0x97, 0x03 },
+    { 0xDE, 0x62, 0x4C, 0x93, 0xF0, 0x54, 0xAF, 0xA5, 0x84, 0x2B, 0x82, 0x8F,
+      0x60, 0xE2, 0xAD, 0x8F, 0xB7, 0xD1, 0x6F, 0xFF, 0xFC, 0x0C, 0x1D, 0x69,
+      0x6F, 0x74, 0x7E, 0x22, 0x43, 0xC8, 0x23, 0x1D, 0xAF, 0x62, 0x0F, 0x07 },
+    { 0x1F, 0x6B, 0xC9, 0x2C, 0x16, 0x80, 0x05, 0x79, 0x70, 0x92, 0xAF, 0xD1,
+      0x3B, 0xF9, 0x53, 0x11, 0x49, 0x62, 0xCD, 0x29, 0xAA, 0xB2, 0x89, 0x81,
+      0x1D, 0x47, 0xC5, 0x2B, 0xFD, 0xDD, 0xF3, 0x22, 0xA3, 0xBF, 0x10, 0x04 },
+    { 0x97, 0x5E, 0x4B, 0xA5, 0x0E, 0x67, 0xD0, 0x29, 0xB9, 0x9D, 0x56, 0x84,
+      0xF4, 0xF0, 0x50, 0xB4, 0x0C, 0x91, 0x27, 0xB9, 0xBA, 0xB4, 0xC6, 0x51,
+      0xE7, 0xC9, 0xD2, 0x8D, 0x50, 0xD6, 0xDE, 0x5D, 0x33, 0xC6, 0x14, 0x05 },
+    { 0x07, 0x2B, 0x33, 0x01, 0xD0, 0xEF, 0x86, 0x47, 0xB3, 0xE2, 0xC3, 0x4C,
+      0xF2, 0x0E, 0x78, 0x75, 0xED, 0x00, 0x58, 0xD7, 0x8B, 0x64, 0xEE, 0x31,
+      0x4B, 0x43, 0x53, 0xF0, 0x6E, 0xC8, 0xF6, 0x8D, 0xCA, 0x99, 0x8C, 0x01 },
+    { 0x56, 0x90, 0xE4, 0x2F, 0xEC, 0x1B, 0x8C, 0x65, 0x3B, 0x9A, 0x17, 0x2C,
+      0xFE, 0xD0, 0xAB, 0x5C, 0x03, 0x40, 0x30, 0x53, 0x5B, 0xC4, 0x5C, 0x0F,
+      0xE0, 0xB3, 0x2C, 0x4E, 0x73, 0x10, 0x73, 0x11, 0x05, 0x00, 0x00, 0x00 },
+    { 0xE9, 0xB9, 0xC8, 0xA5, 0xCA, 0x28, 0xE2, 0xB4, 0x67, 0x32, 0x1F, 0x96,
+      0x9A, 0x83, 0xEE, 0xE8, 0x21, 0x22, 0x3A, 0xFC, 0x25, 0xFA, 0x2B, 0x6E,
+      0xAD, 0x10, 0x91, 0x5D, 0x6A, 0x47, 0x92, 0x6E, 0xDE, 0xA9, 0x10, 0x04 },
+    { 0x0C, 0xBD, 0x13, 0x73, 0x54, 0xB8, 0x33, 0x2B, 0xE9, 0x83, 0xB4, 0x0A,
+      0xB6, 0x7E, 0xEC, 0xD4, 0x11, 0xD1, 0xCA, 0xA6, 0x11, 0xD9, 0x51, 0x9B,
+      0xF9, 0x5D, 0x37, 0xFB, 0x96, 0xC9, 0x39, 0xB3, 0x06, 0x74, 0xCD, 0x01 },
+    { 0xBE, 0x0D, 0x58, 0x91, 0xE2, 0x9F, 0xF7, 0x6C, 0x22, 0x01, 0x4F, 0x02,
+      0xEF, 0xB1, 0x43, 0xCB, 0x29, 0xC0, 0x7B, 0xFE, 0x50, 0x8F, 0x62, 0xDC,
+      0x64, 0xF5, 0xDC, 0x8A, 0xCE, 0x9A, 0x57, 0x3B, 0x60, 0x04, 0x00, 0x00 },
+    { 0x25, 0x66, 0xBD, 0x96, 0xCE, 0x2B, 0x0F, 0xF1, 0xB1, 0xAF, 0xF9, 0x80,
+      0xAE, 0x78, 0xF6, 0x9F, 0x92, 0x80, 0x3E, 0xE8, 0xE4, 0x49, 0xED, 0xD8,
+      0x2D, 0x64, 0x3B, 0xF7, 0x36, 0x26, 0xD8, 0x83, 0xF5, 0xDB, 0xD9, 0x04 },
+    { 0xCF, 0x0F, 0xF1, 0xD9, 0xE5, 0xD4, 0xEF, 0xF1, 0xDD, 0x8B, 0x90, 0x46,
+      0xEE, 0xA5, 0xBC, 0xE0, 0xAE, 0x40, 0x9A, 0x4D, 0xF0, 0x4F, 0x7D, 0x99,
+      0x95, 0x56, 0x56, 0xDF, 0xB8, 0xC7, 0xB7, 0xC1, 0x97, 0xC6, 0x97, 0x03 },
+    { 0x2A, 0x07, 0x07, 0xC7, 0xD6, 0x6D, 0x9A, 0x78, 0x0D, 0xAE, 0xAA, 0x61,
+      0x67, 0xC9, 0x99, 0x52, 0x8D, 0x11, 0x83, 0x44, 0x0B, 0x98, 0x5A, 0x05,
+      0xA8, 0xAC, 0x29, 0xC8, 0x5A, 0x16, 0x3E, 0x66, 0x9D, 0x32, 0x5A, 0x02 },
+    { 0x29, 0x90, 0xBB, 0xBB, 0x01, 0x42, 0x30, 0xCB, 0x18, 0x15, 0xBF, 0x41,
+      0xB9, 0x93, 0xFD, 0x1D, 0xDE, 0x91, 0xC8, 0x4D, 0xD7, 0x98, 0x66, 0x1A,
+      0x61, 0x13, 0x26, 0x83, 0xCA, 0xFF, 0xFA, 0x1B, 0xF8, 0xF1, 0x0F, 0x07 },
+    { 0x70, 0x8A, 0xFE, 0x79, 0xD5, 0x3C, 0x8A, 0x97, 0x0E, 0x2D, 0x80, 0xF0,
+      0x3F, 0xAF, 0xB8, 0x96, 0x5C, 0x80, 0x89, 0x79, 0xC4, 0x17, 0x5D, 0xA5,
+      0x94, 0x02, 0xA0, 0xB2, 0x2A, 0xBA, 0x28, 0xBD, 0x12, 0x3D, 0x97, 0x03 },
+    { 0xD2, 0x73, 0xFC, 0xD8, 0x71, 0x1F, 0x2E, 0x2D, 0xFC, 0xC3, 0x03, 0x45,
+      0x53, 0xD9, 0xF4, 0x6B, 0x38, 0xA2, 0xBC, 0x04, 0xCC, 0x2A, 0x2D, 0x8B,
+      0x8A, 0xBC, 0x1A, 0xC5, 0x6F, 0x76, 0x27, 0xA9, 0xBF, 0x56, 0xD2, 0x02 },
+    { 0xA2, 0xB3, 0x28, 0xC5, 0x72, 0x11, 0x02, 0x8A, 0x1B, 0xAE, 0x78, 0x81,
+      0xD9, 0x8D, 0xAC, 0x63, 0x68, 0x22, 0xF9, 0x9F, 0xE6, 0x95, 0xD9, 0x57,
+      0x7F, 0x88, 0x77, 0xF2, 0x5F, 0x91, 0x0D, 0x76, 0xFD, 0x6B, 0x45, 0x01 },
+    { 0x3E, 0x98, 0x9D, 0xEC, 0x60, 0x87, 0x2A, 0x48, 0xA2, 0x12, 0xBE, 0x30,
+      0x70, 0x9F, 0xEF, 0xF9, 0x3F, 0xA2, 0x88, 0x18, 0x23, 0x01, 0x07, 0x92,
+      0x89, 0x1B, 0x73, 0xD6, 0x74, 0xF9, 0x70, 0x79, 0xE7, 0x60, 0x0B, 0x06 },
+    { 0x38, 0xBE, 0x9C, 0xA3, 0x93, 0xCE, 0x85, 0xDE, 0x51, 0x20, 0xF5, 0x08,
+      0x9C, 0xE0, 0xFA, 0x70, 0x3D, 0xC0, 0xC9, 0x44, 0xFF, 0x51, 0x04, 0x0A,
+      0xF0, 0x6F, 0x3A, 0xCC, 0x30, 0x00, 0x1F, 0xAE, 0x6A, 0x66, 0x8C, 0x01 },
+    { 0x23, 0x0F, 0xA3, 0x68, 0xF7, 0x67, 0x60, 0xEA, 0x95, 0x08, 0xC8, 0xB4,
+      0xAB, 0x44, 0xEC, 0xBA, 0x98, 0x80, 0xE2, 0xA3, 0xFF, 0x82, 0x2A, 0xF8,
+      0xFD, 0x84, 0x83, 0x17, 0x62, 0xE1, 0x9B, 0x60, 0xA9, 0xB8, 0x55, 0x05 },
+    { 0xBE, 0x08, 0x65, 0x41, 0x46, 0x49, 0x33, 0x08, 0xB0, 0xFF, 0x93, 0xED,
+      0x73, 0x9F, 0xDB, 0x83, 0x08, 0xA2, 0xAA, 0xAB, 0xE2, 0x71, 0xA3, 0xD2,
+      0x99, 0x80, 0xD4, 0xCA, 0x21, 0x6F, 0x79, 0x30, 0xD1, 0x65, 0x0B, 0x06 },
+    { 0x17, 0xA5, 0xD0, 0x27, 0x24, 0xA9, 0x74, 0xA5, 0x02, 0xCF, 0xC6, 0x2B,
+      0x58, 0x14, 0x2D, 0x95, 0x60, 0x51, 0x69, 0x0C, 0xBA, 0x9F, 0x8B, 0xBC,
+      0x6F, 0xB2, 0xED, 0x72, 0x33, 0x76, 0xA8, 0x3D, 0x1A, 0x9D, 0x0F, 0x07 },
+    { 0x8C, 0x88, 0x3A, 0x4B, 0x92, 0x5E, 0x96, 0x36, 0xFC, 0x20, 0x1F, 0x43,
+      0x19, 0xDB, 0xE8, 0x15, 0x9F, 0xB3, 0x89, 0xAF, 0x25, 0x5F, 0xC4, 0xF5,
+      0xD1, 0x37, 0x7B, 0x20, 0x45, 0xE3, 0x6E, 0x8A, 0x56, 0x78, 0xC6, 0x07 },
+    { 0xE9, 0x11, 0x83, 0x7D, 0xD8, 0x8A, 0x42, 0x4A, 0x5F, 0xC2, 0xAC, 0x20,
+      0x7E, 0x66, 0x7E, 0xC7, 0x61, 0x22, 0xC2, 0x2A, 0x64, 0x95, 0xC1, 0x23,
+      0x9D, 0x92, 0x31, 0x92, 0x45, 0x47, 0xF7, 0x18, 0xC2, 0xBB, 0x10, 0x04 },
+    { 0xE8, 0x34, 0x8A, 0xBF, 0xA4, 0x4F, 0x67, 0x32, 0x36, 0x94, 0x2D, 0x4E,
+      0xD4, 0xBB, 0xFA, 0x2F, 0x29, 0x40, 0x03, 0xBE, 0x60, 0x0D, 0x22, 0x45,
+      0x2F, 0x94, 0x64, 0x65, 0x50, 0x95, 0x04, 0x10, 0x24, 0x49, 0x1B, 0x02 },
+    { 0x8F, 0x1B, 0x66, 0x7A, 0xDB, 0xDF, 0x2C, 0x88, 0xEC, 0x6B, 0xCD, 0xA5,
+      0x9F, 0xC7, 0x05, 0x9C, 0x91, 0x91, 0xA3, 0xB5, 0x43, 0xF9, 0xE1, 0x4A,
+      0x34, 0x45, 0xB3, 0x9F, 0xDF, 0x38, 0x8F, 0xCC, 0xA9, 0x80, 0x83, 0x06 },
+    { 0xC7, 0xC4, 0x55, 0xB8, 0xB3, 0xF0, 0x1C, 0x0C, 0xD7, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x08, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0xB1, 0x8B, 0x36, 0x59, 0xCE, 0x70, 0xEA, 0xA6, 0x41, 0xA9, 0xF0, 0x16,
+      0x50, 0xB4, 0xF9, 0xF9, 0x7C, 0x33, 0xA3, 0xA1, 0x7A, 0x69, 0xA2, 0xEF,
+      0x4B, 0xA9, 0xBF, 0xDC, 0xEE, 0xC4, 0x89, 0x89, 0xC1, 0x9A, 0x88, 0x00 },
+    { 0x09, 0xA1, 0x92, 0xE4, 0x4D, 0xFC, 0xC7, 0x9E, 0xC2, 0x97, 0x3A, 0xAF,
+      0xD9, 0x22, 0x8F, 0x6A, 0xC7, 0x51, 0x29, 0xB8, 0xD6, 0x9B, 0xC0, 0xCD,
+      0xA5, 0xB7, 0x6F, 0xE2, 0x96, 0xCF, 0xC4, 0x44, 0xFF, 0xBD, 0x14, 0x05 },
+    { 0x09, 0x24, 0xB5, 0x12, 0x9B, 0x72, 0xE1, 0x94, 0x23, 0xFF, 0x28, 0x27,
+      0x7E, 0x95, 0x37, 0x20, 0x21, 0x33, 0x18, 0x81, 0xB6, 0xCE, 0x0E, 0x56,
+      0x74, 0x8C, 0x36, 0x2D, 0xE4, 0x7D, 0xF6, 0x24, 0xD2, 0xA7, 0x1F, 0x03 },
+    { 0xA0, 0x28, 0xDB, 0xCC, 0x53, 0xD6, 0x9A, 0x6E, 0xF9, 0xB1, 0x9F, 0x15,
+      0x4E, 0x23, 0xA3, 0xCF, 0xFA, 0x00, 0x1B, 0x6C, 0x3F, 0xD1, 0x07, 0x03,
+      0x54, 0x7A, 0x9D, 0x3F, 0xEE, 0xFF, 0x63, 0x46, 0xEE, 0x7E, 0x00, 0x00 },
+    { 0x75, 0xBF, 0x19, 0x87, 0x52, 0xF6, 0x01, 0xEF, 0x95, 0xF1, 0xF9, 0x0A,
+      0xF9, 0xE4, 0xB6, 0xAD, 0xAE, 0xC0, 0x02, 0x64, 0x6D, 0xE7, 0x4B, 0xDD,
+      0x44, 0x6A, 0x78, 0x0E, 0x76, 0x75, 0xC1, 0x3D, 0x9E, 0xBD, 0x55, 0x05 },
+    { 0xA1, 0x46, 0x0D, 0xAC, 0xBF, 0x89, 0xDB, 0x80, 0xC5, 0x53, 0x81, 0xB1,
+      0x95, 0x04, 0xBF, 0x3F, 0x18, 0xA2, 0x26, 0xB1, 0x07, 0xE3, 0xBE, 0x5D,
+      0x95, 0x3A, 0xFA, 0x8F, 0x17, 0x8E, 0xBD, 0x40, 0xBC, 0xAC, 0x10, 0x04 },
+    { 0xFE, 0xDA, 0x85, 0x32, 0x15, 0xC6, 0xD7, 0x86, 0x97, 0x10, 0x46, 0x92,
+      0xE1, 0xD9, 0x8E, 0xF6, 0x53, 0xD1, 0x96, 0xF3, 0x58, 0x70, 0xDE, 0xD3,
+      0x1F, 0x31, 0xEE, 0xCD, 0x23, 0x6E, 0x0B, 0x29, 0x17, 0x1D, 0x0F, 0x07 },
+    { 0x42, 0x8E, 0x19, 0xB1, 0xB4, 0xB0, 0xD0, 0xEE, 0xAF, 0xFD, 0xC8, 0x91,
+      0x7E, 0x66, 0x94, 0xEF, 0x89, 0x33, 0x6B, 0xAA, 0x59, 0xE8, 0xC1, 0x52,
+      0x41, 0x2E, 0x9D, 0x1A, 0xBE, 0x69, 0x06, 0x0F, 0x58, 0x1A, 0x4A, 0x06 },
+    { 0xD0, 0xC4, 0x36, 0x37, 0x54, 0xC3, 0x4A, 0xF5, 0xF1, 0xA2, 0xFC, 0x4A,
+      0x27, 0xBC, 0x9C, 0x1A, 0x7D, 0x22, 0xA7, 0x3C, 0x2B, 0xBA, 0xD9, 0x39,
+      0x77, 0x53, 0x05, 0x5A, 0x6B, 0x40, 0x55, 0x99, 0xE7, 0x11, 0x87, 0x07 },
+    { 0xE8, 0xD2, 0x8B, 0xD4, 0xE8, 0x33, 0xBD, 0x0F, 0x4E, 0x95, 0x45, 0xE3,
+      0xBA, 0x99, 0x8E, 0x2B, 0xF1, 0xE2, 0x56, 0x77, 0x0A, 0x8D, 0xC3, 0xC4,
+      0x5A, 0x08, 0x35, 0x99, 0xCE, 0x91, 0x2C, 0x62, 0x3A, 0x1B, 0x0B, 0x06 },
+    { 0x7F, 0xCB, 0xD8, 0x11, 0x7D, 0x76, 0xC5, 0xFB, 0x3D, 0x69, 0xE9, 0xE3,
+      0xFB, 0x35, 0xAD, 0xD2, 0xF4, 0x11, 0xA4, 0x6B, 0xCF, 0xCD, 0x2A, 0xBD,
+      0xBC, 0x08, 0x49, 0x8D, 0x89, 0x5B, 0xDD, 0x5F, 0xD9, 0xB8, 0x14, 0x05 },
+    { 0x39, 0x79, 0x5C, 0x3C, 0xD5, 0xD3, 0xA9, 0x12, 0x0F, 0xFE, 0x3C, 0x50,
+      0x32, 0x49, 0x54, 0x29, 0x2B, 0xA2, 0xBC, 0xF7, 0x5B, 0x91, 0x98, 0xA7,
+      0x20, 0xD0, 0xC1, 0x07, 0xE1, 0x8E, 0x82, 0xA6, 0xC6, 0x87, 0x87, 0x07 },
+    { 0x03, 0xB3, 0xC8, 0x0D, 0xE1, 0x20, 0xA7, 0xC2, 0x97, 0x8B, 0xEF, 0x91,
+      0xB9, 0x26, 0x19, 0xCB, 0xD0, 0x22, 0x3A, 0x04, 0xD2, 0x93, 0x4A, 0xF1,
+      0x6B, 0xB6, 0x2B, 0x8B, 0xC4, 0x81, 0x95, 0x08, 0x20, 0x82, 0x45, 0x01 },
+    { 0xFF, 0xD3, 0x77, 0x2D, 0x45, 0xD2, 0x17, 0x23, 0x3A, 0xB8, 0x6D, 0x70,
+      0x7F, 0x11, 0x09, 0x48, 0x01, 0x11, 0xEE, 0xA2, 0x4C, 0x07, 0xB8, 0x3F,
+      0x0E, 0xCB, 0x72, 0x6B, 0x1E, 0xD8, 0xDA, 0x2B, 0x62, 0xC6, 0x14, 0x05 },
+    { 0x57, 0x76, 0xA7, 0xE5, 0x7C, 0xA2, 0x52, 0x0B, 0x4A, 0xD6, 0xEC, 0xCB,
+      0x24, 0xEF, 0xA7, 0x0A, 0x2E, 0xE2, 0x25, 0x3A, 0xBB, 0x62, 0xBC, 0x00,
+      0x3D, 0xC0, 0x65, 0xC4, 0x26, 0x0A, 0xE3, 0x19, 0x8B, 0xA9, 0x10, 0x04 },
+    { 0x15, 0x1F, 0x20, 0x0B, 0x05, 0x36, 0x78, 0x68, 0x01, 0x6E, 0x27, 0x6E,
+      0x61, 0x95, 0x30, 0x28, 0x3F, 0xB3, 0xEB, 0xF7, 0xE9, 0xE3, 0x64, 0x04,
+      0x20, 0x91, 0x91, 0x53, 0xE3, 0x79, 0xFF, 0x39, 0x95, 0xBE, 0x51, 0x04 },
+    { 0x7A, 0x76, 0x82, 0xFC, 0x9F, 0x42, 0xBA, 0x57, 0x50, 0xB1, 0x02, 0x36,
+      0x11, 0xD7, 0xC1, 0x20, 0xC3, 0x51, 0x87, 0x1B, 0xC0, 0xF7, 0x0D, 0xD7,
+      0x51, 0xC6, 0xF3, 0xB2, 0x1A, 0xA2, 0x4C, 0xE4, 0xCD, 0x43, 0xD6, 0x03 },
+    { 0x21, 0x34, 0x56, 0xAE, 0x6C, 0x80, 0x53, 0x7E, 0x40, 0xB5, 0xF5, 0xDC,
+      0x1D, 0x1D, 0x18, 0x78, 0x0F, 0xA2, 0x70, 0xA0, 0x09, 0x9E, 0xD7, 0x1E,
+      0x4F, 0x0B, 0xB6, 0x9C, 0x8B, 0xEC, 0xB7, 0x46, 0xAB, 0xAD, 0x10, 0x04 },
+    { 0x92, 0x43, 0xF5, 0x00, 0x57, 0x5F, 0xA8, 0xC9, 0xB2, 0x62, 0x58, 0x23,
+      0x75, 0x4B, 0x7E, 0xFA, 0x0F, 0xD1, 0x34, 0xCE, 0x7F, 0x74, 0x0A, 0x96,
+      0xE8, 0x07, 0xE1, 0x95, 0xF4, 0xD9, 0x71, 0xFF, 0x14, 0x38, 0xD6, 0x03 },
+    { 0x0D, 0x3D, 0xA9, 0x11, 0x66, 0x00, 0xC1, 0x37, 0x07, 0xE6, 0x0E, 0xC1,
+      0x83, 0xCF, 0x19, 0xE9, 0xF6, 0xD1, 0x2A, 0x09, 0xC3, 0xE6, 0x8D, 0x83,
+      0x0E, 0xBB, 0x8D, 0xEA, 0x8C, 0x85, 0xDD, 0xC9, 0x90, 0x8E, 0xCD, 0x01 },
+    { 0x25, 0x63, 0xA8, 0x3D, 0x02, 0xA7, 0x20, 0xC7, 0xBA, 0xE6, 0x19, 0x85,
+      0x02, 0xC3, 0xF6, 0x6B, 0x0A, 0xE2, 0x6F, 0x40, 0x24, 0xEC, 0x8C, 0x83,
+      0x44, 0x4E, 0x27, 0x49, 0x6B, 0x3C, 0x83, 0xA9, 0xB3, 0xD6, 0xD2, 0x02 },
+    { 0x99, 0x50, 0x5A, 0xAF, 0x45, 0x62, 0xF8, 0xD8, 0xAC, 0x08, 0x88, 0xE2,
+      0xC5, 0x58, 0x95, 0xB3, 0xFA, 0x62, 0x17, 0x79, 0x0A, 0xE9, 0xF1, 0x8A,
+      0x28, 0xFC, 0x68, 0x42, 0x28, 0xE5, 0x80, 0xE5, 0x08, 0xB0, 0x9C, 0x05 },
+    { 0xA8, 0x8C, 0xF4, 0xA0, 0xFD, 0x48, 0x93, 0x84, 0x28, 0xBA, 0x9F, 0xFA,
+      0x68, 0xEE, 0x84, 0xBA, 0xEB, 0x33, 0xE3, 0x4B, 0x19, 0xA4, 0xD4, 0x4B,
+      0xEF, 0x85, 0xF6, 0xB0, 0x1C, 0x89, 0x01, 0x73, 0x34, 0x59, 0x1F, 0x03 },
+    { 0x8D, 0xE7, 0xB1, 0x46, 0x6A, 0xC4, 0x12, 0xD1, 0xEE, 0x32, 0xED, 0xC9,
+      0x0E, 0x24, 0x65, 0xE7, 0x75, 0xD1, 0x04, 0x46, 0x70, 0xFC, 0xA8, 0x81,
+      0x30, 0x79, 0xFF, 0xFB, 0x47, 0xB2, 0xB5, 0xD2, 0x00, 0xE7, 0xCD, 0x01 },
+    { 0xB8, 0xE4, 0x7C, 0x17, 0xE5, 0xC7, 0xE5, 0xA2, 0x69, 0x45, 0x42, 0x08,
+      0xD3, 0x00, 0x48, 0xEE, 0x25, 0xC0, 0x47, 0x14, 0xA2, 0x5F, 0xD6, 0x3D,
+      0xCD, 0xCF, 0xD2, 0x70, 0x93, 0x3E, 0x21, 0xDA, 0x28, 0x67, 0x8C, 0x01 },
+    { 0xA3, 0x3F, 0xF5, 0xC3, 0x0C, 0x46, 0x3D, 0x40, 0x71, 0x05, 0xA6, 0xD5,
+      0x3A, 0x6B, 0x9E, 0x6A, 0x10, 0x80, 0x30, 0x6B, 0x1E, 0x86, 0x60, 0x3B,
+      0x13, 0x9A, 0x86, 0xFC, 0xDB, 0xAB, 0xC6, 0x0B, 0x7C, 0xD1, 0x55, 0x05 },
+    { 0x3C, 0x86, 0xC9, 0xE3, 0xB1, 0x7E, 0xD8, 0x79, 0x07, 0xCE, 0xD2, 0x6E,
+      0x68, 0x45, 0x6B, 0x66, 0x98, 0xE2, 0x5B, 0x20, 0x57, 0x8F, 0x8F, 0xFD,
+      0x7E, 0x0A, 0xF4, 0x25, 0xA5, 0x13, 0x49, 0x41, 0x57, 0x15, 0x45, 0x01 },
+    { 0xEF, 0x5C, 0x61, 0xCD, 0xDF, 0x25, 0xD8, 0xFE, 0x55, 0x9B, 0x2F, 0x32,
+      0xB4, 0x9E, 0x17, 0x22, 0x1A, 0x80, 0xEF, 0x52, 0x06, 0xFF, 0x13, 0x51,
+      0xBB, 0x7A, 0x7E, 0x58, 0xEA, 0x7A, 0x81, 0xA9, 0x75, 0xE7, 0x8C, 0x01 },
+    { 0x69, 0xEA, 0x5A, 0x14, 0x60, 0x0B, 0xD6, 0x19, 0xA1, 0x69, 0xA4, 0x51,
+      0x28, 0xAD, 0x49, 0x01, 0xA1, 0xE2, 0xCC, 0xF3, 0x31, 0x86, 0xBA, 0xED,
+      0x02, 0x00, 0x77, 0xFB, 0x1B, 0x3D, 0x8F, 0x5E, 0x0F, 0x8D, 0x0B, 0x06 },
+    { 0xD7, 0x8D, 0x56, 0x7F, 0x71, 0xD4, 0x51, 0x71, 0xFD, 0x90, 0xB5, 0x2F,
+      0x51, 0x56, 0x7D, 0xC8, 0x3B, 0x22, 0xAB, 0xB6, 0x0C, 0x53, 0xF7, 0xA2,
+      0xAC, 0x42, 0x85, 0x16, 0x01, 0x77, 0x9A, 0x20, 0xDC, 0xE5, 0x0B, 0x06 },
+    { 0x43, 0x23, 0x85, 0x13, 0xE8, 0xDA, 0xB6, 0xDD, 0x3E, 0x01, 0x31, 0x10,
+      0xE3, 0x9E, 0xB8, 0x6F, 0x62, 0x51, 0x82, 0x26, 0xE6, 0x52, 0x55, 0x54,
+      0x3A, 0x11, 0x05, 0xB7, 0xAA, 0x6A, 0xDB, 0x42, 0x0F, 0x85, 0x41, 0x00 },
+    { 0x97, 0x18, 0x44, 0x04, 0xE8, 0x1B, 0x63, 0x4F, 0x73, 0x17, 0xD5, 0xDD,
+      0xFB, 0x91, 0xBA, 0x4A, 0xAD, 0x33, 0x82, 0xA0, 0xA7, 0x64, 0x1C, 0xAD,
+      0xC8, 0xFD, 0x68, 0x68, 0xC9, 0x0A, 0xB8, 0x77, 0x53, 0x83, 0x04, 0x01 },
+    { 0x3F, 0x90, 0xD8, 0x1C, 0x3D, 0xDF, 0x49, 0x1C, 0xA5, 0xE2, 0x87, 0x4E,
+      0x72, 0xF6, 0xD4, 0x7F, 0x03, 0xA2, 0x80, 0x2A, 0x67, 0x51, 0xA3, 0xE6,
+      0x0C, 0x1D, 0xF3, 0xA2, 0x29, 0xFD, 0xB7, 0x1A, 0xBF, 0xE0, 0x0B, 0x06 },
+    { 0xB4, 0xDD, 0x57, 0x7E, 0x71, 0x8F, 0x64, 0xCA, 0x24, 0x1E, 0x8B, 0x96,
+      0xAC, 0x10, 0xEF, 0x28, 0xEB, 0xB3, 0x4C, 0xCF, 0x9E, 0x8A, 0x2F, 0xED,
+      0xF8, 0xA5, 0x1E, 0x2B, 0xE4, 0x80, 0x13, 0x18, 0x25, 0x41, 0x51, 0x04 },
+    { 0x57, 0xDE, 0x4C, 0xD1, 0x47, 0xE1, 0x54, 0xCE, 0x14, 0xA1, 0x55, 0xBD,
+      0x8E, 0x63, 0x82, 0xCC, 0x00, 0xE2, 0xDD, 0x97, 0x55, 0x79, 0xAE, 0x13,
+      0xD2, 0x9E, 0x53, 0x32, 0xD4, 0xF2, 0xD2, 0x20, 0xFE, 0xAD, 0x10, 0x04 },
+    { 0xC8, 0x47, 0xA6, 0x2E, 0xAF, 0x9D, 0xFA, 0xEB, 0xE5, 0x24, 0x44, 0x3D,
+      0x94, 0xC2, 0x0B, 0x73, 0xF0, 0x80, 0xE6, 0x66, 0x72, 0xE3, 0xEB, 0xA2,
+      0x4E, 0xC7, 0xD2, 0xA3, 0x9D, 0xD0, 0x50, 0x22, 0xAA, 0x7E, 0x00, 0x00 },
+    { 0x11, 0xC8, 0xA6, 0xC9, 0xB6, 0x20, 0x35, 0x28, 0x80, 0xF0, 0x3D, 0x6C,
+      0xE3, 0x64, 0x61, 0x84, 0x92, 0xF3, 0x54, 0xFE, 0x2C, 0x92, 0x16, 0x5C,
+      0x04, 0x60, 0xAE, 0x57, 0x31, 0x04, 0x91, 0xE3, 0x79, 0xA8, 0x93, 0x02 },
+    { 0x5D, 0xC5, 0xAE, 0x8B, 0x5A, 0x67, 0x60, 0x0C, 0xCB, 0x73, 0x80, 0xF2,
+      0x4E, 0x96, 0xA5, 0xD6, 0xF1, 0x51, 0x76, 0x72, 0x08, 0x0B, 0x14, 0x33,
+      0x28, 0x6D, 0x58, 0x43, 0x1C, 0x53, 0xCD, 0x77, 0xD9, 0xA0, 0x5A, 0x02 },
+    { 0x2D, 0x84, 0x35, 0x32, 0x2D, 0x3B, 0xBF, 0x9E, 0x1C, 0x50, 0xA1, 0xEE,
+      0xCB, 0xB7, 0x7A, 0x5E, 0xC6, 0x11, 0xE3, 0xED, 0x66, 0x36, 0x4D, 0xEC,
+      0x8D, 0xEE, 0x39, 0x35, 0x1A, 0x3E, 0xF1, 0xAD, 0xF7, 0xC6, 0xD6, 0x03 },
+    { 0xD6, 0xCB, 0xBB, 0x9B, 0x05, 0x69, 0x38, 0xEA, 0x26, 0x07, 0x19, 0xD3,
+      0x8E, 0x9D, 0x9D, 0x38, 0xAA, 0x80, 0x4E, 0x3C, 0x57, 0x68, 0x5F, 0x33,
+      0x26, 0x13, 0x27, 0x11, 0xDC, 0xA3, 0x2D, 0x0A, 0xB4, 0x20, 0x1B, 0x02 },
+    { 0x19, 0xCD, 0xB8, 0x37, 0xEA, 0xA1, 0x7B, 0x13, 0x89, 0xD0, 0xDF, 0xF0,
+      0xA6, 0x41, 0x41, 0x8E, 0xAB, 0x00, 0xAC, 0xFC, 0xCC, 0x36, 0x2F, 0x39,
+      0x4D, 0x3F, 0x8C, 0x98, 0xF4, 0xA4, 0xF5, 0xD7, 0x86, 0xC6, 0x97, 0x03 },
+    { 0x89, 0x99, 0xE3, 0xE0, 0x1F, 0xF0, 0xAD, 0x0F, 0x49, 0x69, 0xD2, 0x20,
+      0x98, 0xE6, 0xBC, 0x9B, 0xEB, 0x51, 0xB3, 0x1F, 0x77, 0x12, 0x5C, 0xC5,
+      0x47, 0x7E, 0x5C, 0x58, 0x53, 0x74, 0xC1, 0x78, 0x8E, 0xB9, 0x14, 0x05 },
+    { 0x3A, 0x8C, 0xD1, 0x9C, 0xD7, 0xE5, 0x93, 0xC3, 0x8A, 0xD5, 0xA8, 0x05,
+      0xB4, 0xD2, 0x45, 0x13, 0x9B, 0x22, 0xE3, 0xD2, 0xC6, 0x17, 0x67, 0x9A,
+      0x41, 0xD4, 0xA3, 0x8F, 0x2D, 0xA6, 0x09, 0xED, 0x0E, 0x3B, 0xD2, 0x02 },
+    { 0x7D, 0x9A, 0xF1, 0x92, 0xCD, 0xAF, 0x2A, 0xD6, 0xB2, 0x04, 0x31, 0xB5,
+      0x5E, 0xC7, 0xF4, 0xDB, 0x74, 0x33, 0xAA, 0xCD, 0x8D, 0xC6, 0xB2, 0x9D,
+      0xC3, 0xDF, 0x62, 0x73, 0xFA, 0x15, 0xAB, 0x3F, 0xCC, 0xAC, 0x51, 0x04 },
+    { 0x0A, 0x93, 0x95, 0x9D, 0x80, 0x4E, 0xE6, 0x96, 0x6A, 0x97, 0x51, 0x6D,
+      0x5D, 0xCC, 0xAF, 0x5A, 0x71, 0xB3, 0xC3, 0x9A, 0x68, 0xBD, 0x8A, 0x3A,
+      0x66, 0x96, 0x50, 0x3A, 0x27, 0x97, 0x00, 0x5C, 0xB2, 0x64, 0x4A, 0x06 },
+    { 0x86, 0xF8, 0x1B, 0x10, 0x91, 0x5F, 0x2B, 0xA4, 0xFF, 0x23, 0x87, 0x44,
+      0xB0, 0x95, 0x75, 0x01, 0xC3, 0xC0, 0x4E, 0xD3, 0x7A, 0x2F, 0x5C, 0x55,
+      0xB6, 0x6C, 0xB9, 0x4A, 0x4F, 0x93, 0x7F, 0xD0, 0xD0, 0x55, 0x97, 0x03 },
+    { 0x6E, 0xE9, 0xD2, 0xC9, 0xAD, 0x6B, 0x33, 0xAE, 0x36, 0xCE, 0x1D, 0x31,
+      0x26, 0x08, 0xEB, 0x36, 0xEA, 0xE2, 0x4C, 0xF9, 0x21, 0x35, 0xA0, 0x78,
+      0x17, 0x52, 0x63, 0x20, 0x79, 0x05, 0x05, 0x90, 0x65, 0x79, 0x87, 0x07 },
+    { 0xDC, 0xD5, 0xC4, 0xFD, 0x95, 0x78, 0x0A, 0x23, 0xA3, 0x4B, 0x2F, 0x7D,
+      0x9B, 0x62, 0x1D, 0x0D, 0x99, 0x51, 0x34, 0xF7, 0x27, 0x1D, 0xC8, 0x2B,
+      0x9C, 0x6F, 0x59, 0xA3, 0xE1, 0x26, 0x57, 0x61, 0x8F, 0x33, 0x5A, 0x02 },
+    { 0xC0, 0xAD, 0x09, 0x2D, 0xAA, 0x54, 0xBD, 0x00, 0xCA, 0x32, 0x27, 0x79,
+      0x8B, 0x3D, 0xDE, 0x5B, 0x9F, 0x11, 0x73, 0xC4, 0x32, 0x0F, 0x15, 0xDC,
+      0xAD, 0xA5, 0xAB, 0x8B, 0xAF, 0x43, 0x23, 0x27, 0xCE, 0x66, 0x0F, 0x07 },
+    { 0xD0, 0xE9, 0x90, 0x87, 0x44, 0x4E, 0x45, 0xC0, 0x2F, 0x12, 0xFC, 0x13,
+      0xCA, 0xF4, 0x09, 0x8B, 0x53, 0x40, 0xAE, 0x4D, 0xDF, 0x17, 0x80, 0x27,
+      0x7B, 0xF2, 0xFC, 0xF4, 0xFB, 0xE8, 0x4F, 0xE0, 0x03, 0x70, 0x8C, 0x01 },
+    { 0x40, 0xF7, 0xA3, 0x95, 0x93, 0xBB, 0x4A, 0xD8, 0xC5, 0x10, 0x1B, 0x46,
+      0x1A, 0x9E, 0x51, 0x8B, 0x64, 0x11, 0x3D, 0x6C, 0xA5, 0x41, 0x52, 0xD0,
+      0x18, 0xAA, 0x6B, 0xC3, 0x33, 0xAC, 0x17, 0x60, 0x21, 0x18, 0x0F, 0x07 },
+    { 0x6D, 0x5A, 0x78, 0xF1, 0xE2, 0xFC, 0xBA, 0x81, 0x9D, 0x14, 0x13, 0x2A,
+      0xEA, 0xC0, 0x01, 0xAA, 0x19, 0xC0, 0x36, 0x7C, 0xE4, 0x1A, 0x44, 0x8D,
+      0x00, 0xBC, 0x8F, 0xBA, 0x61, 0x30, 0xF4, 0xC3, 0x61, 0xFF, 0xC2, 0x06 },
+    { 0x8C, 0xEF, 0x96, 0x03, 0x0B, 0x52, 0xB5, 0x65, 0x08, 0x33, 0xE7, 0x8F,
+      0x63, 0x13, 0x97, 0x62, 0x5F, 0xD1, 0x4C, 0x95, 0x61, 0x4B, 0xC6, 0xDE,
+      0xF2, 0x6A, 0x3A, 0xAE, 0xE6, 0xD6, 0x6A, 0xA7, 0x4E, 0x66, 0xCD, 0x01 },
+    { 0xF0, 0x33, 0x8A, 0x75, 0xB2, 0x40, 0xF6, 0x28, 0x61, 0x20, 0x2A, 0xCE,
+      0xE2, 0x1F, 0x83, 0x49, 0xBA, 0x40, 0x03, 0xD2, 0xB7, 0xB6, 0xFC, 0xD2,
+      0xBB, 0xE4, 0xFA, 0xDA, 0xC1, 0x17, 0x76, 0xB2, 0xEA, 0x0F, 0x8C, 0x01 },
+    { 0xAF, 0x0E, 0xF1, 0xC2, 0x78, 0xF0, 0xDF, 0x7E, 0x57, 0x0E, 0x3D, 0xF7,
+      0x39, 0xA8, 0x89, 0x5F, 0x34, 0xF3, 0xF3, 0x5B, 0x27, 0x97, 0xE9, 0x4F,
+      0x2A, 0x04, 0x74, 0xD2, 0xD1, 0xB9, 0xEF, 0x9E, 0x9D, 0x88, 0x88, 0x00 },
+    { 0x9C, 0x45, 0x81, 0x4E, 0x65, 0xB1, 0xC6, 0x8E, 0xC6, 0x34, 0x72, 0xC0,
+      0xD3, 0xD1, 0x10, 0x28, 0xA1, 0x22, 0x0C, 0x4D, 0xE2, 0xD6, 0xA7, 0x48,
+      0x30, 0x14, 0x12, 0x4C, 0x74, 0x96, 0x64, 0x51, 0x71, 0x5D, 0x5E, 0x03 },
+    { 0x9D, 0x27, 0x7A, 0x2C, 0xF0, 0x91, 0x83, 0xAF, 0xD5, 0x3F, 0x14, 0x35,
+      0x1A, 0x31, 0x3A, 0x29, 0xB6, 0x22, 0xD8, 0xEF, 0x58, 0x28, 0x14, 0x95,
+      0xB5, 0x74, 0x0A, 0xBC, 0xF7, 0x59, 0x85, 0x19, 0x4D, 0xD9, 0x5E, 0x03 },
+    { 0xE5, 0xA1, 0xE8, 0x64, 0x9B, 0x18, 0xB2, 0x17, 0x54, 0x71, 0xFD, 0xB1,
+      0x8B, 0xAA, 0x85, 0xB7, 0xBC, 0x91, 0xD1, 0x27, 0x83, 0xE7, 0xE9, 0x89,
+      0x1C, 0xF1, 0xDF, 0x21, 0x3E, 0xA4, 0x99, 0xF4, 0x8C, 0xD1, 0xD6, 0x03 },
+    { 0x46, 0x79, 0xC9, 0xF4, 0x1D, 0xB1, 0x8B, 0x15, 0x92, 0x86, 0x6E, 0x2D,
+      0x12, 0xBD, 0xCF, 0xFA, 0x59, 0x73, 0x84, 0x53, 0xE4, 0xBB, 0xC8, 0xAB,
+      0x52, 0x2A, 0x9E, 0x61, 0x67, 0xAF, 0x37, 0x9F, 0xDA, 0x1B, 0x88, 0x00 },
+    { 0x3B, 0x89, 0x26, 0xB0, 0xD8, 0xFE, 0x44, 0x6A, 0x24, 0xEF, 0xD0, 0x0E,
+      0xA4, 0xDB, 0xCB, 0x34, 0x4E, 0x40, 0xF2, 0xCD, 0x4D, 0xCF, 0x8E, 0x6D,
+      0xF4, 0x2F, 0x8B, 0xC9, 0x5E, 0x4D, 0xCC, 0x99, 0x2E, 0xA1, 0xD9, 0x04 },
+    { 0x85, 0x4B, 0xB9, 0xAD, 0x7C, 0xE7, 0xBD, 0x6D, 0x75, 0x33, 0xC0, 0x36,
+      0x03, 0x60, 0xB8, 0x27, 0x5A, 0xE2, 0xB4, 0x16, 0xB0, 0xF7, 0x28, 0x5C,
+      0x47, 0x46, 0x65, 0x9E, 0x90, 0x3D, 0xCB, 0xDF, 0xAD, 0xC5, 0xD2, 0x02 },
+    { 0x43, 0x44, 0xE3, 0x45, 0x55, 0x13, 0x0F, 0xD0, 0xA2, 0x22, 0x89, 0xD7,
+      0x06, 0x9C, 0x30, 0x2E, 0x45, 0x33, 0x87, 0xA2, 0xEC, 0x9B, 0xF1, 0xDA,
+      0x9E, 0xBA, 0xFA, 0x88, 0x4D, 0xFC, 0x81, 0x4B, 0xAA, 0xE4, 0x4A, 0x06 },
+    { 0x4B, 0x22, 0x99, 0x65, 0xC0, 0x2D, 0xA2, 0x0F, 0xD7, 0x70, 0x2A, 0xE6,
+      0xA6, 0x0D, 0x2A, 0xC4, 0x08, 0x00, 0x5B, 0x04, 0x9B, 0x29, 0xD8, 0x83,
+      0x2B, 0x6B, 0x5A, 0x56, 0x4F, 0x95, 0xF8, 0x7A, 0x3E, 0xD0, 0x55, 0x05 },
+    { 0x77, 0x81, 0x3B, 0xBB, 0xB5, 0x86, 0xA9, 0x86, 0xBE, 0x93, 0xEF, 0xFF,
+      0x1E, 0xF3, 0xA4, 0xC7, 0xB6, 0x80, 0x81, 0x5D, 0xB0, 0x0B, 0xA5, 0x56,
+      0x61, 0xBF, 0x0C, 0x49, 0x5D, 0x10, 0xF9, 0x36, 0xCD, 0xA4, 0x1B, 0x02 },
+    { 0x22, 0x4D, 0xA6, 0xAE, 0x9D, 0x88, 0xC9, 0x8F, 0x76, 0x80, 0x4A, 0xC0,
+      0x73, 0xCD, 0x71, 0x77, 0xF1, 0x80, 0xE6, 0x06, 0x6B, 0x74, 0xFC, 0x9F,
+      0x8E, 0xB6, 0xCE, 0xF4, 0xAC, 0x84, 0x17, 0x77, 0xFE, 0x2B, 0x55, 0x05 },
+    { 0xE4, 0xC3, 0x9B, 0x11, 0xFD, 0x0C, 0x17, 0x8E, 0xD4, 0x7D, 0xE1, 0x1E,
+      0x70, 0x26, 0xBD, 0x31, 0xF2, 0x91, 0x85, 0x63, 0x93, 0x08, 0x18, 0x49,
+      0x47, 0xC2, 0xD3, 0xE2, 0x32, 0x44, 0x35, 0xBB, 0xEF, 0x46, 0xD6, 0x03 },
+    { 0x36, 0xD2, 0x14, 0xBC, 0xA8, 0x2E, 0x39, 0x86, 0xAD, 0xF1, 0x2E, 0x9D,
+      0x4B, 0x20, 0xF8, 0x41, 0xCD, 0x33, 0x6D, 0x63, 0x47, 0xB4, 0x5E, 0x7E,
+      0x4F, 0x90, 0x32, 0x19, 0x76, 0x01, 0x60, 0x11, 0x45, 0x10, 0x04, 0x01 },
+    { 0x90, 0x3B, 0x92, 0x73, 0x3E, 0x1E, 0x92, 0xB1, 0xF1, 0xB9, 0xFD, 0xB3,
+      0x69, 0xA1, 0x23, 0x96, 0x68, 0x33, 0xD2, 0x62, 0x15, 0xF7, 0x06, 0x36,
+      0x7C, 0x3A, 0x9B, 0x30, 0x78, 0x0A, 0x1F, 0xD5, 0xF8, 0x1E, 0x88, 0x00 },
+    { 0x7B, 0x91, 0x5E, 0x0A, 0x61, 0x1B, 0x0B, 0xD4, 0x35, 0x4D, 0x71, 0x58,
+      0x51, 0x87, 0x7A, 0xAB, 0x7D, 0x33, 0x62, 0x14, 0xC8, 0x92, 0x6D, 0x92,
+      0xC0, 0xCD, 0xE6, 0xB8, 0x88, 0xC7, 0xDA, 0xCD, 0x95, 0xCF, 0xDD, 0x05 },
+    { 0xBC, 0x13, 0xC6, 0xC2, 0xDC, 0x81, 0x2A, 0xEF, 0xC8, 0xC7, 0xB1, 0xEF,
+      0xD5, 0xAE, 0x94, 0x34, 0x9A, 0x80, 0x68, 0xBC, 0x8D, 0x1E, 0x61, 0xE7,
+      0xC7, 0x23, 0x2A, 0x73, 0x92, 0x11, 0x52, 0x01, 0xC2, 0x70, 0x4E, 0x07 },
+    { 0x20, 0x3D, 0x24, 0x23, 0x0F, 0x1A, 0xAA, 0x95, 0x15, 0xA1, 0x14, 0x01,
+      0xC9, 0x2B, 0xD9, 0x72, 0x7A, 0x62, 0x08, 0x17, 0x89, 0x41, 0x20, 0x88,
+      0xBC, 0xB9, 0x7B, 0x1A, 0x04, 0xA8, 0x13, 0x49, 0xEA, 0x72, 0x0B, 0x06 },
+    { 0x51, 0x78, 0x95, 0x8B, 0x6B, 0x78, 0x61, 0xB5, 0xF1, 0xB5, 0x7F, 0xFD,
+      0x69, 0x29, 0x3E, 0x04, 0xD3, 0x80, 0x3C, 0xA1, 0x71, 0x6D, 0xE8, 0x43,
+      0x89, 0xA3, 0x0A, 0xF3, 0xE5, 0x3E, 0xB9, 0x9A, 0xF9, 0xD1, 0x97, 0x03 },
+    { 0x53, 0x00, 0x98, 0x0A, 0xCD, 0xE4, 0x3A, 0xD8, 0x4B, 0x59, 0xA4, 0x1A,
+      0xC3, 0x6A, 0xCA, 0xE3, 0xA8, 0x62, 0x1A, 0x88, 0xD0, 0x9D, 0xEF, 0x74,
+      0x03, 0x36, 0x5A, 0xBE, 0x85, 0xF2, 0xEC, 0xC7, 0x47, 0xF6, 0xC9, 0x00 },
+    { 0x79, 0x40, 0x65, 0xE8, 0xB2, 0x2E, 0x1A, 0x3B, 0xE1, 0x1F, 0x3E, 0x11,
+      0xDA, 0x76, 0xE3, 0xCF, 0x17, 0x11, 0x0C, 0xFA, 0xA1, 0x34, 0x42, 0x91,
+      0xF2, 0x93, 0xA4, 0x55, 0xC6, 0x11, 0xE3, 0xBB, 0x6C, 0xA4, 0x98, 0x04 },
+    { 0x27, 0x1A, 0x92, 0x49, 0xCF, 0x63, 0x78, 0xB1, 0x80, 0x3A, 0x98, 0xF7,
+      0x3C, 0x82, 0x6F, 0xFE, 0xFC, 0xC0, 0x39, 0xC4, 0x67, 0x28, 0x94, 0x53,
+      0xB1, 0xD1, 0x57, 0x74, 0x04, 0xC7, 0xDA, 0xA6, 0x8D, 0xD5, 0x97, 0x03 },
+    { 0x90, 0x5C, 0xFC, 0x62, 0x92, 0x63, 0x55, 0x4F, 0x95, 0x46, 0xF5, 0xD0,
+      0xCE, 0xDB, 0xCE, 0x78, 0x21, 0x51, 0x57, 0xC2, 0xA6, 0x65, 0xDF, 0xD4,
+      0x1B, 0x1C, 0xC6, 0x15, 0x56, 0x37, 0x05, 0x83, 0x34, 0x69, 0x83, 0x06 },
+    { 0xF1, 0xBE, 0x68, 0x0B, 0x4A, 0xF6, 0xA8, 0x9D, 0xED, 0xE0, 0x3A, 0xE2,
+      0xBF, 0xD5, 0xB4, 0xBE, 0x87, 0x22, 0x3A, 0x03, 0xB4, 0x06, 0x72, 0xA9,
+      0x49, 0x2D, 0x9D, 0xA2, 0xAF, 0x12, 0x8C, 0x95, 0x22, 0xEA, 0x87, 0x07 },
+    { 0x51, 0xF0, 0xEA, 0x49, 0x24, 0x69, 0x46, 0x0A, 0xBC, 0x8C, 0x56, 0xA7,
+      0x02, 0xF0, 0xCB, 0xE2, 0x3D, 0x80, 0xD4, 0xBE, 0xF6, 0xF1, 0x97, 0x11,
+      0xF4, 0x4B, 0xF3, 0xC2, 0x83, 0xA2, 0xA7, 0xCE, 0x05, 0xAE, 0x97, 0x03 },
+    { 0xF4, 0x0E, 0x80, 0x92, 0xBB, 0x53, 0xDE, 0x7E, 0x88, 0x41, 0x49, 0x9E,
+      0x9E, 0x85, 0x8A, 0xEE, 0x77, 0x00, 0x00, 0x66, 0x5E, 0xC9, 0xB0, 0xC0,
+      0x52, 0xEA, 0xFB, 0x6A, 0xB2, 0x8F, 0x3F, 0x50, 0x3B, 0x0F, 0x4E, 0x07 },
+    { 0xDE, 0x62, 0x4C, 0x93, 0xF0, 0x54, 0xAF, 0xA5, 0x84, 0x2B, 0x82, 0x8F,
+      0x60, 0xE3, 0xAD, 0x8F, 0xB7, 0xD1, 0x6F, 0xFF, 0xFC, 0x0C, 0x1D, 0x69,
+      0x6F, 0x74, 0x7E, 0x22, 0x43, 0xC8, 0x23, 0x1D, 0xAF, 0x62, 0x0F, 0x07 },
+    { 0xAA, 0x33, 0x5B, 0x23, 0xD2, 0x98, 0xC1, 0x7E, 0x10, 0x34, 0x4F, 0x91,
+      0xD9, 0xCA, 0xAD, 0x6D, 0x76, 0xB3, 0xF0, 0x68, 0x30, 0x92, 0xF4, 0xDD,
+      0xD9, 0x2D, 0xBE, 0x34, 0x28, 0xE1, 0x22, 0x5B, 0xA7, 0x64, 0x4A, 0x06 },
+    { 0x1F, 0x6B, 0xC9, 0x2C, 0x16, 0x80, 0x05, 0x79, 0x70, 0x92, 0xAF, 0xD1,
+      0x3B, 0xFB, 0x53, 0x11, 0x49, 0x62, 0xCD, 0x29, 0xAA, 0xB2, 0x89, 0x81,
+      0x1D, 0x47, 0xC5, 0x2B, 0xFD, 0xDD, 0xF3, 0x22, 0xA3, 0xBF, 0x10, 0x04 },
+    { 0xE3, 0x6C, 0x5A, 0x14, 0xE9, 0x88, 0x7D, 0x69, 0x54, 0x08, 0xA4, 0xAB,
+      0xEF, 0x53, 0x01, 0x38, 0x2F, 0x33, 0xDC, 0x77, 0x36, 0x14, 0x4D, 0xEC,
+      0x3C, 0x17, 0x90, 0xF2, 0xFD, 0x47, 0x94, 0x53, 0xD3, 0xF2, 0x4A, 0x06 },
+    { 0x97, 0x5E, 0x4B, 0xA5, 0x0E, 0x67, 0xD0, 0x29, 0xB9, 0x9D, 0x56, 0x84,
+      0xF4, 0xF4, 0x50, 0xB4, 0x0C, 0x91, 0x27, 0xB9, 0xBA, 0xB4, 0xC6, 0x51,
+      0xE7, 0xC9, 0xD2, 0x8D, 0x50, 0xD6, 0xDE, 0x5D, 0x33, 0xC6, 0x14, 0x05 },
+    { 0xFF, 0x9D, 0x9D, 0xB8, 0xEE, 0xBE, 0xB3, 0x9D, 0xE6, 0xF6, 0xB8, 0x86,
+      0x0A, 0x3D, 0x40, 0x36, 0xBA, 0xB3, 0x43, 0x6A, 0x25, 0xE2, 0x4F, 0xF4,
+      0x65, 0x8D, 0x54, 0x49, 0x27, 0x79, 0xF7, 0x74, 0x44, 0x82, 0x04, 0x01 },
+    { 0x07, 0x2B, 0x33, 0x01, 0xD0, 0xEF, 0x86, 0x47, 0xB3, 0xE2, 0xC3, 0x4C,
+      0xF2, 0x06, 0x78, 0x75, 0xED, 0x00, 0x58, 0xD7, 0x8B, 0x64, 0xEE, 0x31,
+      0x4B, 0x43, 0x53, 0xF0, 0x6E, 0xC8, 0xF6, 0x8D, 0xCA, 0x99, 0x8C, 0x01 },
+    { 0xFF, 0xB8, 0x34, 0x96, 0xD9, 0x07, 0x31, 0x85, 0x13, 0x54, 0x22, 0x2F,
+      0xA2, 0x9A, 0x3D, 0x18, 0x08, 0xD1, 0x82, 0xC5, 0xF7, 0x5C, 0x97, 0x78,
+      0xF1, 0xF5, 0x1D, 0x25, 0xC2, 0xAA, 0xD9, 0x64, 0x67, 0x8B, 0x0F, 0x07 },
+    { 0x56, 0x90, 0xE4, 0x2F, 0xEC, 0x1B, 0x8C, 0x65, 0x3B, 0x9A, 0x17, 0x2C,
+      0xFE, 0xC0, 0xAB, 0x5C, 0x03, 0x40, 0x30, 0x53, 0x5B, 0xC4, 0x5C, 0x0F,
+      0xE0, 0xB3, 0x2C, 0x4E, 0x73, 0x10, 0x73, 0x11, 0x05, 0x00, 0x00, 0x00 },
+    { 0xC7, 0x83, 0x8F, 0xC3, 0x14, 0x58, 0x4E, 0xC5, 0x94, 0x10, 0x50, 0x5A,
+      0x03, 0x45, 0x6C, 0x9C, 0xCA, 0x73, 0x7A, 0x38, 0x46, 0x71, 0x9E, 0xAB,
+      0x2A, 0x23, 0x5E, 0xCE, 0x23, 0x76, 0xC8, 0xDA, 0x63, 0xF6, 0x88, 0x00 },
+    { 0xE9, 0xB9, 0xC8, 0xA5, 0xCA, 0x28, 0xE2, 0xB4, 0x67, 0x32, 0x1F, 0x96,
+      0x9A, 0xA3, 0xEE, 0xE8, 0x21, 0x22, 0x3A, 0xFC, 0x25, 0xFA, 0x2B, 0x6E,
+      0xAD, 0x10, 0x91, 0x5D, 0x6A, 0x47, 0x92, 0x6E, 0xDE, 0xA9, 0x10, 0x04 },
+    { 0x32, 0xC7, 0xEF, 0xAB, 0x05, 0xD1, 0x60, 0x62, 0x4C, 0x97, 0x2D, 0xCB,
+      0xF4, 0x73, 0x44, 0x5A, 0x18, 0x73, 0x76, 0xA2, 0x08, 0x57, 0xF1, 0x51,
+      0xC3, 0xBC, 0xBB, 0x5B, 0x92, 0xA7, 0x13, 0x83, 0xD6, 0x11, 0xC6, 0x07 },
+    { 0x0C, 0xBD, 0x13, 0x73, 0x54, 0xB8, 0x33, 0x2B, 0xE9, 0x83, 0xB4, 0x0A,
+      0xB6, 0x3E, 0xEC, 0xD4, 0x11, 0xD1, 0xCA, 0xA6, 0x11, 0xD9, 0x51, 0x9B,
+      0xF9, 0x5D, 0x37, 0xFB, 0x96, 0xC9, 0x39, 0xB3, 0x06, 0x74, 0xCD, 0x01 },
+    { 0xEC, 0x2D, 0x5C, 0x2A, 0xCA, 0xC5, 0xBF, 0xF9, 0x9A, 0x83, 0x5D, 0xDA,
+      0x8D, 0x18, 0x53, 0xD9, 0xF8, 0xA2, 0xF1, 0xE0, 0x5A, 0xAD, 0xCD, 0x5F,
+      0x1D, 0x6F, 0x2C, 0xF8, 0x06, 0x4F, 0x4F, 0xFA, 0x72, 0x60, 0xC9, 0x00 },
+    { 0xBE, 0x0D, 0x58, 0x91, 0xE2, 0x9F, 0xF7, 0x6C, 0x22, 0x01, 0x4F, 0x02,
+      0xEF, 0x31, 0x43, 0xCB, 0x29, 0xC0, 0x7B, 0xFE, 0x50, 0x8F, 0x62, 0xDC,
+      0x64, 0xF5, 0xDC, 0x8A, 0xCE, 0x9A, 0x57, 0x3B, 0x60, 0x04, 0x00, 0x00 },
+    { 0x66, 0x65, 0xC6, 0x63, 0xF0, 0x13, 0xF2, 0x85, 0x4D, 0x01, 0x83, 0x7F,
+      0xBE, 0x10, 0x48, 0x59, 0xAB, 0xD1, 0x6C, 0x4D, 0x54, 0x36, 0x0D, 0x9D,
+      0xA4, 0xA1, 0x4B, 0xDB, 0x22, 0x20, 0x3B, 0xC2, 0xA1, 0x4D, 0x98, 0x04 },
+    { 0x25, 0x66, 0xBD, 0x96, 0xCE, 0x2B, 0x0F, 0xF1, 0xB1, 0xAF, 0xF9, 0x80,
+      0xAE, 0x78, 0xF7, 0x9F, 0x92, 0x80, 0x3E, 0xE8, 0xE4, 0x49, 0xED, 0xD8,
+      0x2D, 0x64, 0x3B, 0xF7, 0x36, 0x26, 0xD8, 0x83, 0xF5, 0xDB, 0xD9, 0x04 },
+    { 0x96, 0x11, 0x7C, 0x25, 0xE2, 0x70, 0xF4, 0x34, 0x94, 0x67, 0x0C, 0x59,
+      0x3F, 0x7B, 0xAA, 0x0F, 0x15, 0xF3, 0x3A, 0x9F, 0x34, 0x9E, 0xF1, 0xF4,
+      0xE0, 0xF7, 0x89, 0xCF, 0x9E, 0x14, 0x32, 0x22, 0xCA, 0x27, 0x1F, 0x03 },
+    { 0xCF, 0x0F, 0xF1, 0xD9, 0xE5, 0xD4, 0xEF, 0xF1, 0xDD, 0x8B, 0x90, 0x46,
+      0xEE, 0xA5, 0xBE, 0xE0, 0xAE, 0x40, 0x9A, 0x4D, 0xF0, 0x4F, 0x7D, 0x99,
+      0x95, 0x56, 0x56, 0xDF, 0xB8, 0xC7, 0xB7, 0xC1, 0x97, 0xC6, 0x97, 0x03 },
+    { 0x99, 0xBE, 0x74, 0x24, 0x7E, 0x23, 0x03, 0x5E, 0x51, 0x82, 0x46, 0x9C,
+      0xDC, 0xEC, 0xD8, 0xCA, 0x65, 0xC0, 0x8A, 0x33, 0x19, 0x8A, 0xC6, 0xD9,
+      0x8C, 0x4D, 0x72, 0x0A, 0xEE, 0xD1, 0xFE, 0xF2, 0x1F, 0xF0, 0x8C, 0x01 },
+    { 0x2A, 0x07, 0x07, 0xC7, 0xD6, 0x6D, 0x9A, 0x78, 0x0D, 0xAE, 0xAA, 0x61,
+      0x67, 0xC9, 0x9D, 0x52, 0x8D, 0x11, 0x83, 0x44, 0x0B, 0x98, 0x5A, 0x05,
+      0xA8, 0xAC, 0x29, 0xC8, 0x5A, 0x16, 0x3E, 0x66, 0x9D, 0x32, 0x5A, 0x02 },
+    { 0xB5, 0xF9, 0xE9, 0xB9, 0xE0, 0x66, 0xF4, 0x12, 0x58, 0x7C, 0x4A, 0xF8,
+      0x3C, 0x6A, 0xA6, 0x2F, 0x10, 0x11, 0xFD, 0x04, 0x96, 0x22, 0xD0, 0x8C,
+      0xFE, 0x20, 0x88, 0x21, 0x9E, 0x8D, 0xB0, 0x7E, 0x34, 0x92, 0x41, 0x00 },
+    { 0x29, 0x90, 0xBB, 0xBB, 0x01, 0x42, 0x30, 0xCB, 0x18, 0x15, 0xBF, 0x41,
+      0xB9, 0x93, 0xF5, 0x1D, 0xDE, 0x91, 0xC8, 0x4D, 0xD7, 0x98, 0x66, 0x1A,
+      0x61, 0x13, 0x26, 0x83, 0xCA, 0xFF, 0xFA, 0x1B, 0xF8, 0xF1, 0x0F, 0x07 },
+    { 0x72, 0x31, 0x53, 0xDA, 0xAD, 0x3F, 0x9C, 0x4E, 0x80, 0x25, 0xBE, 0xD1,
+      0xE4, 0xE8, 0xEE, 0xD0, 0x71, 0xA2, 0xBB, 0x02, 0x5F, 0x59, 0xC4, 0x92,
+      0x1F, 0x24, 0xFC, 0xF8, 0xB6, 0x0B, 0x12, 0xBF, 0xE2, 0x44, 0xD2, 0x02 },
+    { 0x70, 0x8A, 0xFE, 0x79, 0xD5, 0x3C, 0x8A, 0x97, 0x0E, 0x2D, 0x80, 0xF0,
+      0x3F, 0xAF, 0xA8, 0x96, 0x5C, 0x80, 0x89, 0x79, 0xC4, 0x17, 0x5D, 0xA5,
+      0x94, 0x02, 0xA0, 0xB2, 0x2A, 0xBA, 0x28, 0xBD, 0x12, 0x3D, 0x97, 0x03 },
+    { 0xE1, 0x11, 0x20, 0x8B, 0x5D, 0x33, 0xAD, 0x42, 0x7C, 0x32, 0x4A, 0xB3,
+      0xD0, 0xCF, 0x8A, 0x04, 0xF2, 0xB3, 0xEB, 0x57, 0xC1, 0x77, 0xC8, 0x86,
+      0x0F, 0x01, 0x37, 0x8A, 0xB4, 0x0B, 0xC2, 0x5D, 0x5C, 0xDD, 0x1F, 0x03 },
+    { 0xD2, 0x73, 0xFC, 0xD8, 0x71, 0x1F, 0x2E, 0x2D, 0xFC, 0xC3, 0x03, 0x45,
+      0x53, 0xD9, 0xD4, 0x6B, 0x38, 0xA2, 0xBC, 0x04, 0xCC, 0x2A, 0x2D, 0x8B,
+      0x8A, 0xBC, 0x1A, 0xC5, 0x6F, 0x76, 0x27, 0xA9, 0xBF, 0x56, 0xD2, 0x02 },
+    { 0xF5, 0x06, 0x4D, 0x7D, 0x5A, 0x21, 0x9F, 0x88, 0xED, 0xC9, 0x74, 0xCD,
+      0xB5, 0x43, 0x0F, 0x7E, 0x67, 0x00, 0x88, 0x7A, 0x4E, 0xF9, 0x55, 0x3C,
+      0xC8, 0xEE, 0x3A, 0xD0, 0x0C, 0x5B, 0xE8, 0x5B, 0x12, 0x8B, 0x4E, 0x07 },
+    { 0xA2, 0xB3, 0x28, 0xC5, 0x72, 0x11, 0x02, 0x8A, 0x1B, 0xAE, 0x78, 0x81,
+      0xD9, 0x8D, 0xEC, 0x63, 0x68, 0x22, 0xF9, 0x9F, 0xE6, 0x95, 0xD9, 0x57,
+      0x7F, 0x88, 0x77, 0xF2, 0x5F, 0x91, 0x0D, 0x76, 0xFD, 0x6B, 0x45, 0x01 },
+    { 0x40, 0x10, 0x5F, 0x9D, 0xED, 0xD1, 0x62, 0xE0, 0x6E, 0x34, 0xFE, 0x4D,
+      0x26, 0x80, 0xF2, 0x98, 0x06, 0x73, 0xD8, 0x1E, 0x64, 0xE8, 0x2B, 0x01,
+      0x21, 0xA3, 0xBC, 0x61, 0xA1, 0x69, 0x6F, 0x08, 0x89, 0x6B, 0x04, 0x01 },
+    { 0x3E, 0x98, 0x9D, 0xEC, 0x60, 0x87, 0x2A, 0x48, 0xA2, 0x12, 0xBE, 0x30,
+      0x70, 0x9F, 0x6F, 0xF9, 0x3F, 0xA2, 0x88, 0x18, 0x23, 0x01, 0x07, 0x92,
+      0x89, 0x1B, 0x73, 0xD6, 0x74, 0xF9, 0x70, 0x79, 0xE7, 0x60, 0x0B, 0x06 },
+    { 0xEA, 0xE4, 0x64, 0x4D, 0xCA, 0x2B, 0x9C, 0x76, 0x35, 0x1A, 0x26, 0xEF,
+      0x66, 0xFA, 0xAF, 0x64, 0x7E, 0xA2, 0x5D, 0x5E, 0xC9, 0x24, 0x44, 0x6C,
+      0x66, 0x4A, 0x67, 0xD5, 0xE7, 0x21, 0x05, 0x60, 0xEB, 0x6A, 0x45, 0x01 },
+    { 0x38, 0xBE, 0x9C, 0xA3, 0x93, 0xCE, 0x85, 0xDE, 0x51, 0x20, 0xF5, 0x08,
+      0x9C, 0xE0, 0xFA, 0x71, 0x3D, 0xC0, 0xC9, 0x44, 0xFF, 0x51, 0x04, 0x0A,
+      0xF0, 0x6F, 0x3A, 0xCC, 0x30, 0x00, 0x1F, 0xAE, 0x6A, 0x66, 0x8C, 0x01 },
+    { 0x02, 0xFD, 0x68, 0x1C, 0x50, 0x98, 0xC4, 0xB9, 0x68, 0x63, 0x13, 0xDD,
+      0xEA, 0x53, 0xDD, 0xD0, 0x49, 0x80, 0x57, 0x1C, 0xEF, 0xC1, 0x25, 0xA1,
+      0x6F, 0xF9, 0xDE, 0x3F, 0x2C, 0x7A, 0x27, 0x57, 0x08, 0x47, 0x55, 0x05 },
+    { 0x23, 0x0F, 0xA3, 0x68, 0xF7, 0x67, 0x60, 0xEA, 0x95, 0x08, 0xC8, 0xB4,
+      0xAB, 0x44, 0xEC, 0xB8, 0x98, 0x80, 0xE2, 0xA3, 0xFF, 0x82, 0x2A, 0xF8,
+      0xFD, 0x84, 0x83, 0x17, 0x62, 0xE1, 0x9B, 0x60, 0xA9, 0xB8, 0x55, 0x05 },
+    { 0x19, 0xAB, 0x23, 0x60, 0xF0, 0xB0, 0xE3, 0xE8, 0x67, 0xD7, 0x97, 0x86,
+      0xC5, 0x00, 0xAC, 0x78, 0x0A, 0xA2, 0x19, 0xD7, 0xC6, 0xCA, 0x97, 0xC3,
+      0x32, 0x17, 0xF1, 0x58, 0x78, 0x78, 0xDB, 0xFD, 0xE6, 0x83, 0x87, 0x07 },
+    { 0xBE, 0x08, 0x65, 0x41, 0x46, 0x49, 0x33, 0x08, 0xB0, 0xFF, 0x93, 0xED,
+      0x73, 0x9F, 0xDB, 0x87, 0x08, 0xA2, 0xAA, 0xAB, 0xE2, 0x71, 0xA3, 0xD2,
+      0x99, 0x80, 0xD4, 0xCA, 0x21, 0x6F, 0x79, 0x30, 0xD1, 0x65, 0x0B, 0x06 },
+    { 0x56, 0xBC, 0x17, 0x9D, 0x60, 0x0A, 0xE8, 0x72, 0xCE, 0xA9, 0xF1, 0x9D,
+      0x6C, 0x04, 0xE6, 0x75, 0x8E, 0xE2, 0x09, 0xAA, 0x67, 0x4E, 0x69, 0xF1,
+      0x3D, 0xDC, 0xC1, 0x4C, 0x1E, 0x36, 0x24, 0x03, 0x14, 0x41, 0x10, 0x04 },
+    { 0x17, 0xA5, 0xD0, 0x27, 0x24, 0xA9, 0x74, 0xA5, 0x02, 0xCF, 0xC6, 0x2B,
+      0x58, 0x14, 0x2D, 0x9D, 0x60, 0x51, 0x69, 0x0C, 0xBA, 0x9F, 0x8B, 0xBC,
+      0x6F, 0xB2, 0xED, 0x72, 0x33, 0x76, 0xA8, 0x3D, 0x1A, 0x9D, 0x0F, 0x07 },
+    { 0x3A, 0x20, 0xB0, 0xFD, 0x3F, 0xA8, 0xE1, 0x3D, 0x45, 0xA1, 0x2F, 0x6E,
+      0x35, 0x20, 0x0C, 0xD5, 0xA6, 0x80, 0xBA, 0x95, 0x1C, 0x1C, 0x37, 0x10,
+      0xD5, 0x15, 0x66, 0x3A, 0xC6, 0x30, 0xCE, 0xEE, 0xA9, 0x16, 0xC2, 0x06 },
+    { 0x8C, 0x88, 0x3A, 0x4B, 0x92, 0x5E, 0x96, 0x36, 0xFC, 0x20, 0x1F, 0x43,
+      0x19, 0xDB, 0xE8, 0x05, 0x9F, 0xB3, 0x89, 0xAF, 0x25, 0x5F, 0xC4, 0xF5,
+      0xD1, 0x37, 0x7B, 0x20, 0x45, 0xE3, 0x6E, 0x8A, 0x56, 0x78, 0xC6, 0x07 },
+    { 0xD4, 0xB6, 0x0B, 0x50, 0x11, 0x03, 0xF6, 0x9C, 0x89, 0x54, 0x9F, 0xBB,
+      0x27, 0x79, 0x4A, 0xCD, 0x55, 0x00, 0xB9, 0xAE, 0xAF, 0x80, 0x62, 0xE6,
+      0xE0, 0x10, 0x84, 0x5E, 0x74, 0x28, 0x49, 0x1C, 0x1E, 0x0B, 0x4E, 0x07 },
+    { 0xE9, 0x11, 0x83, 0x7D, 0xD8, 0x8A, 0x42, 0x4A, 0x5F, 0xC2, 0xAC, 0x20,
+      0x7E, 0x66, 0x7E, 0xE7, 0x61, 0x22, 0xC2, 0x2A, 0x64, 0x95, 0xC1, 0x23,
+      0x9D, 0x92, 0x31, 0x92, 0x45, 0x47, 0xF7, 0x18, 0xC2, 0xBB, 0x10, 0x04 },
+    { 0xAA, 0x9F, 0xF0, 0x3E, 0x83, 0x11, 0x1C, 0x2C, 0xA0, 0x96, 0xFA, 0xDC,
+      0x50, 0x46, 0xE3, 0xF5, 0x55, 0x11, 0x69, 0x05, 0x43, 0x08, 0xA5, 0x82,
+      0x64, 0xAA, 0x2A, 0x8B, 0xAA, 0x4D, 0x6E, 0x76, 0x56, 0x48, 0x5A, 0x02 },
+    { 0xE8, 0x34, 0x8A, 0xBF, 0xA4, 0x4F, 0x67, 0x32, 0x36, 0x94, 0x2D, 0x4E,
+      0xD4, 0xBB, 0xFA, 0x6F, 0x29, 0x40, 0x03, 0xBE, 0x60, 0x0D, 0x22, 0x45,
+      0x2F, 0x94, 0x64, 0x65, 0x50, 0x95, 0x04, 0x10, 0x24, 0x49, 0x1B, 0x02 },
+    { 0x90, 0xF4, 0x37, 0x62, 0x7D, 0x1D, 0xC7, 0xBE, 0xB5, 0x73, 0xE2, 0x92,
+      0xD5, 0x09, 0x2F, 0x68, 0x9F, 0x51, 0xAF, 0x3E, 0xC6, 0xCF, 0x64, 0xBE,
+      0xA5, 0xF0, 0x7E, 0x40, 0xBE, 0x92, 0x17, 0xC4, 0xD6, 0x05, 0x83, 0x06 },
+    { 0x8F, 0x1B, 0x66, 0x7A, 0xDB, 0xDF, 0x2C, 0x88, 0xEC, 0x6B, 0xCD, 0xA5,
+      0x9F, 0xC7, 0x05, 0x1C, 0x91, 0x91, 0xA3, 0xB5, 0x43, 0xF9, 0xE1, 0x4A,
+      0x34, 0x45, 0xB3, 0x9F, 0xDF, 0x38, 0x8F, 0xCC, 0xA9, 0x80, 0x83, 0x06 },
+    { 0xD1, 0xA3, 0x12, 0xC8, 0x10, 0x2B, 0x3B, 0x92, 0x96, 0x76, 0xE3, 0xC6,
+      0xD6, 0x60, 0x0B, 0x53, 0x7F, 0x40, 0xE2, 0x10, 0xD8, 0x93, 0xF2, 0x9B,
+      0xF4, 0xB9, 0xAF, 0xA8, 0x4C, 0x3C, 0xF4, 0x06, 0x59, 0xF1, 0x8C, 0x01 },
+    { 0xC7, 0xC4, 0x55, 0xB8, 0xB3, 0xF0, 0x1C, 0x0C, 0xD7, 0x72, 0x22, 0xE1,
+      0x5C, 0x6D, 0x43, 0xF7, 0x09, 0x11, 0xEF, 0x83, 0x53, 0x5C, 0x01, 0xF1,
+      0x64, 0xED, 0x3B, 0x29, 0x82, 0x10, 0xBD, 0xF6, 0x7F, 0xE8, 0x83, 0x06 },
+    { 0xF7, 0xB1, 0xC5, 0x93, 0x4F, 0x19, 0x57, 0x64, 0x5E, 0x4E, 0xEF, 0xE6,
+      0x88, 0xFA, 0xC1, 0x32, 0x2C, 0x80, 0xD3, 0x52, 0x5C, 0x07, 0x8D, 0x94,
+      0xDB, 0xA0, 0x09, 0x84, 0xE5, 0x1B, 0xB4, 0x4D, 0x1C, 0xCC, 0x1B, 0x02 },
+    { 0xB1, 0x8B, 0x36, 0x59, 0xCE, 0x70, 0xEA, 0xA6, 0x41, 0xA9, 0xF0, 0x16,
+      0x50, 0xB4, 0xF9, 0xF9, 0x7E, 0x33, 0xA3, 0xA1, 0x7A, 0x69, 0xA2, 0xEF,
+      0x4B, 0xA9, 0xBF, 0xDC, 0xEE, 0xC4, 0x89, 0x89, 0xC1, 0x9A, 0x88, 0x00 },
+    { 0xD4, 0x97, 0xC2, 0x4B, 0x01, 0x20, 0x9B, 0x81, 0x6C, 0x40, 0x66, 0x1F,
+      0xB7, 0xC7, 0x15, 0x62, 0x64, 0xC0, 0x19, 0x08, 0x52, 0x36, 0x4C, 0xDE,
+      0x10, 0x10, 0xE5, 0x31, 0x98, 0x8A, 0xA2, 0x7B, 0x70, 0x43, 0x55, 0x05 },
+    { 0x09, 0xA1, 0x92, 0xE4, 0x4D, 0xFC, 0xC7, 0x9E, 0xC2, 0x97, 0x3A, 0xAF,
+      0xD9, 0x22, 0x8F, 0x6A, 0xC3, 0x51, 0x29, 0xB8, 0xD6, 0x9B, 0xC0, 0xCD,
+      0xA5, 0xB7, 0x6F, 0xE2, 0x96, 0xCF, 0xC4, 0x44, 0xFF, 0xBD, 0x14, 0x05 },
+    { 0xE9, 0xD6, 0x21, 0x15, 0x2B, 0xDA, 0xC7, 0xF7, 0x27, 0xBC, 0x89, 0xF5,
+      0x1D, 0x37, 0xBA, 0x8B, 0x43, 0x40, 0xF7, 0xFC, 0xD2, 0xC2, 0xC9, 0x80,
+      0xF4, 0xD2, 0x74, 0xE6, 0x5F, 0x75, 0xBA, 0x1B, 0x56, 0xDA, 0x1B, 0x02 },
+    { 0x09, 0x24, 0xB5, 0x12, 0x9B, 0x72, 0xE1, 0x94, 0x23, 0xFF, 0x28, 0x27,
+      0x7E, 0x95, 0x37, 0x20, 0x29, 0x33, 0x18, 0x81, 0xB6, 0xCE, 0x0E, 0x56,
+      0x74, 0x8C, 0x36, 0x2D, 0xE4, 0x7D, 0xF6, 0x24, 0xD2, 0xA7, 0x1F, 0x03 },
+    { 0xAD, 0x91, 0x88, 0x9E, 0xAA, 0x4F, 0x0C, 0x06, 0x52, 0x43, 0xC7, 0x23,
+      0x74, 0xDD, 0x31, 0xC9, 0x8B, 0x73, 0xB0, 0x42, 0x5F, 0x93, 0x60, 0x8E,
+      0x8A, 0x0B, 0x14, 0x42, 0x34, 0xE0, 0xB6, 0x69, 0xAB, 0xB1, 0xDD, 0x05 },
+    { 0xA0, 0x28, 0xDB, 0xCC, 0x53, 0xD6, 0x9A, 0x6E, 0xF9, 0xB1, 0x9F, 0x15,
+      0x4E, 0x23, 0xA3, 0xCF, 0xEA, 0x00, 0x1B, 0x6C, 0x3F, 0xD1, 0x07, 0x03,
+      0x54, 0x7A, 0x9D, 0x3F, 0xEE, 0xFF, 0x63, 0x46, 0xEE, 0x7E, 0x00, 0x00 },
+    { 0x89, 0x98, 0x9E, 0x73, 0x41, 0x18, 0x31, 0x06, 0xF3, 0x1E, 0xA9, 0x9A,
+      0xC9, 0x9B, 0xE6, 0xC4, 0x7A, 0x91, 0x03, 0x96, 0x6D, 0xDE, 0xB8, 0xC1,
+      0xDE, 0xD4, 0x54, 0xF1, 0xD1, 0x17, 0xE7, 0x49, 0x54, 0x9E, 0x0F, 0x07 },
+    { 0x75, 0xBF, 0x19, 0x87, 0x52, 0xF6, 0x01, 0xEF, 0x95, 0xF1, 0xF9, 0x0A,
+      0xF9, 0xE4, 0xB6, 0xAD, 0x8E, 0xC0, 0x02, 0x64, 0x6D, 0xE7, 0x4B, 0xDD,
+      0x44, 0x6A, 0x78, 0x0E, 0x76, 0x75, 0xC1, 0x3D, 0x9E, 0xBD, 0x55, 0x05 },
+    { 0x71, 0x41, 0x1B, 0x41, 0x54, 0xDE, 0xE6, 0x80, 0x64, 0x0E, 0xEF, 0x08,
+      0x28, 0x42, 0x68, 0x32, 0xA9, 0x40, 0x95, 0x65, 0x35, 0xAE, 0x66, 0x12,
+      0xC1, 0xE5, 0xBA, 0x3C, 0xF2, 0x79, 0xEC, 0x60, 0x43, 0x83, 0x8C, 0x01 },
+    { 0xA1, 0x46, 0x0D, 0xAC, 0xBF, 0x89, 0xDB, 0x80, 0xC5, 0x53, 0x81, 0xB1,
+      0x95, 0x04, 0xBF, 0x3F, 0x58, 0xA2, 0x26, 0xB1, 0x07, 0xE3, 0xBE, 0x5D,
+      0x95, 0x3A, 0xFA, 0x8F, 0x17, 0x8E, 0xBD, 0x40, 0xBC, 0xAC, 0x10, 0x04 },
+    { 0xA0, 0x67, 0x2E, 0x7F, 0x92, 0x7B, 0xFB, 0x18, 0x13, 0x10, 0x1E, 0x46,
+      0x59, 0x95, 0xDB, 0x2B, 0x3C, 0x62, 0x46, 0x4C, 0x8D, 0x68, 0x5A, 0x12,
+      0xE4, 0x67, 0x4C, 0x5B, 0xCC, 0xF7, 0x2A, 0x06, 0x37, 0x48, 0x0B, 0x06 },
+    { 0xFE, 0xDA, 0x85, 0x32, 0x15, 0xC6, 0xD7, 0x86, 0x97, 0x10, 0x46, 0x92,
+      0xE1, 0xD9, 0x8E, 0xF6, 0xD3, 0xD1, 0x96, 0xF3, 0x58, 0x70, 0xDE, 0xD3,
+      0x1F, 0x31, 0xEE, 0xCD, 0x23, 0x6E, 0x0B, 0x29, 0x17, 0x1D, 0x0F, 0x07 },
+    { 0x17, 0xBA, 0xB5, 0x3A, 0xB2, 0x5F, 0xC0, 0x56, 0x35, 0x86, 0xB5, 0x71,
+      0x7A, 0x2E, 0xAB, 0x2C, 0xD1, 0x9E, 0x96, 0xFA, 0x71, 0x9A, 0xC3, 0x23,
+      0x95, 0xBE, 0x01, 0xBE, 0xC2, 0xA6, 0xD7, 0x09, 0x74, 0xD7, 0x30, 0x05 },
+    { 0x42, 0x8E, 0x19, 0xB1, 0xB4, 0xB0, 0xD0, 0xEE, 0xAF, 0xFD, 0xC8, 0x91,
+      0x7E, 0x66, 0x94, 0xEF, 0x89, 0x32, 0x6B, 0xAA, 0x59, 0xE8, 0xC1, 0x52,
+      0x41, 0x2E, 0x9D, 0x1A, 0xBE, 0x69, 0x06, 0x0F, 0x58, 0x1A, 0x4A, 0x06 },
+    { 0x7F, 0xA1, 0x2C, 0x8F, 0x72, 0x15, 0xCD, 0x76, 0xD8, 0xE3, 0x39, 0xDF,
+      0x0F, 0xB1, 0x27, 0xF6, 0x1C, 0x10, 0xB8, 0x83, 0xE1, 0x2E, 0xFD, 0x52,
+      0x64, 0xAC, 0x6B, 0x7D, 0x80, 0xE7, 0xC0, 0x69, 0x2C, 0xD1, 0x15, 0x05 },
+    { 0xD0, 0xC4, 0x36, 0x37, 0x54, 0xC3, 0x4A, 0xF5, 0xF1, 0xA2, 0xFC, 0x4A,
+      0x27, 0xBC, 0x9C, 0x1A, 0x7D, 0x20, 0xA7, 0x3C, 0x2B, 0xBA, 0xD9, 0x39,
+      0x77, 0x53, 0x05, 0x5A, 0x6B, 0x40, 0x55, 0x99, 0xE7, 0x11, 0x87, 0x07 },
+    { 0x8D, 0xAC, 0x2C, 0x8F, 0x72, 0x15, 0xCD, 0x76, 0xD8, 0xE3, 0x39, 0xDF,
+      0x0F, 0xB1, 0x27, 0xF6, 0x1C, 0x10, 0xB8, 0x83, 0xE1, 0x2E, 0xFD, 0x52,
+      0x64, 0xAC, 0x6B, 0x7D, 0x80, 0xE7, 0xC0, 0x69, 0x2C, 0xD1, 0xD5, 0x03 },
+    { 0xE8, 0xD2, 0x8B, 0xD4, 0xE8, 0x33, 0xBD, 0x0F, 0x4E, 0x95, 0x45, 0xE3,
+      0xBA, 0x99, 0x8E, 0x2B, 0xF1, 0xE6, 0x56, 0x77, 0x0A, 0x8D, 0xC3, 0xC4,
+      0x5A, 0x08, 0x35, 0x99, 0xCE, 0x91, 0x2C, 0x62, 0x3A, 0x1B, 0x0B, 0x06 },
+    { 0xE5, 0x08, 0x34, 0xC7, 0xB4, 0xAD, 0x7C, 0x9B, 0x3A, 0x51, 0xDB, 0xD3,
+      0x71, 0x98, 0x60, 0xC7, 0x5D, 0x52, 0x59, 0xF3, 0x47, 0xFC, 0x7E, 0x79,
+      0xF7, 0x98, 0x22, 0x7C, 0x27, 0x50, 0xBF, 0xF6, 0xFC, 0x88, 0xC9, 0x01 },
+    { 0x7F, 0xCB, 0xD8, 0x11, 0x7D, 0x76, 0xC5, 0xFB, 0x3D, 0x69, 0xE9, 0xE3,
+      0xFB, 0x35, 0xAD, 0xD2, 0xF4, 0x19, 0xA4, 0x6B, 0xCF, 0xCD, 0x2A, 0xBD,
+      0xBC, 0x08, 0x49, 0x8D, 0x89, 0x5B, 0xDD, 0x5F, 0xD9, 0xB8, 0x14, 0x05 },
+    { 0x6E, 0xA7, 0x18, 0x48, 0xC6, 0xB8, 0xB1, 0xED, 0xE2, 0xB2, 0xE2, 0x0C,
+      0x7E, 0x29, 0x47, 0x31, 0x41, 0x42, 0xE1, 0x70, 0xA6, 0xD2, 0x83, 0x2B,
+      0x93, 0x34, 0x49, 0x01, 0xA7, 0xB7, 0x7F, 0x9F, 0xD0, 0x59, 0x9C, 0x03 },
+    { 0x39, 0x79, 0x5C, 0x3C, 0xD5, 0xD3, 0xA9, 0x12, 0x0F, 0xFE, 0x3C, 0x50,
+      0x32, 0x49, 0x54, 0x29, 0x2B, 0xB2, 0xBC, 0xF7, 0x5B, 0x91, 0x98, 0xA7,
+      0x20, 0xD0, 0xC1, 0x07, 0xE1, 0x8E, 0x82, 0xA6, 0xC6, 0x87, 0x87, 0x07 },
+    { 0x70, 0xA3, 0x18, 0x48, 0xC6, 0xB8, 0xB1, 0xED, 0xE2, 0xB2, 0xE2, 0x0C,
+      0x7E, 0x29, 0x47, 0x31, 0x41, 0x42, 0xE1, 0x70, 0xA6, 0xD2, 0x83, 0x2B,
+      0x93, 0x34, 0x49, 0x01, 0xA7, 0xB7, 0x7F, 0x9F, 0xD0, 0x59, 0x9C, 0x01 },
+    { 0x03, 0xB3, 0xC8, 0x0D, 0xE1, 0x20, 0xA7, 0xC2, 0x97, 0x8B, 0xEF, 0x91,
+      0xB9, 0x26, 0x19, 0xCB, 0xD0, 0x02, 0x3A, 0x04, 0xD2, 0x93, 0x4A, 0xF1,
+      0x6B, 0xB6, 0x2B, 0x8B, 0xC4, 0x81, 0x95, 0x08, 0x20, 0x82, 0x45, 0x01 }
+};
+
+// 2^i P
+static const eccint_point_t eccint_sect283k1_ptable[288] = {
+    { { 0x36, 0x28, 0x49, 0x58, 0x24, 0xAC, 0xC2, 0xB0, 0x13, 0x69, 0x87, 0x16,
+        0x7A, 0x56, 0xC1, 0x23, 0x5F, 0x26, 0xCD, 0x53, 0xE5, 0x88, 0xF1, 0x62,
+        0x81, 0x3B, 0x1A, 0x3F, 0x88, 0x44, 0xCA, 0x78, 0x3F, 0x21, 0x03, 0x05 },
+      { 0x59, 0x22, 0xDD, 0x77, 0x61, 0x11, 0x34, 0x4E, 0x36, 0x62, 0x59, 0xE4,
+        0x98, 0x46, 0x18, 0xE8, 0xC0, 0x45, 0x7E, 0xE8, 0x6F, 0x42, 0xE5, 0x07,
+        0x5D, 0xF9, 0x90, 0x8D, 0x31, 0x9E, 0x1C, 0x0F, 0x38, 0xDA, 0xCC, 0x01 }, 0 },
+    { { 0xCF, 0x80, 0xAF, 0xAE, 0x6F, 0xDC, 0xC1, 0x49, 0xD7, 0xC9, 0xA1, 0x57,
+        0x8B, 0xE7, 0x45, 0xA5, 0x59, 0xA4, 0x52, 0x9E, 0x03, 0xA1, 0x6F, 0xDC,
+        0x86, 0xE0, 0xDA, 0xBF, 0x44, 0x2D, 0x79, 0xB9, 0x69, 0xE9, 0x0A, 0x03 },
+      { 0x02, 0xFC, 0xB2, 0x27, 0x64, 0x25, 0x70, 0xB9, 0x16, 0x7F, 0x49, 0x66,
+        0x16, 0xAB, 0x0C, 0x8E, 0x3D, 0xBC, 0x80, 0x14, 0xB3, 0x12, 0xF9, 0xA1,
+        0xD6, 0x46, 0xFA, 0x9F, 0x5E, 0x0C, 0xB7, 0xA1, 0x6A, 0x72, 0x9D, 0x05 }, 0 },
+    { { 0x91, 0x7B, 0x6F, 0xCC, 0x36, 0x5D, 0x6C, 0x2C, 0x1C, 0xFC, 0x1D, 0x5F,
+        0x3C, 0x55, 0x4A, 0x59, 0x71, 0xC6, 0xC5, 0xA5, 0x4E, 0x6A, 0x77, 0x29,
+        0x71, 0xF1, 0xB7, 0xA6, 0x57, 0xE4, 0xDD, 0xED, 0xFA, 0x9A, 0x94, 0x03 },
+      { 0x8E, 0xFB, 0x1A, 0x7C, 0x31, 0x72, 0xE0, 0x5F, 0x7A, 0xD5, 0x29, 0x27,
+        0xB5, 0xC6, 0x43, 0xDC, 0xE1, 0x8D, 0x57, 0xB2, 0x0C, 0x2E, 0x21, 0xF6,
+        0x10, 0x33, 0xD2, 0x0B, 0x99, 0x4F, 0xF1, 0x83, 0x18, 0xEE, 0x86, 0x02 }, 0 },
+    { { 0x35, 0x76, 0x3A, 0xBA, 0x8D, 0x48, 0x89, 0x8C, 0xD0, 0x5B, 0xBA, 0x55,
+        0x7D, 0x13, 0x4F, 0x10, 0xE3, 0xE3, 0x5C, 0x64, 0x20, 0x41, 0x5A, 0x1A,
+        0xBD, 0x99, 0x72, 0x96, 0x7D, 0x62, 0xC8, 0x81, 0x1B, 0xEA, 0x09, 0x07 },
+      { 0xDC, 0xFD, 0x46, 0xA6, 0xF3, 0xE7, 0xFF, 0xE5, 0x96, 0x93, 0xD1, 0xB8,
+        0x3D, 0xC6, 0x1F, 0xCB, 0x0C, 0xA3, 0xAA, 0x2B, 0x9E, 0x50, 0x68, 0x52,
+        0x30, 0x49, 0x8C, 0x46, 0x3D, 0x6E, 0x95, 0x25, 0x79, 0xF2, 0x80, 0x00 }, 0 },
+    { { 0x70, 0xD0, 0x96, 0x5E, 0xC1, 0xC3, 0x76, 0x28, 0x95, 0x40, 0xC2, 0x4C,
+        0x0D, 0x8F, 0x65, 0xDE, 0x15, 0x0F, 0x92, 0x07, 0xAC, 0x36, 0x98, 0xA5,
+        0xA8, 0x6C, 0x08, 0xF2, 0x96, 0xAA, 0xCE, 0xC6, 0x6A, 0x4D, 0x53, 0x03 },
+      { 0xED, 0xD1, 0x5E, 0xDC, 0x09, 0x87, 0x83, 0x82, 0x7E, 0x35, 0xF5, 0x31,
+        0x98, 0xED, 0x25, 0x62, 0x8D, 0x42, 0xA9, 0xDF, 0x68, 0xCD, 0xF9, 0x20,
+        0x4B, 0xCB, 0x7C, 0xD6, 0xBC, 0xEC, 0x1B, 0xF2, 0xF8, 0xD2, 0x20, 0x04 }, 0 },
+    { { 0xB5, 0x99, 0x49, 0x2F, 0xFD, 0xD0, 0x86, 0x8A, 0xD6, 0xA4, 0xD3, 0x0F,
+        0x65, 0x0A, 0x10, 0x54, 0x10, 0x33, 0xD8, 0x76, 0x41, 0xC6, 0x21, 0x81,
+        0xAD, 0xE4, 0xF9, 0x9A, 0xC2, 0x20, 0x67, 0x93, 0x63, 0xC1, 0xA6, 0x07 },
+      { 0x1C, 0x40, 0x83, 0x6D, 0xCD, 0xD2, 0x5E, 0xD7, 0xDE, 0x16, 0xBC, 0x96,
+        0xBE, 0xD0, 0x94, 0x16, 0xD4, 0xBE, 0x3B, 0xF5, 0x66, 0x28, 0xA9, 0xB3,
+        0x7E, 0xA3, 0x7A, 0x57, 0x63, 0xBE, 0x84, 0x62, 0x0A, 0x1F, 0x97, 0x04 }, 0 },
+    { { 0x81, 0x75, 0xA1, 0x02, 0x05, 0xD4, 0x5E, 0xAA, 0xB2, 0xED, 0x4D, 0x29,
+        0x33, 0xF8, 0xC6, 0xD2, 0xB5, 0x13, 0x05, 0x67, 0x8E, 0xE4, 0x31, 0x6B,
+        0xA8, 0xDF, 0xB5, 0x96, 0xB0, 0x73, 0x36, 0x14, 0x13, 0xBC, 0x40, 0x05 },
+      { 0xA0, 0xBC, 0xAA, 0x8C, 0x10, 0x5E, 0x21, 0xCA, 0x47, 0xB2, 0xD2, 0xFB,
+        0xF6, 0x15, 0xFA, 0x3E, 0x64, 0x4A, 0xAA, 0x5C, 0xEE, 0x44, 0x12, 0x6B,
+        0xCB, 0xCF, 0x76, 0x93, 0x32, 0x97, 0xE5, 0x1E, 0xA1, 0x97, 0x20, 0x03 }, 0 },
+    { { 0xD6, 0xE6, 0x61, 0x68, 0x7B, 0x5B, 0x55, 0xAA, 0x8F, 0x9D, 0x66, 0xB5,
+        0x61, 0xDE, 0x12, 0x29, 0xCD, 0xF7, 0x03, 0xD8, 0xFC, 0xC0, 0x26, 0xBD,
+        0x9B, 0x49, 0xA7, 0xE4, 0xFB, 0x7E, 0xDB, 0xF7, 0xB7, 0x0A, 0x30, 0x03 },
+      { 0xEC, 0xBB, 0x56, 0x3B, 0x21, 0xF1, 0xE2, 0xEE, 0x87, 0x97, 0xFB, 0xD2,
+        0xD0, 0x5D, 0x38, 0x6A, 0x07, 0xF8, 0x96, 0xE8, 0x05, 0x42, 0xCC, 0x10,
+        0xFB, 0x88, 0x67, 0xAE, 0x6C, 0x4B, 0x36, 0x04, 0xE9, 0xD8, 0xBD, 0x04 }, 0 },
+    { { 0x35, 0xB8, 0x5E, 0x2F, 0x75, 0x2D, 0x88, 0x9C, 0xFB, 0x6C, 0x01, 0xB8,
+        0x09, 0x8E, 0x82, 0xA3, 0x14, 0x11, 0x65, 0xBF, 0x49, 0xE1, 0xEE, 0x17,
+        0x24, 0x7E, 0x86, 0x71, 0xF1, 0x30, 0x7D, 0x4C, 0xC8, 0x98, 0x8D, 0x06 },
+      { 0xB5, 0x23, 0x82, 0xA3, 0x61, 0xD3, 0xC9, 0x5A, 0xC9, 0xFF, 0x66, 0x66,
+        0xDA, 0x95, 0xD4, 0xBA, 0x5E, 0xAA, 0xA0, 0x8F, 0x24, 0x61, 0x54, 0x0C,
+        0x48, 0xE2, 0xE7, 0x0F, 0xD7, 0x13, 0xBA, 0x91, 0x7A, 0xCD, 0xB8, 0x02 }, 0 },
+    { { 0x58, 0x80, 0x56, 0x7E, 0xD3, 0xC9, 0x23, 0x53, 0x11, 0x5A, 0x23, 0x96,
+        0x29, 0x1C, 0xDE, 0x4D, 0x91, 0xF2, 0xBE, 0x20, 0xBA, 0x5B, 0xDE, 0x6E,
+        0x3A, 0x11, 0xA1, 0x78, 0xCF, 0x14, 0x21, 0x3B, 0x79, 0x2F, 0x0E, 0x07 },
+      { 0x85, 0xFB, 0xAD, 0xA4, 0x19, 0xAC, 0x6E, 0xA3, 0x22, 0x76, 0xE3, 0xF8,
+        0x81, 0x17, 0x06, 0xAC, 0xE4, 0x47, 0x27, 0x49, 0x16, 0x63, 0x0E, 0x04,
+        0x6C, 0x61, 0x9C, 0x71, 0x92, 0xD2, 0x40, 0x09, 0x8C, 0x40, 0xDC, 0x00 }, 0 },
+    { { 0xFD, 0x9C, 0xD7, 0xFF, 0xC5, 0x13, 0x68, 0x8D, 0xB3, 0xDC, 0x04, 0xED,
+        0x29, 0x3B, 0x45, 0x15, 0xF3, 0x9E, 0x84, 0xF0, 0x12, 0x8C, 0x09, 0x9F,
+        0xCC, 0xFF, 0x7B, 0xA6, 0x6F, 0x5B, 0x1D, 0x72, 0xC0, 0xC1, 0xAC, 0x03 },
+      { 0xFC, 0x75, 0x0A, 0x9B, 0x58, 0x0C, 0x18, 0x6F, 0x5B, 0x70, 0x60, 0xD5,
+        0xD9, 0xEB, 0x62, 0x30, 0x78, 0x14, 0x46, 0x0A, 0x91, 0x28, 0xF6, 0xFE,
+        0xD9, 0x40, 0x5E, 0xC3, 0x6C, 0xB6, 0xFC, 0xD7, 0xDE, 0xE3, 0x0A, 0x07 }, 0 },
+    { { 0x6B, 0x11, 0xC9, 0x61, 0x54, 0xE3, 0x87, 0x41, 0x7A, 0xA3, 0xFF, 0xAC,
+        0xF6, 0xDD, 0xF4, 0xEB, 0x2B, 0x9E, 0xCD, 0xD5, 0x99, 0xC8, 0xD8, 0x5A,
+        0x0D, 0x63, 0xBA, 0xB7, 0x7C, 0x7A, 0xCC, 0x32, 0x6D, 0x8B, 0x68, 0x06 },
+      { 0xC5, 0x57, 0x69, 0x89, 0xB5, 0x9C, 0x91, 0x56, 0xAE, 0x2D, 0x76, 0xEE,
+        0xC2, 0x58, 0x71, 0xB5, 0x65, 0x40, 0xB1, 0x5C, 0x7D, 0x86, 0xB8, 0x69,
+        0x19, 0xCD, 0x17, 0x40, 0xB2, 0x72, 0xC9, 0x52, 0xB0, 0xA7, 0xCA, 0x04 }, 0 },
+    { { 0x39, 0x20, 0xD3, 0x0E, 0x9C, 0xD1, 0x1A, 0x41, 0xDC, 0x4C, 0xD7, 0x75,
+        0x61, 0xFA, 0xF3, 0xFB, 0x60, 0x21, 0x02, 0xAC, 0xB8, 0xD9, 0xD4, 0x67,
+        0xA9, 0xA5, 0xBA, 0x11, 0xB8, 0xA1, 0x07, 0x01, 0x93, 0xB1, 0x7B, 0x03 },
+      { 0x8E, 0x60, 0x65, 0x6C, 0x6C, 0x94, 0x08, 0x3D, 0x0E, 0x2F, 0x80, 0x58,
+        0x2C, 0xA0, 0xCD, 0x35, 0x50, 0x0D, 0xD5, 0xCE, 0x8C, 0x95, 0xAB, 0xF7,
+        0x2A, 0x7F, 0x5E, 0x4B, 0xD9, 0x01, 0x45, 0x4B, 0xF5, 0x22, 0x56, 0x04 }, 0 },
+    { { 0xD5, 0x44, 0x86, 0x87, 0xE5, 0x06, 0x3E, 0xCF, 0x95, 0xF9, 0x89, 0x09,
+        0x39, 0x2E, 0x55, 0xB8, 0x32, 0x55, 0x0E, 0x35, 0x04, 0x9F, 0x3E, 0xBB,
+        0xEC, 0x12, 0xC0, 0x25, 0x21, 0x16, 0x76, 0xAF, 0x50, 0xE8, 0xD2, 0x03 },
+      { 0x03, 0x7B, 0x05, 0x92, 0x0A, 0xC6, 0x44, 0x63, 0xB9, 0xE5, 0xA5, 0x1C,
+        0x72, 0xC7, 0xE9, 0x81, 0x09, 0x56, 0x85, 0x31, 0xFC, 0x69, 0xC7, 0xE4,
+        0x9A, 0x91, 0x79, 0x9E, 0x18, 0x05, 0x2D, 0xBC, 0xA9, 0x00, 0x91, 0x05 }, 0 },
+    { { 0xBA, 0xD4, 0x3C, 0x8A, 0xE6, 0x50, 0x47, 0xC9, 0x76, 0xF8, 0x6C, 0x0A,
+        0x0B, 0x22, 0x55, 0x21, 0xB1, 0x25, 0x01, 0xB6, 0x41, 0x1B, 0x83, 0x2D,
+        0xA1, 0x33, 0xE0, 0x7D, 0x5F, 0x1A, 0xEE, 0xDC, 0x51, 0x00, 0x1E, 0x05 },
+      { 0x35, 0x12, 0xDC, 0x52, 0x45, 0xC1, 0x4C, 0x08, 0x09, 0xED, 0x8E, 0x7C,
+        0x07, 0xA0, 0x5A, 0x77, 0xB7, 0x5F, 0x72, 0x89, 0x13, 0x49, 0x40, 0xFD,
+        0x83, 0x85, 0xDE, 0x4B, 0x3A, 0x96, 0xE2, 0x1A, 0x5C, 0x07, 0x77, 0x00 }, 0 },
+    { { 0x0B, 0x9F, 0xF6, 0x4D, 0x0D, 0x23, 0xC9, 0xE0, 0x51, 0xBA, 0xC0, 0xA6,
+        0x52, 0xE1, 0x57, 0xD0, 0xD8, 0x50, 0x33, 0xF9, 0x99, 0xC3, 0x79, 0xBB,
+        0x66, 0x76, 0x7E, 0x10, 0x42, 0xA1, 0x07, 0x79, 0x54, 0xEA, 0xCD, 0x07 },
+      { 0xDB, 0xD4, 0x3A, 0x6F, 0x20, 0x0E, 0xBF, 0x0F, 0xDD, 0x18, 0xA3, 0x4E,
+        0xAE, 0x10, 0xDF, 0x50, 0x4E, 0xAC, 0x72, 0x62, 0x9A, 0xF4, 0xB3, 0xF9,
+        0xAD, 0xFA, 0xAD, 0x9C, 0x10, 0xF6, 0xA1, 0xED, 0x7C, 0x42, 0xCC, 0x01 }, 0 },
+    { { 0xED, 0x27, 0x6A, 0x01, 0xD6, 0x4B, 0x44, 0x81, 0x05, 0x27, 0x3A, 0x64,
+        0xC8, 0x4B, 0xDA, 0x8F, 0x60, 0x99, 0x35, 0x05, 0xDC, 0xAE, 0x19, 0xDF,
+        0x16, 0xF2, 0x6F, 0xD4, 0x27, 0xB0, 0xB9, 0x20, 0x76, 0xB7, 0xEC, 0x00 },
+      { 0x57, 0x67, 0x69, 0xB1, 0x0A, 0xDD, 0xBE, 0x06, 0x28, 0x41, 0x1F, 0x71,
+        0x59, 0x40, 0xCE, 0xEA, 0xFB, 0x94, 0xC7, 0x52, 0x9A, 0x05, 0xB6, 0xA5,
+        0xB3, 0xA5, 0xA4, 0xA3, 0x35, 0x3C, 0x29, 0x4C, 0x5E, 0x5C, 0x67, 0x01 }, 0 },
+    { { 0x65, 0x99, 0x24, 0xFA, 0x9A, 0x1E, 0x41, 0x58, 0x3D, 0xD7, 0xFD, 0x96,
+        0x1B, 0xDF, 0x49, 0x98, 0x90, 0x40, 0xC8, 0x6C, 0x2A, 0x67, 0x39, 0xA7,
+        0x71, 0xC5, 0xE2, 0xC6, 0x4D, 0xFB, 0x40, 0x5C, 0xFE, 0xA5, 0x4C, 0x07 },
+      { 0x3C, 0x8C, 0x69, 0xC0, 0x68, 0xD8, 0x94, 0x02, 0x2E, 0x1F, 0xCD, 0x2A,
+        0xBA, 0x76, 0x04, 0x2D, 0xF6, 0xDC, 0x85, 0x41, 0x85, 0x87, 0x93, 0xD0,
+        0x63, 0x90, 0xC6, 0xEC, 0x82, 0x48, 0x52, 0xDC, 0xA1, 0xC3, 0x50, 0x05 }, 0 },
+    { { 0x1E, 0x3D, 0xDE, 0x15, 0x08, 0xEB, 0xA6, 0x80, 0xE3, 0x6C, 0x07, 0xF8,
+        0xE3, 0x55, 0x77, 0xC9, 0x97, 0x20, 0x03, 0x06, 0x38, 0x78, 0xF4, 0xFD,
+        0x43, 0x5E, 0xA1, 0xCA, 0x9E, 0x0F, 0x78, 0xB2, 0xBF, 0x74, 0xF7, 0x06 },
+      { 0xBF, 0x29, 0x6B, 0xE0, 0xAC, 0xE9, 0x01, 0x41, 0x1E, 0xEA, 0x6F, 0x7F,
+        0xE0, 0x6B, 0xDB, 0x3F, 0xEC, 0xBD, 0x7B, 0x44, 0xE1, 0x86, 0x53, 0x79,
+        0x93, 0x16, 0x87, 0xDB, 0x6B, 0x07, 0xFB, 0x32, 0x8A, 0xF9, 0xCF, 0x06 }, 0 },
+    { { 0x6C, 0x99, 0x8E, 0x1B, 0x54, 0x5D, 0x3E, 0x1F, 0x1F, 0xE2, 0xE6, 0xA5,
+        0x96, 0xB8, 0x28, 0xD0, 0x78, 0x42, 0x68, 0xFC, 0x9C, 0x63, 0xDF, 0x1E,
+        0x5F, 0x11, 0x44, 0xC4, 0x55, 0x9E, 0x49, 0x31, 0x48, 0x59, 0xB5, 0x06 },
+      { 0x1E, 0xF4, 0xF1, 0x5C, 0x8F, 0xD9, 0x57, 0xC7, 0x31, 0x44, 0x25, 0x75,
+        0x20, 0xC1, 0x51, 0x48, 0xE0, 0xD1, 0x4D, 0x7B, 0x1A, 0x19, 0x22, 0xE3,
+        0x62, 0xFB, 0xB7, 0x65, 0xA8, 0xA7, 0xB9, 0x2D, 0xE1, 0x65, 0xE9, 0x03 }, 0 },
+    { { 0x34, 0xC3, 0xFA, 0x88, 0x5A, 0x41, 0x0C, 0x7C, 0x63, 0xF9, 0xB2, 0xAC,
+        0xBF, 0xCB, 0xC7, 0x8E, 0x80, 0x23, 0x72, 0x04, 0xD3, 0x38, 0xD9, 0x9F,
+        0x38, 0xF8, 0x1C, 0x7D, 0xFA, 0x59, 0x72, 0xCB, 0x1A, 0x69, 0x3E, 0x01 },
+      { 0x61, 0xDB, 0x17, 0x55, 0x70, 0x08, 0xF2, 0xBD, 0x77, 0xCD, 0x27, 0x2F,
+        0x38, 0x16, 0x06, 0x0A, 0xDE, 0xB4, 0x28, 0x9B, 0x27, 0x64, 0xB5, 0xA8,
+        0xDB, 0x79, 0x90, 0x31, 0x62, 0x2C, 0xDD, 0x0F, 0x9A, 0x28, 0x00, 0x04 }, 0 },
+    { { 0x39, 0xCA, 0xD3, 0x22, 0xDD, 0x13, 0xF0, 0x47, 0x2F, 0x9D, 0xBF, 0xB7,
+        0x25, 0xEE, 0xC0, 0x72, 0xA6, 0xA8, 0x25, 0x95, 0x5C, 0x95, 0x4A, 0x3A,
+        0xDF, 0x0C, 0xA9, 0x0B, 0xB0, 0x43, 0xE8, 0xA2, 0xD3, 0x81, 0x22, 0x06 },
+      { 0xF7, 0xD8, 0xD3, 0x64, 0xC9, 0x59, 0x34, 0x66, 0xF7, 0x99, 0x75, 0xCD,
+        0x64, 0x25, 0xD2, 0x22, 0xB9, 0x0C, 0x3F, 0xB1, 0x1A, 0x7C, 0x7E, 0x83,
+        0x61, 0x23, 0x2F, 0x5C, 0xB3, 0x3D, 0x88, 0x6E, 0x0C, 0x24, 0x12, 0x06 }, 0 },
+    { { 0xC2, 0x51, 0x8F, 0x4C, 0x1E, 0x08, 0x47, 0xA0, 0x2F, 0x6C, 0xC8, 0x06,
+        0x8A, 0xD3, 0x46, 0xEB, 0x7D, 0x97, 0x45, 0x8F, 0x2E, 0x28, 0x0A, 0x83,
+        0xE2, 0xE2, 0xF9, 0xC8, 0xF9, 0x3D, 0x73, 0x8C, 0xBC, 0x6C, 0x5B, 0x02 },
+      { 0xBF, 0x96, 0xB4, 0x82, 0xA0, 0x45, 0x51, 0xD3, 0x66, 0xF4, 0x73, 0x94,
+        0x4F, 0x34, 0xD6, 0x88, 0x75, 0x4B, 0x69, 0x23, 0xF8, 0xEB, 0xDB, 0xCD,
+        0xE3, 0xBC, 0x9E, 0x49, 0x1C, 0x96, 0x93, 0xC8, 0x12, 0x14, 0xA1, 0x05 }, 0 },
+    { { 0x3B, 0x69, 0xA8, 0x20, 0x48, 0xE6, 0xA8, 0xF2, 0xD7, 0x92, 0x48, 0x6A,
+        0xA3, 0x10, 0x48, 0x4D, 0xFF, 0x3D, 0x9C, 0x89, 0xBF, 0x78, 0x1F, 0xEE,
+        0x23, 0xE5, 0xD4, 0x7C, 0x1F, 0x05, 0xD8, 0x71, 0x93, 0xA1, 0x16, 0x04 },
+      { 0x0E, 0x30, 0x8A, 0x92, 0xBC, 0xC8, 0xF3, 0x17, 0x01, 0xB2, 0xE4, 0x9D,
+        0xF7, 0x4B, 0x52, 0x3F, 0x0A, 0xEE, 0x63, 0x36, 0x42, 0x82, 0xF2, 0x38,
+        0xCB, 0x79, 0x74, 0x7E, 0xD4, 0x25, 0xCF, 0x35, 0x8D, 0x85, 0xE9, 0x02 }, 0 },
+    { { 0x61, 0x87, 0xEE, 0xA9, 0x10, 0x68, 0xE8, 0x54, 0xB8, 0xE7, 0xC8, 0xEE,
+        0x14, 0x54, 0xB4, 0x6C, 0x83, 0x18, 0x80, 0x4F, 0xF9, 0x06, 0x1D, 0xAF,
+        0xE7, 0x3A, 0x37, 0xED, 0x23, 0x67, 0x48, 0x58, 0x70, 0x9F, 0x27, 0x01 },
+      { 0x4E, 0x78, 0x35, 0x5A, 0xD0, 0xEF, 0xD1, 0x68, 0x23, 0xED, 0x3E, 0xFB,
+        0xC8, 0xF2, 0xFB, 0x1E, 0x3F, 0xD2, 0xA1, 0x28, 0xE5, 0x61, 0xD5, 0x2D,
+        0x95, 0x15, 0x03, 0x91, 0x8A, 0x23, 0x5D, 0xCE, 0x20, 0xEA, 0xCD, 0x06 }, 0 },
+    { { 0xFB, 0x55, 0x5E, 0x66, 0xBD, 0x17, 0x3C, 0xC9, 0x50, 0x29, 0xDA, 0xE2,
+        0x6A, 0x63, 0x38, 0x24, 0x8D, 0xA1, 0x91, 0x7B, 0x80, 0xD7, 0x55, 0x7A,
+        0xDE, 0x31, 0xD4, 0x56, 0xF4, 0xDF, 0x96, 0x94, 0x82, 0xD4, 0x1A, 0x06 },
+      { 0xA6, 0x0E, 0x8A, 0x5B, 0xB6, 0x8F, 0x53, 0x44, 0xFF, 0x5E, 0x79, 0x2E,
+        0x0B, 0x2A, 0x36, 0xC1, 0x45, 0x11, 0x77, 0x56, 0x78, 0x46, 0x28, 0x97,
+        0x27, 0x67, 0xB4, 0xD1, 0x70, 0xF0, 0xA9, 0x66, 0xE7, 0xFE, 0xD9, 0x02 }, 0 },
+    { { 0x69, 0x10, 0x13, 0x16, 0xEC, 0x52, 0x9D, 0x6E, 0x7D, 0x35, 0x8B, 0x15,
+        0x39, 0x4F, 0xC8, 0x4C, 0x0A, 0xBB, 0x4B, 0x7A, 0xD4, 0xC1, 0x34, 0x8F,
+        0x05, 0x5A, 0x0D, 0x3C, 0x93, 0x79, 0x59, 0x96, 0x51, 0xD0, 0xCF, 0x06 },
+      { 0x09, 0x8C, 0x78, 0x72, 0x3E, 0x70, 0x6C, 0xA6, 0xC4, 0x57, 0x88, 0xE2,
+        0x10, 0xF1, 0x2D, 0x2A, 0xA0, 0xA8, 0xC3, 0xA6, 0x34, 0xBC, 0x43, 0x06,
+        0x7B, 0x04, 0x15, 0x97, 0x59, 0x56, 0xD4, 0x65, 0x5A, 0x4B, 0xAD, 0x04 }, 0 },
+    { { 0xE6, 0x1F, 0x66, 0x03, 0x37, 0x77, 0x43, 0xB0, 0xA0, 0xC6, 0x38, 0x5B,
+        0xA2, 0x51, 0x80, 0x27, 0x28, 0xA2, 0x48, 0x0E, 0x99, 0x70, 0x96, 0x50,
+        0x6A, 0xF2, 0xDD, 0x19, 0xA5, 0x8D, 0x38, 0x52, 0x90, 0x4C, 0x4B, 0x05 },
+      { 0x6B, 0x9E, 0xBC, 0xE4, 0xC9, 0xB6, 0xAB, 0x81, 0x74, 0x58, 0xF3, 0x58,
+        0xC8, 0x4F, 0xB0, 0xA7, 0x9C, 0xB8, 0x68, 0x01, 0x65, 0x45, 0xD8, 0x43,
+        0x30, 0x64, 0xAD, 0x74, 0x48, 0x2D, 0x85, 0x7A, 0x42, 0x8A, 0xFC, 0x04 }, 0 },
+    { { 0xEF, 0xC7, 0xB0, 0x24, 0x60, 0x62, 0x0C, 0x7D, 0xAA, 0xC9, 0x20, 0xC3,
+        0xD5, 0x69, 0x96, 0xAB, 0x26, 0xD0, 0x0D, 0x16, 0x2E, 0x0F, 0xA1, 0x61,
+        0xF1, 0x49, 0x4F, 0xEE, 0xCD, 0x55, 0x22, 0x45, 0xAC, 0xD5, 0xB7, 0x01 },
+      { 0xDD, 0x24, 0x28, 0x36, 0x80, 0x7C, 0xFB, 0x2F, 0xAF, 0xCB, 0x1F, 0xA1,
+        0xD7, 0x31, 0x5E, 0x30, 0xDB, 0x65, 0xD1, 0xC6, 0x80, 0x76, 0x6E, 0x45,
+        0x80, 0xC7, 0x7B, 0x74, 0x94, 0x00, 0x66, 0xAF, 0x79, 0xDA, 0xAA, 0x01 }, 0 },
+    { { 0x6C, 0x95, 0xF3, 0x2E, 0x85, 0x88, 0xE9, 0x10, 0x00, 0x34, 0xC5, 0x8C,
+        0x77, 0xD4, 0xFA, 0xA2, 0x72, 0xAE, 0x8A, 0x28, 0x80, 0xD4, 0x5B, 0x17,
+        0xF6, 0x6F, 0x53, 0xF7, 0xCD, 0xE7, 0x13, 0xED, 0x80, 0x78, 0x63, 0x04 },
+      { 0xC8, 0x63, 0xDB, 0x0B, 0x3F, 0xB8, 0x1C, 0xB0, 0x2B, 0xAB, 0x72, 0x83,
+        0x64, 0x44, 0xE9, 0x2B, 0x83, 0xF1, 0xB5, 0x6E, 0x56, 0xB4, 0xBA, 0x59,
+        0xFB, 0x9F, 0x3C, 0xB2, 0xF0, 0xA0, 0x19, 0x12, 0xCB, 0xAA, 0xBF, 0x03 }, 0 },
+    { { 0x02, 0x5C, 0xE2, 0x4D, 0x1D, 0xD2, 0xE9, 0x32, 0xC7, 0x85, 0x9D, 0xF4,
+        0x2C, 0x76, 0xE6, 0x5E, 0xC1, 0xF8, 0xB1, 0x22, 0x26, 0x6C, 0xB5, 0x3E,
+        0x55, 0x65, 0xDD, 0x21, 0xE5, 0x15, 0xD1, 0x0B, 0xE3, 0x16, 0xFF, 0x07 },
+      { 0x9A, 0x08, 0x53, 0xBF, 0x0E, 0x86, 0xD1, 0x3D, 0x6E, 0x48, 0xC4, 0x1F,
+        0x3C, 0xA2, 0xF3, 0xA4, 0xCB, 0x14, 0x4F, 0xF6, 0xF7, 0x26, 0xF7, 0x9E,
+        0xAA, 0xFF, 0xA2, 0xC6, 0x42, 0xAB, 0x4E, 0x97, 0xA2, 0x73, 0xC8, 0x07 }, 0 },
+    { { 0x23, 0x9A, 0xAC, 0x27, 0x1E, 0xC6, 0xC2, 0x36, 0x5B, 0xA4, 0x1A, 0x3A,
+        0x70, 0xCA, 0xBC, 0xCF, 0x19, 0x4C, 0x6D, 0x12, 0x8F, 0x3E, 0x3F, 0xB0,
+        0xCE, 0xD1, 0xC4, 0xEB, 0x48, 0xB5, 0x8F, 0xF5, 0x91, 0xAC, 0x1E, 0x00 },
+      { 0xF5, 0x27, 0x1B, 0xAB, 0xFC, 0xD6, 0x59, 0xD3, 0x7C, 0x22, 0x3F, 0x0F,
+        0x83, 0x5A, 0x1B, 0x46, 0x3C, 0x30, 0x5E, 0x09, 0x8C, 0xD8, 0xA2, 0xBE,
+        0xF1, 0x2D, 0x65, 0x6B, 0xB8, 0x85, 0x21, 0x09, 0x5E, 0x4A, 0xF9, 0x04 }, 0 },
+    { { 0x42, 0x50, 0x10, 0xF0, 0x0F, 0xF9, 0x38, 0x76, 0x9D, 0x3B, 0x54, 0xE2,
+        0x47, 0x82, 0xEF, 0xEA, 0x2A, 0x49, 0xCC, 0x74, 0x4F, 0xAB, 0x67, 0xC6,
+        0x41, 0x81, 0xCC, 0x90, 0x9B, 0xFA, 0x2D, 0x9A, 0x71, 0x1D, 0x90, 0x05 },
+      { 0xAF, 0x8F, 0x90, 0x62, 0x8E, 0xEB, 0x00, 0xAA, 0xFE, 0x2A, 0x99, 0x99,
+        0x38, 0x41, 0xA7, 0x82, 0xE7, 0x69, 0x2F, 0xFD, 0x49, 0x6B, 0x9C, 0x30,
+        0xDE, 0x8C, 0xED, 0x37, 0xB6, 0xA2, 0xE4, 0x23, 0xE3, 0x6A, 0x88, 0x04 }, 0 },
+    { { 0x96, 0xC8, 0xED, 0xB3, 0x39, 0x06, 0x1B, 0x95, 0xE5, 0xF1, 0x1B, 0xD2,
+        0x50, 0xDC, 0x30, 0xAE, 0xBC, 0x15, 0xB0, 0xD0, 0x2D, 0xF6, 0x91, 0xD3,
+        0xCD, 0x73, 0xF0, 0x7E, 0xB3, 0xAE, 0x5E, 0xA4, 0xBD, 0x36, 0x4C, 0x06 },
+      { 0x69, 0x72, 0x1F, 0xD8, 0x60, 0x95, 0xA0, 0x3F, 0x48, 0x08, 0x63, 0x79,
+        0xC2, 0x0E, 0x27, 0x9F, 0x93, 0x27, 0x14, 0x53, 0x91, 0xDC, 0xC0, 0x31,
+        0x0A, 0x17, 0xB4, 0x1F, 0x6F, 0xAF, 0x98, 0xD7, 0xA8, 0x97, 0x64, 0x00 }, 0 },
+    { { 0x2E, 0xCC, 0xF1, 0xD1, 0x72, 0xDA, 0x9D, 0x24, 0xB6, 0xB1, 0x8B, 0x87,
+        0x8F, 0x89, 0x5B, 0xE2, 0xD5, 0xA0, 0xA6, 0x80, 0x79, 0xB6, 0x34, 0x65,
+        0xD5, 0x56, 0x21, 0xF6, 0x5F, 0x00, 0xD2, 0xC5, 0x7B, 0x46, 0x3B, 0x02 },
+      { 0x4F, 0xA4, 0x5B, 0x80, 0xF5, 0x68, 0xE4, 0xFD, 0x16, 0xD3, 0xF0, 0x30,
+        0x49, 0x2C, 0x75, 0x3B, 0x4B, 0xDB, 0x20, 0x21, 0x08, 0x47, 0x0B, 0x83,
+        0x25, 0x2A, 0x2A, 0xBE, 0x2A, 0xAD, 0x12, 0x5E, 0xE9, 0x8D, 0x1F, 0x06 }, 0 },
+    { { 0xB7, 0xD3, 0x29, 0xC0, 0x2F, 0xB0, 0x1B, 0xE2, 0x45, 0xD0, 0xD4, 0x7E,
+        0x6A, 0x03, 0xC0, 0x41, 0x43, 0xA9, 0x2E, 0x3F, 0x87, 0xF2, 0xAE, 0x5D,
+        0xCA, 0xB3, 0x76, 0xEF, 0x57, 0x13, 0x4A, 0xE0, 0xB6, 0x88, 0xE2, 0x06 },
+      { 0x18, 0xE9, 0xCA, 0x4D, 0x42, 0x43, 0xB0, 0x73, 0xDD, 0x04, 0x5B, 0x04,
+        0x10, 0x60, 0xC2, 0x6C, 0xBF, 0x0A, 0x6F, 0xF1, 0x75, 0xC3, 0x1B, 0x45,
+        0xDA, 0xEB, 0x3E, 0xD0, 0x0E, 0xC4, 0x4B, 0x21, 0xB1, 0x03, 0x9D, 0x02 }, 0 },
+    { { 0x8B, 0xC5, 0x32, 0x62, 0xF1, 0xC1, 0xE2, 0xB1, 0xDD, 0xC2, 0xA7, 0x83,
+        0xBE, 0xDB, 0x47, 0xD4, 0x88, 0x30, 0xFE, 0x2F, 0xBB, 0xE6, 0x7A, 0xF5,
+        0x14, 0x3E, 0x74, 0x6E, 0x81, 0x81, 0x46, 0x6D, 0x94, 0xB5, 0x8E, 0x03 },
+      { 0x3E, 0xA0, 0xE3, 0x31, 0x15, 0x66, 0xF2, 0x92, 0x78, 0xA7, 0xAA, 0x70,
+        0x38, 0xE1, 0xBA, 0xCE, 0x15, 0x1F, 0x35, 0xC2, 0x28, 0xBD, 0x35, 0x38,
+        0xC4, 0x97, 0x7C, 0x82, 0xC3, 0xBC, 0xCD, 0xEC, 0xDD, 0x65, 0xC2, 0x04 }, 0 },
+    { { 0xAD, 0x39, 0x2A, 0xCF, 0xD0, 0x6C, 0xA6, 0xD7, 0xCD, 0x18, 0xD7, 0xD2,
+        0xFC, 0x16, 0x89, 0xA1, 0x67, 0x54, 0xA2, 0x0D, 0xF5, 0xBB, 0x71, 0xFF,
+        0x59, 0x36, 0x2C, 0xD4, 0xE3, 0xD1, 0x89, 0x2D, 0x6E, 0x84, 0x31, 0x02 },
+      { 0x09, 0x7D, 0xC2, 0x5A, 0x85, 0x9F, 0x3B, 0x3C, 0xA9, 0xCB, 0xA6, 0xC7,
+        0x10, 0xAC, 0x14, 0x91, 0x85, 0x9A, 0x9E, 0xF9, 0x23, 0x57, 0x3C, 0xF8,
+        0xB4, 0x9E, 0x04, 0xB8, 0x6E, 0x2F, 0xF0, 0xB9, 0xD3, 0x26, 0xB3, 0x03 }, 0 },
+    { { 0xB3, 0x23, 0x3F, 0x2B, 0x04, 0x5A, 0x4F, 0x2A, 0xE8, 0x5C, 0xEF, 0x68,
+        0xF3, 0x95, 0xC9, 0x68, 0xD9, 0xAC, 0x39, 0x03, 0xE7, 0xEE, 0x1B, 0x5D,
+        0xF0, 0x88, 0x47, 0x93, 0x13, 0x66, 0xE3, 0xB6, 0x55, 0x89, 0x20, 0x01 },
+      { 0xBB, 0x26, 0xED, 0x20, 0x5A, 0xEB, 0x81, 0xFC, 0x84, 0x03, 0x83, 0x3D,
+        0x95, 0xA5, 0x32, 0x0D, 0x5D, 0x01, 0x0A, 0x10, 0xB8, 0x8B, 0x1A, 0x75,
+        0xA6, 0xF9, 0x50, 0x46, 0xD7, 0x21, 0x43, 0xD6, 0x1F, 0xF6, 0x5A, 0x04 }, 0 },
+    { { 0xB1, 0x3B, 0x86, 0x25, 0x56, 0x8F, 0xB7, 0x43, 0xBE, 0x16, 0x68, 0x8B,
+        0xA5, 0xE8, 0xEF, 0xDA, 0x1A, 0x06, 0x7C, 0xD6, 0x04, 0x76, 0x82, 0x21,
+        0x93, 0x9D, 0xE8, 0x9E, 0x46, 0x84, 0x70, 0x35, 0x43, 0x84, 0x39, 0x06 },
+      { 0xED, 0x80, 0x21, 0x1D, 0xC2, 0xB1, 0x71, 0x20, 0xE6, 0x7D, 0x56, 0x9B,
+        0x5C, 0x33, 0xBA, 0x9B, 0x7C, 0x21, 0x10, 0xFD, 0x2D, 0xBE, 0x37, 0x72,
+        0xD4, 0xE6, 0x85, 0xD7, 0x9F, 0x91, 0x8C, 0x24, 0x77, 0x70, 0x1C, 0x06 }, 0 },
+    { { 0x6B, 0xF7, 0x9D, 0x11, 0x0F, 0x9D, 0xBB, 0x64, 0x7F, 0x6F, 0x17, 0x74,
+        0x3B, 0x57, 0xE2, 0x86, 0x68, 0x73, 0x0A, 0x54, 0x90, 0x5F, 0xD3, 0xCA,
+        0x74, 0xA0, 0xE5, 0xB8, 0x5C, 0xAB, 0xE2, 0xA0, 0x9B, 0x9C, 0x70, 0x00 },
+      { 0xB2, 0x17, 0x38, 0x6C, 0x3A, 0x2B, 0x1D, 0x45, 0xEA, 0x97, 0x87, 0xDB,
+        0xB7, 0x5C, 0xCE, 0xA8, 0xBE, 0xB2, 0xFF, 0x49, 0xB9, 0x30, 0x89, 0x1D,
+        0x21, 0xBF, 0xD4, 0x82, 0x74, 0x83, 0x94, 0xE0, 0x7E, 0x84, 0x6D, 0x06 }, 0 },
+    { { 0x41, 0xCC, 0x8F, 0x5A, 0xC8, 0x4F, 0x06, 0xAE, 0xD4, 0xDD, 0xA1, 0xB4,
+        0x01, 0x9D, 0x3A, 0x87, 0xCF, 0x40, 0x3E, 0x27, 0x46, 0x01, 0x3F, 0x9F,
+        0x1B, 0xD6, 0xA9, 0x31, 0x31, 0x48, 0x92, 0x43, 0x03, 0xA0, 0x67, 0x01 },
+      { 0xA1, 0xAF, 0x6A, 0x88, 0xF7, 0x53, 0x82, 0xAF, 0xB7, 0x9E, 0x74, 0x0B,
+        0x7C, 0x42, 0x8B, 0x6C, 0xAD, 0x64, 0xE0, 0x4D, 0xB6, 0x88, 0x6F, 0xD6,
+        0xB2, 0x7E, 0x78, 0x63, 0x8D, 0xA7, 0x22, 0x55, 0xFF, 0x99, 0x8A, 0x02 }, 0 },
+    { { 0x96, 0x89, 0x57, 0x42, 0x7C, 0x83, 0x25, 0x33, 0x34, 0xFC, 0xFF, 0x4B,
+        0xCC, 0xEA, 0xC4, 0xB9, 0xB1, 0x91, 0x98, 0x59, 0x24, 0x13, 0x03, 0xD2,
+        0xD1, 0x0A, 0x8F, 0x2C, 0x53, 0x32, 0xE1, 0x64, 0x30, 0x2F, 0xFC, 0x01 },
+      { 0xD7, 0x95, 0x36, 0xB2, 0x06, 0xD8, 0x15, 0xF7, 0xDC, 0xF6, 0xF1, 0xFA,
+        0x3F, 0x8A, 0x24, 0x79, 0xC2, 0x9C, 0xC3, 0xCE, 0x2A, 0x24, 0xC0, 0x2D,
+        0x76, 0xCD, 0x9C, 0x8B, 0xAA, 0x5E, 0xE7, 0x5F, 0xC1, 0xC3, 0xCF, 0x06 }, 0 },
+    { { 0xE8, 0x88, 0xCA, 0x7A, 0x20, 0xC4, 0x82, 0x47, 0x6C, 0x68, 0x17, 0xA7,
+        0x81, 0x78, 0x96, 0x43, 0x55, 0xD6, 0x9D, 0x54, 0x7A, 0xDD, 0x9D, 0x7C,
+        0xF9, 0x15, 0x2A, 0x28, 0xCC, 0x92, 0x73, 0xAA, 0x6B, 0x7C, 0x03, 0x06 },
+      { 0x37, 0x70, 0xB9, 0xF9, 0x71, 0xF5, 0x59, 0x22, 0x1B, 0x46, 0xBD, 0x62,
+        0x0D, 0x85, 0x64, 0x2B, 0x2B, 0x76, 0x37, 0x6A, 0x08, 0x83, 0xDB, 0x5C,
+        0x65, 0xCC, 0xA6, 0x67, 0xCA, 0x44, 0xEE, 0xE9, 0xD1, 0x76, 0x5F, 0x07 }, 0 },
+    { { 0x9E, 0x11, 0x36, 0xFF, 0x8E, 0x41, 0xAE, 0xF3, 0x98, 0x90, 0x72, 0xE0,
+        0xEF, 0x49, 0x92, 0xBC, 0x5F, 0xC9, 0xE8, 0x0D, 0xF1, 0xE3, 0x5C, 0xBF,
+        0x30, 0x06, 0x32, 0x18, 0x23, 0x4B, 0x75, 0x7B, 0xA6, 0x2C, 0x2F, 0x02 },
+      { 0x32, 0xA8, 0xAB, 0xD5, 0xE7, 0x1F, 0x0B, 0x3C, 0xCB, 0xAD, 0x21, 0x53,
+        0xAA, 0xFB, 0x4C, 0xD2, 0x8F, 0xAE, 0xB2, 0xBE, 0x7B, 0x6A, 0x78, 0x47,
+        0x0F, 0xFC, 0xEA, 0x56, 0xE5, 0xDA, 0xAF, 0x6E, 0xAB, 0x3A, 0x24, 0x03 }, 0 },
+    { { 0x8B, 0x2D, 0x9B, 0x36, 0xF5, 0xC7, 0x81, 0xDE, 0xAD, 0x50, 0x7A, 0xB2,
+        0xB3, 0xEC, 0xE4, 0xD8, 0x22, 0xD8, 0x0A, 0x03, 0xB8, 0xA3, 0xEA, 0xA0,
+        0x0A, 0xC3, 0xC9, 0xBE, 0x96, 0xAF, 0x63, 0x06, 0x29, 0xD1, 0xE9, 0x07 },
+      { 0x96, 0x08, 0x4F, 0xAE, 0x1F, 0xE3, 0xE6, 0xA6, 0x4D, 0x7A, 0xC9, 0x55,
+        0x93, 0x35, 0xC3, 0x7E, 0x60, 0xBF, 0xAF, 0x72, 0x33, 0x02, 0x34, 0xEA,
+        0xFC, 0x0F, 0xB1, 0x09, 0x31, 0x12, 0x2D, 0x9C, 0xDB, 0x6C, 0x4F, 0x04 }, 0 },
+    { { 0x78, 0xEF, 0xCD, 0xAF, 0x6B, 0xAB, 0xCB, 0x86, 0xAA, 0x51, 0x10, 0x77,
+        0x7C, 0x63, 0xEA, 0x61, 0x59, 0xA5, 0xB2, 0x31, 0xC3, 0x2D, 0xFA, 0x7B,
+        0x2B, 0xAD, 0x8A, 0x10, 0xD2, 0x7D, 0xBA, 0x67, 0x40, 0x11, 0xFF, 0x06 },
+      { 0xB5, 0x7C, 0x62, 0x85, 0x40, 0x60, 0x71, 0xA3, 0xC7, 0x51, 0xAA, 0xA6,
+        0x6B, 0xE8, 0xD6, 0xAF, 0x4A, 0x86, 0x0E, 0xBF, 0xB3, 0x94, 0x2D, 0x15,
+        0x81, 0x23, 0x53, 0x18, 0x5D, 0xFE, 0x91, 0x9C, 0x6A, 0x38, 0xBD, 0x06 }, 0 },
+    { { 0xCC, 0x43, 0x2E, 0xA4, 0x80, 0x58, 0xAE, 0x4A, 0x79, 0xA0, 0xA7, 0x4F,
+        0x19, 0xA8, 0xFB, 0x8F, 0x03, 0xF6, 0xDE, 0xD1, 0xA5, 0xCE, 0xB7, 0x06,
+        0x9F, 0xC2, 0x61, 0x54, 0xD6, 0x52, 0x9A, 0x73, 0xA3, 0x23, 0x93, 0x02 },
+      { 0xE5, 0x0A, 0x93, 0x49, 0x6A, 0x10, 0x15, 0x30, 0xFF, 0x31, 0x77, 0x51,
+        0x31, 0x29, 0xC1, 0x0C, 0x20, 0x14, 0x56, 0xF6, 0xBA, 0x5B, 0x9D, 0x4A,
+        0xD2, 0x80, 0x96, 0x72, 0xD5, 0x76, 0xD2, 0x10, 0xAF, 0x84, 0xB4, 0x03 }, 0 },
+    { { 0x2C, 0x5E, 0x25, 0x14, 0xD9, 0xBE, 0x87, 0x8F, 0xDD, 0x65, 0x46, 0x5B,
+        0xE9, 0x97, 0x6D, 0x9B, 0x39, 0x39, 0x94, 0x39, 0x62, 0x39, 0x38, 0x85,
+        0x19, 0x1A, 0x5C, 0x7D, 0x2B, 0x52, 0xAE, 0x26, 0xCD, 0x7C, 0x9E, 0x00 },
+      { 0x2D, 0x63, 0xFB, 0x27, 0xEF, 0xA1, 0x52, 0xBA, 0xC7, 0x4F, 0xA3, 0x3E,
+        0x4E, 0xE1, 0x04, 0xEA, 0xAF, 0x0A, 0x80, 0x54, 0xDD, 0xEC, 0xB3, 0xC3,
+        0xB3, 0xB1, 0xA0, 0x1B, 0x22, 0xC9, 0x2B, 0xB8, 0xB8, 0xA9, 0xF8, 0x06 }, 0 },
+    { { 0x0E, 0xB1, 0xC3, 0x73, 0xB5, 0xCA, 0x6B, 0x39, 0xE8, 0x3A, 0xEF, 0xE3,
+        0x9B, 0x9B, 0x54, 0x5A, 0x0D, 0x07, 0xFC, 0x15, 0x41, 0x07, 0x1A, 0x7E,
+        0x96, 0xF1, 0x91, 0x49, 0xD8, 0xF4, 0xEB, 0x78, 0x33, 0x65, 0xDE, 0x02 },
+      { 0x63, 0x1E, 0x14, 0xBC, 0x9B, 0x6A, 0x93, 0x2D, 0xED, 0xE1, 0x6E, 0x50,
+        0x28, 0xFD, 0x2F, 0x27, 0xE5, 0x0F, 0x75, 0x93, 0x80, 0xAC, 0x43, 0xC5,
+        0x4E, 0x59, 0x82, 0x1E, 0xCB, 0x1A, 0x1A, 0xEA, 0x8D, 0xF6, 0xC3, 0x06 }, 0 },
+    { { 0xD6, 0x9B, 0x1D, 0x94, 0xB5, 0xA7, 0x46, 0x95, 0x62, 0x2E, 0xCA, 0x9B,
+        0x02, 0x70, 0x4C, 0xDD, 0x66, 0xF8, 0xE7, 0xCA, 0xE1, 0x2F, 0x27, 0x4A,
+        0xE4, 0x08, 0x57, 0x21, 0x22, 0x2D, 0x9B, 0x51, 0xE9, 0x05, 0x3D, 0x03 },
+      { 0x59, 0x18, 0x10, 0x5C, 0xFF, 0xAA, 0x38, 0x83, 0xCB, 0x80, 0x1F, 0x5C,
+        0x88, 0x10, 0xBD, 0x67, 0x6F, 0x1F, 0x6F, 0x8B, 0x29, 0xB5, 0x26, 0x76,
+        0xBA, 0x15, 0xA9, 0xDE, 0x98, 0xFA, 0x12, 0x0A, 0x46, 0x64, 0x14, 0x00 }, 0 },
+    { { 0x6F, 0xA5, 0x22, 0x95, 0x19, 0xB0, 0xC2, 0x64, 0xEE, 0xC6, 0x69, 0xB2,
+        0xB0, 0x2A, 0x14, 0xF8, 0x27, 0x70, 0x18, 0xA3, 0xDD, 0x0B, 0x59, 0x9B,
+        0x04, 0x88, 0x25, 0xC3, 0xCF, 0xC2, 0xDF, 0xC0, 0x09, 0x81, 0x32, 0x01 },
+      { 0xD3, 0x6D, 0xBF, 0x55, 0x82, 0xA9, 0x24, 0x06, 0x8C, 0x4B, 0x14, 0xF5,
+        0xFF, 0x67, 0x9D, 0x7F, 0x11, 0xBE, 0x18, 0x03, 0x50, 0x80, 0x32, 0x21,
+        0x55, 0xD6, 0xF0, 0xF2, 0xD0, 0x18, 0x2E, 0xB7, 0x86, 0xE8, 0x7F, 0x01 }, 0 },
+    { { 0xF1, 0x44, 0x19, 0x92, 0x26, 0xBA, 0xBE, 0xBE, 0x07, 0x98, 0x8D, 0x4F,
+        0x7B, 0xF6, 0x7B, 0x5B, 0xFF, 0x6E, 0x38, 0x87, 0x17, 0x12, 0xF6, 0xFC,
+        0x33, 0x20, 0xE7, 0xF5, 0x1E, 0xEA, 0x0B, 0xA1, 0x1B, 0xE6, 0x0E, 0x06 },
+      { 0xA2, 0xE9, 0x71, 0xCF, 0x9F, 0x8C, 0x60, 0xB5, 0xB4, 0x1B, 0xB3, 0x88,
+        0x7D, 0x6A, 0x04, 0x80, 0x97, 0xEB, 0xE9, 0xB9, 0x27, 0x0B, 0xAC, 0x56,
+        0x73, 0x29, 0x27, 0x3D, 0xE2, 0x20, 0x49, 0x84, 0xDB, 0xD6, 0xA3, 0x02 }, 0 },
+    { { 0xDC, 0x79, 0x76, 0x29, 0x60, 0xF2, 0x1C, 0xB1, 0xD9, 0x80, 0x70, 0xB0,
+        0x79, 0x34, 0xB4, 0xC5, 0x97, 0xFE, 0xAB, 0x72, 0x1A, 0xE5, 0xA4, 0x1E,
+        0xAC, 0x12, 0xEC, 0xD5, 0x0F, 0x48, 0xFC, 0xEF, 0xF6, 0x2E, 0x54, 0x00 },
+      { 0x49, 0x85, 0x9D, 0x2C, 0xA9, 0xFC, 0x53, 0xBE, 0x6D, 0x44, 0x5D, 0x45,
+        0xF6, 0x62, 0x16, 0x9E, 0xA0, 0x77, 0x92, 0x01, 0x66, 0x65, 0xF8, 0x26,
+        0x51, 0xEC, 0x48, 0xCD, 0x64, 0xA3, 0x39, 0x6E, 0xF1, 0xFC, 0x10, 0x04 }, 0 },
+    { { 0x5B, 0xF0, 0xB0, 0x04, 0x89, 0xD9, 0x3D, 0xD7, 0x5C, 0xFD, 0x33, 0x22,
+        0xC4, 0x45, 0x39, 0xAF, 0x7C, 0x40, 0x71, 0xC6, 0xD2, 0x31, 0x49, 0x71,
+        0x03, 0x48, 0xA8, 0xC0, 0x7D, 0xBB, 0xA8, 0xF8, 0xB8, 0xED, 0x40, 0x07 },
+      { 0xB4, 0x2B, 0xA0, 0x8E, 0x23, 0x11, 0x63, 0x71, 0xFD, 0xA0, 0x26, 0x94,
+        0x42, 0x16, 0x23, 0x70, 0x49, 0x35, 0x09, 0x9F, 0x38, 0xE0, 0xCD, 0x82,
+        0x87, 0xCA, 0x73, 0x11, 0xAB, 0xDA, 0xB9, 0x81, 0xB2, 0xEF, 0xA8, 0x01 }, 0 },
+    { { 0x7B, 0x5D, 0x1B, 0x6C, 0xB8, 0x1A, 0xE1, 0xF6, 0x23, 0x3C, 0xFB, 0x87,
+        0xF4, 0xC7, 0xE4, 0x93, 0x29, 0xE9, 0xA3, 0xC6, 0x95, 0x54, 0x96, 0x40,
+        0x49, 0x26, 0x91, 0x11, 0xB9, 0xFF, 0xC6, 0x46, 0xC0, 0xDD, 0x60, 0x00 },
+      { 0x34, 0xF9, 0xF9, 0x67, 0x56, 0xA7, 0xE8, 0xD0, 0x3E, 0xCD, 0xE4, 0x27,
+        0xB6, 0x66, 0x9A, 0x84, 0x48, 0x28, 0x9E, 0xA3, 0x47, 0x25, 0xC9, 0x58,
+        0xF3, 0xD1, 0x2A, 0xFC, 0x7F, 0xFD, 0xAE, 0xC8, 0xEB, 0xBF, 0x87, 0x01 }, 0 },
+    { { 0xB5, 0xA7, 0x46, 0x4C, 0xD0, 0x5E, 0x36, 0x96, 0x28, 0xC2, 0x17, 0xDA,
+        0xBD, 0x00, 0xCF, 0xC6, 0x39, 0x7A, 0xB0, 0xE9, 0x81, 0x8C, 0x70, 0xA6,
+        0xDD, 0x3F, 0x8C, 0xCC, 0xA3, 0xDF, 0x12, 0x2C, 0xFC, 0xAC, 0x7C, 0x03 },
+      { 0x0A, 0xFA, 0x6C, 0x9E, 0xF4, 0x0C, 0xB5, 0x5F, 0x72, 0x3A, 0x5B, 0xDB,
+        0xF2, 0x04, 0xE8, 0xD4, 0xE6, 0x18, 0x1C, 0x69, 0xAB, 0x0B, 0x82, 0xF6,
+        0x8F, 0x9B, 0xDE, 0x40, 0xE7, 0xB4, 0x97, 0xEA, 0xBA, 0x89, 0x92, 0x03 }, 0 },
+    { { 0x1A, 0x4C, 0xB6, 0x66, 0x55, 0xFD, 0x8F, 0x09, 0x10, 0x4E, 0xD5, 0x31,
+        0x18, 0x93, 0xB1, 0x0E, 0x95, 0xBF, 0x08, 0x06, 0x0D, 0x38, 0x5B, 0x3C,
+        0x7A, 0x88, 0x72, 0x7B, 0x48, 0x93, 0x5A, 0x27, 0x43, 0x47, 0xE2, 0x03 },
+      { 0xB4, 0x69, 0x1B, 0xE7, 0x06, 0x75, 0x99, 0xD1, 0x24, 0xFC, 0x3A, 0x8D,
+        0x28, 0x18, 0x05, 0x09, 0x6F, 0xC9, 0x5F, 0xDC, 0xEF, 0x25, 0x7F, 0xFB,
+        0xD8, 0xFA, 0xD1, 0xAD, 0x54, 0x73, 0xE3, 0xB3, 0x56, 0x63, 0xE3, 0x03 }, 0 },
+    { { 0x14, 0xFF, 0xE0, 0xAB, 0x98, 0x1F, 0x0E, 0xA7, 0x57, 0x96, 0x6B, 0xDC,
+        0x2D, 0xAB, 0x0D, 0x29, 0x29, 0xB4, 0x6B, 0x5A, 0x10, 0x29, 0x0C, 0xCF,
+        0x23, 0xE9, 0xC1, 0x2B, 0x7A, 0x3E, 0x80, 0xF7, 0x80, 0x1C, 0xBA, 0x06 },
+      { 0xE2, 0xBA, 0xB2, 0x81, 0x56, 0x68, 0x90, 0x0B, 0xCD, 0x66, 0x85, 0xC7,
+        0x5A, 0x0F, 0x34, 0x4E, 0xC3, 0x03, 0x53, 0xF9, 0xE9, 0x7C, 0x46, 0xE8,
+        0xDA, 0xF7, 0xA9, 0xCE, 0xB1, 0xC1, 0x6F, 0x01, 0x2E, 0x74, 0x8F, 0x03 }, 0 },
+    { { 0x61, 0x82, 0xA9, 0xE0, 0x1C, 0xD8, 0x61, 0x0F, 0x31, 0x27, 0x93, 0x65,
+        0x79, 0xA2, 0xC9, 0xF7, 0x9F, 0x95, 0x60, 0x7E, 0xFA, 0x80, 0x0F, 0x1E,
+        0xA3, 0xD3, 0x09, 0x9C, 0x1A, 0x57, 0xCF, 0x58, 0x2C, 0x96, 0xB2, 0x04 },
+      { 0x4A, 0xB6, 0xFA, 0x48, 0x3B, 0xF6, 0xEC, 0x5C, 0xFE, 0x4D, 0xCE, 0xEB,
+        0x78, 0x6F, 0x65, 0x19, 0x3D, 0xB6, 0xBA, 0x09, 0x2A, 0x8B, 0x36, 0xE7,
+        0xBB, 0x18, 0x8B, 0x55, 0xCF, 0x08, 0x3B, 0x27, 0x0B, 0x6C, 0xFD, 0x02 }, 0 },
+    { { 0xC1, 0x4E, 0x14, 0x04, 0x8D, 0xA0, 0x16, 0x1E, 0x24, 0x62, 0xBB, 0x35,
+        0xF1, 0xF0, 0x68, 0x91, 0x61, 0x6E, 0x0D, 0x01, 0x11, 0xED, 0x65, 0x48,
+        0x99, 0x7B, 0x13, 0xDA, 0xC5, 0xDF, 0x8A, 0xEE, 0x2B, 0xBE, 0x57, 0x05 },
+      { 0x0A, 0x67, 0x88, 0xD7, 0xE1, 0xA4, 0xD1, 0x76, 0x4E, 0x1A, 0x49, 0x9F,
+        0xD9, 0xBE, 0x08, 0x14, 0xDE, 0x62, 0x1C, 0x5A, 0x04, 0x14, 0xF1, 0x10,
+        0x47, 0xD0, 0xCA, 0x98, 0x91, 0x69, 0x8C, 0xEA, 0x80, 0x86, 0x22, 0x03 }, 0 },
+    { { 0x39, 0x2D, 0x5C, 0xCE, 0xFE, 0xF7, 0xA4, 0xE9, 0x52, 0xF8, 0x80, 0x52,
+        0x93, 0x4C, 0x77, 0x9D, 0xCC, 0xDC, 0x7E, 0x0F, 0x06, 0x92, 0x45, 0x56,
+        0x52, 0xFC, 0x8F, 0x8B, 0x63, 0x56, 0x97, 0x7D, 0x95, 0xD0, 0x7F, 0x00 },
+      { 0x3F, 0xD0, 0xEE, 0xD1, 0x10, 0x71, 0xBB, 0xFD, 0x22, 0x84, 0x76, 0x74,
+        0x32, 0x42, 0x1D, 0xC6, 0x2B, 0x2E, 0x1F, 0x4D, 0x4D, 0xF9, 0xE8, 0x68,
+        0xFC, 0xAA, 0x66, 0x88, 0xF6, 0x95, 0x46, 0xA7, 0x2E, 0x41, 0x39, 0x04 }, 0 },
+    { { 0xE3, 0x12, 0xBA, 0xD4, 0x45, 0xCA, 0x71, 0xAE, 0xBD, 0x0E, 0x5D, 0x44,
+        0xE4, 0xBB, 0x06, 0x36, 0xF5, 0x6C, 0x12, 0xB6, 0xCC, 0x27, 0x77, 0x40,
+        0xE1, 0x28, 0xDD, 0x0B, 0x34, 0xB9, 0x2D, 0xBA, 0xB2, 0xBE, 0x96, 0x03 },
+      { 0xC3, 0xC7, 0x19, 0x3A, 0x11, 0x88, 0x5E, 0x36, 0xC0, 0x29, 0x28, 0x20,
+        0x61, 0x2F, 0xB7, 0x0D, 0x07, 0x68, 0xC7, 0x3C, 0xC4, 0x5A, 0x99, 0x80,
+        0x3A, 0xAA, 0xB5, 0x45, 0xD4, 0x28, 0x3E, 0x9D, 0xD6, 0xF2, 0x4F, 0x02 }, 0 },
+    { { 0xF5, 0xEF, 0x53, 0x4A, 0x4B, 0x65, 0xBF, 0x6D, 0xE2, 0xFB, 0xB7, 0xD8,
+        0xA8, 0xF0, 0x47, 0xD0, 0xF5, 0x0F, 0x96, 0x40, 0x61, 0x85, 0x90, 0x21,
+        0xEF, 0xE9, 0x1D, 0x05, 0xA7, 0xA0, 0xA1, 0x85, 0x22, 0xD1, 0xC6, 0x00 },
+      { 0xD4, 0xC9, 0x71, 0x88, 0xE0, 0x6C, 0x60, 0x99, 0x54, 0x57, 0xD7, 0x2E,
+        0x4B, 0x7B, 0xB7, 0xF2, 0x0C, 0xC4, 0x8C, 0x1F, 0x5E, 0x5C, 0x79, 0xFE,
+        0x02, 0x92, 0x3B, 0xD1, 0x80, 0x98, 0x47, 0x08, 0x2A, 0xF3, 0xE7, 0x02 }, 0 },
+    { { 0x7E, 0xB6, 0x60, 0xE7, 0x07, 0xA0, 0x2E, 0xCF, 0x1A, 0x31, 0xEE, 0x50,
+        0x03, 0xAE, 0x7C, 0x2D, 0xCC, 0x95, 0xD7, 0x1F, 0x5F, 0xEA, 0x12, 0xAD,
+        0xD2, 0xCC, 0xE3, 0x2B, 0xD9, 0xF5, 0xD9, 0xB1, 0x46, 0x5B, 0xA6, 0x01 },
+      { 0xC6, 0xC8, 0x9D, 0xA7, 0x79, 0x49, 0x65, 0xF0, 0xFD, 0xDC, 0x51, 0x73,
+        0x57, 0x1D, 0xFB, 0x54, 0x5D, 0xB9, 0x08, 0x64, 0x92, 0xEE, 0xC5, 0x28,
+        0x22, 0xEF, 0x5D, 0xC7, 0xF7, 0x2E, 0x17, 0x82, 0xFC, 0xEE, 0xC6, 0x03 }, 0 },
+    { { 0xA7, 0x04, 0x3B, 0x60, 0x1B, 0xD2, 0x0F, 0x26, 0x73, 0x79, 0x64, 0x76,
+        0xFB, 0xB2, 0xD6, 0xEF, 0x7C, 0x62, 0x48, 0xD3, 0x7D, 0x6E, 0x18, 0x48,
+        0x0B, 0x7C, 0xAE, 0xF1, 0xC2, 0xAF, 0x60, 0xBD, 0xF2, 0xFB, 0xA0, 0x07 },
+      { 0x34, 0x1B, 0xAA, 0x16, 0x7E, 0x29, 0x9A, 0xBA, 0xCE, 0x93, 0x6A, 0xF0,
+        0xAF, 0x34, 0xAD, 0xD3, 0x20, 0xFC, 0xF7, 0x04, 0x51, 0x90, 0x98, 0x8A,
+        0x37, 0x7F, 0xD2, 0x5A, 0x83, 0x01, 0xA7, 0x5A, 0xF2, 0x51, 0x97, 0x05 }, 0 },
+    { { 0x74, 0x71, 0x68, 0xD8, 0x41, 0xD6, 0x48, 0x33, 0xE1, 0x9D, 0x14, 0x52,
+        0xFF, 0xF1, 0x77, 0x90, 0x98, 0xC8, 0x6E, 0x2E, 0x13, 0x08, 0xCE, 0xB4,
+        0x3C, 0xF0, 0xE1, 0x20, 0x3A, 0xFB, 0x57, 0x5C, 0xDE, 0x67, 0x30, 0x06 },
+      { 0xAA, 0xC5, 0x38, 0x56, 0xD9, 0xF3, 0xE9, 0xE4, 0x1D, 0x5D, 0xD7, 0x13,
+        0x4F, 0xFC, 0xA5, 0x23, 0x87, 0xE2, 0xD3, 0x70, 0x4C, 0x8B, 0x4A, 0x98,
+        0x57, 0x71, 0x8B, 0x45, 0x09, 0x85, 0x94, 0x55, 0x7D, 0xE2, 0x5C, 0x05 }, 0 },
+    { { 0xCD, 0xB6, 0xD8, 0x44, 0x74, 0xD7, 0x3E, 0x2C, 0x3A, 0xC6, 0xCE, 0xE2,
+        0xD3, 0x1C, 0xE0, 0xC2, 0xCE, 0x95, 0x14, 0x00, 0xA2, 0xE5, 0xE2, 0x63,
+        0x72, 0xFD, 0x45, 0xF6, 0xDE, 0xCC, 0x01, 0xCD, 0xE4, 0xDB, 0xB4, 0x07 },
+      { 0x53, 0x38, 0x6D, 0xBA, 0x09, 0xF6, 0x46, 0xCF, 0x21, 0x81, 0x71, 0x46,
+        0x8B, 0xF8, 0x62, 0x5A, 0x4B, 0x6F, 0x7F, 0xC5, 0x43, 0x0F, 0xAB, 0xC6,
+        0x89, 0x21, 0x5B, 0xEF, 0xD9, 0xC3, 0x3D, 0x34, 0xAB, 0xFD, 0x5C, 0x01 }, 0 },
+    { { 0x3F, 0x6F, 0x09, 0x03, 0xDA, 0x15, 0x95, 0x42, 0xFD, 0xD3, 0x5A, 0x1B,
+        0x9B, 0x86, 0x26, 0x0F, 0x69, 0xC3, 0x29, 0x3E, 0x80, 0x6F, 0xA7, 0x51,
+        0x4F, 0x38, 0x67, 0x6F, 0xB2, 0x07, 0x8F, 0x13, 0xCF, 0xFF, 0x89, 0x06 },
+      { 0x05, 0xEB, 0x1D, 0xC9, 0x1C, 0xFB, 0xBB, 0x49, 0xE5, 0x59, 0x1C, 0x3A,
+        0x4A, 0x76, 0xF6, 0x72, 0xFE, 0x67, 0xAA, 0x2B, 0x97, 0xEF, 0x42, 0x8D,
+        0x2A, 0x48, 0x93, 0x58, 0x03, 0x56, 0x02, 0xB7, 0xC6, 0xFF, 0x91, 0x00 }, 0 },
+    { { 0x19, 0x6E, 0xEE, 0x40, 0x76, 0xE9, 0x4B, 0x33, 0x6E, 0x5E, 0x4A, 0xDF,
+        0x94, 0x12, 0x57, 0x0F, 0x71, 0x70, 0xC1, 0xAD, 0xCB, 0x60, 0xA6, 0x94,
+        0x82, 0x57, 0xB4, 0xE4, 0x4D, 0xA1, 0x29, 0x2E, 0xCB, 0xCB, 0x6A, 0x06 },
+      { 0x04, 0x46, 0x60, 0xDB, 0xCA, 0x6D, 0x2B, 0x0C, 0x2C, 0x01, 0x31, 0x50,
+        0x22, 0xA0, 0x93, 0xDF, 0x1E, 0xC9, 0x8B, 0x05, 0xAD, 0xB5, 0x8C, 0x2A,
+        0x76, 0x86, 0x60, 0xBC, 0xF7, 0x70, 0x5C, 0x88, 0x7B, 0xDC, 0xDD, 0x00 }, 0 },
+    { { 0x07, 0x67, 0xDE, 0x27, 0x20, 0x22, 0xF7, 0x40, 0x60, 0xF3, 0xFD, 0xB9,
+        0x7A, 0xE5, 0xA1, 0x44, 0xDF, 0xFB, 0xB0, 0x51, 0x80, 0x47, 0x6F, 0xF0,
+        0xBD, 0x29, 0xD5, 0x0A, 0x48, 0x4C, 0xF1, 0x55, 0x19, 0x8D, 0x9C, 0x03 },
+      { 0xB4, 0xC9, 0x9A, 0xCE, 0x4C, 0x5C, 0x48, 0x06, 0xEF, 0x68, 0x0F, 0x12,
+        0x3A, 0x46, 0xD3, 0x4C, 0xD1, 0x48, 0x74, 0x52, 0x50, 0x4E, 0x8A, 0xA3,
+        0xF2, 0x41, 0x78, 0xBA, 0x54, 0xB3, 0xE7, 0xE6, 0xE0, 0x9A, 0x2C, 0x02 }, 0 },
+    { { 0x94, 0x87, 0xC9, 0xD2, 0xD0, 0x7F, 0x96, 0xAF, 0x54, 0x39, 0xB2, 0x9D,
+        0x44, 0xCD, 0x89, 0xC8, 0x3B, 0xD6, 0x77, 0x86, 0xD5, 0x15, 0xCA, 0x0F,
+        0x42, 0x5E, 0x2D, 0x20, 0x2A, 0xCA, 0xEC, 0x35, 0xD3, 0x02, 0xDF, 0x05 },
+      { 0xCC, 0xD6, 0x58, 0x6B, 0xA3, 0x9F, 0xEA, 0x54, 0xED, 0x37, 0xDB, 0xFB,
+        0x18, 0x32, 0x85, 0xC5, 0x28, 0x36, 0xEA, 0x42, 0x94, 0x62, 0x46, 0x39,
+        0x71, 0x6A, 0x8A, 0x2B, 0x27, 0x17, 0xB7, 0x56, 0x14, 0xEF, 0xE7, 0x04 }, 0 },
+    { { 0x85, 0x90, 0x0E, 0x99, 0x92, 0xB8, 0x8B, 0xDF, 0xEE, 0x45, 0xC6, 0xEA,
+        0xAB, 0xE6, 0x62, 0x35, 0xAD, 0x2D, 0xC1, 0x46, 0x56, 0xCC, 0x16, 0x5F,
+        0x81, 0xC4, 0x64, 0xFC, 0xBA, 0x2A, 0xE8, 0x0F, 0x81, 0xBA, 0xA5, 0x04 },
+      { 0x86, 0xA9, 0x2F, 0x03, 0x88, 0x85, 0xD8, 0x5F, 0x5A, 0x99, 0xB0, 0x22,
+        0x2B, 0xDD, 0xC9, 0x5A, 0x32, 0xF4, 0x2E, 0x87, 0x35, 0x38, 0x36, 0x1F,
+        0xFF, 0x0E, 0x86, 0x8A, 0x7C, 0x3B, 0x07, 0x48, 0xC6, 0x72, 0x4E, 0x04 }, 0 },
+    { { 0x93, 0xDA, 0x3F, 0xE4, 0x09, 0x88, 0x53, 0x6F, 0x6C, 0x2F, 0x0C, 0x22,
+        0xE6, 0x63, 0xDF, 0x00, 0xBC, 0x03, 0xE2, 0xF2, 0x65, 0x69, 0x91, 0x3F,
+        0xB9, 0x14, 0x15, 0xF4, 0x92, 0x7E, 0x18, 0x25, 0xD1, 0xD0, 0xF4, 0x06 },
+      { 0x2E, 0x6A, 0x10, 0x0A, 0x2B, 0xDB, 0x07, 0x1F, 0x79, 0x76, 0xF9, 0x6E,
+        0x8B, 0xA1, 0x99, 0xF9, 0x3C, 0x42, 0x43, 0x9F, 0x25, 0x69, 0x57, 0xE0,
+        0xDA, 0xF3, 0x15, 0x3A, 0x6B, 0x88, 0x7C, 0x32, 0xEA, 0xAB, 0x64, 0x04 }, 0 },
+    { { 0x96, 0x60, 0xF1, 0xE7, 0xD0, 0xB9, 0x03, 0x5A, 0xFF, 0xA5, 0x7F, 0x7B,
+        0xB9, 0x90, 0x9E, 0x81, 0x17, 0x58, 0x95, 0x64, 0x48, 0x2A, 0x66, 0x4E,
+        0xB3, 0x0B, 0x5A, 0x83, 0x71, 0xE0, 0x3C, 0xF3, 0x10, 0x07, 0x75, 0x06 },
+      { 0xB8, 0x10, 0x87, 0x58, 0xD7, 0x69, 0xE8, 0xA1, 0xB2, 0x56, 0x61, 0x7B,
+        0x8A, 0x59, 0x15, 0x66, 0x0F, 0xE1, 0x0B, 0x4A, 0x12, 0x06, 0x29, 0x8E,
+        0x9A, 0xD2, 0xA3, 0x43, 0xA4, 0xCC, 0x56, 0xB5, 0x8A, 0x91, 0x00, 0x03 }, 0 },
+    { { 0xC3, 0x3B, 0x64, 0xEF, 0x65, 0xCA, 0xA1, 0x44, 0xCC, 0x81, 0x88, 0x1B,
+        0xAB, 0xDC, 0x51, 0x33, 0xB7, 0x92, 0x58, 0xBB, 0x11, 0xFE, 0x52, 0x8D,
+        0x99, 0xB9, 0x8D, 0xF6, 0xCC, 0xA0, 0x05, 0xC3, 0x88, 0xC8, 0x10, 0x01 },
+      { 0xE1, 0xA6, 0x31, 0x08, 0x62, 0xF6, 0x87, 0xC8, 0xC5, 0xDC, 0x78, 0x72,
+        0xC5, 0x39, 0x37, 0x56, 0x41, 0x70, 0xCA, 0x19, 0xD8, 0xA0, 0x9E, 0x0A,
+        0x05, 0x62, 0x67, 0xE6, 0x59, 0xBC, 0x67, 0xB6, 0x40, 0xCA, 0x36, 0x06 }, 0 },
+    { { 0x53, 0x32, 0x31, 0xE2, 0x1E, 0xC9, 0x0B, 0x4D, 0xD0, 0xD1, 0x24, 0x1B,
+        0xF2, 0x2F, 0x68, 0x31, 0x58, 0x33, 0x86, 0x8C, 0x40, 0xB0, 0x24, 0xCA,
+        0x93, 0xDC, 0x72, 0x7B, 0x8B, 0x84, 0x04, 0xD0, 0x32, 0xB6, 0x71, 0x04 },
+      { 0xAC, 0x1D, 0xC7, 0x10, 0xFC, 0x77, 0x2A, 0xE1, 0xB6, 0x59, 0xAA, 0x77,
+        0xBE, 0xE2, 0xAB, 0x6E, 0xBA, 0x81, 0x9E, 0xD1, 0x70, 0xF3, 0xD9, 0x2F,
+        0xF3, 0xA5, 0x82, 0xE8, 0x0D, 0xF8, 0x26, 0x62, 0x8C, 0x9C, 0x73, 0x00 }, 0 },
+    { { 0xB5, 0x62, 0xCA, 0xDC, 0xCA, 0x81, 0x01, 0x6C, 0xF9, 0x70, 0xCF, 0xC9,
+        0x13, 0x0F, 0x5A, 0x57, 0x3E, 0x51, 0xFF, 0xC6, 0x9F, 0x0D, 0xFC, 0xED,
+        0x2F, 0xAE, 0xA5, 0x59, 0x10, 0xE9, 0x61, 0xE4, 0xC2, 0xF4, 0xDC, 0x03 },
+      { 0x19, 0x0B, 0x2B, 0x47, 0xE4, 0x47, 0xC2, 0xC9, 0xF4, 0x00, 0x79, 0xCF,
+        0xF4, 0xC4, 0xAB, 0x13, 0xE9, 0x0B, 0x49, 0x6B, 0xDF, 0x43, 0x59, 0x44,
+        0x1C, 0xC8, 0xC4, 0xE1, 0xE3, 0x95, 0x4B, 0xFE, 0x87, 0xB2, 0xDE, 0x05 }, 0 },
+    { { 0x65, 0x80, 0xA8, 0xE0, 0xB3, 0xF9, 0xC4, 0x08, 0x34, 0x5D, 0x09, 0x51,
+        0x12, 0xB2, 0x6A, 0x00, 0x98, 0xBC, 0x9F, 0xDC, 0xD8, 0xBD, 0x5B, 0x02,
+        0x5B, 0x24, 0x9F, 0x6C, 0xFB, 0x79, 0x3F, 0x9E, 0xDC, 0xB0, 0x84, 0x07 },
+      { 0xF3, 0xF3, 0x32, 0x8D, 0xE7, 0x03, 0x00, 0x83, 0xCE, 0x01, 0xA2, 0x4D,
+        0x35, 0x45, 0x82, 0x89, 0x17, 0x94, 0x0C, 0x96, 0x80, 0x6E, 0xA2, 0x9A,
+        0x17, 0x30, 0xF6, 0xA6, 0x00, 0xBC, 0x82, 0x51, 0x06, 0xAB, 0x16, 0x05 }, 0 },
+    { { 0x97, 0x58, 0xA0, 0x18, 0xC6, 0x6F, 0xC0, 0x7F, 0x6C, 0x5A, 0xA1, 0x4D,
+        0x57, 0xFC, 0x23, 0x85, 0x06, 0x74, 0xB4, 0x99, 0x72, 0xFF, 0x7D, 0xD0,
+        0x8C, 0x80, 0xB0, 0xB9, 0x79, 0xAC, 0xBE, 0x58, 0x21, 0xE2, 0x30, 0x05 },
+      { 0x9A, 0x8F, 0xCD, 0x52, 0xE5, 0x01, 0x87, 0xD4, 0x9B, 0xE7, 0x17, 0x84,
+        0x51, 0x82, 0xC1, 0xB5, 0xA2, 0x3E, 0x35, 0xBE, 0xF5, 0xAA, 0x09, 0x0F,
+        0xB5, 0xEA, 0x64, 0xB7, 0xF5, 0x17, 0x21, 0x62, 0xE3, 0x1C, 0x87, 0x04 }, 0 },
+    { { 0x00, 0x61, 0xDE, 0x6D, 0xBB, 0x2C, 0xED, 0x98, 0x9B, 0x15, 0x4B, 0x52,
+        0xE3, 0xBA, 0xD9, 0x10, 0xA0, 0x2E, 0x65, 0x32, 0x11, 0xD9, 0xCC, 0x0C,
+        0x3E, 0xBD, 0x61, 0xAE, 0x3D, 0x06, 0x71, 0x0C, 0x6D, 0x10, 0x77, 0x00 },
+      { 0x87, 0xDD, 0xA8, 0x76, 0x63, 0x15, 0x06, 0x97, 0xA8, 0x96, 0x5F, 0xD3,
+        0x5F, 0x58, 0xDF, 0x21, 0x90, 0x74, 0x95, 0x20, 0xA7, 0x1D, 0xEF, 0xA8,
+        0x85, 0x4C, 0x7E, 0xED, 0xC6, 0xB7, 0x3A, 0xBB, 0xAB, 0x44, 0x91, 0x04 }, 0 },
+    { { 0xFD, 0x05, 0x29, 0xE8, 0x59, 0x31, 0x0D, 0x3E, 0x33, 0x03, 0xCB, 0xF1,
+        0x00, 0x5C, 0x33, 0x5A, 0x1F, 0xB5, 0x68, 0xCE, 0x21, 0xCA, 0xE2, 0x79,
+        0x8A, 0xA1, 0x95, 0x17, 0x88, 0xC0, 0x41, 0xE2, 0xC1, 0xCD, 0xC2, 0x02 },
+      { 0x41, 0x80, 0xDC, 0x2A, 0xE1, 0x6B, 0xD4, 0xF8, 0xCE, 0x15, 0x9B, 0xBC,
+        0x4B, 0xC0, 0xBA, 0xBE, 0x0E, 0x4F, 0x47, 0x9F, 0xC7, 0x24, 0x7E, 0xE6,
+        0xEB, 0x23, 0xBB, 0xCD, 0x4E, 0x94, 0x18, 0x7C, 0x8C, 0xA5, 0xB7, 0x07 }, 0 },
+    { { 0xBE, 0x9A, 0x9C, 0x5E, 0x8E, 0xEC, 0x49, 0x4F, 0x15, 0xE4, 0x09, 0xDF,
+        0x67, 0x23, 0xCE, 0xC9, 0xFF, 0x61, 0x64, 0x49, 0x53, 0x22, 0x70, 0x20,
+        0x42, 0x53, 0xC5, 0xC3, 0x28, 0x6D, 0x37, 0x6F, 0x95, 0x1D, 0x67, 0x03 },
+      { 0xB2, 0x61, 0xCB, 0x57, 0x20, 0xC2, 0x34, 0x8F, 0x41, 0xEC, 0xF1, 0xEC,
+        0x38, 0xCF, 0xD5, 0xC0, 0x28, 0x37, 0x20, 0x4A, 0x5D, 0xD8, 0xF8, 0x82,
+        0x32, 0x03, 0x12, 0x90, 0x42, 0xD2, 0x63, 0xE8, 0x86, 0xED, 0xDE, 0x04 }, 0 },
+    { { 0xC6, 0xB8, 0x92, 0xEA, 0x42, 0x6B, 0x2B, 0x14, 0x58, 0xA3, 0x7D, 0xB6,
+        0x85, 0x2D, 0x7E, 0xEF, 0x11, 0x6B, 0xF1, 0x48, 0xF4, 0x8A, 0xB3, 0x8A,
+        0x36, 0x63, 0x24, 0x69, 0xF7, 0xA8, 0x94, 0x48, 0xCC, 0x19, 0x20, 0x03 },
+      { 0x49, 0xE0, 0x2D, 0x1B, 0x61, 0x10, 0xC2, 0x66, 0x30, 0x33, 0xE9, 0x9C,
+        0x70, 0x51, 0xA9, 0xD1, 0x87, 0xF4, 0xBB, 0xC8, 0x1F, 0x74, 0xF3, 0x7D,
+        0xE7, 0x05, 0x35, 0x28, 0x1D, 0x8A, 0x3D, 0x10, 0xF1, 0x58, 0xD9, 0x04 }, 0 },
+    { { 0xB5, 0xE7, 0x54, 0x5D, 0xE0, 0x37, 0x01, 0x3C, 0x49, 0xA0, 0x32, 0x55,
+        0xA7, 0x96, 0x04, 0x28, 0x2B, 0xDF, 0x74, 0xD5, 0x23, 0x44, 0x6D, 0x66,
+        0x18, 0xAF, 0x91, 0x11, 0xA4, 0x33, 0x3D, 0x03, 0xDE, 0xAF, 0x78, 0x06 },
+      { 0x29, 0xD3, 0xC9, 0x3F, 0xA6, 0xFA, 0x50, 0xB0, 0xF1, 0x3E, 0x0A, 0x04,
+        0x1A, 0x9C, 0x4D, 0x77, 0xDA, 0xF0, 0xDE, 0x3E, 0x3B, 0xCC, 0x19, 0x12,
+        0xB4, 0xEB, 0x35, 0x27, 0x23, 0x08, 0xD9, 0xF3, 0x8E, 0x31, 0x6B, 0x01 }, 0 },
+    { { 0xB6, 0x45, 0x28, 0xDF, 0xF7, 0x4A, 0xB6, 0x2C, 0x04, 0xA1, 0xC9, 0x77,
+        0x01, 0x5C, 0xEE, 0xD1, 0x1B, 0xA2, 0x9C, 0xD1, 0x53, 0x9B, 0x2A, 0x44,
+        0xBC, 0x65, 0xD6, 0x1A, 0x18, 0x51, 0xF8, 0xB3, 0x2A, 0x6F, 0x1B, 0x05 },
+      { 0xF9, 0x5C, 0x6B, 0x3C, 0x12, 0xB4, 0xF3, 0xB6, 0xB7, 0xA9, 0x8A, 0x6C,
+        0x52, 0x77, 0x97, 0x40, 0xCB, 0xBC, 0xF9, 0x4B, 0x6C, 0x4D, 0x9F, 0xB8,
+        0xA4, 0xB8, 0xC1, 0x07, 0xEC, 0xF2, 0x6E, 0xDD, 0x06, 0xDF, 0x65, 0x04 }, 0 },
+    { { 0x33, 0xA3, 0xD0, 0x77, 0x5C, 0x3A, 0x44, 0x90, 0xFA, 0xC6, 0xA9, 0xE8,
+        0x13, 0xD6, 0xED, 0x4B, 0xA3, 0x06, 0x1C, 0x08, 0x69, 0x5A, 0x24, 0xBB,
+        0x9D, 0x2F, 0x9B, 0x1C, 0xA2, 0xFE, 0x02, 0xC9, 0xA8, 0xC6, 0xCC, 0x07 },
+      { 0x05, 0x79, 0x9F, 0x89, 0x50, 0x3F, 0x8B, 0xCF, 0x1E, 0x86, 0x4E, 0x15,
+        0x4A, 0x2E, 0xDF, 0xA8, 0x8A, 0x5E, 0x12, 0xD5, 0xC3, 0xF7, 0x70, 0xEA,
+        0x48, 0x90, 0x58, 0xFE, 0x18, 0x3F, 0x69, 0x22, 0x4C, 0x61, 0x6B, 0x01 }, 0 },
+    { { 0xCA, 0x9B, 0x4D, 0xB3, 0xC1, 0xF7, 0x11, 0x85, 0x9E, 0xDD, 0x75, 0x16,
+        0x02, 0x22, 0x02, 0xC4, 0x65, 0xE0, 0x43, 0x9E, 0x63, 0xA8, 0xFF, 0x39,
+        0x4D, 0x88, 0xBC, 0x77, 0x42, 0xA2, 0x2D, 0xC3, 0x11, 0x3F, 0xF5, 0x04 },
+      { 0x63, 0xC7, 0x61, 0x1B, 0xFC, 0x4C, 0x14, 0xD7, 0xF0, 0x4B, 0x4B, 0x12,
+        0xB7, 0x2A, 0x96, 0xAD, 0x2A, 0x98, 0x3E, 0x98, 0x74, 0x31, 0xC5, 0x97,
+        0xD8, 0x89, 0x9A, 0x7E, 0xDE, 0xFC, 0xA1, 0x8F, 0xCD, 0x33, 0xD9, 0x01 }, 0 },
+    { { 0x06, 0x3D, 0x68, 0x49, 0x64, 0xA2, 0xE2, 0x25, 0x4D, 0x82, 0x65, 0x9C,
+        0xEF, 0x26, 0xF8, 0xA3, 0x1A, 0xD4, 0x34, 0xA0, 0xB3, 0xC2, 0xFA, 0xC6,
+        0xC2, 0x26, 0xC2, 0xED, 0x63, 0x86, 0x18, 0x37, 0xD5, 0x39, 0x30, 0x06 },
+      { 0x74, 0xD2, 0xEF, 0x97, 0xBA, 0xBC, 0x22, 0xDD, 0x24, 0xC6, 0x9D, 0x4C,
+        0x78, 0x87, 0x06, 0x3D, 0x6F, 0xEB, 0xFB, 0xD8, 0x7F, 0x7E, 0xEF, 0x7E,
+        0xBF, 0x13, 0xA7, 0x84, 0x1D, 0xAE, 0xD4, 0x3B, 0xE1, 0xBD, 0xF1, 0x01 }, 0 },
+    { { 0x25, 0xFC, 0xE3, 0xF6, 0x96, 0x50, 0x18, 0x44, 0x39, 0x75, 0x3F, 0x81,
+        0xFD, 0x54, 0xA6, 0xC8, 0x4F, 0xDA, 0x79, 0xE3, 0x11, 0xCE, 0xEE, 0xC8,
+        0x31, 0xE4, 0x50, 0xE7, 0x21, 0x49, 0xC7, 0x5C, 0xD6, 0xB2, 0xE6, 0x05 },
+      { 0xB0, 0xE7, 0x2B, 0x49, 0xC6, 0x90, 0x9B, 0x29, 0xFB, 0x34, 0x95, 0x9D,
+        0x84, 0x92, 0xB6, 0xA4, 0x0C, 0xE1, 0x2C, 0x50, 0xB3, 0x35, 0x86, 0xF3,
+        0xFB, 0xA8, 0x91, 0xAB, 0xF0, 0x1E, 0x68, 0x02, 0x30, 0xCF, 0xB0, 0x05 }, 0 },
+    { { 0xBD, 0xA6, 0x98, 0xF1, 0x56, 0x3D, 0x8D, 0x77, 0x81, 0x27, 0xA3, 0xB6,
+        0x40, 0x49, 0x21, 0x19, 0xFE, 0x98, 0x18, 0x7D, 0x23, 0xC2, 0x59, 0xB5,
+        0xCB, 0x65, 0xEC, 0x4C, 0x3B, 0x6C, 0x0D, 0x3E, 0x71, 0xE4, 0x03, 0x05 },
+      { 0xAB, 0x5E, 0xF1, 0x51, 0xE0, 0xB3, 0x52, 0xD2, 0xD2, 0x9E, 0x18, 0x77,
+        0x01, 0xBA, 0xE3, 0xD4, 0x16, 0xD0, 0x6F, 0x0C, 0xAF, 0xAB, 0x2F, 0x99,
+        0x1D, 0x4C, 0xF2, 0x5E, 0x23, 0xF4, 0x0D, 0xD1, 0x59, 0x40, 0xDD, 0x00 }, 0 },
+    { { 0x5E, 0x11, 0xBD, 0x1B, 0xC2, 0xE9, 0x82, 0xDC, 0x91, 0xC7, 0xEB, 0x7A,
+        0x91, 0x70, 0x9A, 0x0F, 0x54, 0xD4, 0x8D, 0x35, 0xEA, 0xDF, 0x87, 0xA8,
+        0x1F, 0xCF, 0x4C, 0x07, 0x51, 0x8F, 0x24, 0xDD, 0x95, 0x66, 0xC5, 0x05 },
+      { 0x18, 0x06, 0xB9, 0x6C, 0xFC, 0xD7, 0xC0, 0xDB, 0x7E, 0x90, 0x92, 0x30,
+        0x21, 0x6A, 0x75, 0xBF, 0xCF, 0x91, 0xC1, 0x44, 0x1E, 0xD0, 0x98, 0xC8,
+        0x6B, 0x36, 0x9B, 0x11, 0xF9, 0xA7, 0xDF, 0x37, 0x48, 0x48, 0xA9, 0x02 }, 0 },
+    { { 0xB9, 0xEB, 0x12, 0x22, 0x64, 0x10, 0xE7, 0x81, 0xD3, 0xFA, 0x46, 0x21,
+        0xA6, 0xA5, 0x40, 0x25, 0xEF, 0x2F, 0x5B, 0xAE, 0xC9, 0xCE, 0x7E, 0x9A,
+        0x4E, 0x51, 0x74, 0xB3, 0xFB, 0x1C, 0x0B, 0x48, 0x0C, 0xD3, 0xD4, 0x01 },
+      { 0x67, 0x09, 0x1D, 0xB9, 0xFB, 0x22, 0x1F, 0x5B, 0xD4, 0xF8, 0x88, 0x3D,
+        0x41, 0x96, 0x69, 0x9A, 0xA8, 0xF0, 0xA9, 0x71, 0x22, 0x38, 0x72, 0x94,
+        0xC2, 0x0E, 0x52, 0xA2, 0xD0, 0xDF, 0xFF, 0x6D, 0xE2, 0xCB, 0x76, 0x00 }, 0 },
+    { { 0x3C, 0xCD, 0xC8, 0x86, 0x57, 0x9E, 0x8F, 0xF9, 0x53, 0x12, 0xB6, 0x5C,
+        0xCF, 0x34, 0xA8, 0xB8, 0x55, 0x02, 0xF9, 0x43, 0x8E, 0x97, 0x5C, 0x0A,
+        0x00, 0xDB, 0xD4, 0x33, 0x34, 0x75, 0xE2, 0x43, 0xDD, 0x1F, 0x42, 0x00 },
+      { 0x74, 0x35, 0x28, 0x07, 0xA2, 0xEC, 0xA4, 0x6E, 0x27, 0x9C, 0x73, 0x56,
+        0xE6, 0x65, 0xB5, 0x89, 0x65, 0xDD, 0xB8, 0x21, 0x96, 0x62, 0x9F, 0xC7,
+        0x8D, 0xB7, 0x7C, 0x0E, 0x06, 0xC9, 0x6B, 0x90, 0xFB, 0x94, 0x7F, 0x03 }, 0 },
+    { { 0xF8, 0xD4, 0x70, 0x2F, 0x22, 0xCC, 0x4E, 0xC3, 0xB6, 0xC0, 0xDE, 0x67,
+        0xAC, 0xB4, 0xD5, 0x3E, 0xE6, 0xE8, 0xE3, 0xF7, 0x15, 0xF5, 0x92, 0x70,
+        0xA5, 0xDF, 0xB5, 0xEA, 0x7E, 0x58, 0x53, 0xB5, 0x17, 0x3B, 0xCF, 0x00 },
+      { 0x24, 0xE8, 0x3B, 0xC5, 0xA0, 0x97, 0xD2, 0xBC, 0x33, 0xCA, 0x6E, 0x84,
+        0x40, 0x6F, 0x58, 0xCA, 0x67, 0x6D, 0x1F, 0x1A, 0xDB, 0x8B, 0x29, 0xE8,
+        0x8D, 0x4B, 0x55, 0x09, 0xF7, 0xFC, 0xCE, 0xA3, 0x91, 0x79, 0x15, 0x07 }, 0 },
+    { { 0xDD, 0x83, 0xA9, 0x8A, 0xF4, 0xD1, 0x23, 0x91, 0x3B, 0x80, 0x91, 0xC1,
+        0x68, 0xD8, 0x85, 0x3D, 0x3B, 0x4A, 0xF9, 0x76, 0x8F, 0x76, 0x36, 0x88,
+        0xEC, 0x79, 0xD3, 0x1F, 0xCF, 0x17, 0x51, 0x1D, 0xC7, 0x94, 0x88, 0x03 },
+      { 0xFA, 0x93, 0x1B, 0xF5, 0xC4, 0xA7, 0x34, 0xDF, 0x3C, 0x74, 0xC4, 0xBB,
+        0x87, 0x90, 0xC4, 0x1E, 0xA0, 0xC6, 0x07, 0x20, 0x6B, 0x07, 0x98, 0x68,
+        0x2B, 0x5C, 0xD8, 0x06, 0xDA, 0x53, 0x71, 0xC9, 0x72, 0x10, 0x0B, 0x07 }, 0 },
+    { { 0x4E, 0x7F, 0x9A, 0x8F, 0xA2, 0x17, 0x63, 0x9A, 0x8C, 0x79, 0xB1, 0x88,
+        0x5D, 0xFF, 0x1D, 0x66, 0x9E, 0x4E, 0x1B, 0xD4, 0x58, 0x24, 0xE3, 0xC8,
+        0x75, 0x49, 0xE2, 0x62, 0x2F, 0xF9, 0xB3, 0x93, 0xAC, 0x52, 0x2F, 0x05 },
+      { 0xF5, 0x93, 0x11, 0xEB, 0x33, 0xFD, 0xDE, 0xC9, 0x25, 0xE0, 0x35, 0x8B,
+        0xE6, 0xAE, 0x5A, 0x45, 0xE8, 0xD5, 0x72, 0x3E, 0xA9, 0xEA, 0x57, 0x2B,
+        0x2B, 0xE7, 0x9E, 0x8C, 0xCA, 0x34, 0x13, 0x62, 0xAA, 0x8C, 0xB9, 0x00 }, 0 },
+    { { 0x52, 0xA1, 0xA8, 0x12, 0xC7, 0xE8, 0x32, 0x03, 0xB1, 0x6A, 0x0A, 0xEB,
+        0xAA, 0xFB, 0x94, 0x4D, 0x8A, 0x89, 0x0A, 0x36, 0xF7, 0xC4, 0x23, 0x6E,
+        0x13, 0xD3, 0x69, 0xA4, 0x9D, 0x13, 0x2E, 0xBB, 0xD3, 0x0E, 0xE5, 0x04 },
+      { 0x3C, 0x7D, 0x1A, 0x2C, 0xB9, 0x73, 0x9B, 0x45, 0x2A, 0x8B, 0xD7, 0x3C,
+        0x82, 0x72, 0x0F, 0xC0, 0x34, 0x34, 0x8F, 0x69, 0x11, 0x07, 0x74, 0x08,
+        0x4B, 0xC9, 0xCE, 0x19, 0x7C, 0x64, 0x3D, 0x95, 0x35, 0xCA, 0xAD, 0x04 }, 0 },
+    { { 0x19, 0xC3, 0x07, 0x3B, 0x07, 0xC6, 0x0E, 0xE3, 0xE6, 0xB0, 0x74, 0x11,
+        0xAD, 0xC7, 0xFC, 0xDC, 0x7D, 0xF8, 0x77, 0x7B, 0xE0, 0x0B, 0x8C, 0x75,
+        0x6D, 0x0F, 0x20, 0x2C, 0xEC, 0x88, 0x97, 0xFD, 0x8A, 0xCB, 0xB1, 0x02 },
+      { 0x74, 0x3B, 0x22, 0x60, 0xF2, 0x40, 0x68, 0xE4, 0x08, 0x08, 0xCE, 0xCE,
+        0x80, 0x5F, 0x9D, 0xFE, 0xFF, 0xFB, 0x75, 0x40, 0x8A, 0xED, 0x70, 0xDA,
+        0xF0, 0xA8, 0xE7, 0xF8, 0x72, 0x5B, 0x2E, 0x94, 0x87, 0x8F, 0xB5, 0x05 }, 0 },
+    { { 0x47, 0x08, 0x2C, 0xCD, 0xFB, 0x07, 0x95, 0x2A, 0x7F, 0xB1, 0x6B, 0xEF,
+        0x38, 0x1F, 0x85, 0x1C, 0x5D, 0x48, 0x89, 0x1E, 0xBF, 0xCF, 0xCA, 0x2F,
+        0x36, 0x80, 0xE8, 0xD2, 0x2F, 0xE1, 0x09, 0x19, 0x1D, 0xE5, 0x7C, 0x07 },
+      { 0xDB, 0xB0, 0x7B, 0x60, 0xF8, 0x92, 0xB3, 0x69, 0x19, 0x37, 0xD6, 0x18,
+        0xE1, 0xFC, 0xA1, 0x17, 0x1B, 0x6A, 0x9D, 0x7B, 0x7B, 0xDC, 0x8D, 0x9F,
+        0xD4, 0xE4, 0xEF, 0xD1, 0x91, 0x6E, 0xFB, 0x92, 0xAC, 0x3D, 0x18, 0x05 }, 0 },
+    { { 0xC3, 0x54, 0x91, 0x09, 0xBC, 0x02, 0xEC, 0xB7, 0xEE, 0x50, 0x6F, 0x85,
+        0x57, 0x24, 0x8F, 0x4B, 0x40, 0xE5, 0xAD, 0x0C, 0x6C, 0x7E, 0x3D, 0x3C,
+        0x7D, 0xE4, 0x21, 0x2E, 0xC5, 0x08, 0xD9, 0x84, 0xDA, 0xE9, 0x79, 0x07 },
+      { 0x44, 0x96, 0x1F, 0x21, 0x98, 0x00, 0x9F, 0xD4, 0xB4, 0xC2, 0xC3, 0x37,
+        0x84, 0x8F, 0xA0, 0x97, 0x22, 0x88, 0x62, 0x8F, 0xF3, 0x79, 0xDF, 0xF2,
+        0xF9, 0x47, 0x06, 0xC5, 0xA7, 0xD3, 0xB7, 0x18, 0x1F, 0x50, 0xC9, 0x02 }, 0 },
+    { { 0xE1, 0x45, 0xA0, 0xE4, 0xB3, 0x01, 0xBD, 0xD5, 0x6B, 0x03, 0x9B, 0x3E,
+        0x2A, 0x52, 0x56, 0xD4, 0x9B, 0x20, 0x50, 0x6D, 0xEC, 0x8B, 0x87, 0xE4,
+        0xA6, 0xAD, 0x05, 0x73, 0x13, 0xB2, 0x24, 0xA4, 0x22, 0xD6, 0x92, 0x07 },
+      { 0x1B, 0x85, 0x4B, 0xA6, 0x4F, 0xA3, 0xC2, 0x74, 0x15, 0xAC, 0x5C, 0xB2,
+        0xDE, 0xFD, 0x0B, 0x20, 0x99, 0x81, 0x85, 0x30, 0xEB, 0x61, 0x19, 0x12,
+        0x17, 0xAD, 0xBF, 0x41, 0xAD, 0x2C, 0xBE, 0xF9, 0xCB, 0xAB, 0x6E, 0x04 }, 0 },
+    { { 0x61, 0xE3, 0x3B, 0x64, 0x40, 0xBE, 0x4B, 0x4F, 0x22, 0xEA, 0xBA, 0xEA,
+        0xF8, 0xDE, 0x42, 0x1E, 0x49, 0xD5, 0x56, 0x39, 0xD3, 0xDC, 0x92, 0xF9,
+        0x12, 0xC4, 0x7A, 0x78, 0x7D, 0x5D, 0xB5, 0x14, 0x11, 0xEA, 0xE2, 0x00 },
+      { 0xE7, 0xBB, 0x55, 0x12, 0xA8, 0xE1, 0xA7, 0xA9, 0x00, 0x2B, 0xDA, 0x26,
+        0xAB, 0x84, 0xD2, 0x20, 0xC9, 0x2C, 0x4C, 0xF4, 0x18, 0x19, 0x31, 0x23,
+        0x91, 0x3B, 0x74, 0xC2, 0x65, 0x4C, 0xFF, 0x80, 0xE7, 0xEA, 0xDB, 0x04 }, 0 },
+    { { 0x3F, 0xA6, 0xA8, 0x50, 0x13, 0x48, 0x72, 0x16, 0x1B, 0x66, 0x68, 0x9D,
+        0x7D, 0xE1, 0x91, 0x92, 0x51, 0x99, 0x3C, 0x13, 0xB5, 0xC0, 0x17, 0x1C,
+        0x48, 0xBE, 0x65, 0x33, 0xC8, 0x57, 0x13, 0x07, 0xBB, 0xB9, 0xD7, 0x04 },
+      { 0xAD, 0x71, 0x82, 0xBD, 0x25, 0x90, 0xE1, 0xC4, 0x29, 0x12, 0x05, 0xCC,
+        0x00, 0xB7, 0xB1, 0x59, 0x8C, 0xFD, 0xA2, 0x1F, 0x7A, 0xC6, 0x0A, 0x24,
+        0xEB, 0xA3, 0xB7, 0xF6, 0xB6, 0xD6, 0x0D, 0x97, 0xA7, 0x08, 0x24, 0x01 }, 0 },
+    { { 0x4D, 0x6D, 0xC2, 0xFA, 0x82, 0xE8, 0x93, 0xA1, 0x1C, 0x14, 0xCF, 0x24,
+        0xDD, 0xC6, 0xA7, 0x51, 0x3E, 0xC3, 0x85, 0xC3, 0xD4, 0x0B, 0x2B, 0x16,
+        0x5B, 0xD8, 0x96, 0xD1, 0x02, 0x15, 0x5C, 0x0C, 0x29, 0x96, 0xD1, 0x03 },
+      { 0x59, 0x28, 0x40, 0xCA, 0x27, 0xBF, 0x89, 0x9F, 0xBA, 0xD5, 0xE8, 0x61,
+        0x14, 0x6F, 0xE4, 0x2F, 0x63, 0x88, 0xFC, 0x6C, 0x20, 0x5C, 0x17, 0x4C,
+        0x0E, 0xF0, 0xA8, 0x6B, 0x16, 0xF4, 0xF4, 0x0C, 0x4A, 0x74, 0x89, 0x00 }, 0 },
+    { { 0x34, 0xA0, 0x85, 0x86, 0x65, 0x9A, 0xFC, 0x67, 0x8D, 0xE6, 0x16, 0x27,
+        0x83, 0x69, 0xC1, 0xD5, 0xDA, 0xD5, 0x3C, 0x6B, 0x3A, 0x15, 0x1E, 0x3D,
+        0x51, 0x9C, 0x69, 0xC4, 0x3D, 0xAC, 0x8C, 0x89, 0xDB, 0x12, 0xD7, 0x04 },
+      { 0x2A, 0x09, 0xDD, 0xFA, 0x7B, 0xA7, 0xCD, 0x4D, 0xAA, 0xE5, 0x69, 0x7D,
+        0xD9, 0x13, 0x5F, 0xFB, 0x9E, 0x8D, 0x70, 0xFB, 0x0B, 0x83, 0x4F, 0x78,
+        0xBE, 0xDB, 0xCF, 0x8C, 0x8F, 0x95, 0x01, 0x0E, 0x5A, 0x4B, 0x92, 0x00 }, 0 },
+    { { 0x53, 0x0F, 0xED, 0xDB, 0x34, 0x14, 0x9C, 0x11, 0x79, 0xAA, 0x59, 0xB4,
+        0xEB, 0xB4, 0x10, 0xB2, 0x9A, 0xE3, 0x6D, 0x0A, 0x8E, 0x83, 0xF8, 0xEA,
+        0xF0, 0xC0, 0x77, 0xD6, 0x99, 0xEC, 0xA2, 0xAD, 0xDD, 0x91, 0x29, 0x00 },
+      { 0xC3, 0xBE, 0x5B, 0xB1, 0xC9, 0x0B, 0x13, 0x4B, 0x6F, 0x57, 0xF7, 0x39,
+        0xE5, 0x10, 0xE5, 0x5E, 0xF6, 0x8A, 0x8B, 0x5F, 0x85, 0x78, 0x86, 0xD4,
+        0x8F, 0xBF, 0xAA, 0x4B, 0x03, 0x7D, 0x98, 0x45, 0x49, 0x5B, 0xA9, 0x01 }, 0 },
+    { { 0x43, 0xAE, 0x07, 0xC3, 0x88, 0xD7, 0xF5, 0x51, 0x2B, 0x6B, 0x3A, 0x72,
+        0x98, 0xBF, 0x74, 0x72, 0xAB, 0xD0, 0x66, 0x3C, 0x01, 0x63, 0x3E, 0xEA,
+        0xF2, 0x19, 0xAB, 0x03, 0x7C, 0x48, 0x66, 0xFC, 0x49, 0xD1, 0x47, 0x02 },
+      { 0xCB, 0xC4, 0xFD, 0x68, 0x75, 0x3B, 0x86, 0x78, 0xCC, 0x9A, 0x08, 0x14,
+        0xE4, 0xF7, 0xD3, 0x2D, 0x54, 0xA8, 0x81, 0xD0, 0xCA, 0xD6, 0xB3, 0x67,
+        0x75, 0x03, 0x44, 0x17, 0xB6, 0xE5, 0xE4, 0x03, 0x42, 0xED, 0x9A, 0x05 }, 0 },
+    { { 0x18, 0x8F, 0x5A, 0xB2, 0xA8, 0x6A, 0x1A, 0x95, 0x81, 0x93, 0x98, 0xA1,
+        0xB5, 0x3F, 0xEC, 0x51, 0x1C, 0xEC, 0x56, 0x84, 0xD4, 0xB1, 0x97, 0x81,
+        0x84, 0x53, 0x5B, 0xBC, 0xC7, 0x64, 0x1C, 0xB8, 0xFB, 0x23, 0x35, 0x02 },
+      { 0x6C, 0xA0, 0x53, 0x35, 0x41, 0xFE, 0x20, 0x32, 0x21, 0x6F, 0xD0, 0x79,
+        0xFF, 0xB5, 0xB5, 0xA1, 0x53, 0x8E, 0x44, 0x93, 0x4C, 0x74, 0xF6, 0xF4,
+        0x96, 0x0E, 0x58, 0xCF, 0xD4, 0x0D, 0x53, 0xDC, 0x43, 0x52, 0xD5, 0x02 }, 0 },
+    { { 0xD6, 0xC4, 0x8E, 0x8F, 0x54, 0x0F, 0xD1, 0xCA, 0x9F, 0xB5, 0x15, 0x0B,
+        0x55, 0x49, 0x90, 0x3B, 0x49, 0x94, 0x35, 0x98, 0xE9, 0xB0, 0x7C, 0x7E,
+        0x86, 0xE9, 0xB3, 0xDE, 0x84, 0xCD, 0x53, 0x2C, 0x20, 0x34, 0x4C, 0x07 },
+      { 0xD5, 0x87, 0x69, 0xC7, 0xC6, 0x00, 0xF3, 0x6D, 0xB1, 0x25, 0x40, 0x68,
+        0xDE, 0x62, 0xA0, 0x78, 0xD8, 0x54, 0x48, 0xD2, 0xCE, 0xF6, 0x0C, 0xB6,
+        0x88, 0xE1, 0x2A, 0xD3, 0x25, 0x3B, 0x96, 0x9B, 0x98, 0x2F, 0x7D, 0x07 }, 0 },
+    { { 0x36, 0x48, 0x7D, 0x4A, 0xE4, 0x44, 0x18, 0x29, 0x84, 0x61, 0x5E, 0xD6,
+        0x65, 0xF9, 0x7E, 0x04, 0x09, 0x3A, 0xD8, 0x0A, 0x6F, 0xE0, 0x37, 0xE1,
+        0xF5, 0x7D, 0xBA, 0x40, 0x46, 0x39, 0xB3, 0x13, 0x12, 0x40, 0x54, 0x05 },
+      { 0x99, 0x64, 0xC5, 0x8F, 0x51, 0xE9, 0x80, 0xF7, 0x03, 0xD4, 0xCC, 0x19,
+        0x08, 0xA2, 0x5E, 0x96, 0x27, 0x71, 0x65, 0x1E, 0x37, 0xB8, 0xED, 0x92,
+        0x42, 0xF8, 0x9E, 0x82, 0x1A, 0x0A, 0x2D, 0x75, 0xCE, 0xAF, 0x8A, 0x06 }, 0 },
+    { { 0x6A, 0xED, 0x2C, 0xBE, 0xDC, 0x7E, 0x9D, 0x1F, 0x32, 0x3B, 0xB1, 0xAA,
+        0x90, 0x1F, 0x1C, 0x9B, 0xD8, 0x05, 0x58, 0xA7, 0x3B, 0x9D, 0x2B, 0x0F,
+        0x85, 0x42, 0x36, 0xC1, 0xAA, 0x50, 0x6A, 0x9A, 0x18, 0x63, 0xB7, 0x07 },
+      { 0xE5, 0xFD, 0x56, 0x9C, 0x10, 0x9E, 0xE9, 0x1E, 0x9C, 0xC2, 0x9E, 0x03,
+        0xE3, 0xB8, 0x3C, 0x11, 0x4D, 0x8C, 0x4B, 0x89, 0xFB, 0xFC, 0x63, 0xC6,
+        0xD3, 0x95, 0xAB, 0x86, 0x3E, 0xAC, 0xF3, 0x78, 0xED, 0xF0, 0xE7, 0x07 }, 0 },
+    { { 0x1C, 0x07, 0x8F, 0xCB, 0xD7, 0x15, 0x82, 0xA2, 0x3F, 0xA6, 0x8A, 0x99,
+        0x87, 0x75, 0x64, 0xC2, 0x0C, 0xB5, 0x4B, 0xC2, 0x29, 0xEE, 0x4A, 0x51,
+        0xD4, 0x77, 0xFD, 0x4C, 0x83, 0x5F, 0xA4, 0xD8, 0x60, 0x30, 0xB5, 0x01 },
+      { 0xE9, 0xCF, 0xB1, 0xC9, 0xE8, 0x19, 0x49, 0x12, 0xEE, 0x44, 0x78, 0x19,
+        0xF1, 0xAB, 0x5B, 0x48, 0x6B, 0xC1, 0xE0, 0x83, 0x87, 0x30, 0xD2, 0xF4,
+        0xD3, 0xBF, 0x88, 0xAD, 0xC5, 0x15, 0x65, 0x6A, 0xD8, 0x79, 0x94, 0x04 }, 0 },
+    { { 0xF5, 0x6F, 0x20, 0x2F, 0x11, 0x0F, 0x0E, 0x31, 0xBF, 0x78, 0x15, 0x4F,
+        0x78, 0x38, 0xF3, 0xB8, 0x92, 0xB7, 0x58, 0x4A, 0x7B, 0x5A, 0x1D, 0xCC,
+        0x7E, 0x9C, 0x9A, 0xA1, 0x35, 0x66, 0xEF, 0x7D, 0xD2, 0xAE, 0xA4, 0x07 },
+      { 0x6B, 0xD9, 0xF7, 0xB6, 0xED, 0x83, 0xDD, 0xF9, 0x01, 0x87, 0x6B, 0xE9,
+        0xB8, 0x92, 0xA5, 0xD9, 0x24, 0xEE, 0x50, 0x7C, 0x30, 0x74, 0x5A, 0xBC,
+        0xB1, 0x94, 0xD6, 0x17, 0xBA, 0xEA, 0xDF, 0xCA, 0x33, 0x63, 0x0C, 0x06 }, 0 },
+    { { 0x79, 0x57, 0xC4, 0xD2, 0x2C, 0x61, 0xE9, 0x1F, 0x2C, 0xDC, 0xFA, 0x46,
+        0xDD, 0x8E, 0xEB, 0x85, 0x55, 0x42, 0xA9, 0x0B, 0x88, 0x7F, 0x47, 0x87,
+        0xF0, 0xB0, 0x0D, 0x3C, 0x4A, 0xD7, 0xD3, 0xDD, 0x57, 0x98, 0x51, 0x06 },
+      { 0x6F, 0xF4, 0xBD, 0x0F, 0x32, 0xA6, 0x7D, 0x6B, 0x9B, 0x84, 0x31, 0xE0,
+        0xC7, 0x99, 0x94, 0xC8, 0xA3, 0x92, 0x0D, 0xDC, 0x0E, 0x78, 0xA8, 0xBC,
+        0x3B, 0x88, 0xFA, 0x32, 0xA5, 0x65, 0x62, 0x60, 0x21, 0x8B, 0x0D, 0x06 }, 0 },
+    { { 0x27, 0xD8, 0xCA, 0x66, 0x45, 0x54, 0x4F, 0x97, 0x15, 0x31, 0x1A, 0x96,
+        0xDC, 0x84, 0x3F, 0x27, 0x99, 0xDA, 0x4A, 0xD4, 0x61, 0x49, 0x3D, 0xC6,
+        0xA7, 0xEF, 0x9C, 0xEC, 0x84, 0x2B, 0xD6, 0x4E, 0x48, 0xD3, 0xFA, 0x02 },
+      { 0xD9, 0x4B, 0xCA, 0x7E, 0xD5, 0x6D, 0xCE, 0x20, 0xBB, 0x87, 0x5B, 0x51,
+        0x73, 0x01, 0xE4, 0xFA, 0xB2, 0xB7, 0x7A, 0x04, 0xB6, 0x5F, 0x05, 0x90,
+        0x33, 0x92, 0x61, 0xDA, 0x41, 0xF0, 0x08, 0x67, 0xDB, 0x03, 0xA6, 0x03 }, 0 },
+    { { 0x84, 0xE9, 0xCC, 0x49, 0x6C, 0x31, 0x0E, 0x28, 0xAA, 0x9C, 0x6D, 0x4A,
+        0xD4, 0x57, 0xF6, 0x4F, 0x9A, 0x92, 0xA8, 0xDD, 0xAB, 0x19, 0x30, 0xA4,
+        0x78, 0xCB, 0xC3, 0x6B, 0x76, 0xFC, 0x10, 0x53, 0xDF, 0x2F, 0x84, 0x02 },
+      { 0x01, 0xFF, 0x18, 0x2E, 0x9F, 0x42, 0x98, 0xFD, 0x14, 0x80, 0xE2, 0xE7,
+        0x56, 0x67, 0x8A, 0x10, 0xD0, 0x51, 0x4F, 0xAC, 0x9D, 0x16, 0x5E, 0x45,
+        0xB5, 0xF1, 0xAE, 0x6F, 0x8F, 0xC1, 0x38, 0xCE, 0x6B, 0xEB, 0xF0, 0x05 }, 0 },
+    { { 0xA7, 0x54, 0xD8, 0xEB, 0xED, 0x25, 0x4C, 0xF2, 0x22, 0x4C, 0x11, 0x0C,
+        0x31, 0x0E, 0x0C, 0x98, 0xBC, 0x49, 0x12, 0x01, 0x68, 0xFA, 0x3A, 0xFF,
+        0x7C, 0x4C, 0x2D, 0xE5, 0xFD, 0x4F, 0x4D, 0xC9, 0x6B, 0xBC, 0x88, 0x00 },
+      { 0x7F, 0xB1, 0x07, 0xD2, 0x97, 0x2E, 0x40, 0xF4, 0xFB, 0x3B, 0xB1, 0xC2,
+        0x74, 0x65, 0xC4, 0x07, 0xBB, 0xFE, 0xB1, 0x97, 0x3C, 0xAF, 0x12, 0x1E,
+        0xD0, 0x03, 0xF2, 0x84, 0x91, 0x0E, 0xC3, 0x17, 0x9F, 0xEB, 0xD5, 0x05 }, 0 },
+    { { 0x1A, 0xFA, 0xDE, 0xEC, 0x87, 0x47, 0x52, 0xC3, 0x3D, 0x8B, 0x7D, 0x8F,
+        0xA1, 0x37, 0x68, 0x8E, 0xCD, 0x8A, 0xC5, 0xEB, 0x75, 0xB3, 0x0A, 0x47,
+        0xA1, 0x08, 0xD2, 0x07, 0xC9, 0x03, 0x2D, 0x76, 0x2D, 0x2F, 0x02, 0x03 },
+      { 0xF2, 0x6D, 0xDC, 0x8E, 0x04, 0xA9, 0x52, 0x52, 0x4C, 0xAD, 0x58, 0xE0,
+        0x47, 0x3F, 0x8C, 0x01, 0xED, 0x58, 0xB3, 0xFC, 0xDD, 0x10, 0x77, 0x2C,
+        0x7E, 0x5E, 0xE7, 0x14, 0x41, 0xD0, 0x2A, 0x5F, 0x79, 0x8F, 0x2A, 0x00 }, 0 },
+    { { 0xDB, 0xAB, 0xBF, 0x34, 0xBE, 0xC7, 0xC6, 0xDD, 0x0F, 0xC7, 0x7F, 0xDA,
+        0xD2, 0x0A, 0x22, 0x13, 0xEC, 0x8A, 0x66, 0xAD, 0x30, 0x24, 0x9B, 0xB4,
+        0xAA, 0xFB, 0x7F, 0x28, 0x24, 0x6A, 0x4B, 0xC2, 0x69, 0xD5, 0x6C, 0x05 },
+      { 0x09, 0xF5, 0xDD, 0x15, 0x19, 0xB2, 0xA7, 0x08, 0xC0, 0x35, 0xD2, 0xDE,
+        0x4B, 0x04, 0x9F, 0x92, 0xC0, 0x18, 0x61, 0xFF, 0xD0, 0x24, 0x25, 0x35,
+        0xA1, 0x14, 0xD0, 0x61, 0x46, 0xAE, 0x2A, 0xF5, 0xB2, 0xBF, 0xDC, 0x01 }, 0 },
+    { { 0xDE, 0xA5, 0x8B, 0x50, 0xAA, 0x39, 0x86, 0x6B, 0x56, 0xB0, 0x3B, 0x7D,
+        0x0F, 0x67, 0x34, 0x75, 0xE1, 0x30, 0x86, 0x25, 0xA8, 0x83, 0x08, 0x91,
+        0xD7, 0xFE, 0x49, 0x75, 0xAE, 0x0D, 0x23, 0x41, 0x6E, 0x7E, 0xEE, 0x07 },
+      { 0x7E, 0xF1, 0x25, 0x8F, 0xEE, 0x8A, 0x4B, 0xF2, 0xB7, 0x25, 0x1B, 0x2F,
+        0xFB, 0x22, 0x4B, 0x0D, 0xE4, 0x45, 0x25, 0xEC, 0x37, 0x06, 0x7C, 0x57,
+        0xE6, 0x18, 0xF3, 0x6B, 0x38, 0xB5, 0x8B, 0x66, 0x35, 0xC4, 0xEB, 0x03 }, 0 },
+    { { 0x6F, 0x10, 0x27, 0x0F, 0x1B, 0xE7, 0x95, 0x34, 0xE3, 0x95, 0x20, 0xD1,
+        0xFD, 0x34, 0x7B, 0x17, 0xD1, 0x16, 0xB1, 0x13, 0x43, 0x50, 0xC4, 0xE2,
+        0xCA, 0x25, 0x19, 0x9F, 0xA4, 0xD7, 0x8E, 0x47, 0x57, 0x91, 0xAA, 0x06 },
+      { 0x54, 0x79, 0xE9, 0x16, 0xD3, 0xBB, 0x79, 0x0D, 0xF4, 0x49, 0xCA, 0xC1,
+        0x84, 0xDC, 0x28, 0x13, 0xFB, 0x87, 0xBB, 0xB5, 0xEF, 0xE2, 0x22, 0x9E,
+        0x28, 0xF1, 0x3A, 0x08, 0x91, 0x16, 0xB2, 0x1F, 0x07, 0x7F, 0x27, 0x00 }, 0 },
+    { { 0x24, 0xE1, 0x08, 0x46, 0x59, 0xE0, 0x85, 0xB7, 0xB8, 0xD3, 0x13, 0xE5,
+        0xF7, 0x07, 0x6B, 0x81, 0xD4, 0x2D, 0x46, 0xDC, 0x0B, 0xCD, 0x64, 0x3F,
+        0x7F, 0xF4, 0xEA, 0x6D, 0x38, 0x04, 0x2A, 0x0E, 0xA5, 0x3A, 0x39, 0x02 },
+      { 0x8B, 0x21, 0x4B, 0x74, 0xAF, 0xA7, 0xEF, 0x09, 0xD2, 0xE4, 0xBA, 0xC2,
+        0xFA, 0xDA, 0x47, 0x38, 0xA2, 0x3B, 0xAD, 0x3E, 0x57, 0xBF, 0x7D, 0x29,
+        0x84, 0x36, 0xA3, 0x3A, 0x7D, 0x97, 0x38, 0xF1, 0x91, 0xEB, 0x4E, 0x07 }, 0 },
+    { { 0x37, 0xFF, 0xCA, 0x2B, 0x70, 0xD7, 0x79, 0x94, 0x37, 0xD1, 0xD2, 0x5A,
+        0x83, 0x91, 0xFD, 0x28, 0x34, 0xFB, 0xE3, 0x8B, 0x3B, 0x14, 0xC5, 0xAA,
+        0xF6, 0xD6, 0xA8, 0xE6, 0xDB, 0x7A, 0xAD, 0xB6, 0xBB, 0xC6, 0xE9, 0x01 },
+      { 0x86, 0x86, 0xC9, 0x74, 0x44, 0x34, 0x6A, 0x61, 0x0D, 0x81, 0xCF, 0x88,
+        0x7C, 0xED, 0xC3, 0xB6, 0x57, 0xCF, 0xE5, 0x07, 0x53, 0x65, 0x17, 0x66,
+        0x38, 0x12, 0x63, 0xA8, 0x2F, 0x9F, 0xB6, 0x50, 0x10, 0x94, 0xE0, 0x02 }, 0 },
+    { { 0x6E, 0x97, 0x95, 0x9B, 0x32, 0x08, 0xE0, 0x33, 0xE3, 0x2D, 0x26, 0x41,
+        0x8D, 0xFB, 0x7F, 0x8C, 0xD4, 0x0C, 0x19, 0x1D, 0xBB, 0xBE, 0xD2, 0x87,
+        0x19, 0xC4, 0x82, 0x86, 0x16, 0x2E, 0xA0, 0xA4, 0x93, 0x58, 0xCA, 0x06 },
+      { 0xAC, 0xCD, 0x8B, 0x5F, 0x8E, 0x62, 0x2C, 0x08, 0x6C, 0xB9, 0x28, 0xBA,
+        0xB1, 0x32, 0xA3, 0xEB, 0xD6, 0x85, 0x07, 0x06, 0x83, 0x9A, 0xDC, 0x1B,
+        0x18, 0x30, 0x09, 0x82, 0x4B, 0x8E, 0x76, 0x2C, 0x08, 0x07, 0xC7, 0x06 }, 0 },
+    { { 0x78, 0x5D, 0x40, 0xBC, 0x84, 0x53, 0x7D, 0xFB, 0x76, 0x73, 0x80, 0x85,
+        0x74, 0xA3, 0x66, 0x38, 0xB1, 0x46, 0xC0, 0xEB, 0x5F, 0xEB, 0x20, 0x5F,
+        0x6D, 0xB1, 0xEC, 0x4F, 0xC4, 0x7B, 0xED, 0x41, 0x57, 0x30, 0x14, 0x04 },
+      { 0xA2, 0xCE, 0x59, 0x98, 0xB1, 0x2B, 0x76, 0x9A, 0x82, 0x3C, 0x2F, 0x28,
+        0xE7, 0x75, 0xEE, 0xFB, 0x69, 0xA8, 0x3B, 0x02, 0x56, 0xF1, 0x0C, 0x21,
+        0x96, 0xD3, 0x0F, 0x56, 0x62, 0x4A, 0x3F, 0x49, 0xC9, 0x4E, 0x6D, 0x00 }, 0 },
+    { { 0x79, 0x2E, 0x38, 0x7E, 0xAA, 0xA6, 0x06, 0xFE, 0x12, 0x1B, 0xBB, 0x9E,
+        0x1D, 0xD0, 0x90, 0x6E, 0x46, 0x81, 0xA2, 0x43, 0xEE, 0xB2, 0xD1, 0x85,
+        0xB3, 0x22, 0xAF, 0x3A, 0x3D, 0xFD, 0x9B, 0x8D, 0x7E, 0x8E, 0x7C, 0x05 },
+      { 0x22, 0x32, 0x6F, 0xB3, 0x45, 0x91, 0x98, 0xC4, 0x97, 0x04, 0xDC, 0x59,
+        0xE9, 0xE4, 0x4B, 0xE4, 0x48, 0x02, 0x96, 0x0A, 0x0D, 0x26, 0xB7, 0xF6,
+        0x69, 0x08, 0xFB, 0xD5, 0x08, 0x4D, 0x5C, 0x2D, 0x7D, 0x9D, 0x41, 0x04 }, 0 },
+    { { 0x89, 0x6E, 0xF9, 0x85, 0x68, 0xAB, 0x2F, 0xE5, 0x18, 0x51, 0xA4, 0x09,
+        0x9C, 0xF2, 0x6A, 0xAB, 0xDA, 0x7D, 0xA2, 0xD1, 0xE4, 0x3D, 0x74, 0xA6,
+        0x12, 0xA3, 0x8D, 0x33, 0xD3, 0x1E, 0xCF, 0x94, 0x1B, 0x9D, 0x31, 0x00 },
+      { 0x44, 0x7B, 0x59, 0xF2, 0x47, 0x7F, 0x46, 0x3B, 0x66, 0x5C, 0xA1, 0xC4,
+        0x4D, 0x9D, 0xA9, 0xF5, 0x7A, 0xFA, 0x9E, 0xDC, 0xA3, 0x1F, 0x5E, 0x3B,
+        0xF5, 0x8D, 0xA7, 0x49, 0x37, 0xAB, 0xE2, 0x07, 0x88, 0x45, 0x6D, 0x01 }, 0 },
+    { { 0xE9, 0xF3, 0xCB, 0x05, 0xAB, 0xA8, 0x14, 0x9A, 0x10, 0x48, 0x95, 0x71,
+        0x1E, 0xE4, 0xE6, 0x4B, 0x31, 0x18, 0x5B, 0xB7, 0xF9, 0x5A, 0x40, 0x8E,
+        0x9D, 0x8F, 0x77, 0x00, 0x64, 0x8B, 0xB5, 0x19, 0xEC, 0xCF, 0xA8, 0x04 },
+      { 0x5B, 0xFD, 0x71, 0x7E, 0xC6, 0xB2, 0xDF, 0xEC, 0x33, 0x24, 0xD7, 0x0E,
+        0x4B, 0x06, 0x05, 0x7D, 0xE8, 0x73, 0x48, 0xFA, 0x80, 0x91, 0x42, 0xFB,
+        0x13, 0x30, 0xF4, 0x95, 0xEF, 0x2E, 0xA4, 0xC8, 0xC6, 0x70, 0x96, 0x07 }, 0 },
+    { { 0x94, 0x18, 0x27, 0x0C, 0xAA, 0xF2, 0x4B, 0x47, 0x9F, 0xB4, 0x4D, 0x1A,
+        0xCA, 0xDF, 0x12, 0x59, 0x8A, 0x33, 0x38, 0xB3, 0xA1, 0x9E, 0xCE, 0x5E,
+        0x66, 0x72, 0x8E, 0x3F, 0x5A, 0xBA, 0x0F, 0xA7, 0x73, 0x2E, 0xEF, 0x02 },
+      { 0xD5, 0x52, 0x1A, 0x49, 0x22, 0x34, 0xDB, 0x82, 0xA4, 0x01, 0x13, 0x86,
+        0x59, 0x95, 0xEB, 0xF3, 0x5C, 0x1E, 0x7D, 0x7D, 0x09, 0x72, 0x74, 0x14,
+        0xDA, 0x4E, 0x80, 0x3E, 0x09, 0x47, 0x1D, 0xEC, 0x6B, 0xE2, 0xA4, 0x04 }, 0 },
+    { { 0x5A, 0x4B, 0x6C, 0x68, 0xE7, 0x87, 0x31, 0xD5, 0x09, 0x25, 0x65, 0xF1,
+        0x83, 0x3B, 0x95, 0x6C, 0xC7, 0xB0, 0x91, 0x6E, 0x46, 0x43, 0x04, 0xDA,
+        0xC0, 0xFC, 0xE0, 0x48, 0x05, 0xFD, 0xCE, 0xFA, 0x44, 0x66, 0x9D, 0x02 },
+      { 0x3E, 0x3C, 0x55, 0xC0, 0xD9, 0x5C, 0xBF, 0x0F, 0x15, 0xB2, 0xBF, 0x55,
+        0x13, 0x75, 0xD3, 0x8B, 0x14, 0x5A, 0xB5, 0x8D, 0x1E, 0x0E, 0xBD, 0x30,
+        0x48, 0xFE, 0xAA, 0xFB, 0x33, 0xA5, 0x66, 0x03, 0x57, 0x65, 0xE1, 0x07 }, 0 },
+    { { 0x49, 0x09, 0xC8, 0x97, 0x84, 0xA3, 0x60, 0x2C, 0x69, 0xDE, 0x64, 0x3F,
+        0xCB, 0x1D, 0x62, 0x94, 0x62, 0x84, 0x31, 0x92, 0x41, 0x8C, 0x53, 0xF8,
+        0x15, 0x56, 0xB6, 0x0A, 0x86, 0xA7, 0x09, 0x3D, 0xC8, 0xCA, 0x6D, 0x07 },
+      { 0xE4, 0xC1, 0x77, 0x24, 0x09, 0x89, 0x66, 0xAF, 0xF8, 0xA6, 0xE9, 0xC7,
+        0xAC, 0xFC, 0x73, 0x17, 0x6A, 0xBF, 0xD7, 0x8E, 0xC9, 0xA9, 0x52, 0x33,
+        0xCC, 0xE6, 0xD5, 0x59, 0xA8, 0x9B, 0x11, 0x80, 0x7C, 0xFD, 0xC8, 0x05 }, 0 },
+    { { 0xEC, 0x42, 0x0B, 0xFC, 0x13, 0xEF, 0x79, 0xCA, 0xF4, 0x53, 0xDD, 0xBE,
+        0x1E, 0xE8, 0xCF, 0x4B, 0xF6, 0x4B, 0x3A, 0xF4, 0x87, 0xFD, 0xCD, 0x3E,
+        0x43, 0x67, 0x46, 0x3E, 0xA9, 0xE7, 0xB7, 0x96, 0x2F, 0x7F, 0x62, 0x00 },
+      { 0x52, 0x83, 0xFD, 0xE7, 0x17, 0xF8, 0xB1, 0x32, 0x62, 0xBE, 0xAB, 0x5E,
+        0x15, 0x22, 0x93, 0x61, 0x78, 0xC9, 0xC6, 0xC2, 0x8A, 0x55, 0xC4, 0x8C,
+        0x83, 0x08, 0x12, 0x07, 0x2D, 0x66, 0xD7, 0xC3, 0x65, 0x8D, 0xED, 0x05 }, 0 },
+    { { 0x23, 0x94, 0xB7, 0x73, 0x26, 0xA2, 0xCE, 0x67, 0x51, 0x3F, 0x55, 0x7F,
+        0x31, 0x88, 0x22, 0xCE, 0xF1, 0xCA, 0xDA, 0x0B, 0x24, 0x13, 0x6B, 0x3C,
+        0x7D, 0x16, 0x72, 0x40, 0x23, 0x47, 0xE6, 0xFF, 0x71, 0xE8, 0xF4, 0x02 },
+      { 0x0D, 0x68, 0xF6, 0x2C, 0xDA, 0x3A, 0xEC, 0x4D, 0xFE, 0x04, 0x36, 0x10,
+        0x38, 0x47, 0xDC, 0xCE, 0x69, 0x3B, 0x14, 0x64, 0xD7, 0x4D, 0xAA, 0x65,
+        0xDC, 0xC3, 0x75, 0xC2, 0xD5, 0xCD, 0x6F, 0xEF, 0xC3, 0x59, 0x9B, 0x06 }, 0 },
+    { { 0x8C, 0x43, 0x06, 0xCB, 0x74, 0x38, 0x68, 0x28, 0x40, 0x8B, 0xEC, 0x41,
+        0xFD, 0x24, 0x5D, 0x4A, 0xBF, 0x2C, 0x82, 0xD9, 0x1E, 0xA0, 0x07, 0xB1,
+        0x1F, 0x32, 0xF9, 0x67, 0x80, 0xEA, 0xBE, 0x3A, 0xBF, 0x61, 0x7A, 0x05 },
+      { 0x5D, 0xF1, 0x9A, 0x00, 0x46, 0x40, 0x5B, 0xA7, 0xCF, 0x72, 0xBA, 0x9C,
+        0x73, 0xD8, 0xD0, 0x5C, 0x80, 0x7B, 0x91, 0x92, 0x64, 0x6F, 0xD9, 0xE6,
+        0x21, 0xBB, 0xAD, 0x85, 0x97, 0xDF, 0x61, 0x30, 0x78, 0x06, 0xE2, 0x06 }, 0 },
+    { { 0x26, 0x15, 0xAA, 0x3C, 0x9D, 0xF1, 0x83, 0x44, 0x1A, 0x83, 0x73, 0x92,
+        0xFD, 0x57, 0xB6, 0xE9, 0x92, 0x30, 0x40, 0xC3, 0x31, 0xE9, 0xB6, 0x30,
+        0x90, 0x8C, 0x64, 0xBE, 0x2B, 0xC1, 0x18, 0x44, 0xEC, 0x6F, 0x9E, 0x00 },
+      { 0x43, 0xAB, 0xBB, 0x90, 0x0C, 0xB4, 0xE5, 0xA3, 0x5F, 0x54, 0x0D, 0xCE,
+        0x45, 0x2F, 0xE2, 0xC2, 0x05, 0xCC, 0xE3, 0x29, 0xC3, 0x30, 0x8B, 0xCB,
+        0x70, 0x29, 0xC7, 0x4B, 0xD5, 0x6C, 0xEE, 0x2E, 0x58, 0xC6, 0xDF, 0x06 }, 0 },
+    { { 0xBA, 0xBB, 0x2A, 0x01, 0x61, 0x4C, 0x05, 0x31, 0x19, 0x91, 0x25, 0xBE,
+        0x3A, 0xFD, 0x79, 0x7B, 0x82, 0xF9, 0xAE, 0x5D, 0xF3, 0x7D, 0x62, 0xDB,
+        0xB8, 0x4D, 0x50, 0x83, 0x84, 0x71, 0xED, 0xEF, 0x8E, 0x0A, 0x90, 0x02 },
+      { 0xDC, 0x53, 0x59, 0xE2, 0xF8, 0x24, 0x14, 0x82, 0x76, 0x20, 0x30, 0x59,
+        0x95, 0xDC, 0xF8, 0x6C, 0xB8, 0x24, 0xE3, 0x78, 0x71, 0x8B, 0xB3, 0x25,
+        0x0F, 0xD4, 0xA5, 0x77, 0x4E, 0xDB, 0x36, 0x8C, 0x87, 0xFD, 0x65, 0x04 }, 0 },
+    { { 0xFE, 0x9D, 0x5A, 0xE6, 0x01, 0x8F, 0x64, 0xDA, 0x22, 0x22, 0x48, 0x9B,
+        0xF8, 0x04, 0xB4, 0x6E, 0xE4, 0x4C, 0xD7, 0xAF, 0x94, 0x18, 0xC4, 0x20,
+        0xAF, 0xDC, 0x9C, 0xFA, 0xD2, 0x1B, 0x1F, 0x6B, 0xB5, 0x42, 0xCE, 0x07 },
+      { 0xBE, 0x88, 0x50, 0x32, 0x5C, 0x1F, 0x2A, 0x8E, 0xE2, 0x12, 0xB2, 0x9E,
+        0x96, 0xA9, 0xBB, 0x39, 0x26, 0x6C, 0x0C, 0x7D, 0xA4, 0x0A, 0xCE, 0x56,
+        0xD5, 0xCB, 0x43, 0x01, 0xB5, 0x4E, 0xD2, 0xD7, 0x95, 0x2D, 0x69, 0x03 }, 0 },
+    { { 0x2F, 0x9E, 0xF4, 0xAD, 0x9C, 0x52, 0x79, 0x88, 0x42, 0xE6, 0x96, 0x23,
+        0x3F, 0xFE, 0xC3, 0xB1, 0x34, 0x69, 0xAC, 0x5C, 0x1B, 0xF3, 0x5F, 0x55,
+        0x34, 0x62, 0xCF, 0x9C, 0x4E, 0xC7, 0xDD, 0xA2, 0x1F, 0x96, 0xF7, 0x00 },
+      { 0x51, 0x36, 0x51, 0xE3, 0xFF, 0x39, 0x59, 0xE7, 0x95, 0x37, 0x43, 0x74,
+        0x75, 0xB2, 0x20, 0x06, 0xDF, 0xBD, 0xA0, 0xD7, 0x3F, 0x6B, 0x0F, 0x34,
+        0xDF, 0xCD, 0x27, 0x7F, 0xA6, 0x3B, 0x62, 0x66, 0xEA, 0xD7, 0xFB, 0x01 }, 0 },
+    { { 0x99, 0xE7, 0xBA, 0x42, 0x3F, 0x0B, 0x1F, 0x4A, 0x16, 0x9C, 0xD7, 0xD4,
+        0xDD, 0x11, 0x3D, 0x47, 0x86, 0x2E, 0x33, 0x80, 0x37, 0x69, 0x66, 0x84,
+        0xBF, 0x59, 0xF4, 0x5C, 0xA4, 0x88, 0x18, 0x8A, 0x18, 0xE4, 0x12, 0x04 },
+      { 0xFB, 0x95, 0x56, 0xBF, 0x18, 0xEF, 0xEC, 0xB4, 0x62, 0xBE, 0x35, 0x48,
+        0x68, 0xD7, 0xBD, 0x7F, 0xA7, 0xC5, 0x9B, 0x4B, 0x85, 0x47, 0x15, 0xBB,
+        0x48, 0x5B, 0x7E, 0x13, 0x61, 0xCB, 0x37, 0xA6, 0x5B, 0xB2, 0x75, 0x05 }, 0 },
+    { { 0x9A, 0xCC, 0x24, 0xA2, 0x76, 0x9F, 0xDC, 0x51, 0x7D, 0x80, 0x87, 0xE5,
+        0xEA, 0x54, 0x02, 0x03, 0x25, 0xFD, 0xEF, 0x8F, 0x53, 0x59, 0xEA, 0x40,
+        0x28, 0xA7, 0xF6, 0x0F, 0x83, 0x16, 0x83, 0xE3, 0xEB, 0x42, 0x59, 0x02 },
+      { 0xA9, 0x06, 0x92, 0xD3, 0xF5, 0x4F, 0x18, 0xEC, 0x99, 0xEF, 0x21, 0xD4,
+        0x7D, 0xCB, 0x50, 0xB9, 0x78, 0xAE, 0x07, 0xBF, 0x73, 0xC7, 0xA4, 0xFE,
+        0x5E, 0xA2, 0x05, 0x5E, 0xEA, 0x7B, 0xC0, 0xB9, 0x24, 0x72, 0xE5, 0x07 }, 0 },
+    { { 0x3A, 0x41, 0x89, 0x9C, 0xB7, 0xA3, 0xB2, 0x50, 0xEE, 0x54, 0x5B, 0x2B,
+        0x5D, 0x3F, 0x9F, 0x6E, 0x9F, 0x20, 0xFF, 0xA2, 0x56, 0x94, 0x0D, 0x39,
+        0x47, 0xFA, 0x73, 0xFF, 0x5E, 0x06, 0x05, 0x47, 0xA6, 0x52, 0x41, 0x06 },
+      { 0x2E, 0x3E, 0x69, 0xDF, 0x6A, 0x6E, 0x5B, 0x2F, 0x97, 0x01, 0xAE, 0x80,
+        0x30, 0x18, 0xCD, 0x76, 0x67, 0xFE, 0x5F, 0x4A, 0xE4, 0xA8, 0x8E, 0x8E,
+        0xE9, 0x5E, 0xA8, 0xE7, 0x12, 0x6A, 0x47, 0x51, 0xE8, 0x02, 0x96, 0x00 }, 0 },
+    { { 0x8D, 0xCD, 0x06, 0x13, 0xF0, 0x12, 0x84, 0x24, 0x28, 0x24, 0xA5, 0xFB,
+        0x66, 0xE9, 0xFF, 0x44, 0x6C, 0xE5, 0x67, 0x54, 0xEB, 0xA6, 0x1A, 0xDD,
+        0x54, 0xD9, 0x2A, 0xAF, 0x95, 0x74, 0xB4, 0x6C, 0x77, 0xBE, 0x9A, 0x00 },
+      { 0xA7, 0x17, 0xBB, 0x64, 0xCD, 0xFB, 0x8D, 0xAF, 0x57, 0x12, 0x45, 0xB2,
+        0xE1, 0x5B, 0x57, 0x52, 0x46, 0x35, 0xD4, 0x98, 0x9D, 0xB6, 0xE8, 0x40,
+        0x5C, 0x9D, 0x85, 0x97, 0x49, 0x31, 0x22, 0xFD, 0x2C, 0xAE, 0x95, 0x01 }, 0 },
+    { { 0x6C, 0xDB, 0xE0, 0x68, 0x58, 0x10, 0x4D, 0x00, 0x1C, 0xB1, 0xBD, 0xD3,
+        0xFF, 0xAA, 0xED, 0x30, 0x2A, 0x32, 0xA6, 0xDF, 0x73, 0xAF, 0x57, 0x9D,
+        0x56, 0x3C, 0xBA, 0xD2, 0x52, 0x86, 0xEA, 0xE6, 0x36, 0x56, 0x57, 0x07 },
+      { 0xE2, 0xF4, 0xE9, 0x66, 0xE8, 0xB0, 0x16, 0xFA, 0x6A, 0xA4, 0xDD, 0xD6,
+        0x1F, 0x5E, 0x0A, 0x8C, 0xF8, 0x0A, 0x6B, 0xDB, 0x60, 0xF2, 0x52, 0xFF,
+        0x1C, 0xDC, 0x43, 0x92, 0x80, 0x58, 0x8D, 0x14, 0xCD, 0xF3, 0x52, 0x03 }, 0 },
+    { { 0x58, 0xAB, 0x7C, 0x6D, 0xCB, 0xBC, 0x82, 0x10, 0x56, 0x27, 0xFD, 0x1A,
+        0x97, 0x0C, 0x62, 0x6B, 0x0E, 0xFE, 0x8A, 0x99, 0xC9, 0x68, 0x1B, 0x75,
+        0xC3, 0x64, 0xB6, 0x5A, 0xAB, 0xB0, 0x15, 0x12, 0xBD, 0x15, 0xB3, 0x07 },
+      { 0x37, 0xE7, 0x98, 0xE2, 0x9B, 0xC2, 0x74, 0x71, 0xFD, 0xE0, 0x6C, 0x3C,
+        0xA5, 0x16, 0x02, 0x61, 0x0E, 0xB7, 0x7C, 0x7E, 0xBD, 0xE3, 0x61, 0x90,
+        0xB4, 0x2A, 0x9B, 0x1B, 0x2E, 0x71, 0xE6, 0x4B, 0x15, 0x21, 0x46, 0x01 }, 0 },
+    { { 0x1D, 0x41, 0x25, 0xF6, 0x83, 0xCD, 0xD6, 0xAE, 0xAE, 0x44, 0x32, 0x39,
+        0xF0, 0x3C, 0xDE, 0x20, 0x44, 0x56, 0xCA, 0xD9, 0x7E, 0xDF, 0xC0, 0x5C,
+        0x5D, 0x3E, 0x0E, 0xD1, 0x5F, 0x9A, 0x12, 0xCE, 0x68, 0xF2, 0x13, 0x04 },
+      { 0xCD, 0x8F, 0xD9, 0x26, 0xF0, 0x30, 0x6F, 0x1E, 0x1D, 0xB7, 0xFB, 0xE1,
+        0x07, 0x4F, 0xC8, 0xCD, 0xE4, 0xE9, 0x0E, 0x6C, 0xA6, 0x29, 0x04, 0x31,
+        0x12, 0x9C, 0xDB, 0xA3, 0xB3, 0xBE, 0xEE, 0xFD, 0x0D, 0x42, 0x7B, 0x07 }, 0 },
+    { { 0x79, 0xE4, 0x3D, 0x38, 0xC4, 0x19, 0x1F, 0xF0, 0xE5, 0xCA, 0xCB, 0xEC,
+        0x20, 0xB8, 0x7A, 0x66, 0x5A, 0x15, 0x61, 0xDF, 0x65, 0x5C, 0x13, 0x95,
+        0x14, 0x97, 0xB6, 0x05, 0x87, 0x2B, 0xA6, 0xF3, 0x5A, 0xF0, 0xEC, 0x00 },
+      { 0xFF, 0xFA, 0xAC, 0x5B, 0x18, 0x7B, 0xE3, 0xC3, 0x93, 0x54, 0x35, 0x92,
+        0xFC, 0xF1, 0x40, 0x2D, 0xDE, 0x75, 0xAE, 0xBF, 0x2A, 0x81, 0xF8, 0xAC,
+        0x15, 0x52, 0x27, 0x2B, 0x3C, 0x43, 0xAE, 0xC7, 0x20, 0xFA, 0x84, 0x04 }, 0 },
+    { { 0xF1, 0xAB, 0x7F, 0x5F, 0x6A, 0x52, 0x17, 0x4A, 0x15, 0xC4, 0xF0, 0x0E,
+        0x76, 0x89, 0x71, 0xC7, 0x53, 0x46, 0xA7, 0x13, 0x8D, 0x09, 0x0D, 0xD3,
+        0xEC, 0x00, 0x37, 0x49, 0x06, 0x47, 0x3E, 0xCA, 0x42, 0xFA, 0x6B, 0x07 },
+      { 0xC0, 0xF2, 0xC3, 0x82, 0xB4, 0x4F, 0x22, 0x5B, 0x64, 0x62, 0xE1, 0xC1,
+        0x7E, 0xC6, 0xFF, 0x14, 0xAA, 0x4D, 0xE0, 0xFE, 0x2E, 0x8A, 0x0A, 0xB7,
+        0x0B, 0x7E, 0x55, 0x13, 0x46, 0x21, 0xF5, 0x11, 0xA2, 0xBC, 0x95, 0x01 }, 0 },
+    { { 0x87, 0x31, 0x43, 0xE6, 0xC9, 0xF0, 0xA8, 0xE3, 0xD7, 0xC7, 0xF9, 0x52,
+        0x8C, 0xF4, 0xB1, 0x52, 0x95, 0x57, 0xFE, 0x8B, 0xD4, 0x10, 0xAD, 0x38,
+        0x75, 0x45, 0x58, 0xDD, 0x15, 0x39, 0xD3, 0xA1, 0x0D, 0xB3, 0xE4, 0x03 },
+      { 0x83, 0x5C, 0x84, 0x8F, 0xB2, 0xC9, 0x5F, 0xA1, 0x33, 0xD0, 0x0C, 0x18,
+        0xE1, 0x5E, 0xD2, 0xFC, 0xA4, 0x03, 0x25, 0x45, 0xF6, 0x20, 0x3A, 0x70,
+        0xCB, 0x7E, 0xA3, 0x96, 0x1F, 0x8F, 0x76, 0x04, 0x66, 0x48, 0x4C, 0x00 }, 0 },
+    { { 0x5C, 0x21, 0xC1, 0x07, 0x7E, 0x46, 0xA6, 0x4C, 0x73, 0x49, 0xDE, 0x67,
+        0xF8, 0xBA, 0x02, 0xD3, 0x14, 0x1A, 0x3A, 0x1A, 0x13, 0xE4, 0xA9, 0x05,
+        0xF3, 0x94, 0xD3, 0xEA, 0x21, 0x4E, 0x6D, 0x0D, 0x2C, 0x1B, 0x1D, 0x03 },
+      { 0xE4, 0x66, 0x93, 0x2A, 0xD3, 0x47, 0xAA, 0x6B, 0x2D, 0xFB, 0x0C, 0x72,
+        0x24, 0x4F, 0x2B, 0x5E, 0xD2, 0xDC, 0xB0, 0xE0, 0x3F, 0x84, 0x58, 0x7E,
+        0xF6, 0x05, 0x2A, 0x2B, 0x41, 0xA0, 0xB6, 0xE0, 0x9E, 0x94, 0x78, 0x05 }, 0 },
+    { { 0x11, 0xF3, 0x61, 0x9A, 0xE3, 0x61, 0x9E, 0x8B, 0x9C, 0x08, 0x7B, 0x45,
+        0x7E, 0x49, 0xC1, 0xDB, 0xFC, 0xFF, 0xC0, 0xE8, 0x73, 0x49, 0xC0, 0x04,
+        0x3A, 0xB3, 0xF2, 0xAA, 0xA5, 0x8D, 0x1C, 0x8D, 0x31, 0xEE, 0xD6, 0x01 },
+      { 0x0A, 0xB8, 0x0C, 0xDF, 0x5F, 0x7D, 0xF5, 0xD1, 0x17, 0xC7, 0x62, 0x5D,
+        0x2A, 0x1A, 0xC1, 0x0A, 0x48, 0xD0, 0xD0, 0x8D, 0x07, 0xD6, 0x6F, 0xEA,
+        0x49, 0x71, 0xA4, 0xC6, 0xC0, 0x8B, 0x08, 0x3D, 0xD0, 0x4C, 0x71, 0x06 }, 0 },
+    { { 0xFE, 0x77, 0x95, 0x90, 0x62, 0xAB, 0xD1, 0xF1, 0xFC, 0x21, 0x2A, 0x0D,
+        0x49, 0x38, 0xA6, 0x54, 0xF9, 0x23, 0x3C, 0x0D, 0xED, 0x9B, 0x98, 0xA8,
+        0x3B, 0x5C, 0xF0, 0x07, 0xAC, 0x11, 0x1B, 0x5A, 0x6D, 0x6A, 0xF6, 0x05 },
+      { 0x1C, 0xC5, 0x29, 0x76, 0x10, 0x00, 0x89, 0x53, 0x7E, 0xD0, 0xC2, 0xBD,
+        0x31, 0x5E, 0x82, 0x47, 0x10, 0x7A, 0xC0, 0xA9, 0xC7, 0xAE, 0x17, 0x7A,
+        0xFF, 0x4A, 0xAC, 0x42, 0xF4, 0xEE, 0x37, 0x0D, 0x0E, 0x6A, 0x27, 0x00 }, 0 },
+    { { 0xAA, 0xE5, 0x69, 0xDE, 0xF2, 0x6E, 0x0C, 0x4B, 0x8C, 0xD3, 0x85, 0x99,
+        0xEA, 0xBC, 0x8F, 0xA7, 0xDB, 0x94, 0x3B, 0x45, 0xEB, 0x10, 0xA7, 0x2D,
+        0xB8, 0x3C, 0x39, 0x6F, 0x26, 0x38, 0xAC, 0xB4, 0xCE, 0x4C, 0x57, 0x06 },
+      { 0x9D, 0xB8, 0xEA, 0x91, 0xC3, 0x6F, 0xD7, 0x07, 0x69, 0x70, 0x9C, 0x53,
+        0xF9, 0xA9, 0x34, 0x10, 0xD7, 0x64, 0xE4, 0xF9, 0xCA, 0x9F, 0x04, 0x11,
+        0x1D, 0x0F, 0xE0, 0x4A, 0xE4, 0x97, 0xE1, 0x1C, 0xE5, 0x2D, 0x79, 0x03 }, 0 },
+    { { 0xD7, 0x6B, 0xBE, 0xF1, 0xB0, 0xB8, 0x70, 0x5E, 0x66, 0x2E, 0x95, 0x88,
+        0x3F, 0xBC, 0xC6, 0xB7, 0x6F, 0x3E, 0xB5, 0x27, 0x30, 0xB5, 0x93, 0xAD,
+        0x0F, 0xF5, 0x75, 0x23, 0x12, 0x12, 0x4A, 0x73, 0x2D, 0x8D, 0x7E, 0x07 },
+      { 0x14, 0x68, 0x9F, 0x6C, 0x4C, 0xED, 0xA0, 0x2B, 0x0F, 0xB3, 0xAB, 0xC2,
+        0x20, 0x50, 0xAE, 0xE5, 0x00, 0x08, 0x3D, 0x9F, 0x9A, 0xF5, 0x78, 0x69,
+        0x47, 0x72, 0x83, 0xE0, 0x5B, 0x66, 0x35, 0xAD, 0xB6, 0x78, 0x39, 0x05 }, 0 },
+    { { 0x05, 0x29, 0x44, 0x6C, 0x0D, 0x55, 0x0D, 0x3E, 0xF2, 0x57, 0x7E, 0xF8,
+        0xD9, 0x3F, 0xAB, 0x25, 0x70, 0x3C, 0xA0, 0x00, 0x19, 0x94, 0x0E, 0xC4,
+        0xE4, 0x19, 0x82, 0x20, 0x17, 0xC2, 0x35, 0x3F, 0xF4, 0xCF, 0x6A, 0x04 },
+      { 0x5B, 0x47, 0x4F, 0x7D, 0xF3, 0xEA, 0xA9, 0xF1, 0xCB, 0x96, 0x68, 0x16,
+        0xEB, 0xCC, 0xFE, 0xC5, 0x8F, 0x6E, 0xF8, 0xA1, 0xA7, 0xAB, 0x07, 0x62,
+        0x12, 0x9C, 0x91, 0x5F, 0xF5, 0x31, 0x8F, 0x7E, 0xDE, 0x8F, 0xAB, 0x03 }, 0 },
+    { { 0x9C, 0x6A, 0x9D, 0xE9, 0x66, 0xF0, 0x52, 0x35, 0xDE, 0xA6, 0xF1, 0x23,
+        0x72, 0xE5, 0x27, 0xE4, 0x99, 0xC9, 0xB3, 0x99, 0x3D, 0x1A, 0x9C, 0x22,
+        0xE2, 0x79, 0xE7, 0xA6, 0x57, 0x0F, 0x81, 0xE3, 0x40, 0x01, 0x90, 0x04 },
+      { 0x72, 0x9F, 0xB6, 0x16, 0x09, 0x23, 0x55, 0x89, 0x6A, 0x33, 0xCF, 0x92,
+        0xA0, 0xE5, 0x81, 0xE7, 0x2A, 0x0E, 0x4B, 0x2C, 0xB5, 0xC6, 0xCD, 0x93,
+        0x68, 0xA8, 0x3E, 0x85, 0xD2, 0xD1, 0xDB, 0xD7, 0x43, 0x75, 0xF0, 0x07 }, 0 },
+    { { 0x4B, 0xF0, 0xAF, 0x34, 0xE2, 0x18, 0x61, 0x95, 0x0E, 0x7E, 0x16, 0xE7,
+        0x3B, 0x3A, 0x83, 0xFF, 0xA4, 0x67, 0xB8, 0xA4, 0x62, 0xCD, 0x41, 0x5F,
+        0x63, 0x6A, 0xA2, 0x06, 0x09, 0x2C, 0xBA, 0x4E, 0xCD, 0xA1, 0x4D, 0x05 },
+      { 0x44, 0xC4, 0x61, 0xB5, 0x31, 0x03, 0x6B, 0xD0, 0xA3, 0x81, 0x7D, 0xB9,
+        0x75, 0xF2, 0x6B, 0x0B, 0xA3, 0xC0, 0x7F, 0x21, 0x7E, 0x75, 0x5A, 0x84,
+        0xFB, 0xCF, 0x60, 0xC3, 0x03, 0xC2, 0x9F, 0x7F, 0x67, 0xA2, 0x8B, 0x07 }, 0 },
+    { { 0x69, 0x32, 0x9A, 0x2C, 0x73, 0xC2, 0x99, 0x62, 0x52, 0xDB, 0xB1, 0x33,
+        0x6B, 0xB9, 0x68, 0x69, 0x80, 0x58, 0x55, 0x3B, 0x8F, 0xBC, 0x71, 0x6C,
+        0x7F, 0xD7, 0x8F, 0x89, 0xE1, 0x51, 0x2E, 0x4F, 0xB7, 0xEB, 0xE7, 0x03 },
+      { 0x4A, 0xF9, 0x30, 0x12, 0x54, 0x70, 0x95, 0x77, 0x11, 0xD1, 0x4D, 0x12,
+        0x51, 0x25, 0xC4, 0xB9, 0xEA, 0xF7, 0xF6, 0xDC, 0x65, 0xE2, 0x3C, 0xB6,
+        0x25, 0x52, 0x17, 0x56, 0xC5, 0x47, 0x20, 0xA0, 0xCA, 0x90, 0x50, 0x04 }, 0 },
+    { { 0xBE, 0xE9, 0xA2, 0x1D, 0x0C, 0x80, 0xE6, 0xF8, 0xC3, 0xB6, 0x7F, 0xE6,
+        0x0B, 0x71, 0x3C, 0xF5, 0xC8, 0x58, 0x66, 0x8C, 0xDF, 0x9B, 0xED, 0x63,
+        0xA1, 0xCA, 0xFF, 0x9A, 0x5C, 0x27, 0x22, 0xED, 0x73, 0x3A, 0x58, 0x03 },
+      { 0xC2, 0x87, 0x1B, 0x9C, 0xFB, 0x6A, 0xE8, 0x61, 0xFD, 0x47, 0x77, 0x32,
+        0x3C, 0xB0, 0x4D, 0x64, 0xF7, 0x47, 0x0B, 0xF8, 0x83, 0xE6, 0xA0, 0x8F,
+        0xFA, 0x73, 0x54, 0xD6, 0x44, 0x5A, 0x6E, 0x19, 0x28, 0xE3, 0x09, 0x02 }, 0 },
+    { { 0x8A, 0x58, 0x7C, 0xB2, 0xFA, 0x28, 0x1B, 0x9C, 0xBD, 0xDE, 0x4D, 0xE2,
+        0x28, 0x67, 0xD0, 0xD1, 0x4F, 0xDD, 0xEB, 0x6E, 0x2E, 0xA8, 0x6A, 0x1A,
+        0xDB, 0xFB, 0x97, 0xC2, 0xAD, 0x63, 0xA4, 0xF7, 0x53, 0x7E, 0xE6, 0x03 },
+      { 0x18, 0x97, 0xB6, 0x57, 0xE4, 0x15, 0x72, 0xFB, 0xB5, 0x93, 0x09, 0x34,
+        0x51, 0xDC, 0x06, 0xB1, 0x49, 0xD0, 0xEB, 0xF0, 0xC3, 0x61, 0x77, 0xFB,
+        0x17, 0xCD, 0x73, 0x95, 0x19, 0x86, 0xB5, 0x1A, 0x6E, 0xCB, 0x0A, 0x04 }, 0 },
+    { { 0x01, 0xBD, 0x05, 0xA0, 0x8D, 0x14, 0x74, 0xD8, 0xAB, 0x23, 0x20, 0x09,
+        0xFB, 0x45, 0xE5, 0x7C, 0x95, 0x55, 0x6F, 0xD5, 0x37, 0x51, 0x2A, 0x82,
+        0x70, 0x31, 0xB1, 0x5A, 0x1C, 0xB2, 0x39, 0xE9, 0x10, 0xC0, 0xF9, 0x04 },
+      { 0x79, 0x3E, 0x0C, 0x0A, 0x28, 0xC8, 0x1D, 0xEA, 0xBD, 0xAE, 0xFE, 0x35,
+        0x0B, 0x42, 0x78, 0x8D, 0x28, 0x78, 0x2E, 0x74, 0x0C, 0xB7, 0x41, 0xE5,
+        0x91, 0xEA, 0x1E, 0xF4, 0x60, 0x9B, 0x4E, 0x70, 0xCE, 0xE8, 0x87, 0x00 }, 0 },
+    { { 0xF6, 0xD3, 0x52, 0x38, 0xFE, 0x42, 0x34, 0x28, 0x08, 0x84, 0x3F, 0x5A,
+        0xB4, 0x6A, 0x9B, 0x83, 0x3F, 0xE5, 0xA7, 0xEF, 0xB3, 0x8F, 0xC7, 0x35,
+        0x1A, 0x8C, 0x85, 0x68, 0x69, 0x01, 0xCC, 0xF6, 0x01, 0x3D, 0x79, 0x04 },
+      { 0x42, 0x0C, 0xA1, 0xFD, 0x5B, 0xB1, 0x3F, 0x8D, 0xF2, 0x84, 0x8A, 0xB9,
+        0xD0, 0xD3, 0x53, 0x7C, 0x59, 0xA1, 0x0A, 0x24, 0x19, 0xF8, 0x17, 0x36,
+        0x83, 0xF7, 0xD4, 0x7C, 0x68, 0x94, 0x03, 0xAD, 0xB3, 0xFE, 0xAF, 0x05 }, 0 },
+    { { 0xFE, 0xF6, 0x72, 0x32, 0x95, 0xF8, 0x1F, 0xCD, 0x2F, 0xE8, 0x99, 0x43,
+        0xC7, 0xF3, 0x61, 0xE1, 0x70, 0xA9, 0x2D, 0xBB, 0x78, 0xA1, 0x3B, 0x1A,
+        0x64, 0x4C, 0x1E, 0xDE, 0xF3, 0x8F, 0x2C, 0x5C, 0xC9, 0x2B, 0x81, 0x03 },
+      { 0x46, 0xC5, 0xE6, 0xBF, 0x5C, 0x9A, 0xBB, 0x78, 0xAC, 0x5E, 0x92, 0xE5,
+        0xCB, 0x98, 0xBC, 0xAD, 0x8B, 0x2C, 0x04, 0x92, 0x25, 0xD5, 0x81, 0xF4,
+        0x54, 0x78, 0x47, 0x76, 0x3F, 0x04, 0xE3, 0x0A, 0x37, 0xB9, 0xB7, 0x06 }, 0 },
+    { { 0x75, 0xD5, 0x55, 0x52, 0x49, 0xC3, 0x8B, 0x32, 0xC1, 0x43, 0xB8, 0x9A,
+        0x29, 0x24, 0xED, 0x91, 0x2D, 0xE3, 0x5F, 0xF4, 0x7B, 0x85, 0xCC, 0x52,
+        0x6F, 0xAE, 0x29, 0x89, 0x1C, 0x6B, 0x0A, 0xB8, 0x31, 0xC9, 0x75, 0x02 },
+      { 0x61, 0x75, 0xD6, 0x30, 0xFF, 0x0A, 0xAE, 0xD0, 0x7B, 0xA2, 0xE0, 0x7A,
+        0x37, 0x83, 0xF5, 0xF1, 0xDD, 0x36, 0x61, 0xE5, 0x93, 0x0D, 0x52, 0x5B,
+        0xD1, 0xD9, 0x8A, 0x6B, 0xDF, 0xB7, 0xC0, 0x08, 0xE2, 0x4A, 0xCB, 0x01 }, 0 },
+    { { 0x6F, 0x06, 0x1B, 0x9C, 0x2D, 0xD0, 0xAE, 0xF2, 0x2F, 0x4B, 0xDA, 0x64,
+        0xCE, 0x3E, 0xD2, 0x73, 0xD6, 0x00, 0xA8, 0x4E, 0xFC, 0x0D, 0xED, 0x0F,
+        0x7B, 0x22, 0x20, 0xE6, 0x03, 0xF0, 0x04, 0x98, 0x30, 0xC5, 0xCA, 0x03 },
+      { 0xBF, 0x8E, 0xBA, 0x16, 0xFA, 0xCA, 0xC0, 0x0B, 0x41, 0xF3, 0xDB, 0x21,
+        0x1A, 0x87, 0xB5, 0xF4, 0x0B, 0xB4, 0x1F, 0xF4, 0x13, 0xC6, 0x43, 0x94,
+        0x6B, 0xB6, 0x08, 0xBC, 0xCD, 0x37, 0xC2, 0x09, 0xDE, 0x17, 0x4A, 0x04 }, 0 },
+    { { 0xB9, 0xC6, 0xA4, 0xCA, 0xCD, 0xEB, 0xD5, 0xD9, 0xB4, 0xCF, 0x03, 0xD7,
+        0x3A, 0x96, 0x0A, 0xE1, 0x7E, 0x66, 0xC1, 0x93, 0xF3, 0xA5, 0x70, 0xB5,
+        0x4F, 0xC9, 0x53, 0xEF, 0x2C, 0x7A, 0x1D, 0xA1, 0x76, 0xF0, 0xF0, 0x02 },
+      { 0x40, 0xDD, 0x60, 0x9B, 0x7F, 0xCF, 0xF1, 0x0A, 0xDF, 0xD9, 0x02, 0xA9,
+        0xEC, 0xBD, 0xDA, 0xDD, 0x4D, 0x61, 0xD2, 0x49, 0xEB, 0x1E, 0x78, 0x99,
+        0x63, 0x88, 0xEA, 0x1F, 0x92, 0xD4, 0x42, 0xCA, 0x26, 0x34, 0xFF, 0x04 }, 0 },
+    { { 0x3A, 0xA9, 0x02, 0x27, 0xC1, 0xE3, 0x28, 0x34, 0xD2, 0xA7, 0xEA, 0x1D,
+        0x36, 0x38, 0x06, 0xCB, 0x92, 0x88, 0x42, 0x3C, 0xF2, 0x67, 0xEC, 0x95,
+        0xCE, 0x08, 0x66, 0xF8, 0x7E, 0xEA, 0x92, 0x02, 0xCA, 0x32, 0x2C, 0x04 },
+      { 0xD2, 0x16, 0x21, 0x94, 0xBB, 0x9F, 0xF3, 0xDB, 0x56, 0x76, 0xEA, 0xCB,
+        0xAC, 0x9D, 0xDF, 0x7A, 0x24, 0x67, 0x53, 0xD4, 0x14, 0x0D, 0x9B, 0x19,
+        0xDE, 0x5F, 0xB8, 0x6F, 0x12, 0x99, 0x19, 0x34, 0x10, 0x9D, 0x65, 0x02 }, 0 },
+    { { 0x33, 0x92, 0x2E, 0xEA, 0x2A, 0x19, 0x6F, 0x52, 0xA0, 0x1A, 0x07, 0xB5,
+        0x10, 0xED, 0x82, 0xD4, 0xB3, 0xE9, 0x40, 0x00, 0x62, 0xFC, 0x25, 0x7C,
+        0x36, 0x93, 0xBC, 0xEB, 0x2E, 0xD3, 0x64, 0xE7, 0x81, 0x88, 0x97, 0x05 },
+      { 0x84, 0x6D, 0xD6, 0x2F, 0x1D, 0xE1, 0x1E, 0x48, 0x1C, 0x57, 0xBC, 0x9A,
+        0x32, 0x85, 0x75, 0x99, 0xAE, 0x9E, 0x59, 0x2A, 0xEC, 0xC3, 0xFC, 0xA5,
+        0xEA, 0x7A, 0x4C, 0xD2, 0x9C, 0x12, 0xD4, 0xEF, 0x71, 0x20, 0x96, 0x05 }, 0 },
+    { { 0x18, 0xEB, 0x4B, 0xB7, 0x48, 0xA6, 0x0E, 0x35, 0xB3, 0xEE, 0xCB, 0xA9,
+        0x57, 0x68, 0xF7, 0x61, 0xBC, 0x4B, 0x7D, 0xE6, 0x9B, 0xBE, 0xFB, 0xD7,
+        0x94, 0x67, 0x4C, 0x00, 0x07, 0x02, 0x4B, 0x24, 0x5B, 0x07, 0x2D, 0x02 },
+      { 0x24, 0xDE, 0x65, 0x29, 0x2B, 0xEB, 0x0F, 0x58, 0x44, 0xC4, 0xD6, 0x5C,
+        0x8E, 0x54, 0x80, 0x50, 0x34, 0x32, 0x60, 0x67, 0xE0, 0x3C, 0x95, 0xB0,
+        0x09, 0xB9, 0x1F, 0x72, 0x64, 0x4B, 0xCD, 0xB2, 0x1D, 0x15, 0xDE, 0x06 }, 0 },
+    { { 0x06, 0x20, 0x49, 0xA5, 0x42, 0x8B, 0x14, 0x54, 0x7B, 0xF9, 0xE8, 0xF5,
+        0x50, 0x6A, 0x2A, 0x5B, 0xF4, 0x20, 0xFF, 0xAA, 0x3E, 0x27, 0x2B, 0x34,
+        0xD4, 0x73, 0x1C, 0xE5, 0x43, 0xFC, 0x85, 0xC1, 0x41, 0x3D, 0x11, 0x03 },
+      { 0x07, 0x6B, 0xA4, 0x13, 0xC6, 0x45, 0x60, 0x84, 0x62, 0x7A, 0xFE, 0xCE,
+        0x9D, 0x3E, 0xAD, 0x6B, 0xDE, 0x6C, 0x4E, 0xEE, 0xD7, 0x4A, 0x47, 0x25,
+        0x26, 0xCE, 0x00, 0x45, 0x7E, 0x17, 0x05, 0x9A, 0x4D, 0xF3, 0xB8, 0x06 }, 0 },
+    { { 0x61, 0x79, 0xFA, 0xB8, 0x2A, 0x36, 0x72, 0x28, 0x46, 0xE9, 0xCC, 0xCC,
+        0x6A, 0x25, 0xFA, 0xBE, 0x7D, 0xE1, 0xEB, 0xA7, 0x26, 0x4F, 0x5E, 0x22,
+        0xAB, 0x36, 0xF1, 0xCB, 0x25, 0x07, 0x7E, 0xC9, 0x5E, 0x83, 0x4D, 0x07 },
+      { 0xA5, 0x37, 0x07, 0xAC, 0x6E, 0x8B, 0x57, 0xE2, 0x29, 0xAC, 0x82, 0x1C,
+        0x16, 0xE1, 0x14, 0xF7, 0xEC, 0x58, 0xDA, 0x21, 0x0E, 0x79, 0xC0, 0xCD,
+        0x1C, 0xAC, 0x9F, 0x6B, 0x53, 0x1F, 0x43, 0x28, 0x54, 0x2B, 0x3D, 0x04 }, 0 },
+    { { 0xD0, 0x38, 0x6C, 0x28, 0x7B, 0x15, 0x52, 0xF5, 0xB0, 0x3C, 0xD9, 0x19,
+        0x38, 0x77, 0x51, 0xD3, 0x56, 0xA8, 0xDB, 0xDF, 0xE6, 0x3F, 0x7D, 0x2C,
+        0xB9, 0x71, 0x61, 0x9E, 0xFD, 0x39, 0x98, 0xA2, 0x48, 0x0E, 0x9D, 0x04 },
+      { 0xB0, 0xDA, 0x74, 0x62, 0x59, 0x87, 0x44, 0xEB, 0xF9, 0x2B, 0x54, 0x92,
+        0xD6, 0x72, 0x67, 0x14, 0x74, 0xF6, 0x61, 0x31, 0xFD, 0x0B, 0x63, 0xE1,
+        0xFC, 0x83, 0x48, 0x46, 0x8F, 0x40, 0x71, 0xE4, 0xAD, 0xA6, 0x67, 0x06 }, 0 },
+    { { 0x25, 0x2D, 0x27, 0xAE, 0x05, 0x47, 0x4F, 0x0D, 0x72, 0x49, 0x1F, 0x99,
+        0x80, 0x33, 0xCB, 0xF0, 0x48, 0x12, 0xB2, 0x3A, 0x44, 0x0E, 0xE4, 0x47,
+        0x09, 0xE0, 0x3A, 0x9C, 0x4A, 0x24, 0x9A, 0xE9, 0x66, 0xA4, 0x2B, 0x05 },
+      { 0x43, 0xD4, 0x87, 0x8E, 0xAE, 0x1E, 0x2A, 0x13, 0x73, 0x8A, 0x9B, 0x30,
+        0x79, 0xCE, 0x15, 0xF6, 0xCD, 0x1F, 0x11, 0x3C, 0xAA, 0xC7, 0x9B, 0x2A,
+        0x75, 0x5E, 0x33, 0x28, 0x31, 0x34, 0x5E, 0x07, 0x63, 0xA9, 0x3F, 0x01 }, 0 },
+    { { 0x45, 0x00, 0x9C, 0xD3, 0x68, 0x7D, 0x39, 0xAA, 0xD9, 0x21, 0x70, 0x2C,
+        0xDF, 0xFF, 0x14, 0x2F, 0x02, 0x16, 0xD4, 0xBE, 0x2B, 0x95, 0xEA, 0xFB,
+        0x35, 0x43, 0x64, 0xF5, 0x02, 0x1C, 0xEA, 0xD5, 0xF6, 0x9A, 0x8F, 0x00 },
+      { 0x98, 0xD9, 0x51, 0x9F, 0x56, 0x86, 0xFD, 0x8A, 0xAA, 0x9E, 0xEA, 0xCF,
+        0x32, 0x8E, 0xDC, 0xBD, 0x42, 0x5C, 0xC0, 0x94, 0x39, 0x04, 0xDB, 0xDF,
+        0x4D, 0x6C, 0x35, 0xF3, 0x92, 0xDF, 0x2F, 0xF0, 0xD6, 0x96, 0x2A, 0x07 }, 0 },
+    { { 0x27, 0x6A, 0x60, 0x2A, 0xCD, 0x87, 0x19, 0x2C, 0x6E, 0x83, 0x6F, 0xC4,
+        0x4C, 0x9E, 0x51, 0x02, 0xEA, 0x6E, 0xFD, 0xDC, 0xD0, 0xF9, 0x45, 0xA2,
+        0x18, 0x0B, 0xA6, 0xB7, 0xCB, 0x04, 0x39, 0xC8, 0x71, 0xD5, 0x31, 0x06 },
+      { 0xDB, 0xDD, 0xA5, 0xC6, 0x20, 0x15, 0xEA, 0xDB, 0x46, 0x60, 0xFE, 0x31,
+        0xD8, 0xB3, 0x5D, 0x90, 0x69, 0x6F, 0xC5, 0xFF, 0x14, 0x0D, 0x3D, 0x61,
+        0x22, 0x59, 0x75, 0x8E, 0xDC, 0xD1, 0x89, 0x28, 0x87, 0xA9, 0xFF, 0x02 }, 0 },
+    { { 0x79, 0xB5, 0x30, 0x70, 0x82, 0x9F, 0x12, 0x6B, 0xBD, 0x55, 0xA5, 0x43,
+        0xCB, 0xFD, 0xC8, 0xD3, 0x38, 0x96, 0x01, 0x02, 0x67, 0x27, 0x30, 0x5E,
+        0x96, 0x8D, 0xB6, 0xF4, 0xC6, 0xFE, 0x9F, 0x3B, 0x57, 0x87, 0x71, 0x02 },
+      { 0x70, 0x4D, 0xEB, 0x77, 0x07, 0x5F, 0x6A, 0xCB, 0x69, 0xEC, 0x83, 0x53,
+        0xD6, 0xDD, 0x10, 0xFC, 0x50, 0x7A, 0x5A, 0xCB, 0x44, 0x0B, 0x6D, 0x50,
+        0xAF, 0x58, 0x5F, 0xA8, 0x09, 0xDD, 0x12, 0x62, 0xEC, 0xC8, 0x8B, 0x03 }, 0 },
+    { { 0xB7, 0x21, 0x34, 0x26, 0xD3, 0x5F, 0xAA, 0xBB, 0xAB, 0x19, 0x63, 0xD9,
+        0x62, 0x0F, 0x34, 0x83, 0xFD, 0x3D, 0x23, 0x14, 0x0D, 0x8F, 0xB6, 0xC5,
+        0x09, 0x26, 0x72, 0xAB, 0xDC, 0xE3, 0xCC, 0xA5, 0x49, 0xB7, 0x77, 0x07 },
+      { 0x2B, 0x96, 0x31, 0x4B, 0x21, 0xCB, 0xE9, 0xE0, 0xDD, 0xB8, 0x98, 0x8F,
+        0x2D, 0x3B, 0x74, 0x18, 0xA0, 0xAC, 0x3E, 0xD3, 0x6E, 0x5A, 0xBA, 0x15,
+        0xD5, 0xFA, 0x87, 0x40, 0xFA, 0x15, 0x50, 0xFD, 0x13, 0x6C, 0xD3, 0x07 }, 0 },
+    { { 0x12, 0x72, 0x9E, 0x61, 0x7A, 0xEC, 0x34, 0x18, 0x64, 0x66, 0x8E, 0x53,
+        0x00, 0x4B, 0xC8, 0x96, 0xC6, 0xD4, 0x58, 0x48, 0xD2, 0x60, 0x7E, 0xD1,
+        0x15, 0x85, 0x76, 0xDA, 0x66, 0x71, 0x01, 0xF0, 0x48, 0x5A, 0x88, 0x00 },
+      { 0xB4, 0xF2, 0xA6, 0x12, 0x2F, 0x49, 0xF4, 0x91, 0x2F, 0x16, 0xAB, 0xFD,
+        0xB1, 0xB6, 0xCB, 0x8F, 0xAE, 0xCA, 0x2B, 0xB6, 0x73, 0x7D, 0x42, 0xE0,
+        0x38, 0xA0, 0x73, 0x6D, 0x5E, 0xE5, 0x00, 0x51, 0x5B, 0x91, 0xF2, 0x06 }, 0 },
+    { { 0xAA, 0x91, 0xE9, 0x72, 0x75, 0x5A, 0x78, 0x96, 0x78, 0x79, 0x1C, 0xF9,
+        0x46, 0x27, 0x49, 0x0D, 0xCA, 0xF0, 0xD2, 0xCA, 0x83, 0xF8, 0x78, 0x79,
+        0x32, 0x28, 0x1A, 0xCF, 0x6E, 0xFA, 0x1B, 0xB9, 0xED, 0x30, 0x55, 0x00 },
+      { 0x2E, 0x70, 0x3E, 0x33, 0x65, 0xB9, 0x92, 0xB9, 0xE9, 0xE4, 0x2D, 0x92,
+        0x9D, 0x3F, 0x9D, 0x29, 0x99, 0xB1, 0x2A, 0x25, 0x0F, 0xBF, 0xA1, 0x7A,
+        0x64, 0xFC, 0xEB, 0xA3, 0xC1, 0x75, 0x9A, 0x41, 0x10, 0x73, 0x5B, 0x05 }, 0 },
+    { { 0xBE, 0x1B, 0x1F, 0x31, 0xDD, 0x35, 0x92, 0x94, 0xE0, 0x88, 0x12, 0xDE,
+        0x5F, 0x92, 0x32, 0x09, 0x5B, 0xEB, 0xDD, 0x44, 0xB6, 0xD4, 0x6A, 0x79,
+        0x3C, 0x93, 0xB0, 0x73, 0x7E, 0xCD, 0x02, 0x06, 0x87, 0x7F, 0xE2, 0x03 },
+      { 0x1D, 0xD3, 0x4B, 0x07, 0x26, 0x91, 0xE2, 0xED, 0xA5, 0x6B, 0x9A, 0x40,
+        0xA5, 0x90, 0x1E, 0x3E, 0x11, 0x15, 0xC3, 0x5B, 0x88, 0x4A, 0x2F, 0x32,
+        0xDE, 0x2A, 0x22, 0x78, 0xAE, 0x28, 0x79, 0xF4, 0x7A, 0x78, 0x02, 0x02 }, 0 },
+    { { 0xC8, 0x4F, 0xF1, 0x7B, 0x8C, 0xF0, 0xE9, 0x6C, 0x4F, 0x71, 0x57, 0x5F,
+        0xFC, 0x97, 0x52, 0xB3, 0x23, 0x7F, 0x01, 0x09, 0x33, 0x03, 0xB3, 0xAC,
+        0x44, 0x48, 0x68, 0x9F, 0x7B, 0x33, 0xD2, 0xB0, 0x02, 0x28, 0x43, 0x06 },
+      { 0xE8, 0x43, 0x74, 0x09, 0xE6, 0x27, 0x1E, 0x25, 0xEB, 0x80, 0x85, 0xB3,
+        0x20, 0xEB, 0x0F, 0x96, 0x45, 0xC6, 0x57, 0x9E, 0x85, 0x5E, 0xE8, 0xD3,
+        0x14, 0xD8, 0xE5, 0x7B, 0x4D, 0xE2, 0xA5, 0x4E, 0xA3, 0x8A, 0x03, 0x07 }, 0 },
+    { { 0xFE, 0x57, 0xC4, 0xD0, 0xAE, 0xFE, 0x9B, 0x34, 0x56, 0x5E, 0xA0, 0xBD,
+        0x81, 0x34, 0x6A, 0x15, 0xDF, 0x8A, 0xFC, 0x3B, 0xF0, 0x93, 0xD4, 0x37,
+        0x27, 0x77, 0x08, 0xEF, 0x70, 0xE2, 0x0E, 0x92, 0x63, 0x07, 0x6B, 0x04 },
+      { 0xB6, 0x03, 0x08, 0xBF, 0xB7, 0x79, 0x47, 0x13, 0x2B, 0x10, 0x88, 0x27,
+        0x2B, 0xF5, 0x0E, 0x07, 0x55, 0xE0, 0xF9, 0x8A, 0x2E, 0xA4, 0x47, 0xF8,
+        0xA7, 0xDA, 0x13, 0x9E, 0xAE, 0x5B, 0x75, 0xB2, 0x1E, 0x33, 0x21, 0x03 }, 0 },
+    { { 0x02, 0xE6, 0xDB, 0x85, 0x88, 0xAC, 0xBF, 0x44, 0x34, 0x47, 0x31, 0x03,
+        0x4F, 0x0A, 0x17, 0xEB, 0x7C, 0xA9, 0xE7, 0xEC, 0x8D, 0x09, 0x9E, 0x34,
+        0x07, 0x80, 0x39, 0xAA, 0x49, 0x50, 0x42, 0xEE, 0x4D, 0x57, 0x1F, 0x01 },
+      { 0xF9, 0xE3, 0x20, 0xE1, 0xF3, 0x01, 0x6E, 0x8C, 0xCF, 0x14, 0x44, 0x5A,
+        0x08, 0xA9, 0xB9, 0x47, 0xE9, 0x55, 0x7F, 0x8F, 0x06, 0x25, 0x9C, 0xB6,
+        0x2B, 0xDD, 0x70, 0xAE, 0xDD, 0x04, 0x10, 0xE5, 0x8B, 0x1C, 0xC6, 0x03 }, 0 },
+    { { 0x80, 0x57, 0x2D, 0x70, 0x29, 0x07, 0x0D, 0x57, 0xAF, 0xB5, 0xB6, 0xCD,
+        0x68, 0xB7, 0x2D, 0xCF, 0x3A, 0x8D, 0x3C, 0xE4, 0xC3, 0xC5, 0x1B, 0xE2,
+        0x81, 0xD6, 0x28, 0xEE, 0x06, 0x8D, 0x92, 0x14, 0x2E, 0x36, 0x80, 0x06 },
+      { 0x1F, 0x2A, 0xC2, 0x80, 0x8C, 0xDB, 0x5D, 0x57, 0xC7, 0x7A, 0x05, 0x33,
+        0x89, 0xC1, 0x5F, 0x60, 0xD0, 0xEE, 0xB6, 0x12, 0x02, 0x08, 0x73, 0x7B,
+        0x3E, 0x31, 0x38, 0x38, 0x90, 0x97, 0xE3, 0x07, 0xEE, 0x73, 0xFF, 0x00 }, 0 },
+    { { 0x1F, 0x4A, 0x55, 0x81, 0x8C, 0x33, 0x8C, 0xE5, 0xD5, 0xB4, 0xD5, 0xA2,
+        0x54, 0x4F, 0x29, 0x24, 0xDE, 0x25, 0x59, 0x85, 0xE0, 0x9C, 0x66, 0x41,
+        0x76, 0x50, 0x93, 0x36, 0xB3, 0x04, 0x4D, 0x25, 0x31, 0xA4, 0x06, 0x05 },
+      { 0x23, 0xBC, 0xCA, 0x16, 0xC0, 0x63, 0xB2, 0x85, 0x9F, 0x3E, 0xC2, 0x70,
+        0xFE, 0xA4, 0x38, 0xD7, 0xB2, 0xDA, 0xAE, 0xD3, 0x6F, 0x10, 0xA7, 0x2B,
+        0xB4, 0x9A, 0x08, 0xD4, 0x25, 0x75, 0xA5, 0x74, 0x46, 0xBB, 0x34, 0x00 }, 0 },
+    { { 0x9C, 0x32, 0x59, 0x3C, 0x6A, 0x8C, 0xC6, 0x84, 0x19, 0xE4, 0xA2, 0xC9,
+        0x7C, 0x52, 0xEB, 0x47, 0xC2, 0x09, 0x94, 0x55, 0x99, 0x8E, 0x1A, 0x49,
+        0x02, 0x21, 0xBD, 0x9D, 0xE3, 0x01, 0xC3, 0xD9, 0x91, 0x58, 0x3B, 0x02 },
+      { 0x25, 0x03, 0x97, 0x54, 0x11, 0x7D, 0x8D, 0x0B, 0x8F, 0xEA, 0xAB, 0xA0,
+        0x33, 0xB3, 0x91, 0x30, 0xBF, 0x9B, 0x73, 0x06, 0x57, 0x8C, 0xB1, 0xA4,
+        0xD6, 0x42, 0x8A, 0x20, 0xB2, 0x9F, 0x12, 0xE4, 0xAD, 0xF0, 0x2E, 0x04 }, 0 },
+    { { 0x42, 0xAA, 0x0E, 0x7F, 0xF5, 0x0A, 0x5F, 0xA7, 0xF6, 0x2F, 0x09, 0x92,
+        0xC4, 0x89, 0xDF, 0xD9, 0x60, 0xEB, 0xC6, 0x6E, 0x2F, 0x25, 0x93, 0x23,
+        0x4A, 0x04, 0x4B, 0x74, 0x54, 0x7E, 0x93, 0xB2, 0xD7, 0x0C, 0xE5, 0x00 },
+      { 0xE6, 0xA5, 0xC7, 0x4B, 0xB1, 0x7C, 0xB7, 0xD5, 0x24, 0xD4, 0x5E, 0xD5,
+        0xF1, 0x0A, 0x96, 0x71, 0x4E, 0xF9, 0x9F, 0x67, 0xB8, 0xB8, 0xDB, 0xE1,
+        0xCF, 0xB2, 0xBD, 0x5F, 0xD7, 0x32, 0xDF, 0x32, 0xEA, 0xEA, 0xA3, 0x07 }, 0 },
+    { { 0x96, 0x1F, 0x3D, 0xAF, 0x8C, 0x05, 0x06, 0xCD, 0xDF, 0x8E, 0xDB, 0x48,
+        0x93, 0xE5, 0xE0, 0x24, 0xD6, 0x23, 0x46, 0xA1, 0x9E, 0x41, 0x7F, 0xBD,
+        0xDA, 0xA8, 0x02, 0xC1, 0x56, 0x7D, 0x70, 0x73, 0x4A, 0x42, 0xC3, 0x00 },
+      { 0x92, 0x1B, 0xF1, 0x39, 0xCD, 0x09, 0xF6, 0xC5, 0x1B, 0x7F, 0xF0, 0x2A,
+        0x89, 0x4A, 0x58, 0x98, 0x80, 0xB2, 0x0E, 0x18, 0x9D, 0x25, 0x77, 0xDD,
+        0xC8, 0x21, 0x37, 0xCF, 0x6D, 0x66, 0xDB, 0x6D, 0x48, 0x0B, 0x8A, 0x03 }, 0 },
+    { { 0x91, 0x57, 0x44, 0xE3, 0x55, 0x05, 0xB4, 0xA5, 0x39, 0x19, 0x12, 0xE7,
+        0xB5, 0x27, 0x11, 0x6D, 0xBD, 0xF4, 0x4D, 0xF2, 0x38, 0x8C, 0x02, 0x02,
+        0x37, 0x71, 0x24, 0xD4, 0xD6, 0x97, 0x53, 0x60, 0x1D, 0xF0, 0x3E, 0x02 },
+      { 0x4A, 0x00, 0xA6, 0xD6, 0x0B, 0x23, 0xA4, 0xD0, 0xD2, 0x2A, 0x46, 0xC1,
+        0x9D, 0xAC, 0x73, 0x34, 0x44, 0x1C, 0x6F, 0xA0, 0x38, 0x35, 0xC9, 0x3E,
+        0x66, 0x66, 0x02, 0x1E, 0x51, 0x0B, 0xC8, 0x8D, 0x3D, 0x3D, 0x24, 0x02 }, 0 },
+    { { 0xBB, 0x7B, 0x22, 0x58, 0xCD, 0xE3, 0x4C, 0xEB, 0x85, 0x01, 0xFB, 0x75,
+        0x1C, 0xFA, 0xAB, 0x81, 0x34, 0x7B, 0x1A, 0xDF, 0xFF, 0xEC, 0x43, 0x13,
+        0x4A, 0x27, 0xDB, 0x12, 0xBA, 0xB1, 0xFA, 0xF8, 0xDB, 0xDE, 0x02, 0x02 },
+      { 0x1C, 0xCF, 0xAF, 0x63, 0xC7, 0x87, 0xF7, 0x18, 0xFC, 0x7C, 0x4A, 0x60,
+        0xCE, 0x50, 0x9C, 0x32, 0x31, 0x4A, 0xB8, 0x04, 0xB4, 0x41, 0xE5, 0x7F,
+        0x3D, 0xD9, 0x0F, 0x4A, 0x05, 0x27, 0xDD, 0x04, 0xE6, 0x54, 0x08, 0x01 }, 0 },
+    { { 0x5F, 0xAC, 0x3B, 0xF5, 0xB1, 0x83, 0x05, 0x1B, 0x88, 0x34, 0xA5, 0x80,
+        0x74, 0xA2, 0x09, 0x87, 0xB6, 0x11, 0xC8, 0xFD, 0xEF, 0xB0, 0x9B, 0x6D,
+        0xBE, 0x05, 0x12, 0xFA, 0x14, 0xBF, 0x46, 0xB5, 0xC3, 0xB9, 0x4A, 0x00 },
+      { 0xCD, 0x01, 0xBA, 0x5C, 0xD9, 0x90, 0x7A, 0x8D, 0xF0, 0x48, 0xCE, 0x3A,
+        0x4B, 0xFE, 0x55, 0x74, 0x16, 0x9D, 0x97, 0x34, 0x15, 0x48, 0x0C, 0x32,
+        0xA6, 0x0E, 0x53, 0xBE, 0x42, 0x26, 0x48, 0xE3, 0xCF, 0x1C, 0xFC, 0x07 }, 0 },
+    { { 0xC0, 0xA9, 0x85, 0x97, 0x03, 0x5C, 0x77, 0x60, 0xB6, 0x0E, 0x5C, 0xD4,
+        0x70, 0xEB, 0xE4, 0x19, 0x0C, 0x8E, 0x42, 0x23, 0xE4, 0x80, 0x8D, 0xEF,
+        0xE4, 0x74, 0x3C, 0xAD, 0xEF, 0x11, 0xD2, 0x05, 0xF5, 0x60, 0xC7, 0x04 },
+      { 0x8C, 0xC9, 0x9C, 0x42, 0xD2, 0xB6, 0xCE, 0x30, 0x88, 0x61, 0x00, 0x5D,
+        0xA1, 0x51, 0xEF, 0x09, 0x88, 0xE0, 0xE1, 0x84, 0x33, 0x14, 0xDF, 0x82,
+        0x8F, 0xE8, 0xCD, 0x12, 0x61, 0x74, 0x75, 0x39, 0x7F, 0xB5, 0x9B, 0x04 }, 0 },
+    { { 0x54, 0xF3, 0x5A, 0x61, 0xC2, 0xDB, 0x18, 0x35, 0x57, 0x48, 0x63, 0x25,
+        0x26, 0xF3, 0x89, 0x27, 0x0B, 0x48, 0xA6, 0x5F, 0x9E, 0xF1, 0xEA, 0xCF,
+        0x2C, 0x93, 0xC2, 0xC4, 0x10, 0xCE, 0xDF, 0x87, 0x05, 0x62, 0xE7, 0x04 },
+      { 0x0A, 0xDE, 0x83, 0x71, 0x7D, 0x13, 0xC5, 0xD3, 0x92, 0x3F, 0xEC, 0x20,
+        0xF5, 0xF2, 0xFB, 0x39, 0x17, 0x82, 0x75, 0x07, 0x8C, 0xC1, 0x34, 0x7D,
+        0xA7, 0xD8, 0x6F, 0x6F, 0x03, 0xB6, 0xA3, 0xDF, 0x78, 0x0E, 0x9A, 0x04 }, 0 },
+    { { 0x2F, 0xE7, 0x1C, 0xD8, 0xCD, 0x59, 0x0D, 0x1C, 0x34, 0xF6, 0x8D, 0x28,
+        0x41, 0xF2, 0x2A, 0xF5, 0xB9, 0xAB, 0xA6, 0x38, 0xAE, 0x28, 0x7B, 0x77,
+        0x1F, 0x45, 0xEB, 0xF8, 0x4C, 0x1F, 0xC7, 0xC7, 0xAA, 0xE8, 0xA9, 0x02 },
+      { 0x61, 0x80, 0x44, 0x4D, 0x02, 0x71, 0x08, 0x42, 0xE9, 0xF2, 0x4A, 0x75,
+        0x8C, 0x32, 0x0D, 0xAA, 0x89, 0x74, 0x21, 0x7E, 0x07, 0xB2, 0xE0, 0x57,
+        0x6B, 0x3A, 0x38, 0x82, 0x74, 0xD2, 0x4C, 0x11, 0xBB, 0x2C, 0x75, 0x04 }, 0 },
+    { { 0x66, 0x86, 0x79, 0x2A, 0xB3, 0xC0, 0x79, 0xB3, 0xF8, 0x16, 0x6D, 0xAB,
+        0x55, 0x70, 0xB9, 0x31, 0x42, 0x88, 0xA3, 0x14, 0x5C, 0x16, 0x73, 0xE9,
+        0x07, 0x60, 0xF7, 0x6E, 0xD9, 0x20, 0x94, 0x09, 0xA9, 0x55, 0xD1, 0x03 },
+      { 0x4B, 0x6F, 0x0A, 0xF3, 0xFB, 0x82, 0x70, 0x60, 0xF7, 0x5B, 0x4F, 0x36,
+        0x6D, 0xF5, 0x0B, 0x4D, 0x7B, 0x74, 0xFD, 0xB3, 0x82, 0x05, 0x49, 0xB2,
+        0xE9, 0x10, 0x2C, 0x8E, 0x0F, 0x2A, 0xF1, 0xAB, 0xD0, 0xD8, 0xB7, 0x00 }, 0 },
+    { { 0x8E, 0x89, 0xF7, 0xA3, 0xA4, 0x9D, 0x54, 0x54, 0x15, 0x8A, 0xBB, 0x15,
+        0x53, 0xEF, 0xF8, 0xAA, 0x3E, 0x86, 0xAB, 0x14, 0xB6, 0xD5, 0x45, 0x68,
+        0x77, 0x1A, 0x1F, 0x54, 0x63, 0xF9, 0xD4, 0x86, 0xA8, 0x6A, 0x67, 0x01 },
+      { 0xFB, 0x72, 0x3A, 0x8B, 0xBF, 0x6E, 0xC4, 0xB4, 0xF1, 0xD7, 0xD2, 0x26,
+        0xB1, 0xFA, 0xEF, 0x51, 0x32, 0x48, 0xAE, 0x69, 0xD7, 0xFF, 0xA4, 0xC3,
+        0xD8, 0x60, 0x94, 0xBF, 0x7E, 0x36, 0x6D, 0xCE, 0xBE, 0x5B, 0xA0, 0x05 }, 0 },
+    { { 0xB4, 0x82, 0x90, 0xCD, 0x4B, 0xEF, 0xB0, 0x0B, 0x0F, 0x94, 0x65, 0x6C,
+        0x7F, 0xD5, 0xF4, 0xB2, 0x66, 0x15, 0xC6, 0x0B, 0x83, 0x07, 0xBD, 0xC1,
+        0xE4, 0x77, 0xC3, 0xBF, 0x6E, 0x8F, 0xF8, 0xFD, 0xB9, 0x23, 0xBC, 0x06 },
+      { 0xC2, 0x0D, 0x6B, 0x40, 0x79, 0xF0, 0x32, 0x48, 0x89, 0xE4, 0x5F, 0xA7,
+        0xF3, 0x39, 0xF4, 0xFF, 0x43, 0x1F, 0xC4, 0x47, 0xAD, 0xD1, 0xCB, 0x01,
+        0xC0, 0x91, 0x07, 0xF3, 0xBC, 0xAD, 0x81, 0xA3, 0xE1, 0xC8, 0x83, 0x03 }, 0 },
+    { { 0x4F, 0xA4, 0x16, 0x0E, 0x09, 0x73, 0x15, 0xF7, 0x6F, 0xCD, 0x17, 0x6F,
+        0xDB, 0x21, 0x27, 0x75, 0x0C, 0xD7, 0x28, 0xFB, 0x24, 0x34, 0xDE, 0x8E,
+        0x45, 0xDA, 0xBA, 0x12, 0x94, 0x03, 0x33, 0x3E, 0x41, 0xE3, 0xE9, 0x03 },
+      { 0x16, 0xF2, 0xD6, 0x55, 0x42, 0x42, 0x12, 0x6B, 0x66, 0xE7, 0x52, 0xBA,
+        0xB1, 0x89, 0xE9, 0x45, 0x6B, 0xE0, 0x9F, 0x24, 0xA3, 0xF4, 0xAE, 0x80,
+        0xF1, 0x3B, 0x84, 0x62, 0x07, 0x8D, 0x54, 0x9F, 0x35, 0x67, 0x7B, 0x00 }, 0 },
+    { { 0x96, 0x2F, 0xFD, 0x85, 0xCB, 0xEF, 0x8E, 0x79, 0x5A, 0x7F, 0x6C, 0xBF,
+        0x01, 0xA6, 0xDA, 0x24, 0xFC, 0x55, 0x34, 0x00, 0x93, 0xD6, 0xBE, 0x8D,
+        0x6E, 0x3B, 0xE8, 0xC1, 0x93, 0x13, 0xE5, 0xA4, 0x23, 0x15, 0x92, 0x07 },
+      { 0xBD, 0x03, 0xFE, 0x8F, 0xA4, 0x78, 0xE8, 0x42, 0xEF, 0xC3, 0xC4, 0x24,
+        0x84, 0x64, 0x7A, 0x7E, 0x1B, 0xAE, 0x6B, 0xE4, 0xE8, 0x91, 0x49, 0x15,
+        0x28, 0x57, 0xC1, 0x57, 0x43, 0xCB, 0xF2, 0xA5, 0x4E, 0xC5, 0x1E, 0x02 }, 0 },
+    { { 0xBD, 0x26, 0x61, 0xE7, 0xD6, 0xDE, 0x4F, 0xE9, 0x43, 0x3E, 0x74, 0x32,
+        0x54, 0xFE, 0xAB, 0xBC, 0xD2, 0x2D, 0xC6, 0x72, 0x2F, 0x5A, 0x4E, 0xD5,
+        0x32, 0x48, 0xD0, 0xD2, 0x6C, 0xAE, 0x6D, 0x5F, 0x3B, 0xBC, 0x9B, 0x05 },
+      { 0x36, 0xCD, 0x16, 0xD0, 0x84, 0x0D, 0x66, 0xF3, 0x2D, 0x05, 0x29, 0x4A,
+        0x7F, 0x7B, 0x1E, 0x34, 0xEC, 0x2C, 0x5B, 0x00, 0xAD, 0x7E, 0xB7, 0x7A,
+        0x50, 0xC1, 0x44, 0x57, 0x5A, 0x39, 0xA5, 0x32, 0xE9, 0xA5, 0x27, 0x01 }, 0 },
+    { { 0xF7, 0xB8, 0x68, 0xF2, 0xBD, 0x24, 0x1F, 0x8D, 0xB5, 0xFB, 0xF8, 0x93,
+        0x25, 0x07, 0xC0, 0x2F, 0x77, 0x03, 0x7F, 0x41, 0x7A, 0x3C, 0x90, 0x79,
+        0x53, 0x12, 0x59, 0xD0, 0x79, 0x0A, 0xEF, 0xBB, 0x6F, 0x96, 0x63, 0x03 },
+      { 0x9A, 0x4A, 0x51, 0x34, 0x18, 0x61, 0xE4, 0x82, 0xCC, 0x8A, 0x57, 0xF4,
+        0xA7, 0x36, 0x73, 0x5A, 0x3E, 0x05, 0x35, 0x87, 0x6E, 0x8E, 0x78, 0xF7,
+        0x7F, 0xBB, 0xE5, 0x59, 0xEF, 0xB6, 0x3B, 0xEF, 0xC5, 0x08, 0x36, 0x07 }, 0 },
+    { { 0xEC, 0x56, 0xE6, 0x50, 0x20, 0xF6, 0x90, 0xC0, 0xFA, 0xA6, 0x54, 0xFA,
+        0x5F, 0xC6, 0x29, 0x70, 0x97, 0x10, 0xC6, 0xCB, 0xC6, 0x71, 0x59, 0xE5,
+        0x01, 0x83, 0x43, 0x86, 0x6D, 0x3C, 0x16, 0x49, 0x6E, 0x24, 0xE8, 0x03 },
+      { 0xE4, 0xC1, 0x72, 0x7E, 0x45, 0x89, 0xF2, 0x83, 0xB5, 0xAD, 0x8C, 0x92,
+        0x1B, 0x57, 0x4D, 0xDE, 0x86, 0x7E, 0x7F, 0x3C, 0xE3, 0x8C, 0x01, 0xB4,
+        0x1C, 0x75, 0xE6, 0x2A, 0xF2, 0xAF, 0xA6, 0x50, 0x38, 0xCB, 0x0F, 0x02 }, 0 },
+    { { 0x19, 0x23, 0x7C, 0x40, 0x47, 0x75, 0xDA, 0x75, 0x14, 0x3E, 0xEA, 0x02,
+        0xA6, 0x85, 0x0E, 0xE9, 0x53, 0x08, 0x4A, 0xA4, 0x96, 0x1A, 0x9F, 0xDB,
+        0x41, 0x47, 0x88, 0x6B, 0x10, 0x61, 0x5A, 0xDB, 0x5E, 0x82, 0xB9, 0x03 },
+      { 0x6D, 0x81, 0x50, 0x5C, 0x9D, 0x8F, 0x2B, 0x18, 0x9A, 0x10, 0x86, 0xF8,
+        0xAD, 0xF2, 0x33, 0x18, 0x35, 0xC0, 0x7A, 0x0C, 0x80, 0x03, 0x09, 0xA0,
+        0xE7, 0x7B, 0xF8, 0x75, 0xFB, 0x44, 0x7E, 0x06, 0x0F, 0xFF, 0xC1, 0x01 }, 0 },
+    { { 0xDA, 0xF1, 0xF3, 0x65, 0x29, 0xEF, 0x38, 0x7B, 0x93, 0xA2, 0xC9, 0x42,
+        0x1A, 0x88, 0x16, 0x55, 0xB5, 0xF0, 0xDC, 0x06, 0xB9, 0xAE, 0x85, 0x48,
+        0x56, 0x12, 0xD1, 0xAF, 0x00, 0x9D, 0x94, 0x65, 0x3C, 0x66, 0xA6, 0x01 },
+      { 0x4D, 0xFE, 0x2E, 0x40, 0x83, 0x74, 0xF8, 0x54, 0xFA, 0x76, 0xAD, 0x7E,
+        0x7E, 0x7D, 0x4E, 0xCB, 0x3E, 0xC6, 0xA0, 0xD8, 0xC5, 0x61, 0x22, 0xBF,
+        0x8F, 0xAD, 0xE0, 0xC4, 0x89, 0x1A, 0x3A, 0x1C, 0xA6, 0x79, 0xD8, 0x01 }, 0 },
+    { { 0x54, 0xDF, 0xBD, 0xA2, 0xC4, 0xF7, 0x5B, 0x70, 0x4D, 0x23, 0x53, 0x08,
+        0xAC, 0x0A, 0x2A, 0x14, 0xA5, 0x9A, 0x61, 0xB8, 0xE2, 0x47, 0x60, 0x62,
+        0xCC, 0x36, 0xDD, 0xF0, 0x59, 0x27, 0x34, 0x1A, 0xA9, 0x22, 0x04, 0x00 },
+      { 0xC9, 0xD2, 0x23, 0x04, 0x69, 0x59, 0xB6, 0x44, 0x9C, 0xAE, 0xAE, 0x63,
+        0xC5, 0xF8, 0xDC, 0x5F, 0x7C, 0x2C, 0x37, 0x04, 0x01, 0x9D, 0x3C, 0xCD,
+        0x2C, 0x64, 0x9A, 0x13, 0x36, 0x9C, 0x6A, 0xFB, 0x6F, 0x6E, 0xFB, 0x07 }, 0 },
+    { { 0x41, 0x6D, 0xD6, 0x92, 0x4E, 0x3F, 0xE6, 0x70, 0x01, 0x31, 0x90, 0x9F,
+        0x5F, 0x26, 0xFF, 0xF8, 0x38, 0xE3, 0x4E, 0x9B, 0x9F, 0x28, 0xB2, 0x0A,
+        0x30, 0x7C, 0x28, 0x7F, 0x62, 0x72, 0x01, 0x40, 0x0B, 0xB9, 0x0C, 0x00 },
+      { 0xD7, 0xA2, 0xB9, 0x05, 0x1A, 0x93, 0xF4, 0x85, 0x1E, 0x79, 0x59, 0xB3,
+        0x7E, 0x56, 0xB3, 0x30, 0x8B, 0x2D, 0x45, 0x90, 0xA7, 0x34, 0x44, 0x0D,
+        0x71, 0x80, 0xA6, 0x4E, 0x21, 0x97, 0x1A, 0x7D, 0xEB, 0xC0, 0x8E, 0x00 }, 0 },
+    { { 0x1D, 0xC4, 0x60, 0x01, 0x81, 0x74, 0x37, 0x7A, 0x69, 0x5D, 0x7D, 0xEB,
+        0x21, 0x52, 0xBE, 0xAA, 0xF0, 0x95, 0xD9, 0x6F, 0x5D, 0xC6, 0xB8, 0x32,
+        0xC3, 0x48, 0x9E, 0xEE, 0x07, 0xAA, 0x40, 0x62, 0x19, 0xF9, 0xA5, 0x06 },
+      { 0x1D, 0x5B, 0x5E, 0x6E, 0x98, 0x91, 0xB3, 0xAA, 0xBB, 0x3B, 0x1F, 0xAF,
+        0x94, 0x2D, 0x16, 0xB1, 0x52, 0x1C, 0x7B, 0xCE, 0xD3, 0x80, 0xD1, 0x23,
+        0x86, 0x15, 0x91, 0x92, 0x35, 0xE5, 0x85, 0xA7, 0x93, 0x63, 0x6F, 0x03 }, 0 },
+    { { 0xF4, 0x95, 0xE0, 0x34, 0x4D, 0x99, 0x41, 0x97, 0xD2, 0xB1, 0xE1, 0xEA,
+        0xAE, 0x95, 0x67, 0x6B, 0x5F, 0x26, 0x2E, 0x9C, 0xD4, 0x9B, 0xA9, 0x3A,
+        0x0A, 0x96, 0xC0, 0xD7, 0x46, 0x3C, 0xFA, 0xD5, 0x9C, 0x38, 0x11, 0x04 },
+      { 0xAE, 0xA3, 0x0F, 0x22, 0xB5, 0x46, 0x5E, 0xAA, 0xC9, 0x71, 0xE2, 0xAF,
+        0xE3, 0x07, 0x8D, 0x72, 0xE7, 0xA0, 0x49, 0xA2, 0xFF, 0x44, 0x48, 0x99,
+        0x08, 0x5D, 0xE0, 0x36, 0xAB, 0x48, 0xF7, 0xD4, 0x4F, 0x62, 0x4E, 0x04 }, 0 },
+    { { 0x2B, 0x84, 0xC6, 0x47, 0x39, 0xCF, 0x77, 0x9B, 0xE9, 0x7B, 0x27, 0xCE,
+        0xF2, 0x11, 0xAE, 0xC9, 0xD2, 0x5C, 0x36, 0x64, 0x76, 0x79, 0xC1, 0x21,
+        0x58, 0x21, 0xB3, 0xEC, 0xC6, 0xD9, 0x86, 0x42, 0xEC, 0xA6, 0xE8, 0x00 },
+      { 0xCF, 0x3B, 0xD4, 0x9D, 0xF6, 0xBB, 0xFE, 0x2A, 0xCC, 0x91, 0xBE, 0xA9,
+        0x2E, 0xCD, 0x15, 0x9C, 0xF3, 0x0E, 0x65, 0x00, 0x27, 0xD3, 0xCA, 0x06,
+        0x78, 0x10, 0xBC, 0x82, 0x5F, 0xED, 0xC6, 0x7E, 0xF4, 0x6F, 0xDA, 0x07 }, 0 },
+    { { 0x96, 0x41, 0x0F, 0x6E, 0x61, 0x58, 0xD9, 0x44, 0x1A, 0x21, 0x64, 0x06,
+        0x30, 0x1B, 0xF2, 0x31, 0xB7, 0x47, 0x14, 0xF8, 0xCF, 0x32, 0x51, 0xCA,
+        0xB4, 0xFD, 0x84, 0xCA, 0x96, 0x28, 0x51, 0xDB, 0x54, 0x26, 0x4A, 0x04 },
+      { 0xB8, 0xC2, 0x34, 0x36, 0x7F, 0x4E, 0x6A, 0x45, 0x13, 0x29, 0x30, 0xFD,
+        0x8B, 0x5F, 0x7D, 0x87, 0xBF, 0xF2, 0x93, 0x6B, 0xF8, 0x7F, 0x70, 0x96,
+        0x67, 0x38, 0x35, 0x1A, 0xC2, 0x9F, 0xB0, 0xFA, 0x6C, 0xD0, 0x70, 0x00 }, 0 },
+    { { 0x43, 0x50, 0xAA, 0x28, 0x10, 0xCC, 0xB3, 0x7D, 0x01, 0x45, 0xF5, 0x9B,
+        0x73, 0x76, 0x55, 0x5C, 0x1C, 0xC0, 0x36, 0xF9, 0xB1, 0x09, 0x03, 0x95,
+        0xE4, 0xCB, 0x6A, 0xBC, 0xE5, 0x58, 0x18, 0x92, 0x27, 0xAF, 0xF3, 0x03 },
+      { 0x34, 0x19, 0xF9, 0xD1, 0x33, 0x90, 0x45, 0x25, 0xAA, 0xF7, 0xB6, 0x97,
+        0xBF, 0x58, 0x78, 0xE5, 0xA7, 0x2C, 0xEF, 0x61, 0x82, 0xC9, 0x47, 0xB9,
+        0x15, 0x01, 0xA1, 0x5F, 0x71, 0x6C, 0x3D, 0xA4, 0x40, 0x09, 0x42, 0x06 }, 0 },
+    { { 0xF3, 0x5A, 0x46, 0xDA, 0x33, 0x9C, 0x52, 0x01, 0x92, 0xFB, 0x91, 0xB4,
+        0xD2, 0xEB, 0xC2, 0xDC, 0xA4, 0xF2, 0xA5, 0x7C, 0x9C, 0xB3, 0xC9, 0xC9,
+        0x1E, 0x07, 0xC5, 0xB1, 0x68, 0xAD, 0x5E, 0x69, 0x9E, 0xE1, 0x7B, 0x05 },
+      { 0x91, 0x04, 0xFD, 0xD2, 0x70, 0x6A, 0xA2, 0xB1, 0x08, 0xC9, 0x3C, 0x9B,
+        0x11, 0x9C, 0x7B, 0xEA, 0x3B, 0x52, 0xCF, 0x98, 0x84, 0x8C, 0x9C, 0x8B,
+        0x9F, 0x00, 0x44, 0xA4, 0xCC, 0x0A, 0xAF, 0x83, 0xB1, 0xFE, 0x3E, 0x06 }, 0 },
+    { { 0xBE, 0xF2, 0xA0, 0xF1, 0xDF, 0xA4, 0xF1, 0x02, 0x5E, 0x2D, 0x7E, 0xF6,
+        0xB7, 0x3A, 0xB7, 0xBF, 0x86, 0xEA, 0x91, 0xC4, 0x8E, 0x8B, 0xDA, 0x2C,
+        0x1D, 0x0B, 0xD9, 0x76, 0xD5, 0xA7, 0x22, 0xB8, 0xBC, 0x58, 0xBC, 0x06 },
+      { 0xF4, 0x48, 0x00, 0x20, 0x57, 0xC2, 0x8B, 0xDC, 0x3C, 0x18, 0xA2, 0x3F,
+        0x62, 0x8E, 0x3C, 0x0B, 0xA8, 0x5C, 0xE1, 0xCD, 0x9F, 0x84, 0x81, 0xEA,
+        0x96, 0x45, 0x7F, 0x2C, 0xA3, 0xA2, 0x77, 0x4D, 0xB8, 0x02, 0x32, 0x06 }, 0 },
+    { { 0xA2, 0xD2, 0x5E, 0x5D, 0xD7, 0xC9, 0x63, 0x32, 0xA0, 0x61, 0x83, 0x3C,
+        0xA3, 0xF7, 0x7E, 0x09, 0x38, 0x44, 0x18, 0x58, 0xD3, 0xE5, 0x2A, 0x5F,
+        0x0F, 0xE0, 0x2B, 0xCF, 0xAE, 0x90, 0xD8, 0x9D, 0xBD, 0x69, 0x0C, 0x06 },
+      { 0x43, 0x84, 0x14, 0x77, 0x34, 0x84, 0xF2, 0xD9, 0x8B, 0xD7, 0xC7, 0xFE,
+        0x12, 0x72, 0xD0, 0x0F, 0xFC, 0x5B, 0xCA, 0xEA, 0x87, 0x50, 0xEB, 0x10,
+        0x0D, 0x7C, 0xF5, 0x83, 0x43, 0x2F, 0xCD, 0xBA, 0xAC, 0xD2, 0xBE, 0x05 }, 0 },
+    { { 0xCF, 0x12, 0xFC, 0xE2, 0x9F, 0xA9, 0x20, 0x4C, 0xFE, 0xE9, 0x19, 0x97,
+        0xE6, 0x66, 0x1A, 0xF5, 0x96, 0x83, 0x43, 0xD4, 0x96, 0x70, 0x5D, 0x02,
+        0x1D, 0xAF, 0x79, 0xE0, 0x75, 0x09, 0x3E, 0x57, 0xE7, 0xC8, 0xE5, 0x05 },
+      { 0xE8, 0x8D, 0xA4, 0xD3, 0x9E, 0x6A, 0x74, 0x82, 0xEE, 0x40, 0x36, 0xD9,
+        0xE9, 0x8F, 0x33, 0x0D, 0x16, 0x01, 0x4F, 0xE0, 0x77, 0x50, 0x4B, 0xBB,
+        0xB7, 0x22, 0x05, 0xD3, 0x95, 0x1B, 0xE2, 0x70, 0x1E, 0xEC, 0xFC, 0x06 }, 0 },
+    { { 0xA0, 0x2C, 0xCB, 0x59, 0xB5, 0x06, 0x23, 0xB5, 0xF8, 0x79, 0xE3, 0x59,
+        0x7B, 0x08, 0x26, 0xF6, 0xF2, 0xFE, 0x5B, 0xE5, 0xAB, 0x41, 0x3E, 0x12,
+        0x64, 0x8D, 0x23, 0xFB, 0xBA, 0x31, 0x14, 0x4D, 0x55, 0x50, 0xBD, 0x06 },
+      { 0xB6, 0xF1, 0x1F, 0x55, 0xB1, 0x93, 0xC7, 0x07, 0x6A, 0xCA, 0xDD, 0xD6,
+        0xE0, 0x60, 0x79, 0x00, 0x74, 0xC4, 0x59, 0x6E, 0xA3, 0x8A, 0x03, 0x59,
+        0xFA, 0xF2, 0x2D, 0x69, 0x21, 0x4F, 0xD1, 0xB6, 0x34, 0x4D, 0x2A, 0x04 }, 0 },
+    { { 0xA3, 0xB8, 0x3C, 0xB4, 0x93, 0x71, 0x2F, 0x0A, 0xE5, 0xF4, 0xB4, 0xC0,
+        0x09, 0xCB, 0xFA, 0x00, 0x7F, 0x2F, 0x35, 0x42, 0x26, 0xDD, 0xC6, 0x08,
+        0xF9, 0x2F, 0x9C, 0xC2, 0x2F, 0xDF, 0x92, 0xB0, 0x27, 0xF7, 0x1C, 0x00 },
+      { 0x8A, 0x1B, 0xF1, 0x01, 0x62, 0xE2, 0xD4, 0x75, 0xFA, 0x7F, 0xF7, 0x2C,
+        0x03, 0x7A, 0xF3, 0x98, 0xB1, 0xF3, 0x5E, 0x37, 0x19, 0x0A, 0x92, 0xD3,
+        0x52, 0xC0, 0x92, 0xEF, 0xCB, 0x3E, 0x44, 0x08, 0x69, 0x1E, 0x8D, 0x05 }, 0 },
+    { { 0xAE, 0x6F, 0x69, 0xB6, 0xF1, 0x0A, 0x62, 0xD6, 0xDC, 0x8F, 0x3C, 0x1E,
+        0x57, 0x61, 0xF3, 0x90, 0x5B, 0xD6, 0x34, 0x97, 0x91, 0x10, 0xA8, 0xD6,
+        0x43, 0x20, 0x69, 0x30, 0xA9, 0x8F, 0x98, 0x76, 0xF2, 0x24, 0x3B, 0x07 },
+      { 0x31, 0x80, 0x0E, 0x81, 0x31, 0x08, 0xF7, 0xE2, 0x71, 0xBA, 0x9B, 0xEE,
+        0x79, 0x3A, 0x97, 0x2C, 0x91, 0x2F, 0x4C, 0x50, 0x1F, 0xF6, 0x52, 0x62,
+        0x36, 0xED, 0x74, 0xA8, 0x30, 0x14, 0x0C, 0xEA, 0x9B, 0xB3, 0x84, 0x05 }, 0 },
+    { { 0x52, 0xA5, 0xB5, 0xE7, 0x80, 0x0E, 0xB7, 0xD1, 0x6D, 0x89, 0x18, 0xC0,
+        0xA2, 0xB2, 0xFF, 0x0F, 0xC9, 0xE1, 0x9D, 0xF7, 0x77, 0xCC, 0xDC, 0xD7,
+        0xC8, 0x41, 0x9A, 0x06, 0x30, 0x26, 0x14, 0x86, 0xFC, 0x43, 0x70, 0x06 },
+      { 0x38, 0x60, 0xA4, 0x7B, 0xC9, 0x4C, 0xF0, 0x81, 0x99, 0x68, 0xF5, 0x34,
+        0x51, 0xBF, 0xE0, 0x00, 0xF5, 0xBC, 0x52, 0xE4, 0x69, 0x43, 0x9B, 0x07,
+        0x7E, 0xE4, 0xB2, 0x14, 0xDE, 0xBF, 0xA9, 0xC7, 0xD0, 0x1C, 0x06, 0x06 }, 0 },
+    { { 0x5D, 0xB8, 0x29, 0x5C, 0xAE, 0x06, 0x07, 0x2F, 0xD5, 0x85, 0x09, 0x88,
+        0x0F, 0x11, 0xE4, 0x24, 0x90, 0x23, 0xB9, 0xEF, 0x8A, 0x66, 0xBC, 0x61,
+        0xC7, 0x57, 0x1C, 0x47, 0x49, 0x68, 0x2C, 0x73, 0xBA, 0xCF, 0x92, 0x07 },
+      { 0x41, 0x7F, 0x00, 0xAB, 0xC7, 0xF1, 0x2C, 0xEC, 0xAD, 0x9B, 0x67, 0x9D,
+        0x38, 0x13, 0xE0, 0x7E, 0x54, 0x91, 0xF4, 0x5D, 0xDE, 0x27, 0x5D, 0x05,
+        0x21, 0x1F, 0x01, 0x52, 0x53, 0x21, 0x4D, 0x04, 0xAE, 0xF6, 0x11, 0x07 }, 0 },
+    { { 0x1B, 0xA5, 0xD2, 0x59, 0x3D, 0x13, 0x42, 0x9E, 0x4D, 0xB2, 0x6B, 0xAB,
+        0xFF, 0xA1, 0xA2, 0x2D, 0x1F, 0x29, 0x94, 0x0F, 0x47, 0x7B, 0x61, 0x85,
+        0x01, 0x78, 0x26, 0x00, 0xC4, 0x97, 0xBC, 0xC1, 0x23, 0xC6, 0x07, 0x06 },
+      { 0x78, 0xCF, 0x61, 0xB0, 0x84, 0x3F, 0xE6, 0x57, 0x4F, 0x52, 0x85, 0xE7,
+        0xE7, 0xE8, 0x44, 0xBF, 0x69, 0x96, 0x48, 0xD2, 0x11, 0x97, 0x0D, 0xA4,
+        0x49, 0x44, 0x0D, 0x8D, 0x11, 0xC7, 0x02, 0xAC, 0xB2, 0x1C, 0xB7, 0x00 }, 0 },
+    { { 0x44, 0x59, 0x89, 0x1E, 0x2D, 0x66, 0x9B, 0xFE, 0x4D, 0x3C, 0x24, 0x1A,
+        0xE3, 0x9D, 0x05, 0xD4, 0x14, 0xAE, 0x0E, 0x54, 0x49, 0x64, 0x59, 0x2B,
+        0xC9, 0xE9, 0x84, 0x44, 0x10, 0x06, 0x25, 0x9E, 0x30, 0x08, 0xB4, 0x03 },
+      { 0x0C, 0xA7, 0x01, 0x0D, 0xD0, 0x21, 0x4B, 0xD6, 0x5F, 0x92, 0x5F, 0xCE,
+        0x28, 0x64, 0x98, 0x43, 0x5E, 0xA4, 0x69, 0x41, 0xB0, 0xB4, 0x45, 0xAE,
+        0x77, 0x2E, 0xE5, 0x16, 0x86, 0x24, 0x1B, 0xF1, 0xA3, 0x3E, 0x2A, 0x07 }, 0 },
+    { { 0x1E, 0x09, 0xC2, 0xDA, 0x43, 0xC1, 0xA7, 0xB5, 0xEE, 0x17, 0xF6, 0x1E,
+        0xAA, 0x28, 0x4B, 0x1C, 0x2D, 0x3A, 0xD1, 0xB6, 0x18, 0xB4, 0x1B, 0x30,
+        0x49, 0xE7, 0xD8, 0x16, 0xA7, 0x33, 0x48, 0xD6, 0x19, 0x16, 0x12, 0x06 },
+      { 0x54, 0x20, 0x3E, 0x11, 0x3C, 0x99, 0x1F, 0xB1, 0xF4, 0x3F, 0xE8, 0x45,
+        0x27, 0x41, 0x31, 0x80, 0x9F, 0x5D, 0x41, 0xEA, 0x15, 0xAE, 0xB5, 0xEF,
+        0x67, 0x04, 0xE3, 0xA0, 0x0D, 0x25, 0xD4, 0xBE, 0x6F, 0x70, 0x83, 0x02 }, 0 },
+    { { 0x3C, 0x3C, 0x3C, 0x51, 0x89, 0xB5, 0x5F, 0x76, 0x1C, 0x70, 0x10, 0x32,
+        0x9D, 0xD7, 0x04, 0x51, 0x7E, 0xEB, 0x72, 0xCA, 0x1E, 0x8D, 0xED, 0xBD,
+        0x13, 0x41, 0x7D, 0x52, 0xD3, 0x4C, 0xEB, 0x71, 0x84, 0x2E, 0xF2, 0x01 },
+      { 0x8B, 0xD8, 0xB1, 0x82, 0xD4, 0x92, 0x40, 0x18, 0x73, 0x0D, 0x67, 0xEC,
+        0xDF, 0x16, 0xBA, 0x8A, 0xEE, 0x9F, 0xA6, 0xA9, 0x2C, 0x5D, 0x7A, 0x5A,
+        0x4F, 0xDF, 0x24, 0xEA, 0x40, 0x4F, 0xA4, 0x15, 0x6F, 0x6D, 0x87, 0x07 }, 0 },
+    { { 0xE6, 0x1B, 0xD4, 0xA3, 0x79, 0x72, 0xB0, 0xBE, 0xAE, 0xC4, 0x7B, 0x61,
+        0xAD, 0x7D, 0xDF, 0xF3, 0x03, 0x6E, 0x93, 0xE4, 0x85, 0xD8, 0x5D, 0x6D,
+        0xDD, 0x59, 0x60, 0x1C, 0x15, 0xAC, 0xB4, 0x7A, 0x1D, 0x6E, 0xDC, 0x04 },
+      { 0xB4, 0x0E, 0xF1, 0x86, 0xA9, 0x4B, 0x71, 0x59, 0x48, 0x50, 0x5E, 0x03,
+        0xDD, 0xF2, 0xCC, 0x55, 0x95, 0x56, 0x4F, 0x7F, 0x64, 0x27, 0x8F, 0xE1,
+        0xA5, 0x6C, 0x7B, 0x95, 0xB8, 0x23, 0xD0, 0x27, 0xBC, 0x6F, 0xBE, 0x01 }, 0 },
+    { { 0xD2, 0xF0, 0x52, 0x0D, 0x9C, 0xEB, 0x84, 0x97, 0xFB, 0x40, 0x10, 0x7A,
+        0xE7, 0x73, 0xC8, 0xFF, 0x3B, 0x00, 0x59, 0xFD, 0x23, 0x3A, 0x2A, 0xEB,
+        0xF5, 0xA3, 0x31, 0x92, 0xE1, 0x1D, 0xF7, 0x4D, 0x8E, 0x17, 0x08, 0x01 },
+      { 0xF8, 0xF6, 0x2D, 0xE8, 0x85, 0xEC, 0x32, 0x19, 0xEA, 0x5F, 0x82, 0x23,
+        0x54, 0x3B, 0xC5, 0x9A, 0xFE, 0xBD, 0x60, 0xD7, 0x69, 0x36, 0x78, 0xBB,
+        0x53, 0xBE, 0xCB, 0x38, 0xC3, 0xBE, 0xA7, 0x6A, 0xDD, 0x8A, 0xCB, 0x04 }, 0 },
+    { { 0x50, 0xA6, 0x84, 0x22, 0x5C, 0xAE, 0x82, 0xC1, 0x2B, 0xB8, 0x1D, 0x88,
+        0x4A, 0xB9, 0xCC, 0xEE, 0x5B, 0xB7, 0x39, 0x1F, 0x11, 0x5C, 0x02, 0x68,
+        0xE4, 0x5B, 0xC0, 0x4B, 0x64, 0xCD, 0xA2, 0xF8, 0xE5, 0x6E, 0xD4, 0x07 },
+      { 0xE4, 0xCF, 0xC9, 0xD6, 0x30, 0xA3, 0x92, 0xED, 0xBB, 0xA4, 0xCC, 0xC9,
+        0x55, 0xA5, 0xED, 0xC2, 0x73, 0x15, 0x45, 0x95, 0x7B, 0x71, 0x80, 0x6F,
+        0xAE, 0xC1, 0xAC, 0x8C, 0xA2, 0x22, 0xDF, 0x74, 0x04, 0x88, 0x37, 0x05 }, 0 },
+    { { 0x91, 0x64, 0xDE, 0xD3, 0x12, 0x56, 0xEB, 0x28, 0xDF, 0x53, 0x7F, 0x04,
+        0xFD, 0x06, 0x70, 0xBD, 0xAC, 0x5C, 0xE8, 0xE3, 0x14, 0x07, 0xA1, 0x28,
+        0x24, 0x59, 0xAA, 0xB0, 0x78, 0x9D, 0xFD, 0x4D, 0x1B, 0xBB, 0xAE, 0x00 },
+      { 0x07, 0x75, 0xDE, 0x77, 0x4A, 0xC3, 0x99, 0x66, 0xF6, 0x31, 0x3A, 0x76,
+        0x61, 0x39, 0xD4, 0xC5, 0xAE, 0xB5, 0x6B, 0x18, 0x5F, 0x1B, 0xCE, 0xF6,
+        0xB5, 0x3A, 0xF4, 0xC4, 0x75, 0xEB, 0x7C, 0x0F, 0x24, 0x67, 0x5E, 0x02 }, 0 },
+    { { 0x30, 0x72, 0x62, 0xA1, 0x63, 0x97, 0xA1, 0xE3, 0xB1, 0x0E, 0x75, 0x77,
+        0x5F, 0x15, 0xAE, 0x63, 0x88, 0x5F, 0xFF, 0xE3, 0x68, 0x40, 0x1D, 0x4B,
+        0x0C, 0x6B, 0x81, 0x62, 0x00, 0x34, 0x42, 0xF6, 0x11, 0x4D, 0xCF, 0x03 },
+      { 0xA3, 0x51, 0xC1, 0x0D, 0xC9, 0x70, 0xA6, 0xE1, 0x63, 0x77, 0xB1, 0x22,
+        0xE5, 0x4D, 0xAC, 0x73, 0x04, 0x85, 0xE1, 0xFB, 0x37, 0xF3, 0x50, 0xA4,
+        0xA9, 0xBF, 0x82, 0xE7, 0x04, 0xAE, 0x3F, 0x4D, 0x49, 0xA8, 0x1F, 0x04 }, 0 },
+    { { 0x6D, 0xEB, 0x20, 0xA4, 0xA9, 0xEF, 0x26, 0xED, 0x22, 0xDB, 0xB9, 0x3B,
+        0x5A, 0xCB, 0x88, 0x0F, 0xDB, 0xAC, 0x83, 0xA3, 0xD1, 0x6D, 0x7F, 0x4E,
+        0x85, 0x95, 0x9F, 0xF7, 0xF1, 0x8E, 0x1B, 0x1D, 0xD0, 0x99, 0xBE, 0x00 },
+      { 0xF8, 0x85, 0xB6, 0x19, 0x2F, 0x28, 0x5F, 0x98, 0x12, 0x5F, 0x31, 0x98,
+        0x27, 0xC6, 0x53, 0xEE, 0x08, 0x4E, 0x84, 0xF3, 0x3D, 0x5C, 0xDC, 0x40,
+        0x87, 0x80, 0x9B, 0x6E, 0x17, 0x5E, 0x03, 0x3D, 0x3D, 0x73, 0x6F, 0x03 }, 0 },
+    { { 0xF4, 0x81, 0x26, 0xCF, 0xB3, 0x83, 0x07, 0x10, 0xC3, 0x36, 0x3B, 0xB9,
+        0x3E, 0x4D, 0xE2, 0x7A, 0x1D, 0x41, 0x7C, 0x72, 0xA3, 0xD3, 0xB8, 0xDD,
+        0x6B, 0xFB, 0xAD, 0x66, 0xEC, 0xD4, 0xB6, 0x64, 0xDB, 0x7B, 0x00, 0x04 },
+      { 0xC7, 0x55, 0xCA, 0xB6, 0xEC, 0xA2, 0x19, 0x00, 0xE1, 0x94, 0x07, 0x30,
+        0xF3, 0x6B, 0x00, 0x34, 0xCD, 0xBB, 0xF0, 0xE4, 0x12, 0xD2, 0x46, 0xFF,
+        0x69, 0x68, 0x05, 0xD2, 0x3A, 0x73, 0xA0, 0xBD, 0x69, 0xAC, 0x4E, 0x01 }, 0 },
+    { { 0x45, 0x6F, 0x88, 0x2F, 0xCA, 0x69, 0x56, 0xCA, 0x02, 0xF8, 0x0E, 0x0C,
+        0x50, 0x10, 0xC9, 0x18, 0x30, 0xA3, 0x22, 0x0A, 0x20, 0x18, 0x01, 0x8D,
+        0x43, 0x27, 0xE6, 0x19, 0xF0, 0xE9, 0xD3, 0xA8, 0xD6, 0xBC, 0x5A, 0x04 },
+      { 0xA4, 0x39, 0xBD, 0x1F, 0xE3, 0x66, 0xDE, 0x93, 0x8B, 0xA8, 0xB3, 0xAF,
+        0x3A, 0x56, 0x41, 0x8E, 0xE2, 0x76, 0x85, 0xF1, 0x09, 0x5F, 0x20, 0x6E,
+        0x47, 0x6B, 0xC3, 0xEC, 0x18, 0x15, 0x46, 0xEA, 0x3A, 0xA9, 0x92, 0x06 }, 0 },
+    { { 0x1D, 0x55, 0xB5, 0x5C, 0x3E, 0xC1, 0x4B, 0x4F, 0x87, 0x5C, 0x88, 0x63,
+        0xCE, 0x9B, 0x98, 0xE9, 0xD2, 0xD3, 0x0C, 0x2F, 0xD0, 0x12, 0x59, 0x5E,
+        0x77, 0xA1, 0xE5, 0x7F, 0x8A, 0xF5, 0x90, 0x59, 0x41, 0xE2, 0x92, 0x07 },
+      { 0x74, 0x5B, 0x55, 0x62, 0xC6, 0xF3, 0x91, 0x14, 0x4D, 0x7D, 0x3F, 0xD2,
+        0xD1, 0x8B, 0x85, 0x0C, 0x08, 0x2B, 0x04, 0xAE, 0x34, 0x60, 0xE9, 0x95,
+        0xC0, 0xAA, 0xE5, 0x4C, 0xEE, 0x7A, 0x35, 0xD8, 0x81, 0x31, 0xFF, 0x04 }, 0 },
+    { { 0x91, 0x74, 0x9B, 0x8E, 0x6F, 0x6C, 0xC6, 0x37, 0x8D, 0x92, 0x56, 0x60,
+        0x36, 0x02, 0xDB, 0x99, 0xB1, 0xC2, 0xA6, 0xE4, 0xEB, 0x86, 0xE1, 0xA4,
+        0x9B, 0x93, 0xB6, 0x01, 0xE6, 0xA1, 0x0F, 0xBB, 0x9C, 0x80, 0xC7, 0x07 },
+      { 0xEE, 0x2F, 0x5A, 0xF6, 0x01, 0xEB, 0xB8, 0x34, 0xDD, 0xDF, 0x1E, 0x7A,
+        0x05, 0xA0, 0x06, 0xCF, 0xC1, 0xA3, 0xF5, 0x1E, 0xD7, 0x78, 0x41, 0x86,
+        0xE0, 0x27, 0xED, 0x92, 0xEE, 0x2A, 0xD6, 0x96, 0xD3, 0x5C, 0xAA, 0x05 }, 0 },
+    { { 0x9B, 0x95, 0x39, 0x15, 0x02, 0xE8, 0xA1, 0x0B, 0x03, 0x21, 0x7D, 0xCD,
+        0x80, 0x67, 0xCF, 0xFD, 0x41, 0xED, 0x7C, 0xC3, 0x04, 0x1B, 0x69, 0x31,
+        0x34, 0x81, 0x7D, 0x02, 0x7F, 0x9B, 0x5B, 0x0E, 0x85, 0xBF, 0x4E, 0x01 },
+      { 0x10, 0x4A, 0x54, 0x31, 0x04, 0xB9, 0xBF, 0x9B, 0x87, 0xB5, 0x04, 0x99,
+        0x71, 0xBD, 0x7D, 0x8E, 0x3A, 0x1B, 0x6B, 0x01, 0x58, 0x8B, 0x21, 0xEE,
+        0x5A, 0x91, 0x70, 0xE3, 0xF8, 0x6B, 0xF3, 0xE2, 0xE6, 0x36, 0xF4, 0x05 }, 0 },
+    { { 0x28, 0xB9, 0x8A, 0x72, 0xA6, 0xBB, 0x74, 0xB7, 0xCB, 0xD7, 0x23, 0x03,
+        0x36, 0xE2, 0xF0, 0xE7, 0xAB, 0x71, 0x60, 0x3E, 0x2B, 0x29, 0xC8, 0xEA,
+        0xDC, 0xBA, 0x36, 0x07, 0xB7, 0x0C, 0x8D, 0xAD, 0xDD, 0x20, 0x4C, 0x04 },
+      { 0xC2, 0xE5, 0x58, 0x4A, 0x9C, 0xEC, 0x39, 0xD2, 0x83, 0x02, 0xAB, 0xA4,
+        0xCC, 0xC5, 0x2E, 0x6D, 0x2F, 0xA5, 0x15, 0xD2, 0xCA, 0xA9, 0x8C, 0x8F,
+        0xC4, 0x12, 0x3C, 0x56, 0x7E, 0x0B, 0x74, 0x56, 0x3C, 0xAD, 0xF0, 0x05 }, 0 },
+    { { 0x94, 0xA3, 0xC4, 0x6B, 0x35, 0x67, 0xD3, 0xD0, 0x38, 0xD3, 0xC1, 0xA0,
+        0x00, 0x14, 0xD3, 0xC0, 0xE1, 0x8F, 0xC6, 0xBB, 0xF3, 0x32, 0x95, 0x2B,
+        0x2A, 0x3D, 0xC4, 0xE8, 0xA5, 0x76, 0xDC, 0xA4, 0x23, 0x45, 0x6F, 0x06 },
+      { 0x49, 0x87, 0x08, 0x90, 0xAB, 0x9C, 0xE6, 0xD0, 0x87, 0x0B, 0xC3, 0x67,
+        0x8E, 0x5C, 0x9D, 0x2E, 0xC5, 0xC3, 0x7B, 0x64, 0xEC, 0xC5, 0xB9, 0xE6,
+        0x21, 0x81, 0x55, 0x13, 0x99, 0xDD, 0x47, 0xF9, 0x8C, 0x4E, 0xF2, 0x07 }, 0 },
+    { { 0x02, 0x5B, 0xDF, 0xC9, 0xC6, 0xEB, 0x7B, 0xD3, 0x09, 0xF1, 0x9B, 0x27,
+        0xD7, 0x3A, 0x75, 0x5D, 0xF7, 0x8A, 0xD2, 0xAB, 0xCA, 0xD8, 0x5E, 0x54,
+        0xB9, 0xD9, 0x4C, 0xB2, 0x63, 0xF2, 0x56, 0x32, 0xBE, 0x66, 0x5C, 0x03 },
+      { 0x43, 0xCB, 0x4A, 0xB2, 0x27, 0x27, 0x1A, 0xE9, 0x99, 0xDF, 0x82, 0xB5,
+        0x83, 0x8B, 0x7D, 0xB3, 0x9E, 0xAC, 0xB9, 0xD1, 0x26, 0xA4, 0x30, 0x6B,
+        0x84, 0x7F, 0x3A, 0xD5, 0xF1, 0xA1, 0xFE, 0x7A, 0xB1, 0xD7, 0xB2, 0x04 }, 0 },
+    { { 0x77, 0x5F, 0x1F, 0xE0, 0x28, 0x41, 0x06, 0x43, 0xF6, 0xDD, 0x84, 0x32,
+        0xFF, 0xCE, 0x80, 0xD3, 0x74, 0x24, 0x50, 0x03, 0x55, 0xE0, 0xCF, 0xA7,
+        0x98, 0x6E, 0x2D, 0x4C, 0x0A, 0x51, 0x01, 0x30, 0x35, 0xE3, 0x9A, 0x04 },
+      { 0xFF, 0x10, 0xE9, 0x7A, 0xFE, 0xD3, 0x21, 0xD7, 0x28, 0x5F, 0x1F, 0xBD,
+        0x49, 0x5C, 0x12, 0x99, 0x5A, 0x58, 0x35, 0xFE, 0x7E, 0xA2, 0xC1, 0x3A,
+        0xEE, 0x23, 0xD8, 0xCA, 0x90, 0x48, 0x46, 0x1F, 0xA4, 0x7A, 0xC9, 0x02 }, 0 },
+    { { 0xD0, 0x2B, 0x3D, 0x5E, 0x14, 0xBF, 0x67, 0xF4, 0x4A, 0xB1, 0xDF, 0x29,
+        0x75, 0x2A, 0x0E, 0x61, 0xDE, 0xD6, 0x2E, 0x4D, 0x95, 0x14, 0x6E, 0x5E,
+        0x85, 0x19, 0x2A, 0x62, 0x3C, 0xA2, 0x70, 0x72, 0xB2, 0x15, 0x1A, 0x04 },
+      { 0x6B, 0x24, 0xD1, 0x24, 0xC4, 0xD1, 0x17, 0xDB, 0xAC, 0x23, 0xAC, 0x48,
+        0xE6, 0xE4, 0x24, 0x58, 0x3C, 0x7E, 0xF0, 0x72, 0x14, 0xE0, 0xEE, 0xF9,
+        0xB0, 0xC3, 0x2C, 0xBD, 0x2E, 0xA7, 0xE6, 0x86, 0x44, 0x5E, 0x1E, 0x02 }, 0 },
+    { { 0xFD, 0x28, 0x22, 0xE3, 0xFB, 0x3E, 0xCC, 0x9D, 0x48, 0x62, 0x82, 0x35,
+        0x48, 0xD8, 0xB5, 0xAC, 0x21, 0xD8, 0x78, 0xEC, 0xAE, 0xC5, 0x26, 0xE8,
+        0xFF, 0x5E, 0xD1, 0x34, 0xB0, 0xB0, 0xC4, 0x3E, 0x67, 0xD7, 0x2C, 0x01 },
+      { 0xB5, 0x87, 0xFA, 0xEA, 0x8F, 0x4C, 0x71, 0xDE, 0x94, 0xB8, 0x5C, 0xDF,
+        0x2C, 0x15, 0xA5, 0x1A, 0xBE, 0x97, 0x40, 0x7F, 0x56, 0x47, 0xAD, 0x0B,
+        0x4D, 0xBE, 0xEE, 0x75, 0x24, 0x50, 0xFD, 0x08, 0xBE, 0x60, 0xCE, 0x00 }, 0 },
+    { { 0x0F, 0x63, 0x6F, 0x87, 0xCC, 0x9B, 0xBB, 0xEF, 0x7F, 0xDE, 0x7E, 0xAA,
+        0x19, 0x98, 0x01, 0x34, 0x23, 0x6A, 0x69, 0xBA, 0x84, 0x00, 0xDD, 0xE4,
+        0x90, 0x5B, 0x53, 0xF1, 0xE9, 0xA9, 0xDE, 0xD6, 0x6E, 0xF3, 0x8C, 0x07 },
+      { 0x62, 0x61, 0x86, 0x8D, 0xF7, 0xA7, 0x3B, 0xD6, 0x4C, 0x15, 0xB5, 0xCB,
+        0x43, 0x8E, 0x30, 0xFF, 0xD5, 0x17, 0x86, 0x26, 0xE5, 0xC8, 0x84, 0xFA,
+        0x9E, 0x41, 0x7C, 0x30, 0x9D, 0x18, 0x0B, 0xA9, 0x9A, 0xCB, 0x9F, 0x07 }, 0 },
+    { { 0xDE, 0x9C, 0x35, 0x62, 0x7E, 0xA9, 0x54, 0xD4, 0x2F, 0x13, 0x91, 0x2C,
+        0xBD, 0xD2, 0xA4, 0xF4, 0x43, 0x3C, 0x2A, 0x0A, 0xC7, 0x7E, 0x9C, 0xC8,
+        0x3A, 0x07, 0x10, 0xDC, 0x2A, 0x1B, 0x96, 0x99, 0x45, 0x6B, 0xB4, 0x06 },
+      { 0x26, 0x66, 0x7A, 0x61, 0x35, 0x58, 0x65, 0xDC, 0x74, 0xB4, 0xD1, 0xB7,
+        0xAF, 0x3E, 0xEE, 0x25, 0x84, 0x36, 0xA0, 0x8F, 0xDF, 0xCD, 0xE3, 0x59,
+        0xC7, 0xC3, 0xD1, 0x18, 0x75, 0xB9, 0xC4, 0x37, 0xC8, 0x33, 0xF8, 0x03 }, 0 },
+    { { 0x24, 0x41, 0x10, 0x88, 0x81, 0x94, 0x20, 0xA9, 0x21, 0x7E, 0x54, 0x61,
+        0x6B, 0x23, 0x9D, 0x89, 0xC2, 0xE3, 0x6C, 0xFE, 0x8E, 0x05, 0x66, 0xFE,
+        0x0F, 0x3F, 0xFC, 0xB2, 0xFB, 0x4E, 0xD7, 0xE6, 0xC1, 0x37, 0xDF, 0x06 },
+      { 0x8C, 0x35, 0x60, 0x9F, 0x46, 0x8A, 0xD9, 0xA6, 0x34, 0xDD, 0x55, 0x39,
+        0xEE, 0x09, 0xC8, 0x0A, 0x53, 0xFB, 0x64, 0xC6, 0x97, 0x18, 0x3D, 0x4C,
+        0xB9, 0xCA, 0x73, 0xA5, 0x1B, 0xD3, 0x50, 0x08, 0xBA, 0x46, 0xB0, 0x03 }, 0 },
+    { { 0x80, 0x7D, 0x0A, 0x9F, 0x64, 0x97, 0xB2, 0xDC, 0x98, 0xDD, 0x88, 0xB9,
+        0x55, 0xEB, 0x7D, 0x61, 0x70, 0x60, 0x01, 0x48, 0xE5, 0x1D, 0xAF, 0xAE,
+        0xF7, 0xD4, 0x05, 0xD4, 0x35, 0x50, 0x15, 0x53, 0xA6, 0x1E, 0x39, 0x07 },
+      { 0x62, 0x03, 0x17, 0x90, 0x38, 0xC9, 0xF4, 0xCA, 0xA6, 0xE3, 0x15, 0xD6,
+        0x42, 0x97, 0xF0, 0x63, 0xD7, 0x1F, 0x57, 0x63, 0x1D, 0xBB, 0x02, 0x57,
+        0xF6, 0x74, 0xFB, 0x46, 0xBC, 0x55, 0x9A, 0x21, 0xC9, 0xEE, 0xF1, 0x07 }, 0 },
+    { { 0x4F, 0xA7, 0xE7, 0x5F, 0x91, 0x57, 0x3A, 0x65, 0xD7, 0xC2, 0x87, 0xFD,
+        0x9B, 0xBA, 0x18, 0xC0, 0xC4, 0x43, 0xC6, 0x85, 0x92, 0x90, 0x37, 0x89,
+        0xFD, 0x77, 0x84, 0x06, 0x1E, 0x8F, 0xB1, 0x14, 0xED, 0xBA, 0xA8, 0x01 },
+      { 0xA8, 0xF6, 0xE1, 0xC0, 0x89, 0xB0, 0x2C, 0xF4, 0x7E, 0x5D, 0x40, 0x64,
+        0x32, 0x76, 0x45, 0x1A, 0xA1, 0xBD, 0xC0, 0xE5, 0x57, 0x1F, 0xD4, 0x0D,
+        0x49, 0x3A, 0x3B, 0xC8, 0xDF, 0x34, 0x85, 0x46, 0x60, 0x74, 0xA6, 0x07 }, 0 },
+    { { 0xF9, 0x91, 0x06, 0xEB, 0xA3, 0x29, 0x57, 0xBA, 0xA5, 0x87, 0xC0, 0xBD,
+        0x01, 0x26, 0x79, 0xF2, 0x02, 0x56, 0xA9, 0x91, 0x09, 0xC4, 0x8F, 0xBE,
+        0x83, 0x3F, 0xA1, 0xAE, 0x41, 0xE5, 0x44, 0xFF, 0x7C, 0xF4, 0xFD, 0x00 },
+      { 0x92, 0x88, 0x9F, 0xBC, 0x31, 0x12, 0xD8, 0x52, 0xE5, 0x5B, 0x10, 0x7E,
+        0xBB, 0x29, 0x9F, 0xF6, 0x6E, 0x01, 0x90, 0x58, 0xCE, 0x1D, 0x9B, 0x9D,
+        0x09, 0x81, 0x71, 0xBA, 0x59, 0x39, 0x64, 0x16, 0xD8, 0x29, 0xFC, 0x05 }, 0 },
+    { { 0x95, 0xEF, 0x2B, 0xA6, 0xFD, 0xAC, 0x31, 0xAD, 0xFD, 0xAA, 0x38, 0x5B,
+        0xCE, 0xFC, 0xF7, 0xC8, 0x96, 0x93, 0x98, 0x32, 0xCB, 0x32, 0xC0, 0x19,
+        0x05, 0xFB, 0x48, 0xC5, 0x49, 0xF1, 0x9B, 0x03, 0xB4, 0xAB, 0x06, 0x03 },
+      { 0x6F, 0xF0, 0xEF, 0x57, 0x30, 0xCC, 0x5A, 0xEC, 0x12, 0x15, 0xB8, 0x6E,
+        0x87, 0x6C, 0xD6, 0x91, 0x08, 0x03, 0x6B, 0xCD, 0x18, 0x7B, 0x32, 0x60,
+        0x22, 0xFC, 0x8F, 0xB1, 0x3C, 0x5B, 0x09, 0x56, 0xAA, 0x0C, 0x0F, 0x05 }, 0 },
+    { { 0xEB, 0x7F, 0x6B, 0x61, 0xE1, 0x87, 0xEC, 0x4B, 0x63, 0x72, 0xDF, 0x9B,
+        0x35, 0xFE, 0x18, 0xEF, 0x9D, 0xD4, 0x3E, 0xC4, 0x81, 0xE5, 0xD9, 0x84,
+        0x0A, 0x71, 0x37, 0x2A, 0xFE, 0xC0, 0xF7, 0x84, 0xF5, 0xCD, 0x20, 0x04 },
+      { 0x2C, 0x94, 0x0D, 0xB7, 0x43, 0xFA, 0x49, 0xD4, 0xBC, 0x0D, 0x5F, 0x74,
+        0x15, 0x0B, 0xF5, 0xB6, 0x0B, 0xC5, 0x28, 0x0F, 0x0E, 0x6F, 0xB0, 0x3E,
+        0x67, 0xA7, 0xF6, 0xEB, 0x7B, 0xD6, 0xDF, 0x2F, 0xE4, 0x89, 0x86, 0x00 }, 0 },
+    { { 0x1A, 0x81, 0x69, 0x5D, 0x52, 0x87, 0xE6, 0x7D, 0x32, 0x11, 0x5A, 0x18,
+        0x8F, 0x3A, 0xF4, 0x9D, 0xAE, 0x13, 0x67, 0x89, 0x15, 0x43, 0xF8, 0xAA,
+        0x55, 0x0D, 0xA9, 0x26, 0x17, 0x29, 0xFB, 0xC6, 0x9A, 0x1E, 0x8C, 0x00 },
+      { 0x8B, 0xE3, 0x22, 0x99, 0xCB, 0x88, 0x76, 0x4A, 0xFD, 0xD1, 0xE3, 0x0E,
+        0x1F, 0x53, 0x52, 0x69, 0xBA, 0x0E, 0x38, 0x98, 0x10, 0x09, 0x34, 0x71,
+        0x42, 0x66, 0xBB, 0x92, 0xE4, 0x65, 0x1D, 0x1F, 0x99, 0xC9, 0x61, 0x00 }, 0 },
+    { { 0xE5, 0x84, 0x61, 0x31, 0xB8, 0x71, 0xC8, 0x50, 0x65, 0xA7, 0x19, 0xA2,
+        0xBD, 0x8A, 0x14, 0xB5, 0x32, 0x13, 0xCB, 0xC7, 0x73, 0x9C, 0x34, 0x35,
+        0x07, 0xD8, 0xB2, 0xA4, 0x8A, 0xF9, 0xBB, 0x39, 0x68, 0x86, 0xCA, 0x05 },
+      { 0xBC, 0xEF, 0xD1, 0x08, 0x35, 0x92, 0x7F, 0x5C, 0xFA, 0x1B, 0xBD, 0x25,
+        0x5D, 0xD4, 0xE9, 0xB0, 0x98, 0x0F, 0x76, 0x6C, 0xE2, 0x09, 0x53, 0xFB,
+        0x6A, 0xA6, 0xF7, 0xA0, 0xD7, 0x9B, 0xF1, 0x15, 0x20, 0x0C, 0xA1, 0x07 }, 0 },
+    { { 0xC5, 0x7A, 0x20, 0x25, 0x45, 0x59, 0x28, 0x16, 0xBF, 0x53, 0x35, 0xDE,
+        0x77, 0xEE, 0x1E, 0x41, 0x09, 0x4D, 0x5A, 0xA7, 0xDB, 0x17, 0x66, 0xB6,
+        0x09, 0xBE, 0xB2, 0x79, 0x22, 0xCC, 0xE6, 0xD6, 0xBA, 0x81, 0xA3, 0x05 },
+      { 0x18, 0x88, 0x56, 0x4D, 0xDF, 0x43, 0x2E, 0xFB, 0x9F, 0xDE, 0xDF, 0x22,
+        0x57, 0x22, 0x20, 0x20, 0x9C, 0xCD, 0x7E, 0x2B, 0x6B, 0x66, 0x77, 0x5F,
+        0xE5, 0x11, 0x2C, 0x6E, 0xE8, 0x44, 0xF2, 0x3B, 0x25, 0xD6, 0x83, 0x02 }, 0 },
+    { { 0x9F, 0x54, 0xF4, 0xDE, 0xED, 0xEA, 0x7E, 0x47, 0xDA, 0x9A, 0xBB, 0xAD,
+        0xD7, 0x4C, 0xD9, 0x64, 0xED, 0x93, 0x39, 0x81, 0x81, 0x74, 0xCA, 0x39,
+        0xE4, 0x86, 0x65, 0xDC, 0x38, 0xB1, 0xB2, 0x43, 0x35, 0xFF, 0xA9, 0x07 },
+      { 0x33, 0x55, 0xC9, 0x7F, 0x98, 0x57, 0x9A, 0x95, 0x60, 0xFA, 0x74, 0xFD,
+        0xCE, 0xB9, 0xEA, 0x3E, 0xAB, 0x57, 0xA0, 0xA9, 0x1E, 0x77, 0x1A, 0x99,
+        0x99, 0xC2, 0x48, 0x46, 0xC9, 0x0C, 0x16, 0x9C, 0x01, 0xEC, 0x1B, 0x01 }, 0 },
+    { { 0xAA, 0x1F, 0x51, 0x94, 0xDB, 0x9E, 0x39, 0x41, 0xA7, 0xD6, 0x9B, 0xEB,
+        0xE9, 0x90, 0xB7, 0xD0, 0xE0, 0x44, 0x10, 0x28, 0x70, 0xE9, 0x24, 0xAA,
+        0x9C, 0xB4, 0x78, 0x0A, 0x8C, 0x19, 0x30, 0xD5, 0x8F, 0x7C, 0xE7, 0x02 },
+      { 0x62, 0x07, 0xAF, 0x7B, 0x1F, 0xDC, 0x24, 0x28, 0x11, 0x0D, 0x8A, 0x2F,
+        0xF2, 0x41, 0x5A, 0xB3, 0x0B, 0xD6, 0x62, 0xAC, 0x64, 0x8D, 0xBE, 0x84,
+        0x02, 0xF2, 0x09, 0xE7, 0x51, 0x60, 0x9C, 0xC8, 0xAB, 0xCB, 0x9D, 0x07 }, 0 },
+    { { 0xDA, 0xD1, 0x5F, 0x7B, 0x55, 0x7E, 0x6B, 0x1B, 0x7F, 0x5A, 0xE6, 0x80,
+        0x66, 0xC8, 0x99, 0x5E, 0x3C, 0xD0, 0x45, 0xD3, 0x71, 0xA9, 0x7D, 0xA7,
+        0x96, 0xEF, 0x50, 0x40, 0x77, 0xA2, 0xD2, 0x9E, 0x1D, 0x6D, 0x64, 0x01 },
+      { 0xBB, 0xB2, 0xA5, 0x8D, 0xB9, 0x4C, 0xC8, 0x14, 0x22, 0xF3, 0x2C, 0x7C,
+        0x98, 0x7E, 0xB7, 0x98, 0xBA, 0x24, 0x40, 0x71, 0x8B, 0x29, 0x20, 0x46,
+        0x0D, 0x02, 0x6D, 0x0E, 0x59, 0xF7, 0x41, 0xE1, 0xCA, 0x90, 0xD9, 0x06 }, 0 },
+    { { 0x5A, 0x31, 0x5A, 0xED, 0xC7, 0x83, 0x30, 0x2B, 0x3E, 0x01, 0x69, 0xBF,
+        0x7A, 0x1A, 0x3F, 0x88, 0x83, 0x2B, 0x57, 0xA0, 0xC8, 0x7A, 0xA8, 0x9D,
+        0x3E, 0x25, 0xFD, 0xC9, 0xFD, 0xF5, 0x86, 0xA4, 0x98, 0x10, 0x1E, 0x02 },
+      { 0xD2, 0x9B, 0x85, 0x65, 0x89, 0x9F, 0x85, 0xFA, 0xDF, 0x00, 0x04, 0x05,
+        0x76, 0xB7, 0xA6, 0x9E, 0xEE, 0x4A, 0x5D, 0x3B, 0x63, 0x6A, 0x8D, 0x02,
+        0xA0, 0xE0, 0x67, 0x28, 0xB6, 0x12, 0x5E, 0xBE, 0x15, 0x69, 0xF0, 0x06 }, 0 },
+    { { 0xEC, 0xEC, 0x1F, 0x10, 0xDE, 0x86, 0x16, 0xE1, 0x7F, 0xF1, 0xDE, 0xB0,
+        0x87, 0x89, 0xC3, 0x46, 0x94, 0xF6, 0x87, 0xC1, 0x55, 0xA9, 0x49, 0xFF,
+        0x31, 0x0E, 0x8E, 0x51, 0x41, 0x39, 0xCB, 0xA5, 0x12, 0x51, 0xB8, 0x03 },
+      { 0x74, 0x52, 0xDD, 0x1C, 0x34, 0x8D, 0x4C, 0x16, 0x50, 0x53, 0x6E, 0x52,
+        0x42, 0x87, 0x85, 0x35, 0x70, 0x32, 0x38, 0x12, 0x46, 0x7E, 0x17, 0x26,
+        0x56, 0x2F, 0x21, 0x90, 0x8C, 0x2C, 0xC5, 0x40, 0xFC, 0xAE, 0x68, 0x00 }, 0 },
+    { { 0xB8, 0x4B, 0x76, 0xE3, 0x1A, 0xD9, 0xD5, 0x44, 0x20, 0x65, 0xFF, 0x8B,
+        0xE6, 0x09, 0x09, 0xA7, 0x8B, 0x8C, 0x01, 0xAC, 0x98, 0xCA, 0xF6, 0x56,
+        0xB4, 0x17, 0x6F, 0x0F, 0x76, 0xD2, 0x0A, 0xFA, 0xB5, 0x16, 0x84, 0x04 },
+      { 0x24, 0x7F, 0x40, 0x6C, 0x28, 0xA6, 0xAC, 0xFC, 0x26, 0x4E, 0xA7, 0xFC,
+        0x01, 0xC6, 0xC7, 0x20, 0x7D, 0xE8, 0xE6, 0x0D, 0xE3, 0xFA, 0x00, 0x12,
+        0x26, 0x71, 0x61, 0xCD, 0x70, 0x2B, 0x59, 0xAC, 0xE6, 0xC3, 0x2D, 0x06 }, 0 },
+    { { 0xE1, 0x4A, 0xC2, 0xBB, 0x2F, 0x28, 0x48, 0xB1, 0xA5, 0xAA, 0xD1, 0x6A,
+        0xEF, 0xAB, 0xAC, 0x64, 0x23, 0x8C, 0xE2, 0x48, 0xB2, 0x7B, 0xAE, 0x30,
+        0x19, 0x5F, 0xE7, 0x68, 0x75, 0x84, 0x2D, 0x9B, 0xB4, 0x87, 0x49, 0x01 },
+      { 0xAB, 0x40, 0xEE, 0x29, 0x7F, 0x57, 0xEE, 0x46, 0xF1, 0x2F, 0x72, 0x24,
+        0x83, 0x16, 0x64, 0x0B, 0xE6, 0x45, 0x6F, 0x89, 0x0B, 0x5F, 0x1A, 0x2F,
+        0x5A, 0x37, 0x7D, 0x62, 0x73, 0x4D, 0x53, 0xB9, 0xEC, 0x67, 0xB6, 0x04 }, 0 },
+    { { 0xBB, 0x14, 0x52, 0x96, 0x4F, 0x5B, 0x12, 0xAD, 0x98, 0x83, 0x6D, 0x5D,
+        0xF1, 0x82, 0x3D, 0x3F, 0x8A, 0x9B, 0xC8, 0xAA, 0xA7, 0xB1, 0x14, 0x3F,
+        0x93, 0x5E, 0xC9, 0xF4, 0x76, 0x11, 0x1F, 0x05, 0x45, 0xF3, 0xD4, 0x03 },
+      { 0xC1, 0x49, 0xB3, 0xF1, 0x6D, 0xB3, 0x80, 0xEE, 0x6D, 0x08, 0xA5, 0x4A,
+        0x43, 0x19, 0x1F, 0x85, 0x45, 0x8D, 0xBA, 0x95, 0xEE, 0x1E, 0x52, 0x13,
+        0xB1, 0xF4, 0x94, 0x2B, 0x11, 0xE4, 0xBF, 0x3D, 0x30, 0x15, 0xD6, 0x01 }, 0 },
+    { { 0x33, 0x00, 0x1B, 0xEE, 0x14, 0x87, 0x87, 0x29, 0x17, 0x86, 0xF1, 0xED,
+        0x8F, 0xC2, 0x7B, 0x92, 0xDD, 0xC2, 0x25, 0x26, 0x13, 0xA6, 0x64, 0xD1,
+        0xAA, 0x8C, 0x40, 0x46, 0x69, 0x8A, 0x49, 0x04, 0x9C, 0xB8, 0x3F, 0x02 },
+      { 0x54, 0x2C, 0xBA, 0xA6, 0x49, 0x98, 0x66, 0x87, 0x66, 0xFE, 0x86, 0xD4,
+        0xCC, 0xA1, 0x8F, 0x3E, 0xB3, 0xCD, 0xFB, 0x91, 0x1D, 0x78, 0xEF, 0x0B,
+        0xFF, 0xD2, 0x6B, 0x30, 0x42, 0x4B, 0x06, 0x7F, 0xC5, 0xD1, 0xF5, 0x07 }, 0 },
+    { { 0x3A, 0xB7, 0xF1, 0xBD, 0xE7, 0x5A, 0x24, 0x4C, 0xC7, 0x5E, 0x7E, 0x07,
+        0x89, 0x8F, 0x25, 0xC7, 0x20, 0xF7, 0x18, 0x7B, 0xA1, 0x97, 0x38, 0xCE,
+        0xF7, 0x7E, 0x8C, 0xDA, 0xEE, 0x71, 0x6E, 0xE8, 0xEB, 0x48, 0x2D, 0x07 },
+      { 0xE1, 0x3C, 0x30, 0x5A, 0x9E, 0xBA, 0xE0, 0x16, 0x15, 0x43, 0xD2, 0x56,
+        0xBA, 0x06, 0x96, 0x9A, 0xC5, 0xA2, 0x4D, 0x85, 0x9B, 0xD0, 0xAC, 0x5B,
+        0x4D, 0x1B, 0xF2, 0xCF, 0x45, 0xFD, 0xFD, 0xCC, 0xBC, 0xCF, 0xF5, 0x04 }, 0 },
+    { { 0x32, 0x60, 0x67, 0x42, 0x03, 0x38, 0xC4, 0xC0, 0xCB, 0xD5, 0x36, 0xB6,
+        0x7B, 0xBF, 0xA8, 0x47, 0xDE, 0xD6, 0x3C, 0x43, 0xAC, 0xCA, 0xCB, 0x90,
+        0x6D, 0x57, 0x86, 0xDA, 0x94, 0xBF, 0x7F, 0x47, 0x91, 0x4B, 0x19, 0x05 },
+      { 0xA1, 0xF5, 0x1A, 0xF8, 0x6E, 0x97, 0x79, 0x73, 0x66, 0xC1, 0x0E, 0x4A,
+        0x80, 0xE3, 0x2D, 0x94, 0x2D, 0xC1, 0x5F, 0x54, 0x96, 0xB2, 0x71, 0xDA,
+        0x40, 0x3C, 0x7A, 0x31, 0xDE, 0x1B, 0x2D, 0x1F, 0x69, 0xB4, 0x94, 0x06 }, 0 },
+    { { 0x85, 0x72, 0x6E, 0x39, 0xD7, 0x4A, 0x21, 0x0E, 0x73, 0xC3, 0xF4, 0x82,
+        0x30, 0xB9, 0xF2, 0x22, 0x5D, 0x77, 0x39, 0x71, 0xA3, 0x10, 0x66, 0x3A,
+        0xE3, 0x64, 0x7C, 0xAD, 0xF5, 0x0E, 0xFB, 0x7B, 0xD1, 0xE8, 0x8D, 0x07 },
+      { 0x50, 0x98, 0x64, 0x8C, 0xAB, 0x30, 0xB0, 0x2D, 0x77, 0x4A, 0x97, 0xDD,
+        0xBD, 0x70, 0x53, 0x35, 0x75, 0x64, 0x9E, 0xED, 0xED, 0x73, 0x2F, 0x6D,
+        0xDE, 0x22, 0x81, 0xCC, 0x5C, 0x52, 0x1A, 0x1C, 0xD4, 0xF6, 0x0B, 0x02 }, 0 },
+    { { 0x1A, 0x55, 0x0A, 0x4D, 0x2F, 0x4A, 0xDD, 0x8D, 0x7B, 0xC7, 0x2D, 0xEB,
+        0x05, 0xAE, 0x43, 0x14, 0x0A, 0x7A, 0xF8, 0x07, 0xB8, 0x2F, 0xA4, 0x87,
+        0x44, 0x6D, 0x97, 0x91, 0xF2, 0x23, 0xC9, 0x59, 0xBB, 0x27, 0x6B, 0x01 },
+      { 0x8F, 0x73, 0x02, 0xB8, 0x1D, 0xD8, 0x10, 0x0D, 0x0A, 0x90, 0xFF, 0x55,
+        0xE3, 0x4B, 0x82, 0x31, 0x95, 0x6A, 0x9A, 0xEF, 0x7E, 0xB9, 0x03, 0x45,
+        0x8E, 0x1E, 0x97, 0x08, 0xEB, 0x92, 0x8F, 0xEF, 0xFC, 0xB4, 0xDE, 0x07 }, 0 },
+    { { 0x7C, 0x5E, 0x44, 0x83, 0xE2, 0x76, 0xC4, 0x7D, 0x81, 0xE7, 0x53, 0x4A,
+        0xE4, 0x23, 0xEA, 0x2C, 0xD8, 0x20, 0x69, 0xB6, 0x05, 0x61, 0xB9, 0x91,
+        0x99, 0x4E, 0xF3, 0x44, 0x1E, 0x3A, 0x22, 0xB8, 0xE6, 0x55, 0x8A, 0x06 },
+      { 0x30, 0xDA, 0xB6, 0x28, 0x2F, 0xEB, 0x20, 0x0D, 0x10, 0xE5, 0xEC, 0xB2,
+        0x25, 0x38, 0x89, 0x1A, 0x62, 0xB4, 0x15, 0x5F, 0x16, 0xE4, 0x27, 0x89,
+        0x5C, 0x50, 0x2E, 0x37, 0x6E, 0x1D, 0xA3, 0x04, 0xCF, 0x19, 0xAD, 0x05 }, 0 },
+    { { 0x51, 0xB6, 0x8F, 0x16, 0x59, 0x2D, 0xB7, 0x62, 0xF4, 0x34, 0x86, 0x11,
+        0x2A, 0x50, 0xBF, 0x71, 0x4E, 0x03, 0xC8, 0x86, 0x24, 0xAD, 0x3E, 0xCD,
+        0x73, 0xAA, 0xEF, 0x02, 0x0A, 0x10, 0xCD, 0x70, 0x2A, 0xE8, 0xF2, 0x06 },
+      { 0x47, 0xDF, 0x16, 0x31, 0x72, 0x9E, 0x50, 0xFB, 0x91, 0xAC, 0x38, 0xDA,
+        0xEA, 0xE6, 0x12, 0x05, 0xC1, 0xE1, 0xA1, 0xB2, 0x21, 0x40, 0x04, 0x93,
+        0x0A, 0x67, 0xB7, 0x47, 0x20, 0x5C, 0x87, 0x13, 0xF7, 0xDA, 0x18, 0x06 }, 0 },
+    { { 0xA7, 0xB6, 0x08, 0x48, 0xBE, 0x23, 0xCC, 0xE4, 0xDF, 0x04, 0x2B, 0xEF,
+        0x40, 0x3B, 0x44, 0x9D, 0xD9, 0x61, 0x16, 0x92, 0xBC, 0x22, 0xC3, 0x5A,
+        0x66, 0x94, 0x09, 0x37, 0x56, 0x76, 0x72, 0x9E, 0xE3, 0xF0, 0x98, 0x07 },
+      { 0xA8, 0xDD, 0x9A, 0xD3, 0x77, 0x3C, 0xA8, 0xD1, 0xE9, 0x4A, 0x69, 0x21,
+        0xCE, 0x26, 0x22, 0x6F, 0x74, 0x11, 0x64, 0xE8, 0xAD, 0x4A, 0xBC, 0xAB,
+        0x70, 0xC8, 0xE4, 0x9B, 0x59, 0xCC, 0x10, 0x0F, 0x48, 0xF9, 0x61, 0x07 }, 0 },
+    { { 0x4A, 0xC9, 0x0F, 0x82, 0xC9, 0x89, 0x75, 0xF9, 0xEE, 0xAB, 0x1B, 0x7B,
+        0x57, 0xD1, 0xCD, 0x27, 0xE5, 0xC0, 0xDC, 0xF3, 0x3C, 0x24, 0x73, 0xAA,
+        0x67, 0xBD, 0x28, 0xEC, 0x37, 0xBC, 0xA4, 0x24, 0x12, 0x05, 0x1F, 0x03 },
+      { 0xBE, 0xB9, 0x5F, 0x2A, 0x31, 0x8B, 0x51, 0x10, 0xA6, 0x0F, 0xDF, 0x80,
+        0x6F, 0x37, 0x4E, 0x2F, 0xDE, 0xF1, 0xF1, 0x4B, 0x89, 0xE4, 0xF8, 0x85,
+        0xA6, 0xAD, 0x24, 0x7E, 0xA5, 0x13, 0x0A, 0xCE, 0x8A, 0x5E, 0x3F, 0x03 }, 0 },
+    { { 0x37, 0xD6, 0xC6, 0x1F, 0xB7, 0xEF, 0x05, 0x6E, 0xED, 0xC7, 0xCB, 0x95,
+        0xAC, 0x3F, 0xE0, 0x94, 0x27, 0xCB, 0x08, 0x46, 0x29, 0xEF, 0x49, 0x5D,
+        0xB0, 0xDD, 0x46, 0x16, 0xEB, 0xD9, 0x6F, 0x44, 0x2A, 0xF6, 0x5F, 0x04 },
+      { 0x39, 0x99, 0xED, 0xBD, 0xDE, 0x11, 0x3E, 0xD7, 0x86, 0x0B, 0x06, 0xC4,
+        0x3C, 0x99, 0x48, 0x4E, 0xDB, 0xFF, 0x02, 0x82, 0xE6, 0x99, 0x71, 0x85,
+        0xB9, 0x57, 0x33, 0x28, 0xE7, 0x9C, 0xFE, 0xFB, 0xB5, 0x0A, 0x21, 0x01 }, 0 },
+    { { 0x8D, 0xF3, 0xAD, 0x36, 0x1E, 0x96, 0x73, 0x5C, 0x90, 0xB5, 0x3D, 0x9E,
+        0x22, 0xAB, 0xCC, 0x81, 0xF4, 0xFC, 0xBB, 0x3A, 0x52, 0x13, 0x23, 0xC4,
+        0xDC, 0x72, 0x63, 0x48, 0x73, 0xEC, 0x77, 0xC9, 0x17, 0xEF, 0x24, 0x07 },
+      { 0xCA, 0x8C, 0x55, 0x4C, 0xA1, 0x21, 0x72, 0x76, 0xE9, 0x11, 0x2D, 0x13,
+        0x09, 0x63, 0xB9, 0xBA, 0x9B, 0x4A, 0xEC, 0x48, 0x90, 0xA7, 0xA5, 0x06,
+        0x2F, 0xF3, 0x12, 0xE7, 0xF7, 0x00, 0x5B, 0xAD, 0xFA, 0xF3, 0xBA, 0x06 }, 0 },
+    { { 0x8C, 0xE0, 0xF5, 0xC2, 0x27, 0x4B, 0x8C, 0xA9, 0xDB, 0x3B, 0xF3, 0xB1,
+        0xEF, 0x83, 0xD2, 0x10, 0x11, 0x8E, 0x9B, 0x6E, 0x7B, 0xE4, 0x5E, 0x61,
+        0xD9, 0xAD, 0x16, 0x32, 0x8D, 0xE3, 0x95, 0xD7, 0xCD, 0x28, 0x59, 0x01 },
+      { 0x8F, 0x77, 0x7E, 0x9D, 0xCC, 0x1B, 0xAF, 0xC0, 0x8A, 0x13, 0x45, 0x3B,
+        0xF0, 0x65, 0xDB, 0x10, 0x65, 0x01, 0x5A, 0x51, 0x6E, 0x85, 0x00, 0xE7,
+        0x27, 0x35, 0xCA, 0x99, 0xD8, 0x3C, 0x35, 0x79, 0x30, 0x73, 0xB5, 0x02 }, 0 },
+    { { 0x59, 0x17, 0x03, 0x68, 0x49, 0x59, 0x1C, 0x3B, 0x86, 0x41, 0x7B, 0x4A,
+        0x10, 0xB5, 0x24, 0x4F, 0x96, 0x16, 0xAB, 0x3A, 0x06, 0x71, 0x4A, 0xA9,
+        0x29, 0x98, 0xCB, 0x40, 0x22, 0xF1, 0xAD, 0xBD, 0x7A, 0x82, 0xA4, 0x00 },
+      { 0x5A, 0x00, 0x1C, 0x8B, 0x7E, 0x14, 0x94, 0xF8, 0x9C, 0x53, 0xD1, 0xB7,
+        0x1A, 0xB6, 0xB6, 0x3B, 0x7A, 0x4C, 0xEE, 0x67, 0x7D, 0x51, 0x4D, 0xB8,
+        0x4F, 0x4C, 0x71, 0xFF, 0x75, 0x7D, 0x9B, 0x5B, 0xEE, 0xBF, 0x1C, 0x05 }, 0 },
+    { { 0xF4, 0xE0, 0x80, 0xF7, 0x97, 0x05, 0xEB, 0xE8, 0xCD, 0x80, 0xC3, 0x68,
+        0x76, 0x9C, 0x61, 0x7A, 0x2C, 0xEA, 0xFE, 0xB0, 0xFE, 0xA0, 0xCE, 0xBC,
+        0x95, 0xD9, 0xC6, 0x1B, 0x53, 0x3A, 0xE0, 0xCF, 0xDC, 0x46, 0xEC, 0x01 },
+      { 0x46, 0x45, 0x15, 0x00, 0x4C, 0x70, 0x7F, 0x02, 0x86, 0x51, 0x64, 0xDB,
+        0x0C, 0x77, 0x98, 0x11, 0x94, 0x8F, 0x88, 0x8D, 0x68, 0x1C, 0xB6, 0x5E,
+        0x02, 0xE8, 0xDE, 0xD3, 0xE1, 0x10, 0xDE, 0x8A, 0x27, 0x45, 0xDD, 0x04 }, 0 },
+    { { 0x8B, 0x8A, 0xC7, 0xB0, 0x1D, 0x31, 0x2B, 0x33, 0xCF, 0x4F, 0xA8, 0x20,
+        0x57, 0x42, 0x99, 0xF7, 0x09, 0x9C, 0x04, 0x80, 0xED, 0x01, 0xE1, 0x8D,
+        0x47, 0x6D, 0x85, 0xFA, 0x7B, 0xEE, 0x1D, 0xC9, 0xCD, 0xAE, 0xBF, 0x04 },
+      { 0x63, 0x38, 0xEB, 0x01, 0x66, 0x4E, 0xBD, 0x5F, 0x81, 0xC7, 0x3E, 0x9D,
+        0x53, 0x1F, 0x71, 0x2D, 0xA5, 0xBB, 0x49, 0x2C, 0x2F, 0xAF, 0x4A, 0x91,
+        0xC7, 0x49, 0xB3, 0x04, 0xC9, 0xB7, 0x28, 0xC0, 0x13, 0xF6, 0xA0, 0x01 }, 0 },
+    { { 0xF1, 0xB4, 0xBE, 0xC6, 0xC9, 0xCA, 0xD3, 0x3F, 0x6D, 0x44, 0x04, 0x44,
+        0xBF, 0x51, 0xB4, 0xCB, 0xD9, 0x45, 0xC9, 0xD2, 0x7C, 0x39, 0x26, 0xB8,
+        0xBA, 0xB8, 0x16, 0x1A, 0xA7, 0xB4, 0xC3, 0x42, 0x7F, 0xDD, 0x3F, 0x05 },
+      { 0x00, 0x39, 0x32, 0xAF, 0x87, 0xB3, 0xE3, 0xEB, 0xA6, 0x4B, 0xE9, 0x20,
+        0x71, 0x8A, 0x48, 0x4F, 0x91, 0xE8, 0xCA, 0x46, 0x36, 0xC1, 0x0A, 0x50,
+        0x8D, 0x67, 0xFC, 0xD9, 0x1F, 0x33, 0x3C, 0x8F, 0xDD, 0x18, 0xCD, 0x06 }, 0 },
+    { { 0x3B, 0xBF, 0x7E, 0x7C, 0x08, 0xD9, 0x6E, 0x92, 0x88, 0x1D, 0x18, 0x32,
+        0x54, 0x6F, 0xC1, 0x41, 0x33, 0x46, 0xE7, 0xF4, 0x44, 0x75, 0xFC, 0xF5,
+        0x3E, 0x28, 0xBA, 0xBC, 0xBB, 0xE1, 0xBE, 0x5A, 0x24, 0x96, 0x83, 0x04 },
+      { 0x23, 0xD7, 0x72, 0x53, 0xD8, 0xBC, 0xC2, 0x08, 0xF8, 0x85, 0x8F, 0x39,
+        0xB2, 0x13, 0xFF, 0x76, 0x3D, 0xC4, 0x11, 0x74, 0xD5, 0xC4, 0x18, 0xEB,
+        0x6A, 0x5D, 0xF3, 0xD0, 0x13, 0x69, 0x05, 0x2E, 0x41, 0x49, 0x39, 0x02 }, 0 },
+    { { 0x56, 0x0F, 0x0C, 0x5D, 0xC4, 0x90, 0xF6, 0xE2, 0x83, 0x8D, 0x54, 0x31,
+        0x4D, 0xF7, 0x4C, 0x4C, 0x93, 0x3F, 0x1C, 0x0E, 0x38, 0x85, 0x45, 0x27,
+        0x3F, 0x4D, 0xF8, 0xA7, 0x99, 0x73, 0x45, 0x8D, 0x08, 0x28, 0xE8, 0x06 },
+      { 0x7A, 0x78, 0x40, 0x44, 0xBC, 0x14, 0x3F, 0xA4, 0x1C, 0x69, 0x4D, 0xB5,
+        0xC1, 0xE1, 0x1C, 0xBC, 0x93, 0xF5, 0x56, 0xA9, 0xED, 0x97, 0xB6, 0xB4,
+        0xD4, 0xD9, 0xD1, 0x5D, 0xFE, 0x59, 0x60, 0x27, 0x70, 0xBA, 0xA3, 0x06 }, 0 },
+    { { 0x76, 0x1F, 0x00, 0x7C, 0x56, 0x0A, 0x5B, 0x18, 0xAE, 0xC3, 0x53, 0xB3,
+        0x39, 0xBE, 0x10, 0xBF, 0x13, 0x71, 0xB4, 0xA7, 0x26, 0x06, 0x32, 0x88,
+        0xD6, 0x4F, 0x06, 0xFE, 0x64, 0x3D, 0x9C, 0xE4, 0xBB, 0x44, 0x1B, 0x07 },
+      { 0x56, 0xDD, 0xDE, 0x2D, 0x28, 0x4D, 0xEE, 0xD7, 0xA4, 0x5C, 0xCC, 0xF2,
+        0x82, 0x62, 0xF7, 0x11, 0x48, 0x00, 0xB0, 0x7B, 0xDB, 0x9E, 0xB6, 0x75,
+        0x27, 0x02, 0x34, 0x50, 0xF2, 0xFF, 0xA0, 0x91, 0x8E, 0xDA, 0xCC, 0x03 }, 0 },
+    { { 0x31, 0x98, 0xDD, 0x8A, 0xEF, 0x18, 0x7C, 0x1A, 0xAF, 0x4B, 0x41, 0x90,
+        0x28, 0xE0, 0x4E, 0x08, 0xF8, 0x0D, 0x00, 0xFE, 0x49, 0x18, 0x68, 0xDD,
+        0x45, 0xD4, 0x03, 0xF4, 0xDA, 0x4B, 0xC1, 0x7E, 0x57, 0x80, 0x6F, 0x06 },
+      { 0x10, 0xA7, 0x73, 0xBB, 0x5D, 0x64, 0xC8, 0x6F, 0xFD, 0x80, 0x45, 0xF7,
+        0x1F, 0xF9, 0x39, 0x21, 0x0D, 0x04, 0x39, 0xBD, 0x18, 0x92, 0x41, 0x84,
+        0x44, 0x95, 0x1B, 0xE7, 0x28, 0x6A, 0xF8, 0x22, 0x8F, 0xFD, 0x19, 0x06 }, 0 },
+    { { 0x92, 0xF9, 0x34, 0x2A, 0x5F, 0x6B, 0x8F, 0x1E, 0xC9, 0x17, 0x30, 0x03,
+        0xBD, 0xAE, 0x80, 0xDF, 0x0A, 0x54, 0xBE, 0x38, 0x3D, 0x51, 0x57, 0xF8,
+        0x51, 0x63, 0x8A, 0x5F, 0x66, 0x5A, 0x95, 0x33, 0x9B, 0x4F, 0x17, 0x05 },
+      { 0x72, 0xD5, 0x23, 0x25, 0xFF, 0xC6, 0x86, 0xCE, 0x2C, 0x29, 0x33, 0xE0,
+        0xA1, 0xAF, 0x35, 0x53, 0xD9, 0xF0, 0x22, 0xF6, 0x4D, 0x9B, 0xB2, 0x53,
+        0x2F, 0xD8, 0x82, 0x60, 0x6E, 0x28, 0x07, 0xF3, 0x18, 0xA2, 0x43, 0x04 }, 0 },
+    { { 0x00, 0x1F, 0x3D, 0x24, 0x60, 0x10, 0x74, 0x12, 0xCC, 0x12, 0x47, 0x68,
+        0x75, 0x0C, 0xF9, 0xB9, 0xCF, 0x2A, 0xF6, 0xBD, 0x89, 0xFB, 0x6D, 0xD6,
+        0x44, 0x03, 0xA1, 0x1B, 0xF2, 0x41, 0x52, 0x83, 0x31, 0x3A, 0xAB, 0x02 },
+      { 0xC5, 0x4F, 0x75, 0xF3, 0x49, 0x0D, 0xC2, 0x8D, 0x1F, 0x09, 0x79, 0xFD,
+        0x8E, 0x8A, 0xCC, 0xAF, 0x7F, 0x6C, 0xAB, 0xB1, 0x00, 0x47, 0x3B, 0x46,
+        0xFA, 0xE2, 0x74, 0x75, 0x69, 0xD8, 0x03, 0x23, 0x20, 0xC3, 0x9B, 0x05 }, 0 },
+    { { 0x06, 0xED, 0xA6, 0xC5, 0x98, 0xA3, 0x96, 0x34, 0x25, 0x62, 0x53, 0xFD,
+        0xF1, 0x04, 0xBA, 0x0B, 0x0F, 0x97, 0x63, 0xC5, 0x13, 0xBD, 0x40, 0x62,
+        0x1D, 0x93, 0x53, 0x46, 0x46, 0xEF, 0x35, 0x13, 0x47, 0x45, 0x74, 0x04 },
+      { 0xF8, 0x39, 0x3A, 0xA1, 0x3D, 0xD9, 0xDE, 0x2B, 0xD0, 0xCC, 0x4D, 0x40,
+        0xDA, 0x06, 0x9C, 0x75, 0x4B, 0x78, 0x63, 0x7F, 0xDC, 0x50, 0xA1, 0xB1,
+        0x20, 0xBF, 0xAE, 0xE1, 0x89, 0x38, 0x31, 0x73, 0x7D, 0x44, 0xDA, 0x01 }, 0 },
+    { { 0x9D, 0xD4, 0x37, 0xB3, 0x47, 0x1E, 0x2B, 0xCC, 0x17, 0x95, 0xC9, 0x9B,
+        0xE1, 0x43, 0xAF, 0x9D, 0x3C, 0xD4, 0x32, 0x95, 0xD4, 0x82, 0x34, 0x41,
+        0x57, 0x7E, 0x66, 0x32, 0xE8, 0x1B, 0xC4, 0xD5, 0x8A, 0xBD, 0xB7, 0x01 },
+      { 0x3D, 0x0E, 0x4B, 0x8B, 0x94, 0x09, 0x17, 0x81, 0xD2, 0x51, 0x34, 0x1D,
+        0xF4, 0x6E, 0xB6, 0x12, 0xF1, 0x4D, 0x4D, 0x85, 0x68, 0x01, 0xE2, 0x8D,
+        0xFF, 0xC7, 0x40, 0x12, 0x62, 0x4E, 0xA5, 0x84, 0x07, 0x85, 0x95, 0x01 }, 0 },
+    { { 0x5B, 0x77, 0x1F, 0xDC, 0x98, 0x8C, 0x20, 0x7C, 0x9B, 0xD9, 0x11, 0x2E,
+        0x8B, 0xF0, 0x35, 0x5D, 0x6A, 0xFF, 0x73, 0xA3, 0x49, 0xC9, 0xF1, 0x9A,
+        0x1A, 0x73, 0x63, 0xE1, 0xFA, 0xD4, 0x0B, 0xC3, 0x3D, 0xD1, 0x3E, 0x03 },
+      { 0xF9, 0x23, 0xCB, 0x7A, 0x73, 0xE9, 0xDE, 0xFE, 0x2C, 0x01, 0xA3, 0x1A,
+        0xFC, 0xFF, 0xCD, 0x65, 0x8C, 0xBC, 0x10, 0x8A, 0xFA, 0xF5, 0x82, 0xD0,
+        0xF2, 0x0E, 0x78, 0xB7, 0x29, 0x56, 0x33, 0x72, 0x9C, 0x63, 0xD7, 0x01 }, 0 },
+    { { 0xC1, 0x4A, 0xFE, 0x5B, 0xFB, 0x25, 0xF3, 0x48, 0xDF, 0xB0, 0x82, 0x96,
+        0x7B, 0xF8, 0xDA, 0xFB, 0x31, 0x4E, 0xB9, 0x74, 0xF7, 0xB0, 0xE5, 0x60,
+        0x7F, 0x5B, 0x4C, 0x01, 0x2C, 0x3A, 0xBC, 0xFB, 0xBB, 0xDD, 0x44, 0x05 },
+      { 0xEF, 0x94, 0xC5, 0x21, 0x60, 0x4A, 0xB8, 0xE0, 0x8E, 0x51, 0x34, 0x7C,
+        0xF8, 0x04, 0xED, 0xF9, 0xB1, 0x42, 0x4B, 0x31, 0x2B, 0xBD, 0x6F, 0xA4,
+        0x75, 0x56, 0xBF, 0xC4, 0xB6, 0xB5, 0x95, 0x91, 0x16, 0x46, 0x05, 0x01 }, 0 },
+    { { 0x1B, 0x24, 0x8E, 0x01, 0x89, 0xE5, 0x44, 0x1D, 0x19, 0x5E, 0x18, 0x46,
+        0x6F, 0xA9, 0x63, 0xD4, 0x01, 0x4A, 0x05, 0x32, 0xE3, 0x03, 0x2D, 0x39,
+        0x10, 0x0E, 0x27, 0x90, 0x6B, 0x0C, 0x06, 0x2E, 0x94, 0x8F, 0x40, 0x05 },
+      { 0xFB, 0x13, 0x1C, 0x67, 0x12, 0xCF, 0xCF, 0x5E, 0x3E, 0x75, 0x46, 0x6A,
+        0xAB, 0x23, 0x4D, 0xC8, 0xA1, 0x41, 0x37, 0x16, 0x79, 0x63, 0x14, 0x73,
+        0x18, 0x5B, 0xAD, 0x70, 0x17, 0x2E, 0x97, 0xBA, 0x79, 0xB5, 0x2C, 0x05 }, 0 },
+    { { 0xF7, 0x52, 0x8A, 0xA2, 0xCD, 0xD5, 0x71, 0x84, 0x2F, 0xD0, 0xBD, 0x43,
+        0x30, 0xD4, 0xA4, 0xC1, 0x05, 0xE2, 0x04, 0xFE, 0xBD, 0x91, 0xBE, 0xC0,
+        0xC7, 0xA0, 0x11, 0xC0, 0xC6, 0x85, 0xE9, 0xCD, 0x20, 0xE7, 0x55, 0x05 },
+      { 0x90, 0xBA, 0xFD, 0x27, 0x05, 0x05, 0x52, 0xEC, 0x85, 0xE5, 0xE8, 0x3B,
+        0xA3, 0x41, 0xA4, 0x37, 0xA3, 0xD0, 0x85, 0xAB, 0x21, 0xE7, 0x6C, 0xD6,
+        0x4D, 0xB1, 0x31, 0x02, 0x3D, 0xD3, 0x15, 0xB1, 0x96, 0x77, 0x79, 0x04 }, 0 }
+};
+
+static const curve_generated_t sect283k1_generated = {
+    .square = eccint_square_sect283k1,
+    .inv = eccint_inv_sect283k1,
+    .tracemask = eccint_sect283k1_tracemask,
+    .halftrace = eccint_sect283k1_halftrace[0],
+    .ptable = eccint_sect283k1_ptable
+};
+
+#endif
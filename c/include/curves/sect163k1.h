@@ -7,25 +7,9 @@
 #define __SECT163K1_H
 
 #include "ecctypes.h"
+#include "sect163k1_kernels.h"
 
-void eccint_mod_sect163k1(eccint_t *in, eccint_t *res, const curve_t *curve) {
-    // Seog Chung Seo et al, Algorithm 3
-    eccint_t tmp;
-
-    for (size_t i = 41; i > 20; i--) {
-        tmp = in[i];
-        in[i - 21] ^= (tmp << 5);
-        in[i - 20] ^= (tmp << 4) ^ (tmp << 3) ^ tmp ^ (tmp >> 3);
-        in[i - 19] ^= (tmp >> 4) ^ (tmp >> 5);
-    }
-
-    tmp = in[20] >> 3;
-    in[0] ^= (tmp << 7) ^ (tmp << 6) ^ (tmp << 3) ^ tmp;
-    in[1] ^= (tmp >> 1) ^ (tmp >> 2);
-    in[20] &= 0x07;
-}
-
-static curve_t sect163k1 = {
+static const curve_t sect163k1 = {
     // z^163+z^7+z^6+z^3+1 = z^163 + 0xC9
     .q = { 0xC9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08 },
 
@@ -39,9 +23,11 @@ static curve_t sect163k1 = {
     //.n = { 0xEF, 0xA5, 0xF8, 0x99, 0x0D, 0xCC, 0xE0, 0xA2, 0x08, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 }, // flipped order
 
     .h = 0x02,
+    .order = { 0xEF, 0xA5, 0xF8, 0x99, 0x0D, 0xCC, 0xE0, 0xA2, 0x08, 0x01, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04 }, // flipped order
     .words = 21,
     .m = 163,
-    .mod_fast = eccint_mod_sect163k1
+    .mod_fast = eccint_mod_sect163k1,
+    .generated = &sect163k1_generated
 };
 
 #endif
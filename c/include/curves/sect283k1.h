@@ -0,0 +1,43 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __SECT283K1_H
+#define __SECT283K1_H
+
+#include "ecctypes.h"
+
+// 36 words, needs a build with KEYSIZE=36 or more
+#if KEYSIZE >= 36
+
+#include "sect283k1_kernels.h"
+
+static const curve_t sect283k1 = {
+    // z^283+z^12+z^7+z^5+1 = z^283 + 0x10A1
+    .q = { 0xA1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08 },
+
+    .a = { 0x00 },
+    .b = { 0x01 },
+
+    .P = {{ 0x36, 0x28, 0x49, 0x58, 0x24, 0xAC, 0xC2, 0xB0, 0x13, 0x69, 0x87, 0x16, 0x7A, 0x56, 0xC1, 0x23, 0x5F, 0x26,
+            0xCD, 0x53, 0xE5, 0x88, 0xF1, 0x62, 0x81, 0x3B, 0x1A, 0x3F, 0x88, 0x44, 0xCA, 0x78, 0x3F, 0x21, 0x03, 0x05 },
+          { 0x59, 0x22, 0xDD, 0x77, 0x61, 0x11, 0x34, 0x4E, 0x36, 0x62, 0x59, 0xE4, 0x98, 0x46, 0x18, 0xE8, 0xC0, 0x45,
+            0x7E, 0xE8, 0x6F, 0x42, 0xE5, 0x07, 0x5D, 0xF9, 0x90, 0x8D, 0x31, 0x9E, 0x1C, 0x0F, 0x38, 0xDA, 0xCC, 0x01 }}, // flipped order
+
+    .n = { 0xA1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08 },
+
+    .h = 0x04,
+    .order = { 0x61, 0x3C, 0x16, 0x1E, 0x06, 0x1E, 0x45, 0x94, 0x7F, 0xFF, 0x5D, 0x26, 0x77, 0x75, 0xD0, 0x2E, 0xAE, 0xE9,
+               0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01 }, // flipped order
+    .words = 36,
+    .m = 283,
+    .mod_fast = eccint_mod_sect283k1,
+    .generated = &sect283k1_generated
+};
+
+#endif
+
+#endif
@@ -0,0 +1,48 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __SECT409K1_H
+#define __SECT409K1_H
+
+#include "ecctypes.h"
+
+// 52 words, needs a build with KEYSIZE=52 or more
+#if KEYSIZE >= 52
+
+#include "sect409k1_kernels.h"
+
+static const curve_t sect409k1 = {
+    // z^409+z^87+1 = z^409 + 0x8000000000000000000001
+    .q = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 },
+
+    .a = { 0x00 },
+    .b = { 0x01 },
+
+    .P = {{ 0x46, 0x37, 0x02, 0xE9, 0xCF, 0x40, 0x55, 0xB3, 0xB1, 0x2E, 0x22, 0xEE, 0x62, 0xAA, 0xAA, 0xB5, 0x9E, 0x18,
+            0x60, 0xC4, 0xC2, 0x7C, 0xF6, 0xF9, 0xB8, 0xCF, 0xAC, 0x27, 0x4C, 0xC8, 0x07, 0xE3, 0x87, 0x09, 0xFD, 0x0E,
+            0x21, 0x84, 0x71, 0x0F, 0x89, 0xB1, 0x3A, 0xAD, 0xC1, 0x49, 0x8F, 0x65, 0x5F, 0xF0, 0x60, 0x00 },
+          { 0x6B, 0x28, 0xE0, 0xD8, 0x48, 0xEC, 0x63, 0x58, 0x7A, 0xA2, 0x9C, 0xAA, 0x15, 0x52, 0xC5, 0xE9, 0x42, 0x6C,
+            0x5F, 0xDA, 0xE3, 0x10, 0xEA, 0xE9, 0x65, 0x51, 0x32, 0xE6, 0x27, 0xA4, 0x8E, 0x91, 0x2F, 0x78, 0x60, 0x34,
+            0x9C, 0x29, 0x04, 0xBF, 0xAC, 0x1D, 0xBA, 0xAC, 0x42, 0x4E, 0x7C, 0x0B, 0x05, 0x69, 0xE3, 0x01 }}, // flipped order
+
+    .n = { 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 },
+
+    .h = 0x04,
+    .order = { 0xCF, 0x5F, 0x1E, 0xE0, 0xB8, 0x83, 0x5C, 0x4B, 0x5B, 0xCA, 0xE7, 0xE3, 0xD3, 0x5E, 0x7D, 0x55, 0xC4, 0x0E,
+               0x40, 0x20, 0xEA, 0xD4, 0xB2, 0x83, 0x5F, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+               0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00 }, // flipped order
+    .words = 52,
+    .m = 409,
+    .mod_fast = eccint_mod_sect409k1,
+    .generated = &sect409k1_generated
+};
+
+#endif
+
+#endif
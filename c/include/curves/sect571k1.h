@@ -0,0 +1,53 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __SECT571K1_H
+#define __SECT571K1_H
+
+#include "ecctypes.h"
+
+// 72 words, needs a build with KEYSIZE=72 or more
+#if KEYSIZE >= 72
+
+#include "sect571k1_kernels.h"
+
+static const curve_t sect571k1 = {
+    // z^571+z^10+z^5+z^2+1 = z^571 + 0x425
+    .q = { 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08 },
+
+    .a = { 0x00 },
+    .b = { 0x01 },
+
+    .P = {{ 0x72, 0x89, 0x1C, 0xA0, 0x83, 0x52, 0x94, 0xE2, 0xC7, 0x88, 0xCA, 0x4D, 0x17, 0x47, 0x8B, 0x98, 0xFB, 0x76,
+            0x47, 0x49, 0x39, 0xBA, 0xD1, 0xBB, 0x8C, 0xB0, 0xCE, 0xB4, 0x4D, 0x30, 0xDA, 0x47, 0xE6, 0x05, 0xB2, 0x93,
+            0x84, 0x95, 0x70, 0x43, 0xA4, 0x1C, 0x84, 0x01, 0x48, 0x80, 0x24, 0x60, 0xD4, 0xD5, 0x12, 0x00, 0x97, 0xA2,
+            0x9C, 0xAC, 0xE4, 0x3F, 0x10, 0xF8, 0x31, 0x96, 0x18, 0x82, 0xBC, 0x3F, 0x92, 0x59, 0xA8, 0xB7, 0x6E, 0x02 },
+          { 0xA3, 0xC7, 0xF1, 0x3E, 0x14, 0x4C, 0xCD, 0x01, 0xF6, 0x84, 0x19, 0x59, 0xC8, 0x30, 0x04, 0x32, 0x1B, 0xAF,
+            0xA7, 0x7B, 0x1A, 0xB0, 0x20, 0xB6, 0xDC, 0xAE, 0x72, 0xF7, 0xB9, 0xBB, 0xBE, 0x4F, 0xA7, 0xAE, 0x44, 0xAC,
+            0xC0, 0x79, 0x49, 0x9D, 0x2C, 0x8A, 0x6D, 0x00, 0xFC, 0x1E, 0xC6, 0xFF, 0x54, 0x7A, 0x30, 0x9F, 0xEC, 0x8C,
+            0xD5, 0x4D, 0x31, 0x95, 0xCA, 0x3B, 0xDE, 0xEA, 0x4A, 0x4F, 0x37, 0xBF, 0x4F, 0x7F, 0x80, 0xDC, 0x49, 0x03 }}, // flipped order
+
+    .n = { 0x25, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+           0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08 },
+
+    .h = 0x04,
+    .order = { 0x01, 0x10, 0x7C, 0x63, 0x8F, 0x77, 0xFE, 0x5C, 0xB4, 0xDE, 0x91, 0x1E, 0x38, 0x39, 0xD6, 0xE5, 0x4B, 0xD8,
+               0x30, 0xB6, 0x38, 0x41, 0x7F, 0x91, 0xDB, 0xA8, 0x91, 0xB3, 0xE4, 0x63, 0x9A, 0xF1, 0xE1, 0x50, 0x18, 0x13,
+               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+               0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02 }, // flipped order
+    .words = 72,
+    .m = 571,
+    .mod_fast = eccint_mod_sect571k1,
+    .generated = &sect571k1_generated
+};
+
+#endif
+
+#endif
@@ -10,15 +10,19 @@
 #include "eccmath.h"
 
 static void testcurve9_mod_slow(eccint_t *c, eccint_t *res, const curve_t *curve) {
-    eccint_mod(c, curve->q, res, curve);
+    eccint_general_mod(c, curve->q, res, curve);
 }
 
-static curve_t testcurve9 = {
+static const curve_t testcurve9 = {
     .q = { 0b00000011, 0b00000010 },
     .a = { 0b00000001, 0b00000000 },
     .b = { 0b00000001, 0b00000000 },
     .h = 0x02,
 
+    // #E = 518, so the odd subgroup has 259 elements. P generates all of E
+    // and is not in it, 2P is.
+    .order = { 0x03, 0x01 },
+
     // This is a random point on the curve, does not necessesarily generate all
     // points. (238,175) = (0b11101110, 0b10101111) = (0xEE, 0xAF)
     .P = {{ 0xEE, 0x00 }, { 0xAF, 0x00 }},
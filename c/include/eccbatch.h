@@ -0,0 +1,30 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCBATCH_H
+#define __ECCBATCH_H
+
+#include "ecctypes.h"
+
+// Items per chunk, the unit of work that is handed out and stolen
+#define ECC_BATCH_CHUNK 8
+
+typedef struct _ecc_pool_t ecc_pool_t;
+
+/**
+ * Called once when all items of a batch are done, from the worker thread
+ * that finished the last item. |valid| is the number of valid signatures for
+ * a verify batch, and the number of items for a sign batch.
+ */
+typedef void (*ecc_batch_done_fn)(void *arg, const size_t valid);
+
+ecc_pool_t *ecc_pool_create(const size_t threads);
+void ecc_pool_destroy(ecc_pool_t *pool);
+size_t ecc_pool_threads(const ecc_pool_t *pool);
+
+int ecc_sign_batch(ecc_pool_t *pool, const eccint_t *privatekey, const eccint_keyptr_t *hashes, eccint_signature_t *signatures, const size_t count, const curve_t *curve, ecc_batch_done_fn done, void *arg);
+int ecc_verify_batch_parallel(ecc_pool_t *pool, const eccint_point_t *publickeys, const eccint_keyptr_t *hashes, const eccint_signature_t *signatures, int *results, const size_t count, const curve_t *curve, ecc_batch_done_fn done, void *arg);
+
+#endif
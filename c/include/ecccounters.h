@@ -0,0 +1,57 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCCOUNTERS_H
+#define __ECCCOUNTERS_H
+
+#include "ecctypes.h"
+
+/**
+ * Operation counts, only collected when built with ECC_COUNTERS (make
+ * COUNTERS=1). Squarings are not counted as multiplications, divisions count
+ * as inversions. Reductions are counted where a product or value is reduced,
+ * whichever algorithm is used.
+ */
+typedef struct {
+    uint64_t mul;
+    uint64_t square;
+    uint64_t inv;
+    uint64_t reduce;
+    uint64_t point_add;
+    uint64_t point_double;
+    uint64_t point_halve;
+} ecc_counters_t;
+
+// The top-level operations counts are kept for
+typedef enum {
+    ECC_COUNTERS_KEYGEN,
+    ECC_COUNTERS_SIGN,
+    ECC_COUNTERS_VERIFY,
+    ECC_COUNTERS_OPS
+} ecc_counters_op_t;
+
+#ifdef ECC_COUNTERS
+// The eccmath.h macros count in C++ code too, which spells it thread_local
+#ifdef __cplusplus
+extern thread_local ecc_counters_t ecc_counters;
+#else
+extern _Thread_local ecc_counters_t ecc_counters;
+#endif
+
+#define ECC_COUNT(counter) (ecc_counters.counter++)
+#define ECC_COUNTERS_BEGIN(start) ecc_counters_t start = ecc_counters
+#define ECC_COUNTERS_END(op, start) ecc_counters_end((op), &(start))
+#else
+#define ECC_COUNT(counter) ((void) 0)
+#define ECC_COUNTERS_BEGIN(start) do {} while (0)
+#define ECC_COUNTERS_END(op, start) do {} while (0)
+#endif
+
+void ecc_counters_end(const ecc_counters_op_t op, const ecc_counters_t *start);
+int ecc_counters_get(const ecc_counters_op_t op, ecc_counters_t *last, ecc_counters_t *total, uint64_t *calls);
+void ecc_counters_reset(void);
+void ecc_counters_print(const char *prefix, const ecc_counters_t *counters);
+
+#endif
@@ -0,0 +1,58 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCDISPATCH_H
+#define __ECCDISPATCH_H
+
+#include "ecctypes.h"
+
+typedef void (*ecc_mul_fn)(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve);
+typedef void (*ecc_reduce_fn)(eccint_t *c, eccint_t *res, const curve_t *curve);
+typedef void (*ecc_div_mod_fn)(const eccint_t *y, const eccint_t *x, const eccint_t *mod, eccint_t *res, const curve_t *curve);
+typedef void (*ecc_point_double_fn)(const eccint_point_t *p, eccint_point_t *res, const curve_t *curve);
+typedef void (*ecc_point_add_fn)(const eccint_point_t *p, const eccint_point_t *q, eccint_point_t *res, const curve_t *curve);
+typedef void (*ecc_point_mul_fn)(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve);
+
+/**
+ * The algorithms used for the arithmetic, one function per operation. A curve
+ * uses its own table if curve->dispatch is set, otherwise the host default.
+ * The names identify the backend chosen for each operation.
+ */
+struct _ecc_dispatch_t {
+    ecc_mul_fn mul;
+    ecc_reduce_fn reduce;
+    ecc_div_mod_fn div_mod;
+    ecc_point_double_fn point_double;
+    ecc_point_add_fn point_add;
+    ecc_point_mul_fn point_mul;
+
+    const char *mul_name;
+    const char *reduce_name;
+    const char *div_mod_name;
+    const char *point_double_name;
+    const char *point_add_name;
+    const char *point_mul_name;
+};
+
+typedef struct _ecc_dispatch_t ecc_dispatch_t;
+
+// The operations that can be selected by name
+#define ECC_OP_MUL "mul"
+#define ECC_OP_REDUCE "reduce"
+#define ECC_OP_DIV_MOD "div_mod"
+#define ECC_OP_POINT_DOUBLE "point_double"
+#define ECC_OP_POINT_ADD "point_add"
+#define ECC_OP_POINT_MUL "point_mul"
+
+const ecc_dispatch_t *ecc_dispatch_default(void);
+int ecc_dispatch_select(ecc_dispatch_t *dispatch, const char *op, const char *name);
+size_t ecc_dispatch_backends(const char *op, const char **names, const size_t max);
+void ecc_dispatch_autotune(ecc_dispatch_t *dispatch, const curve_t *curve);
+
+static inline const ecc_dispatch_t *ecc_dispatch(const curve_t *curve) {
+    return curve->dispatch ? curve->dispatch : ecc_dispatch_default();
+}
+
+#endif
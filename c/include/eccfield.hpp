@@ -0,0 +1,531 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCFIELD_HPP
+#define __ECCFIELD_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#endif
+
+extern "C" {
+#include "ecctypes.h"
+#include "ecdsa.h"
+}
+
+/**
+ * Header-only C++17 layer with the field and the curve fixed at compile time.
+ * The C code loops over curve->words bytes and goes through the dispatch
+ * table for every multiplication. Here gf2m<M, poly<K...>> is an element of
+ * GF(2^M) modulo z^M + z^K... + 1 in 64 bit limbs: the limb count, the
+ * reduction shifts and the inversion chain are constants, so the loops are
+ * unrolled and everything is inlined into the caller.
+ *
+ * koblitz<F, A> is the curve y^2 + xy = x^3 + Ax^2 + 1 over F with affine
+ * addition and doubling, and scalar multiplication with the López-Dahab
+ * Montgomery ladder. Elements and points convert from and to the eccint_t
+ * layout of the C API, curve_ref forwards key generation, signing and
+ * verification to it.
+ *
+ * Multiplication uses PCLMULQDQ if the CPU has it, otherwise a 4 bit window
+ * multiply on 64 bit words. Requires GCC or clang.
+ */
+
+#define ECC_UNROLL _Pragma("GCC unroll 64")
+
+namespace ecc {
+
+// Reduction polynomial z^M + z^K... + 1, the middle terms K in descending
+// order. taps also holds the constant term.
+template<unsigned... K>
+struct poly {
+    static constexpr unsigned count = sizeof...(K) + 1;
+    static constexpr unsigned taps[] = { K..., 0 };
+};
+
+namespace detail {
+
+inline bool have_pclmul() {
+#if defined(__x86_64__)
+    static const bool supported = (__builtin_cpu_init(), __builtin_cpu_supports("pclmul"));
+    return supported;
+#else
+    return false;
+#endif
+}
+
+// Bits of a byte spread to the even bits of a 16 bit word, for squaring
+struct spread_table {
+    uint16_t v[256];
+
+    constexpr spread_table() : v() {
+        for (unsigned i = 0; i < 256; i++) {
+            unsigned s = 0;
+            for (unsigned bit = 0; bit < 8; bit++) {
+                s |= ((i >> bit) & 1) << (2 * bit);
+            }
+            v[i] = s;
+        }
+    }
+};
+
+inline constexpr spread_table spread{};
+
+// 64 x 64 bit carry-less multiply with a 4 bit window. The table loses the
+// top three bits of a, they are added back from b at the end.
+inline void clmul64(const uint64_t a, const uint64_t b, uint64_t &lo, uint64_t &hi) {
+    uint64_t table[16];
+
+    table[0] = 0;
+    table[1] = a;
+    ECC_UNROLL
+    for (unsigned i = 2; i < 16; i += 2) {
+        table[i] = table[i / 2] << 1;
+        table[i + 1] = table[i] ^ a;
+    }
+
+    lo = table[b & 0x0F];
+    hi = 0;
+    ECC_UNROLL
+    for (unsigned i = 4; i < 64; i += 4) {
+        const uint64_t u = table[(b >> i) & 0x0F];
+        lo ^= u << i;
+        hi ^= u >> (64 - i);
+    }
+
+    hi ^= ((b & 0xEEEEEEEEEEEEEEEEULL) >> 1) & (0 - (a >> 63));
+    hi ^= ((b & 0xCCCCCCCCCCCCCCCCULL) >> 2) & (0 - ((a >> 62) & 1));
+    hi ^= ((b & 0x8888888888888888ULL) >> 3) & (0 - ((a >> 61) & 1));
+}
+
+template<size_t L>
+inline void mul_soft(const uint64_t *a, const uint64_t *b, uint64_t *res) {
+    ECC_UNROLL
+    for (size_t i = 0; i < 2 * L; i++) {
+        res[i] = 0;
+    }
+    ECC_UNROLL
+    for (size_t i = 0; i < L; i++) {
+        ECC_UNROLL
+        for (size_t j = 0; j < L; j++) {
+            uint64_t lo, hi;
+            clmul64(a[i], b[j], lo, hi);
+            res[i + j] ^= lo;
+            res[i + j + 1] ^= hi;
+        }
+    }
+}
+
+template<size_t L>
+inline void square_soft(const uint64_t *a, uint64_t *res) {
+    ECC_UNROLL
+    for (size_t i = 0; i < L; i++) {
+        uint64_t lo = 0, hi = 0;
+        ECC_UNROLL
+        for (unsigned j = 0; j < 4; j++) {
+            lo |= (uint64_t) spread.v[(a[i] >> (8 * j)) & 0xFF] << (16 * j);
+            hi |= (uint64_t) spread.v[(a[i] >> (8 * j + 32)) & 0xFF] << (16 * j);
+        }
+        res[2 * i] = lo;
+        res[2 * i + 1] = hi;
+    }
+}
+
+#if defined(__x86_64__)
+// The intrinsics need the target attribute, so these are not inlined into
+// callers without it
+template<size_t L>
+__attribute__((target("pclmul,sse2")))
+void mul_clmul(const uint64_t *a, const uint64_t *b, uint64_t *res) {
+    ECC_UNROLL
+    for (size_t i = 0; i < 2 * L; i++) {
+        res[i] = 0;
+    }
+    ECC_UNROLL
+    for (size_t i = 0; i < L; i++) {
+        const __m128i ai = _mm_cvtsi64_si128(a[i]);
+        ECC_UNROLL
+        for (size_t j = 0; j < L; j++) {
+            const __m128i p = _mm_clmulepi64_si128(ai, _mm_cvtsi64_si128(b[j]), 0x00);
+            res[i + j] ^= (uint64_t) _mm_cvtsi128_si64(p);
+            res[i + j + 1] ^= (uint64_t) _mm_cvtsi128_si64(_mm_srli_si128(p, 8));
+        }
+    }
+}
+
+template<size_t L>
+__attribute__((target("pclmul,sse2")))
+void square_clmul(const uint64_t *a, uint64_t *res) {
+    ECC_UNROLL
+    for (size_t i = 0; i < L; i++) {
+        const __m128i ai = _mm_cvtsi64_si128(a[i]);
+        const __m128i p = _mm_clmulepi64_si128(ai, ai, 0x00);
+        res[2 * i] = (uint64_t) _mm_cvtsi128_si64(p);
+        res[2 * i + 1] = (uint64_t) _mm_cvtsi128_si64(_mm_srli_si128(p, 8));
+    }
+}
+#endif
+
+template<size_t L>
+inline void mul(const uint64_t *a, const uint64_t *b, uint64_t *res) {
+#if defined(__x86_64__)
+    if (have_pclmul()) {
+        mul_clmul<L>(a, b, res);
+        return;
+    }
+#endif
+    mul_soft<L>(a, b, res);
+}
+
+template<size_t L>
+inline void square(const uint64_t *a, uint64_t *res) {
+#if defined(__x86_64__)
+    if (have_pclmul()) {
+        square_clmul<L>(a, res);
+        return;
+    }
+#endif
+    square_soft<L>(a, res);
+}
+
+// Word-level reduction of the 2L words in c, from the top word down. Every
+// term of the polynomial is a shift known at compile time.
+template<unsigned M, typename Poly, size_t L>
+inline void reduce(uint64_t *c, uint64_t *res) {
+    constexpr unsigned top = M % 64;
+
+    ECC_UNROLL
+    for (size_t i = 2 * L - 1; i >= L; i--) {
+        const uint64_t w = c[i];
+        ECC_UNROLL
+        for (unsigned k = 0; k < Poly::count; k++) {
+            const size_t s = 64 * i - M + Poly::taps[k];
+            c[s / 64] ^= w << (s % 64);
+            if (s % 64) {
+                c[s / 64 + 1] ^= w >> (64 - s % 64);
+            }
+        }
+    }
+
+    // Bits M and up of the top word
+    const uint64_t w = c[L - 1] >> top;
+    c[L - 1] &= (1ULL << top) - 1;
+    ECC_UNROLL
+    for (unsigned k = 0; k < Poly::count; k++) {
+        const unsigned s = Poly::taps[k];
+        c[s / 64] ^= w << (s % 64);
+        if (s % 64) {
+            c[s / 64 + 1] ^= w >> (64 - s % 64);
+        }
+    }
+
+    ECC_UNROLL
+    for (size_t i = 0; i < L; i++) {
+        res[i] = c[i];
+    }
+}
+
+} // namespace detail
+
+template<unsigned M, typename Poly>
+struct gf2m {
+    static constexpr unsigned bits = M;
+    static constexpr size_t limbs = (M + 63) / 64;
+    static constexpr size_t bytes = (M + 7) / 8;
+
+    static_assert(M % 64 != 0, "the top limb must be partial");
+    static_assert(Poly::taps[0] + 63 < M, "reducing a word must not reach the word itself");
+    static_assert(Poly::taps[0] + 64 * limbs - M <= M, "reducing the top limb must stay below M");
+
+    uint64_t v[limbs];
+
+    static gf2m zero() {
+        return gf2m{};
+    }
+
+    static gf2m one() {
+        gf2m res{};
+        res.v[0] = 1;
+        return res;
+    }
+
+    // Little endian bytes as in the C API, |bytes| of them
+    static gf2m from_bytes(const eccint_t *in) {
+        gf2m res{};
+        ECC_UNROLL
+        for (size_t i = 0; i < bytes; i++) {
+            res.v[i / 8] |= (uint64_t) in[i] << (8 * (i % 8));
+        }
+        return res;
+    }
+
+    void to_bytes(eccint_t *out) const {
+        ECC_UNROLL
+        for (size_t i = 0; i < bytes; i++) {
+            out[i] = v[i / 8] >> (8 * (i % 8));
+        }
+    }
+
+    // True if the C curve is over this field
+    static bool is_field_of(const curve_t *curve) {
+        if (curve->m != M || curve->words != bytes) {
+            return false;
+        }
+        gf2m q = from_bytes(curve->q);
+        gf2m expect{};
+        for (unsigned k = 0; k < Poly::count; k++) {
+            expect.v[Poly::taps[k] / 64] |= 1ULL << (Poly::taps[k] % 64);
+        }
+        expect.v[limbs - 1] |= 1ULL << (M % 64);
+        return q == expect;
+    }
+
+    bool is_zero() const {
+        uint64_t acc = 0;
+        ECC_UNROLL
+        for (size_t i = 0; i < limbs; i++) {
+            acc |= v[i];
+        }
+        return !acc;
+    }
+
+    friend bool operator==(const gf2m &a, const gf2m &b) {
+        uint64_t acc = 0;
+        ECC_UNROLL
+        for (size_t i = 0; i < limbs; i++) {
+            acc |= a.v[i] ^ b.v[i];
+        }
+        return !acc;
+    }
+
+    friend bool operator!=(const gf2m &a, const gf2m &b) {
+        return !(a == b);
+    }
+
+    friend gf2m operator+(const gf2m &a, const gf2m &b) {
+        gf2m res;
+        ECC_UNROLL
+        for (size_t i = 0; i < limbs; i++) {
+            res.v[i] = a.v[i] ^ b.v[i];
+        }
+        return res;
+    }
+
+    friend gf2m operator*(const gf2m &a, const gf2m &b) {
+        uint64_t c[2 * limbs];
+        gf2m res;
+        detail::mul<limbs>(a.v, b.v, c);
+        detail::reduce<M, Poly, limbs>(c, res.v);
+        return res;
+    }
+
+    friend gf2m sqr(const gf2m &a) {
+        uint64_t c[2 * limbs];
+        gf2m res;
+        detail::square<limbs>(a.v, c);
+        detail::reduce<M, Poly, limbs>(c, res.v);
+        return res;
+    }
+
+    // a^(2^n)
+    friend gf2m sqr(gf2m a, unsigned n) {
+        for (; n; n--) {
+            a = sqr(a);
+        }
+        return a;
+    }
+
+    // Itoh-Tsujii, a^-1 = (a^(2^(M-1) - 1))^2. b_k = a^(2^k - 1) is built
+    // along the bits of M - 1 with b_2k = b_k^(2^k) b_k and b_2k+1 = b_2k^2 a,
+    // so the chain is fixed at compile time. Zero maps to zero.
+    friend gf2m inv(const gf2m &a) {
+        constexpr unsigned n = M - 1;
+        constexpr int top = 31 - __builtin_clz(n);
+        gf2m b = a;
+        unsigned k = 1;
+
+        ECC_UNROLL
+        for (int i = top - 1; i >= 0; i--) {
+            b = sqr(b, k) * b;
+            k *= 2;
+            if ((n >> i) & 1) {
+                b = sqr(b) * a;
+                k++;
+            }
+        }
+        return sqr(b);
+    }
+};
+
+// Koblitz curve y^2 + xy = x^3 + Ax^2 + 1 over F
+template<typename F, unsigned A>
+struct koblitz {
+    static_assert(A <= 1, "a is 0 or 1 on Koblitz curves");
+
+    using field = F;
+
+    struct point {
+        F x;
+        F y;
+        bool infinity;
+    };
+
+    static point infinity() {
+        return point{ F::zero(), F::zero(), true };
+    }
+
+    static point from_c(const eccint_point_t *p) {
+        return point{ F::from_bytes(p->x), F::from_bytes(p->y), p->infinity != 0 };
+    }
+
+    static void to_c(const point &p, eccint_point_t *res) {
+        p.x.to_bytes(res->x);
+        p.y.to_bytes(res->y);
+        res->infinity = p.infinity;
+    }
+
+    // True if the C curve is this curve
+    static bool is_curve_of(const curve_t *curve) {
+        return F::is_field_of(curve) && F::from_bytes(curve->a) == (A ? F::one() : F::zero()) &&
+               F::from_bytes(curve->b) == F::one();
+    }
+
+    // Algorithm 3.22 (Hankerson et al), -P = (x, x + y)
+    static point add(const point &p, const point &q) {
+        if (p.infinity) {
+            return q;
+        }
+        if (q.infinity) {
+            return p;
+        }
+        if (p.x == q.x) {
+            return p.y == q.y ? dbl(p) : infinity();
+        }
+
+        const F sx = p.x + q.x;
+        const F l = (p.y + q.y) * inv(sx);
+        F x = sqr(l) + l + sx;
+        if constexpr (A) {
+            x.v[0] ^= 1;
+        }
+        return point{ x, l * (p.x + x) + x + p.y, false };
+    }
+
+    static point dbl(const point &p) {
+        if (p.infinity || p.x.is_zero()) {
+            return infinity();
+        }
+
+        const F l = p.x + p.y * inv(p.x);
+        F x = sqr(l) + l;
+        if constexpr (A) {
+            x.v[0] ^= 1;
+        }
+        return point{ x, sqr(p.x) + (l + F::one()) * x, false };
+    }
+
+    // kP with the x-only Montgomery ladder in López-Dahab coordinates and y
+    // recovered at the end, Hankerson et al, Algorithm 3.40. |scalar| has
+    // |size| little endian bytes.
+    static point mul(const eccint_t *scalar, const size_t size, const point &p) {
+        ptrdiff_t i = 8 * (ptrdiff_t) size - 1;
+        while (i >= 0 && !((scalar[i / 8] >> (i % 8)) & 1)) {
+            i--;
+        }
+        if (i < 0 || p.infinity) {
+            return infinity();
+        }
+        if (p.x.is_zero()) {
+            // (0, 1) has order two
+            return (scalar[0] & 1) ? p : infinity();
+        }
+
+        const F x = p.x;
+        F x1 = x;
+        F z1 = F::one();
+        F z2 = sqr(x);
+        F x2 = sqr(z2) + F::one();
+
+        for (i--; i >= 0; i--) {
+            const bool bit = (scalar[i / 8] >> (i % 8)) & 1;
+            F &ax = bit ? x1 : x2;
+            F &az = bit ? z1 : z2;
+            F &dx = bit ? x2 : x1;
+            F &dz = bit ? z2 : z1;
+
+            // Madd: Z = (X1 Z2 + X2 Z1)^2, X = x Z + (X1 Z2)(X2 Z1)
+            const F t1 = x1 * z2;
+            const F t2 = x2 * z1;
+            az = sqr(t1 + t2);
+            ax = x * az + t1 * t2;
+
+            // Mdouble: Z = X^2 Z^2, X = X^4 + Z^4 since b = 1
+            const F s1 = sqr(dx);
+            const F s2 = sqr(dz);
+            dz = s1 * s2;
+            dx = sqr(s1 + s2);
+        }
+
+        if (z1.is_zero()) {
+            return infinity();
+        }
+        if (z2.is_zero()) {
+            return point{ x, x + p.y, false };
+        }
+
+        // x3 = X1/Z1, y3 = (x + x3)[(X1 + xZ1)(X2 + xZ2) + (x^2 + y)Z1Z2] / (xZ1Z2) + y
+        // with a single inversion
+        const F z = z1 * z2;
+        const F d = inv(x * z);
+        const F x3 = x1 * x * z2 * d;
+        const F t = (x1 + x * z1) * (x2 + x * z2) + (sqr(x) + p.y) * z;
+        return point{ x3, (x + x3) * t * d + p.y, false };
+    }
+};
+
+// The C API for one curve
+class curve_ref {
+public:
+    explicit curve_ref(const curve_t *curve) : curve_(curve) {}
+
+    const curve_t *get() const {
+        return curve_;
+    }
+
+    int keygen(eccint_point_t *publickey, eccint_t *privatekey) const {
+        return ecc_keygen(publickey, privatekey, curve_);
+    }
+
+    void sign(const eccint_t *privatekey, const eccint_t *hash, eccint_signature_t *signature) const {
+        ecc_sign(privatekey, hash, signature, curve_);
+    }
+
+    int verify(const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature) const {
+        return ecc_verify(publickey, hash, signature, curve_);
+    }
+
+private:
+    const curve_t *curve_;
+};
+
+// SEC2 Koblitz curves
+using sect163k1_field = gf2m<163, poly<7, 6, 3>>;
+using sect233k1_field = gf2m<233, poly<74>>;
+using sect283k1_field = gf2m<283, poly<12, 7, 5>>;
+using sect409k1_field = gf2m<409, poly<87>>;
+using sect571k1_field = gf2m<571, poly<10, 5, 2>>;
+
+using sect163k1_curve = koblitz<sect163k1_field, 1>;
+using sect233k1_curve = koblitz<sect233k1_field, 0>;
+using sect283k1_curve = koblitz<sect283k1_field, 0>;
+using sect409k1_curve = koblitz<sect409k1_field, 0>;
+using sect571k1_curve = koblitz<sect571k1_field, 0>;
+
+} // namespace ecc
+
+#endif
@@ -0,0 +1,36 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCGENERATED_H
+#define __ECCGENERATED_H
+
+#include "ecctypes.h"
+
+/**
+ * Kernels and tables generated for one curve by contrib/gftable/kernels.js,
+ * see generated/ and `make generate`. A curve points to them with
+ * curve->generated; without them the generic code and the tables built by
+ * ecc_curve_init are used. The generated reduction is the curve's mod_fast.
+ */
+struct _curve_generated_t {
+    /* x -> x^2 mod f(z) */
+    void (*square)(const eccint_t *a, eccint_t *res, const struct _curve_t *curve);
+
+    /* x -> x^-1 mod f(z), Itoh-Tsujii with the addition chain for m - 1 */
+    void (*inv)(const eccint_t *a, eccint_t *res, const struct _curve_t *curve);
+
+    /* Bit i is Tr(z^i), see curve_tables_t */
+    const eccint_t *tracemask;
+
+    /* H(z^i) for i in [0, m), words bytes each */
+    const eccint_t *halftrace;
+
+    /* 2^i * P for i in [0, 8 * words), see ecc_precomp_build */
+    const eccint_point_t *ptable;
+};
+
+typedef struct _curve_generated_t curve_generated_t;
+
+#endif
@@ -0,0 +1,58 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCHISTOGRAM_H
+#define __ECCHISTOGRAM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// The phases of signing and verifying that are timed
+typedef enum {
+    ECC_PHASE_NONCE,    /* choosing k */
+    ECC_PHASE_KP,       /* k * P */
+    ECC_PHASE_R,        /* r = x_1 mod n */
+    ECC_PHASE_SCALAR,   /* s in sign, u_1 and u_2 in verify */
+    ECC_PHASE_INV,      /* w = s^(-1) mod n */
+    ECC_PHASE_MSM,      /* u_1 * P + u_2 * Q */
+    ECC_PHASE_COMPARE,  /* v = x mod n and v == r */
+    ECC_PHASE_SIGN,     /* all of ecc_sign */
+    ECC_PHASE_VERIFY,   /* all of ecc_verify */
+    ECC_PHASES
+} ecc_phase_t;
+
+/* Log-linear buckets as in HdrHistogram: values below 16ns get a bucket
+ * each, above that every power of two is split into 16 buckets, so a bucket
+ * is at most 1/16 of its value wide. Values of 2^40ns and more (about 18
+ * minutes) land in the last bucket. */
+#define ECC_HISTOGRAM_SUB_BITS 4
+#define ECC_HISTOGRAM_MAX_EXP 40
+#define ECC_HISTOGRAM_BUCKETS ((ECC_HISTOGRAM_MAX_EXP - ECC_HISTOGRAM_SUB_BITS + 2) << ECC_HISTOGRAM_SUB_BITS)
+
+typedef struct {
+    uint64_t count;
+    uint64_t sum;
+    uint64_t max;
+    uint64_t buckets[ECC_HISTOGRAM_BUCKETS];
+} ecc_histogram_t;
+
+// Merged histograms of all threads, values in nanoseconds
+typedef struct {
+    ecc_histogram_t phases[ECC_PHASES];
+} ecc_histogram_snapshot_t;
+
+void ecc_histogram_enable(const int enable);
+int ecc_histogram_enabled(void);
+
+uint64_t ecc_histogram_now(void);
+uint64_t ecc_histogram_lap(const ecc_phase_t phase, const uint64_t start);
+
+void ecc_histogram_snapshot(ecc_histogram_snapshot_t *snapshot);
+void ecc_histogram_reset(void);
+uint64_t ecc_histogram_percentile(const ecc_histogram_t *histogram, const double percentile);
+const char *ecc_histogram_phase_name(const ecc_phase_t phase);
+size_t ecc_histogram_format(const ecc_histogram_snapshot_t *snapshot, char *buf, const size_t size);
+
+#endif
@@ -0,0 +1,31 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCKEYCACHE_H
+#define __ECCKEYCACHE_H
+
+#include <stdint.h>
+
+#include "ecctypes.h"
+
+/**
+ * Bounded cache of public keys that passed ecc_validate_publickey, so keys
+ * that are seen again skip the validation. A key hashes to a set of
+ * ECC_KEYCACHE_WAYS entries, a full set replaces its entries in turn. Only
+ * valid keys are cached. The cache can be shared between threads; the curve
+ * must outlive it.
+ */
+#define ECC_KEYCACHE_WAYS 4
+
+typedef struct _ecc_keycache_t ecc_keycache_t;
+
+ecc_keycache_t *ecc_keycache_create(const size_t capacity, const curve_t *curve);
+void ecc_keycache_destroy(ecc_keycache_t *cache);
+
+int ecc_keycache_validate(ecc_keycache_t *cache, const eccint_point_t *publickey);
+int ecc_verify_validated(ecc_keycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature);
+void ecc_keycache_stats(ecc_keycache_t *cache, uint64_t *hits, uint64_t *misses);
+
+#endif
@@ -0,0 +1,74 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCKEYSTORE_H
+#define __ECCKEYSTORE_H
+
+#include <sys/types.h>
+
+#include "ecctypes.h"
+
+#define ECC_KEYSTORE_MAGIC "ECCKEYS\0"
+#define ECC_KEYSTORE_VERSION 1
+
+// The index has a power of two of 32 bit slots, at least twice the keys
+#define ECC_KEYSTORE_MAX_KEYS (UINT32_C(1) << 30)
+
+// Per-key flags
+#define ECC_KEY_YBIT 0x01
+#define ECC_KEY_TRUSTED 0x02
+
+/**
+ * File header of a key store. Keys are stored compressed as a structure of
+ * arrays: ids[count], x[count][stride], flags[count], followed by an open
+ * addressing index of |slots| entries. All sections are 64 byte aligned.
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t stride;
+    uint32_t m;
+    uint32_t slots;
+    uint64_t count;
+    uint64_t curve_id;
+
+    uint64_t ids_offset;
+    uint64_t x_offset;
+    uint64_t flags_offset;
+    uint64_t index_offset;
+} ecc_keystore_header_t;
+
+/**
+ * Index entry, four per cache line. The flags are duplicated here so checking
+ * whether a key is known and trusted only touches the index. |pos| is the
+ * position of the key plus one, zero marks an empty slot.
+ */
+typedef struct {
+    uint64_t id;
+    uint32_t pos;
+    uint32_t flags;
+} ecc_keystore_slot_t;
+
+typedef struct {
+    const ecc_keystore_header_t *header;
+    const uint64_t *ids;
+    const eccint_t *x;
+    const uint8_t *flags;
+    const ecc_keystore_slot_t *index;
+
+    void *data;
+    size_t size;
+} ecc_keystore_t;
+
+int ecc_keystore_write(const char *path, const uint64_t *ids, const eccint_point_t *keys, const size_t count, const curve_t *curve);
+int ecc_keystore_generate(const char *path, const uint64_t *ids, eccint_keyptr_t *privatekeys, const size_t count, const curve_t *curve);
+int ecc_keystore_open(ecc_keystore_t *store, const char *path, const curve_t *curve);
+void ecc_keystore_close(ecc_keystore_t *store);
+
+ssize_t ecc_keystore_find(const ecc_keystore_t *store, const uint64_t id);
+int ecc_keystore_lookup(const ecc_keystore_t *store, const uint64_t id, eccint_point_t *publickey, const curve_t *curve);
+int ecc_keystore_verify(const ecc_keystore_t *store, const uint64_t id, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve);
+
+#endif
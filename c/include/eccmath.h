@@ -7,23 +7,23 @@
 #define __ECCMATH_H
 
 #include "ecctypes.h"
+#include "eccdispatch.h"
+#include "ecccounters.h"
 
+// The multiplier, reduction, divider and point arithmetic are selected at
+// runtime per curve, see eccdispatch.h
 #define eccint_add eccint_binary_add
 #define eccint_sub eccint_binary_add
-#define eccint_mul eccint_shiftnadd_mul
-#define eccint_div_mod eccint_binary_sun_div_mod
-#define eccint_point_double eccint_book_point_double
-#define eccint_point_add eccint_book_point_add
-#define eccint_point_mul eccint_binary_doublenadd_mul
-//#define eccint_div_mod eccint_binary_book_div_mod
-//#define eccint_div_mod eccint_common_div_mod
-//#define eccint_inv_mod eccint_common_inv_mod
-//#define eccint_point_double eccint_point_double_affine
-//#define eccint_point_mul eccint_montgomery_ladder_point_mul
-
-// The squaring speed could be improved by a custom function
+#define eccint_mul(a, b, res, curve) (ecc_dispatch(curve)->mul((a), (b), (res), (curve)))
+#define eccint_reduce(c, res, curve) (ecc_dispatch(curve)->reduce((c), (res), (curve)))
+#define eccint_div_mod(y, x, mod, res, curve) (ECC_COUNT(inv), ecc_dispatch(curve)->div_mod((y), (x), (mod), (res), (curve)))
+#define eccint_point_double(p, res, curve) (ECC_COUNT(point_double), ecc_dispatch(curve)->point_double((p), (res), (curve)))
+#define eccint_point_add(p, q, res, curve) (ECC_COUNT(point_add), ecc_dispatch(curve)->point_add((p), (q), (res), (curve)))
+#define eccint_point_mul(k, p, res, curve) (ecc_dispatch(curve)->point_mul((k), (p), (res), (curve)))
+
+// Squaring modulo the field polynomial uses the curve's squaring table if
+// there is one, see eccint_square_mod
 #define eccint_square(a, res, curve) eccint_mul((a), (a), res, curve)
-#define eccint_square_mod(a, mod, res, curve) eccint_mul_mod((a), (a), mod, res, curve)
 #define eccint_even(in) (!(in[0] & 1))
 
 int eccint_degree(const eccint_t *a, const size_t size);
@@ -32,22 +32,54 @@ eccint_t eccint_shift_right(eccint_t * const in, eccint_t *res, size_t shift, co
 
 eccint_t eccint_binary_add(const eccint_t *a, const eccint_t *b, eccint_t *res, const size_t size);
 
+eccint_t eccint_int_add(const eccint_t *a, const eccint_t *b, eccint_t *res, const size_t size);
+eccint_t eccint_int_sub(const eccint_t *a, const eccint_t *b, eccint_t *res, const size_t size);
+void eccint_int_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const size_t size);
+void eccint_int_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const size_t size);
+void eccint_int_mul_mod(const eccint_t *a, const eccint_t *b, const eccint_t *mod, eccint_t *res, const size_t size);
+int eccint_int_inv_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const size_t size);
+
 void eccint_general_mod(eccint_t *c, const eccint_t *mod, eccint_t *res, const curve_t *curve);
 
 void eccint_shiftnadd_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve);
+void eccint_comb_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve);
+#if defined(__x86_64__)
+void eccint_clmul_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve);
+void eccint_karatsuba_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve);
+#endif
+void eccint_general_reduce(eccint_t *c, eccint_t *res, const curve_t *curve);
+void eccint_shifted_reduce(eccint_t *c, eccint_t *res, const curve_t *curve);
+void eccint_fast_reduce(eccint_t *c, eccint_t *res, const curve_t *curve);
 void eccint_mul_mod(const eccint_t *a, const eccint_t *b, const eccint_t *mod, eccint_t *res, const curve_t *curve);
 void eccint_mod(const eccint_t *in, const eccint_t *mod, eccint_t *res, const curve_t *curve);
 void eccint_mul_mod_fast(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve);
+void eccint_square_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const curve_t *curve);
+void eccint_multisquare(const eccint_t *a, const size_t k, eccint_t *res, const curve_t *curve);
 
 void eccint_binary_sun_div_mod(const eccint_t *y, const eccint_t *x, const eccint_t *mod, eccint_t *res, const curve_t *curve);
 void eccint_binary_book_div_mod(const eccint_t *b, const eccint_t *a, const eccint_t *mod, eccint_t *res, const curve_t *curve);
 void eccint_inv_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const curve_t *curve);
 
+int eccint_trace(const eccint_t *a, const curve_t *curve);
+void eccint_halftrace(const eccint_t *a, eccint_t *res, const curve_t *curve);
+void eccint_sqrt(const eccint_t *a, eccint_t *res, const curve_t *curve);
+
 int eccint_point_on_curve(const eccint_point_t *in, const curve_t *curve);
+eccint_t eccint_point_compress(const eccint_point_t *p, eccint_t *x, const curve_t *curve);
+int eccint_point_decompress(const eccint_t *x, const eccint_t ybit, eccint_point_t *res, const curve_t *curve);
+size_t eccint_point_encode(const eccint_point_t *p, const int compressed, uint8_t *out, const curve_t *curve);
+int eccint_point_decode(const uint8_t *in, const size_t inlen, eccint_point_t *res, const curve_t *curve);
 
 void eccint_book_point_double(const eccint_point_t *p, eccint_point_t *res, const curve_t *curve);
 void eccint_book_point_add(const eccint_point_t *p, const eccint_point_t *q, eccint_point_t *res, const curve_t *curve);
 void eccint_montgomery_ladder_point_mul(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve);
+void eccint_ld_point_double(const eccint_ld_point_t *p, eccint_ld_point_t *res, const curve_t *curve);
+void eccint_ld_point_add_affine(const eccint_ld_point_t *p, const eccint_point_t *q, eccint_ld_point_t *res, const curve_t *curve);
+void eccint_ld_point_normalize_batch(const eccint_ld_point_t *in, eccint_point_t *res, eccint_keyptr_t *scratch, const size_t count, const curve_t *curve);
+void eccint_ld_ladder_x(const eccint_t *scalar, const size_t size, const eccint_t *x, eccint_t *X, eccint_t *Z, const curve_t *curve);
+void eccint_point_halve(const eccint_point_t *p, eccint_point_t *res, const curve_t *curve);
+void eccint_halving_point_mul(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve);
 void eccint_binary_doublenadd_mul(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve);
+void eccint_shamir_point_mul(const eccint_t *k, const eccint_point_t *p, const eccint_t *l, const eccint_point_t *q, eccint_point_t *res, const curve_t *curve);
 
 #endif
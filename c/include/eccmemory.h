@@ -12,7 +12,6 @@ eccint_t eccint_testbit_single(const eccint_t in, const size_t bit);
 eccint_t eccint_testbit(const eccint_t *in, const size_t bit);
 
 int eccint_testzero(const eccint_t *in, const size_t size);
-int eccint_testinfinite(const eccint_t *in, const size_t size);
 int eccint_testnumber(const eccint_t *in, const eccint_t num, const size_t size);
 void eccint_setbit(eccint_t *in, const size_t bit, const int val);
 
@@ -30,6 +29,7 @@ int eccint_cmp(const eccint_t *a, const eccint_t *b, const size_t size);
 int eccint_point_cmp(const eccint_point_t *a, const eccint_point_t *b, const size_t size);
 void eccint_point_cpy(eccint_point_t *dst, const eccint_point_t *src, const size_t size);
 void eccint_point_set(eccint_point_t *dst, const eccint_t elem, const size_t size);
+void eccint_point_set_infinity(eccint_point_t *dst, const size_t size);
 
 uint32_t eccint_as_number(const eccint_t *in, const size_t size);
 void eccint_from_number(const uint32_t num, eccint_t *res, const size_t size);
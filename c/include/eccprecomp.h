@@ -0,0 +1,77 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCPRECOMP_H
+#define __ECCPRECOMP_H
+
+#include "ecctypes.h"
+
+#define ECC_PRECOMP_MAGIC "ECCPRE\0\0"
+#define ECC_PRECOMP_VERSION 2
+
+// Tables are placed at this alignment, both in memory and in the file
+#define ECC_PRECOMP_ALIGN 64
+
+// What the table was generated for
+#define ECC_PRECOMP_CURVE 1
+#define ECC_PRECOMP_KEY 2
+
+// Flags for ecc_precomp_map
+#define ECC_PRECOMP_VERIFY 1
+
+/**
+ * File header of a precomputation table. The file is written in host byte
+ * order and with the host's eccint_point_t layout, it is a cache and not an
+ * interchange format. A file from a host with different byte order will fail
+ * the version check, one built with a different KEYSIZE the keysize check.
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t kind;
+    uint32_t keysize;
+    uint32_t words;
+    uint32_t m;
+    uint32_t count;
+
+    /* Byte offset of the table from the start of the header */
+    uint64_t offset;
+
+    /* Fingerprint of the curve parameters, see ecc_curve_fingerprint */
+    uint64_t curve_id;
+
+    /* FNV-1a over base and table */
+    uint64_t checksum;
+
+    /* The point the table was generated for */
+    eccint_point_t base;
+} ecc_precomp_header_t;
+
+/**
+ * Fixed-base table, table[i] = 2^i * base for i in [0, count). The table is
+ * either built in memory or mapped read-only from a file, in both cases it is
+ * used in place.
+ */
+struct _ecc_precomp_t {
+    const ecc_precomp_header_t *header;
+    const eccint_point_t *table;
+
+    void *data;
+    size_t size;
+    int mapped;
+};
+
+typedef struct _ecc_precomp_t ecc_precomp_t;
+
+uint64_t ecc_curve_fingerprint(const curve_t *curve);
+
+int ecc_precomp_build(ecc_precomp_t *pre, const eccint_point_t *base, const uint32_t kind, const curve_t *curve);
+int ecc_precomp_save(const ecc_precomp_t *pre, const char *path);
+int ecc_precomp_map(ecc_precomp_t *pre, const char *path, const eccint_point_t *base, const uint32_t kind, const curve_t *curve, const int flags);
+void ecc_precomp_free(ecc_precomp_t *pre);
+
+void eccint_precomp_point_mul(const eccint_t *scalar, const ecc_precomp_t *pre, eccint_point_t *res, const curve_t *curve);
+
+#endif
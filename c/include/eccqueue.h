@@ -0,0 +1,57 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCQUEUE_H
+#define __ECCQUEUE_H
+
+#include <stdint.h>
+
+#include "ecctypes.h"
+
+typedef enum {
+    ECC_SIGN_PENDING = 0,
+    ECC_SIGN_DONE,
+    ECC_SIGN_EXPIRED
+} ecc_sign_status_t;
+
+typedef struct _ecc_sign_request_t ecc_sign_request_t;
+
+// Called from a worker thread when a request is done or has expired
+typedef void (*ecc_sign_done_fn)(ecc_sign_request_t *request);
+
+/**
+ * A signing request. It belongs to the caller and must stay valid, together
+ * with the key and hash it points to, until it is completed.
+ */
+struct _ecc_sign_request_t {
+    const eccint_t *privatekey;
+    const eccint_t *hash;
+
+    // Latest start in ecc_sign_queue_now() time, or 0 for no deadline
+    uint64_t deadline;
+
+    // Called on completion. Without it the request is handed back through
+    // ecc_sign_queue_completed() and the queue's event fd.
+    ecc_sign_done_fn done;
+    void *arg;
+
+    ecc_sign_status_t status;
+    eccint_signature_t signature;
+
+    struct _ecc_sign_request_t *next;
+};
+
+typedef struct _ecc_sign_queue_t ecc_sign_queue_t;
+
+ecc_sign_queue_t *ecc_sign_queue_create(const size_t capacity, const size_t threads, const curve_t *curve);
+void ecc_sign_queue_destroy(ecc_sign_queue_t *queue);
+
+int ecc_sign_queue_submit(ecc_sign_queue_t *queue, ecc_sign_request_t *request);
+int ecc_sign_queue_fd(const ecc_sign_queue_t *queue);
+ecc_sign_request_t *ecc_sign_queue_completed(ecc_sign_queue_t *queue);
+
+uint64_t ecc_sign_queue_now(void);
+
+#endif
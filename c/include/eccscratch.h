@@ -0,0 +1,81 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCSCRATCH_H
+#define __ECCSCRATCH_H
+
+#include <stdio.h>
+
+#include "ecctypes.h"
+
+/**
+ * Per-thread scratch arena for the temporaries of the arithmetic routines,
+ * so they don't live in variable-length arrays on the stack. The arena is a
+ * stack of ECC_SCRATCH_SIZE bytes on the heap, allocated on the first use in
+ * a thread and freed when the thread exits. A routine remembers the top, takes
+ * its temporaries and resets the top before it returns:
+ *
+ *   size_t mark = ecc_scratch_begin();
+ *   eccint_t *t = ecc_scratch_get(curve->words);
+ *   ...
+ *   ecc_scratch_end(mark);
+ *
+ * Each request is rounded up to whole slots of ECC_SCRATCH_ALIGN bytes, so a
+ * field element of sect163k1 takes one slot and every temporary is aligned
+ * for vector loads. Running out of space aborts.
+ *
+ * Built with ECC_SCRATCH_DEBUG (make SCRATCH_DEBUG=1) the highest top of any
+ * thread is recorded, see ecc_scratch_report.
+ */
+#define ECC_SCRATCH_ALIGN 32
+// The general reduction alone takes 4 * m * words bytes
+#if KEYSIZE > 36
+#define ECC_SCRATCH_SIZE (256 * 1024)
+#else
+#define ECC_SCRATCH_SIZE (64 * 1024)
+#endif
+
+typedef struct {
+    eccint_t *base;
+    size_t top;
+#ifdef ECC_SCRATCH_DEBUG
+    size_t peak;
+#endif
+} ecc_scratch_t;
+
+extern _Thread_local ecc_scratch_t ecc_scratch;
+
+eccint_t *ecc_scratch_grow(const size_t bytes);
+void ecc_scratch_peak(void);
+size_t ecc_scratch_highwater(void);
+void ecc_scratch_report(FILE *out);
+
+static inline size_t ecc_scratch_begin(void) {
+    return ecc_scratch.top;
+}
+
+// |size| bytes of scratch, valid until the matching ecc_scratch_end
+static inline eccint_t *ecc_scratch_get(const size_t size) {
+    const size_t bytes = (size + ECC_SCRATCH_ALIGN - 1) & ~((size_t) ECC_SCRATCH_ALIGN - 1);
+
+    if (!ecc_scratch.base || ecc_scratch.top + bytes > ECC_SCRATCH_SIZE) {
+        return ecc_scratch_grow(bytes);
+    }
+
+    eccint_t *res = ecc_scratch.base + ecc_scratch.top;
+    ecc_scratch.top += bytes;
+#ifdef ECC_SCRATCH_DEBUG
+    if (ecc_scratch.top > ecc_scratch.peak) {
+        ecc_scratch_peak();
+    }
+#endif
+    return res;
+}
+
+static inline void ecc_scratch_end(const size_t mark) {
+    ecc_scratch.top = mark;
+}
+
+#endif
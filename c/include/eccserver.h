@@ -0,0 +1,69 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCSERVER_H
+#define __ECCSERVER_H
+
+#include <stdint.h>
+
+#include "ecctypes.h"
+
+/**
+ * Protocol of the signing server. Every request and response starts with an
+ * ecc_server_header_t in host byte order, followed by |length| bytes of
+ * payload. Field elements take curve->words bytes each (w below):
+ *
+ *   SIGN    request  hash[w]                      response  r[w] s[w]
+ *   VERIFY  request  [x[w] y[w]] hash[w] r[w] s[w] response  -
+ *   PUBKEY  request  -                            response  x[w] y[w]
+ *
+ * A verify request carries the public key only if |key| is
+ * ECC_SERVER_KEY_INLINE, otherwise the key of that slot is used. Inline keys
+ * that fail validation are answered with ECC_SERVER_INVALID. Responses
+ * echo |op|, |key| and |id| and set |status|. Verifies are answered after
+ * their batch, unless the same signature was found valid before, so
+ * responses can arrive out of order and have to be matched by |id|.
+ *
+ * The socket is created with mode 0600, and connections from processes of
+ * other users than the server's are closed right away.
+ */
+#define ECC_SERVER_MAGIC 0xECC5
+
+#define ECC_SERVER_SIGN 1
+#define ECC_SERVER_VERIFY 2
+#define ECC_SERVER_PUBKEY 3
+
+#define ECC_SERVER_KEY_INLINE 0xFFFF
+
+#define ECC_SERVER_OK 0
+#define ECC_SERVER_INVALID 1
+#define ECC_SERVER_BADREQUEST 2
+#define ECC_SERVER_NOKEY 3
+
+// Most verifies that are coalesced into one batch
+#define ECC_SERVER_BATCH 256
+
+typedef struct {
+    uint16_t magic;
+    uint8_t op;
+    uint8_t status;
+    uint16_t key;
+    uint16_t length;
+    uint32_t id;
+} ecc_server_header_t;
+
+typedef struct {
+    eccint_t privatekey[KEYSIZE];
+    eccint_point_t publickey;
+} ecc_server_key_t;
+
+typedef struct _ecc_server_t ecc_server_t;
+
+ecc_server_t *ecc_server_create(const char *path, const ecc_server_key_t *keys, const size_t count, const curve_t *curve, const size_t threads, const size_t nonces);
+int ecc_server_run(ecc_server_t *server);
+void ecc_server_stop(ecc_server_t *server);
+void ecc_server_destroy(ecc_server_t *server);
+
+#endif
@@ -0,0 +1,57 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCTABLES_H
+#define __ECCTABLES_H
+
+#include "ecctypes.h"
+
+/**
+ * A GF(2)-linear map on field elements, applied one byte at a time:
+ * f(a) = table[0][a[0]] + table[1][a[1]] + ... + table[words-1][a[words-1]].
+ * The table holds words * 256 field elements.
+ */
+typedef struct {
+    eccint_t *table;
+} eccint_linmap_t;
+
+// Number of x^(2^k) tables a curve can hold
+#define ECC_MULTISQUARE_MAX 8
+
+/**
+ * Tables precomputed per curve by ecc_curve_init. Everything in here is
+ * read-only once built, so a curve can be shared between threads.
+ */
+struct _curve_tables_t {
+    /* Bit i is Tr(z^i), so Tr(a) is the parity of a & tracemask */
+    eccint_t tracemask[KEYSIZE];
+
+    /* The half-trace, only built for odd m */
+    eccint_linmap_t halftrace;
+
+    /* Squaring, x -> x^2 mod f(z) */
+    eccint_linmap_t square;
+
+    /* f(z) shifted left by 0 to 7 bits, used for reduction */
+    eccint_t qshift[8][KEYSIZE+1];
+
+    /* sqrt(z) = z^(2^(m-1)), used to take square roots with one multiply */
+    eccint_t sqrtz[KEYSIZE];
+
+    /* Tables for x -> x^(2^k), see ecc_curve_init_multisquare */
+    eccint_linmap_t multisquare[ECC_MULTISQUARE_MAX];
+    size_t multisquare_k[ECC_MULTISQUARE_MAX];
+    size_t multisquare_count;
+};
+
+typedef struct _curve_tables_t curve_tables_t;
+
+int ecc_curve_init(curve_t *curve);
+int ecc_curve_init_multisquare(curve_t *curve, const size_t *k, const size_t count);
+void ecc_curve_free(curve_t *curve);
+
+void eccint_linmap_apply(const eccint_linmap_t *map, const eccint_t *a, eccint_t *res, const curve_t *curve);
+
+#endif
@@ -22,14 +22,26 @@ typedef uint8_t eccint_t;
 typedef uint16_t ecclong_t;
 typedef eccint_t eccint_keyptr_t[KEYSIZE];
 
+// Affine point. infinity is 1 for the point at infinity, x and y are zero
+// then. Every function that writes a point sets it.
 typedef struct {
     eccint_t x[KEYSIZE];
     eccint_t y[KEYSIZE];
+    eccint_t infinity;
 } eccint_point_t;
 
+// López-Dahab projective point, x = X/Z and y = Y/Z^2. Z = 0 is infinity.
+typedef struct {
+    eccint_t x[KEYSIZE];
+    eccint_t y[KEYSIZE];
+    eccint_t z[KEYSIZE];
+} eccint_ld_point_t;
+
+// recid lets ecc_recover_publickey find the key, see ecc_sign
 typedef struct {
     eccint_t r[KEYSIZE];
     eccint_t s[KEYSIZE];
+    eccint_t recid;
 } eccint_signature_t;
 
 struct _curve_t {
@@ -52,6 +64,11 @@ struct _curve_t {
   /* Cofactor h = #E(F_q) / n */
   eccint_t h;
 
+  /* #E(F_q) / h as an integer, the order of the subgroup point halving works
+   * in. Signature scalars are integers modulo this order; n is only used as
+   * a polynomial. Zero if unknown. */
+  eccint_t order[KEYSIZE+1];
+
   /* Number of words used, this is KEYSIZE */
   size_t words;
 
@@ -59,6 +76,20 @@ struct _curve_t {
   size_t m;
 
   void (*mod_fast)(eccint_t *, eccint_t *, const struct _curve_t *);
+
+  /* Optional fixed-base table for P, see eccprecomp.h */
+  const struct _ecc_precomp_t *precomp;
+
+  /* Tables built by ecc_curve_init, see ecctables.h */
+  const struct _curve_tables_t *tables;
+
+  /* Algorithms used for this curve, NULL for the host default. See
+   * eccdispatch.h */
+  const struct _ecc_dispatch_t *dispatch;
+
+  /* Kernels and tables generated for this curve, NULL if there are none. See
+   * eccgenerated.h */
+  const struct _curve_generated_t *generated;
 };
 
 typedef struct _curve_t curve_t;
@@ -0,0 +1,36 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECCVERIFYCACHE_H
+#define __ECCVERIFYCACHE_H
+
+#include "ecctypes.h"
+
+/**
+ * Cache of recent positive verification results, so a replayed message
+ * (key, hash, r, s) is accepted without another verify. Entries hold the
+ * whole tuple and a hit compares all of it, the hash of the tuple only picks
+ * the place. Only valid signatures are cached.
+ *
+ * The cache is split into ECC_VERIFYCACHE_SHARDS shards of sets with
+ * ECC_VERIFYCACHE_WAYS entries. Lookups take no lock, each entry is guarded
+ * by a sequence counter that writers make odd while they change it. Writers
+ * lock their shard and evict with the CLOCK policy: a hit marks its entry,
+ * the set's hand skips and unmarks marked entries and replaces the first
+ * unmarked one.
+ */
+#define ECC_VERIFYCACHE_SHARDS 16
+#define ECC_VERIFYCACHE_WAYS 8
+
+typedef struct _ecc_verifycache_t ecc_verifycache_t;
+
+ecc_verifycache_t *ecc_verifycache_create(const size_t capacity, const curve_t *curve);
+void ecc_verifycache_destroy(ecc_verifycache_t *cache);
+
+int ecc_verifycache_lookup(ecc_verifycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature);
+void ecc_verifycache_insert(ecc_verifycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature);
+int ecc_verify_cached(ecc_verifycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve);
+
+#endif
@@ -0,0 +1,14 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __ECDH_H
+#define __ECDH_H
+
+#include "ecctypes.h"
+
+int ecc_ecdh(const eccint_t *privatekey, const uint8_t *peer, const size_t peerlen, eccint_t *shared, const curve_t *curve);
+size_t ecc_ecdh_batch(const eccint_t *privatekey, const uint8_t *const *peers, const size_t *peerlens, eccint_keyptr_t *shared, int *results, const size_t count, const curve_t *curve);
+
+#endif
@@ -7,15 +7,32 @@
 #define __ECDSA_H
 
 #include "ecctypes.h"
+#include "eccprecomp.h"
+
+// A nonce k together with r = (kP)_x mod n, see ecc_nonce_compute
+typedef struct {
+    eccint_t k[KEYSIZE];
+    eccint_t r[KEYSIZE];
+    eccint_t recid;
+} ecc_nonce_t;
+
+// Keys that share one inversion in ecc_keygen_batch
+#define ECC_KEYGEN_ROUND 1024
 
 void eccint_urand(void *dst, const ssize_t size);
 
 int ecc_keygen(eccint_point_t *publickey, eccint_t *privatekey, const curve_t *curve);
+int ecc_keygen_batch(eccint_point_t *publickeys, eccint_keyptr_t *privatekeys, const size_t count, const curve_t *curve);
 int ecc_validate_publickey(const eccint_point_t *publickey, const curve_t *curve);
 
 void ecc_sign(const eccint_t *privatekey, const eccint_t *hash, eccint_signature_t *signature, const curve_t *curve);
 void ecc_sign_verbose(const eccint_t *privatekey, const eccint_t *hash, eccint_signature_t *signature, const curve_t *curve, eccint_t verbose);
+int ecc_nonce_compute(const eccint_t *k, ecc_nonce_t *nonce, const curve_t *curve);
+void ecc_nonce_generate(ecc_nonce_t *nonce, const curve_t *curve);
+int ecc_sign_nonce(const eccint_t *privatekey, const eccint_t *hash, const ecc_nonce_t *nonce, eccint_signature_t *signature, const curve_t *curve);
 int ecc_verify(const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve);
 int ecc_verify_verbose(const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve, eccint_t verbose);
+int ecc_recover_publickey(const eccint_t *hash, const eccint_signature_t *signature, eccint_point_t *publickey, const curve_t *curve);
+int ecc_verify_precomp(const ecc_precomp_t *keytable, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve);
 
 #endif
@@ -0,0 +1,401 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "ecctypes.h"
+#include "ecdsa.h"
+#include "eccbatch.h"
+
+/**
+ * A batch is cut into chunks of ECC_BATCH_CHUNK items, and the chunks are
+ * split evenly into one range per worker. A worker takes chunks from the
+ * front of its own range. When that is empty it steals the upper half of
+ * another worker's range, so the load balances without a shared queue.
+ * Ranges are packed into one word, begin in the high and end in the low
+ * half, and updated with compare-and-swap.
+ */
+typedef struct _ecc_batch_t {
+    void (*item)(struct _ecc_batch_t *batch, const size_t i);
+
+    const eccint_t *privatekey;
+    const eccint_point_t *publickeys;
+    const eccint_keyptr_t *hashes;
+    eccint_signature_t *signatures;
+    const eccint_signature_t *verify_signatures;
+    int *results;
+    const curve_t *curve;
+
+    size_t count;
+    size_t pending;
+    size_t valid;
+
+    ecc_batch_done_fn done;
+    void *arg;
+
+    /* Workers inside the batch, and whether all items are done. Guarded by
+     * the pool lock. */
+    size_t refs;
+    int finished;
+    int queued;
+    struct _ecc_batch_t *next;
+
+    uint64_t ranges[];
+} ecc_batch_t;
+
+struct _ecc_pool_t {
+    size_t threads;
+    pthread_t *ids;
+
+    pthread_mutex_t lock;
+    pthread_cond_t work;
+    pthread_cond_t idle;
+
+    ecc_batch_t *head;
+    ecc_batch_t *tail;
+    int stop;
+};
+
+typedef struct {
+    ecc_pool_t *pool;
+    size_t index;
+} worker_arg_t;
+
+#define RANGE(begin, end) (((uint64_t) (begin) << 32) | (uint32_t) (end))
+#define RANGE_BEGIN(range) ((size_t) ((range) >> 32))
+#define RANGE_END(range) ((size_t) ((range) & 0xFFFFFFFF))
+
+// --- ranges ---
+
+// Take the first chunk of a range, returns 0 if it is empty
+static int range_pop(uint64_t *range, size_t *chunk) {
+    uint64_t cur = __atomic_load_n(range, __ATOMIC_ACQUIRE);
+
+    while (RANGE_BEGIN(cur) < RANGE_END(cur)) {
+        uint64_t next = RANGE(RANGE_BEGIN(cur) + 1, RANGE_END(cur));
+        if (__atomic_compare_exchange_n(range, &cur, next, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+            *chunk = RANGE_BEGIN(cur);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Take the upper half of another worker's range. The first stolen chunk is
+// returned, the rest becomes the thief's own range.
+static int range_steal(ecc_batch_t *batch, const size_t self, const size_t workers, size_t *chunk) {
+    for (size_t n = 1; n < workers; n++) {
+        uint64_t *victim = &batch->ranges[(self + n) % workers];
+        uint64_t cur = __atomic_load_n(victim, __ATOMIC_ACQUIRE);
+
+        while (RANGE_BEGIN(cur) < RANGE_END(cur)) {
+            size_t begin = RANGE_BEGIN(cur);
+            size_t end = RANGE_END(cur);
+            size_t mid = begin + (end - begin) / 2;
+
+            if (__atomic_compare_exchange_n(victim, &cur, RANGE(begin, mid), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+                __atomic_store_n(&batch->ranges[self], RANGE(mid + 1, end), __ATOMIC_RELEASE);
+                *chunk = mid;
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+// --- items ---
+
+// ecc_sign draws a fresh nonce for every item
+static void sign_item(ecc_batch_t *batch, const size_t i) {
+    ecc_sign(batch->privatekey, batch->hashes[i], &batch->signatures[i], batch->curve);
+}
+
+static void verify_item(ecc_batch_t *batch, const size_t i) {
+    batch->results[i] = ecc_verify(&batch->publickeys[i], batch->hashes[i], &batch->verify_signatures[i], batch->curve);
+}
+
+// --- pool ---
+
+// Drop a worker's reference, frees an asynchronous batch once it is done and
+// unused. Called with the pool lock held.
+static void batch_release(ecc_pool_t *pool, ecc_batch_t *batch) {
+    batch->refs--;
+    if (batch->finished && batch->refs == 0) {
+        if (batch->done) {
+            free(batch);
+        }
+        pthread_cond_broadcast(&pool->idle);
+    }
+}
+
+static void batch_unlink(ecc_pool_t *pool, ecc_batch_t *batch) {
+    ecc_batch_t **it = &pool->head;
+
+    if (!batch->queued) {
+        return;
+    }
+    while (*it != batch) {
+        it = &(*it)->next;
+    }
+    *it = batch->next;
+    if (pool->tail == batch) {
+        pool->tail = NULL;
+        for (ecc_batch_t *b = pool->head; b; b = b->next) {
+            pool->tail = b;
+        }
+    }
+    batch->queued = 0;
+}
+
+// Work on a batch until there is nothing left to take
+static void batch_run(ecc_pool_t *pool, ecc_batch_t *batch, const size_t self) {
+    size_t chunk;
+
+    while (range_pop(&batch->ranges[self], &chunk) || range_steal(batch, self, pool->threads, &chunk)) {
+        size_t first = chunk * ECC_BATCH_CHUNK;
+        size_t last = first + ECC_BATCH_CHUNK < batch->count ? first + ECC_BATCH_CHUNK : batch->count;
+        size_t valid = 0;
+
+        for (size_t i = first; i < last; i++) {
+            batch->item(batch, i);
+            valid += batch->results ? (batch->results[i] != 0) : 1;
+        }
+
+        __atomic_add_fetch(&batch->valid, valid, __ATOMIC_RELAXED);
+        if (__atomic_sub_fetch(&batch->pending, last - first, __ATOMIC_ACQ_REL) == 0) {
+            // The last chunk, the callback runs before the batch can go away
+            if (batch->done) {
+                batch->done(batch->arg, __atomic_load_n(&batch->valid, __ATOMIC_RELAXED));
+            }
+            pthread_mutex_lock(&pool->lock);
+            batch->finished = 1;
+            pthread_mutex_unlock(&pool->lock);
+        }
+    }
+}
+
+static void *pool_worker(void *data) {
+    worker_arg_t *warg = data;
+    ecc_pool_t *pool = warg->pool;
+    const size_t self = warg->index;
+    free(warg);
+
+    pthread_mutex_lock(&pool->lock);
+    while (!pool->stop) {
+        ecc_batch_t *batch = pool->head;
+        if (!batch) {
+            pthread_cond_wait(&pool->work, &pool->lock);
+            continue;
+        }
+
+        batch->refs++;
+        pthread_mutex_unlock(&pool->lock);
+
+        batch_run(pool, batch, self);
+
+        pthread_mutex_lock(&pool->lock);
+        // Nothing left to take, later workers go on to the next batch
+        batch_unlink(pool, batch);
+        batch_release(pool, batch);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+// Create a pool with |threads| workers, or one per CPU if |threads| is 0
+ecc_pool_t *ecc_pool_create(const size_t threads) {
+    ecc_pool_t *pool = calloc(1, sizeof(ecc_pool_t));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->threads = threads;
+    if (!pool->threads) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        pool->threads = cpus > 0 ? cpus : 1;
+    }
+
+    pool->ids = calloc(pool->threads, sizeof(pthread_t));
+    if (!pool->ids) {
+        free(pool);
+        return NULL;
+    }
+
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->work, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+
+    for (size_t t = 0; t < pool->threads; t++) {
+        worker_arg_t *warg = malloc(sizeof(worker_arg_t));
+        if (warg) {
+            warg->pool = pool;
+            warg->index = t;
+        }
+        if (!warg || pthread_create(&pool->ids[t], NULL, pool_worker, warg) != 0) {
+            free(warg);
+            pool->threads = t;
+            ecc_pool_destroy(pool);
+            return NULL;
+        }
+    }
+    return pool;
+}
+
+// Stop the workers and free the pool. Batches still running are finished
+// first, the pool must not be used for new batches while this runs.
+void ecc_pool_destroy(ecc_pool_t *pool) {
+    if (!pool) {
+        return;
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->head) {
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    }
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->work);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (size_t t = 0; t < pool->threads; t++) {
+        pthread_join(pool->ids[t], NULL);
+    }
+
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->work);
+    pthread_mutex_destroy(&pool->lock);
+    free(pool->ids);
+    free(pool);
+}
+
+size_t ecc_pool_threads(const ecc_pool_t *pool) {
+    return pool->threads;
+}
+
+static ecc_pool_t *default_pool = NULL;
+static pthread_once_t default_pool_once = PTHREAD_ONCE_INIT;
+
+static void default_pool_init(void) {
+    default_pool = ecc_pool_create(0);
+}
+
+// Queue a batch and, without a callback, wait until it is done
+static int batch_submit(ecc_pool_t *pool, ecc_batch_t *batch) {
+    const size_t chunks = (batch->count + ECC_BATCH_CHUNK - 1) / ECC_BATCH_CHUNK;
+
+    if (!pool) {
+        pthread_once(&default_pool_once, default_pool_init);
+        pool = default_pool;
+    }
+    if (!pool || chunks > UINT32_MAX) {
+        return 0;
+    }
+
+    if (batch->count == 0) {
+        if (batch->done) {
+            batch->done(batch->arg, 0);
+            free(batch);
+        }
+        return 1;
+    }
+
+    // Even split of the chunks over the workers
+    for (size_t t = 0; t < pool->threads; t++) {
+        batch->ranges[t] = RANGE(chunks * t / pool->threads, chunks * (t + 1) / pool->threads);
+    }
+    batch->pending = batch->count;
+
+    pthread_mutex_lock(&pool->lock);
+    batch->queued = 1;
+    if (pool->tail) {
+        pool->tail->next = batch;
+    } else {
+        pool->head = batch;
+    }
+    pool->tail = batch;
+    pthread_cond_broadcast(&pool->work);
+
+    if (!batch->done) {
+        while (!batch->finished || batch->refs > 0) {
+            pthread_cond_wait(&pool->idle, &pool->lock);
+        }
+        batch_unlink(pool, batch);
+        pthread_cond_broadcast(&pool->idle);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return 1;
+}
+
+static ecc_batch_t *batch_alloc(ecc_pool_t *pool) {
+    if (!pool) {
+        pthread_once(&default_pool_once, default_pool_init);
+        pool = default_pool;
+    }
+    if (!pool) {
+        return NULL;
+    }
+    return calloc(1, sizeof(ecc_batch_t) + pool->threads * sizeof(uint64_t));
+}
+
+// Sign |count| hashes with the same private key on |pool|, or on a shared
+// pool with one worker per CPU if |pool| is NULL. Signatures are written in
+// the order of the hashes. Without |done| this returns when all are signed,
+// with |done| it returns right away and |done| is called when they are; the
+// buffers must stay valid until then. Returns 0 if the batch could not be
+// queued.
+int ecc_sign_batch(ecc_pool_t *pool, const eccint_t *privatekey, const eccint_keyptr_t *hashes, eccint_signature_t *signatures, const size_t count, const curve_t *curve, ecc_batch_done_fn done, void *arg) {
+    ecc_batch_t *batch = batch_alloc(pool);
+    if (!batch) {
+        return 0;
+    }
+
+    batch->item = sign_item;
+    batch->privatekey = privatekey;
+    batch->hashes = hashes;
+    batch->signatures = signatures;
+    batch->count = count;
+    batch->curve = curve;
+    batch->done = done;
+    batch->arg = arg;
+
+    if (!batch_submit(pool, batch)) {
+        free(batch);
+        return 0;
+    }
+    if (!done) {
+        free(batch);
+    }
+    return 1;
+}
+
+// Verify |count| signatures, each against its own public key. results[i] is
+// set to the result of ecc_verify for item i. Otherwise as ecc_sign_batch.
+int ecc_verify_batch_parallel(ecc_pool_t *pool, const eccint_point_t *publickeys, const eccint_keyptr_t *hashes, const eccint_signature_t *signatures, int *results, const size_t count, const curve_t *curve, ecc_batch_done_fn done, void *arg) {
+    ecc_batch_t *batch = batch_alloc(pool);
+    if (!batch) {
+        return 0;
+    }
+
+    batch->item = verify_item;
+    batch->publickeys = publickeys;
+    batch->hashes = hashes;
+    batch->verify_signatures = signatures;
+    batch->results = results;
+    batch->count = count;
+    batch->curve = curve;
+    batch->done = done;
+    batch->arg = arg;
+
+    if (!batch_submit(pool, batch)) {
+        free(batch);
+        return 0;
+    }
+    if (!done) {
+        free(batch);
+    }
+    return 1;
+}
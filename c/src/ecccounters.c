@@ -0,0 +1,89 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <string.h>
+
+#include "ecctypes.h"
+#include "ecccounters.h"
+
+#ifdef ECC_COUNTERS
+// Running counts of this thread
+_Thread_local ecc_counters_t ecc_counters;
+
+// Counts of the last call and the sum over all calls, per operation
+static _Thread_local ecc_counters_t counters_last[ECC_COUNTERS_OPS];
+static _Thread_local ecc_counters_t counters_total[ECC_COUNTERS_OPS];
+static _Thread_local uint64_t counters_calls[ECC_COUNTERS_OPS];
+
+#define COUNTERS_FIELDS (sizeof(ecc_counters_t) / sizeof(uint64_t))
+#endif
+
+// Record the counts of an operation that started when the running counts
+// were |start|
+void ecc_counters_end(const ecc_counters_op_t op, const ecc_counters_t *start) {
+#ifdef ECC_COUNTERS
+    const uint64_t *now = (const uint64_t *) &ecc_counters;
+    const uint64_t *before = (const uint64_t *) start;
+    uint64_t *last = (uint64_t *) &counters_last[op];
+    uint64_t *total = (uint64_t *) &counters_total[op];
+
+    for (size_t i = 0; i < COUNTERS_FIELDS; i++) {
+        last[i] = now[i] - before[i];
+        total[i] += last[i];
+    }
+    counters_calls[op]++;
+#else
+    (void) op;
+    (void) start;
+#endif
+}
+
+// Counts of the last call of |op| on this thread, and the sum and number of
+// calls since the last reset. Any of the outputs may be NULL. Returns 0 if
+// the library was built without counters, the outputs are zeroed then.
+int ecc_counters_get(const ecc_counters_op_t op, ecc_counters_t *last, ecc_counters_t *total, uint64_t *calls) {
+#ifdef ECC_COUNTERS
+    if (last) {
+        *last = counters_last[op];
+    }
+    if (total) {
+        *total = counters_total[op];
+    }
+    if (calls) {
+        *calls = counters_calls[op];
+    }
+    return 1;
+#else
+    (void) op;
+    if (last) {
+        memset(last, 0, sizeof(*last));
+    }
+    if (total) {
+        memset(total, 0, sizeof(*total));
+    }
+    if (calls) {
+        *calls = 0;
+    }
+    return 0;
+#endif
+}
+
+// Reset all counts of this thread
+void ecc_counters_reset(void) {
+#ifdef ECC_COUNTERS
+    memset(&ecc_counters, 0, sizeof(ecc_counters));
+    memset(counters_last, 0, sizeof(counters_last));
+    memset(counters_total, 0, sizeof(counters_total));
+    memset(counters_calls, 0, sizeof(counters_calls));
+#endif
+}
+
+void ecc_counters_print(const char *prefix, const ecc_counters_t *counters) {
+    printf("%sM = %llu, S = %llu, I = %llu, R = %llu, A = %llu, D = %llu, H = %llu\n", prefix,
+           (unsigned long long) counters->mul, (unsigned long long) counters->square,
+           (unsigned long long) counters->inv, (unsigned long long) counters->reduce,
+           (unsigned long long) counters->point_add, (unsigned long long) counters->point_double,
+           (unsigned long long) counters->point_halve);
+}
@@ -0,0 +1,341 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "ecctypes.h"
+#include "eccmath.h"
+#include "eccmemory.h"
+#include "eccdispatch.h"
+#include "ecdsa.h"
+
+// --- backends ---
+
+typedef struct {
+    const char *name;
+    void (*fn)(void);
+    int (*supported)(void);
+} backend_t;
+
+#define BACKEND(name, fn) { name, (void (*)(void)) fn, NULL }
+#define BACKEND_IF(name, fn, supported) { name, (void (*)(void)) fn, supported }
+
+#if defined(__x86_64__)
+// The CPU features are looked up once, ecc_dispatch_default runs on every
+// field operation
+static pthread_once_t cpu_once = PTHREAD_ONCE_INIT;
+static int cpu_pclmul;
+
+static void cpu_detect(void) {
+    __builtin_cpu_init();
+    cpu_pclmul = __builtin_cpu_supports("pclmul");
+}
+
+static int have_pclmul(void) {
+    pthread_once(&cpu_once, cpu_detect);
+    return cpu_pclmul;
+}
+#endif
+
+// The first entry of each list is the reference the others are checked against
+static const backend_t mul_backends[] = {
+    BACKEND("shiftnadd", eccint_shiftnadd_mul),
+    BACKEND("comb", eccint_comb_mul),
+#if defined(__x86_64__)
+    BACKEND_IF("clmul", eccint_clmul_mul, have_pclmul),
+    BACKEND_IF("karatsuba", eccint_karatsuba_mul, have_pclmul),
+#endif
+    { NULL }
+};
+
+static const backend_t reduce_backends[] = {
+    BACKEND("general", eccint_general_reduce),
+    BACKEND("shifted", eccint_shifted_reduce),
+    BACKEND("fast", eccint_fast_reduce),
+    { NULL }
+};
+
+static const backend_t div_mod_backends[] = {
+    BACKEND("sun", eccint_binary_sun_div_mod),
+    BACKEND("book", eccint_binary_book_div_mod),
+    { NULL }
+};
+
+static const backend_t point_double_backends[] = {
+    BACKEND("book", eccint_book_point_double),
+    { NULL }
+};
+
+static const backend_t point_add_backends[] = {
+    BACKEND("book", eccint_book_point_add),
+    { NULL }
+};
+
+static const backend_t point_mul_backends[] = {
+    BACKEND("doublenadd", eccint_binary_doublenadd_mul),
+    BACKEND("ladder", eccint_montgomery_ladder_point_mul),
+    BACKEND("halving", eccint_halving_point_mul),
+    { NULL }
+};
+
+static const ecc_dispatch_t dispatch_generic = {
+    .mul = eccint_comb_mul,
+    .reduce = eccint_shifted_reduce,
+    .div_mod = eccint_binary_sun_div_mod,
+    .point_double = eccint_book_point_double,
+    .point_add = eccint_book_point_add,
+    .point_mul = eccint_binary_doublenadd_mul,
+
+    .mul_name = "comb",
+    .reduce_name = "shifted",
+    .div_mod_name = "sun",
+    .point_double_name = "book",
+    .point_add_name = "book",
+    .point_mul_name = "doublenadd"
+};
+
+#if defined(__x86_64__)
+static const ecc_dispatch_t dispatch_clmul = {
+    .mul = eccint_clmul_mul,
+    .reduce = eccint_shifted_reduce,
+    .div_mod = eccint_binary_sun_div_mod,
+    .point_double = eccint_book_point_double,
+    .point_add = eccint_book_point_add,
+    .point_mul = eccint_binary_doublenadd_mul,
+
+    .mul_name = "clmul",
+    .reduce_name = "shifted",
+    .div_mod_name = "sun",
+    .point_double_name = "book",
+    .point_add_name = "book",
+    .point_mul_name = "doublenadd"
+};
+#endif
+
+static pthread_once_t dispatch_once = PTHREAD_ONCE_INIT;
+static const ecc_dispatch_t *dispatch_host = &dispatch_generic;
+
+static void dispatch_detect(void) {
+#if defined(__x86_64__)
+    if (have_pclmul()) {
+        dispatch_host = &dispatch_clmul;
+    }
+#endif
+}
+
+// Default algorithms for this host, based on the CPU features
+const ecc_dispatch_t *ecc_dispatch_default(void) {
+    pthread_once(&dispatch_once, dispatch_detect);
+    return dispatch_host;
+}
+
+static const backend_t *backends_for(const char *op) {
+    if (strcmp(op, ECC_OP_MUL) == 0) {
+        return mul_backends;
+    } else if (strcmp(op, ECC_OP_REDUCE) == 0) {
+        return reduce_backends;
+    } else if (strcmp(op, ECC_OP_DIV_MOD) == 0) {
+        return div_mod_backends;
+    } else if (strcmp(op, ECC_OP_POINT_DOUBLE) == 0) {
+        return point_double_backends;
+    } else if (strcmp(op, ECC_OP_POINT_ADD) == 0) {
+        return point_add_backends;
+    } else if (strcmp(op, ECC_OP_POINT_MUL) == 0) {
+        return point_mul_backends;
+    }
+    return NULL;
+}
+
+static void dispatch_set(ecc_dispatch_t *dispatch, const char *op, const backend_t *backend) {
+    if (strcmp(op, ECC_OP_MUL) == 0) {
+        dispatch->mul = (ecc_mul_fn) backend->fn;
+        dispatch->mul_name = backend->name;
+    } else if (strcmp(op, ECC_OP_REDUCE) == 0) {
+        dispatch->reduce = (ecc_reduce_fn) backend->fn;
+        dispatch->reduce_name = backend->name;
+    } else if (strcmp(op, ECC_OP_DIV_MOD) == 0) {
+        dispatch->div_mod = (ecc_div_mod_fn) backend->fn;
+        dispatch->div_mod_name = backend->name;
+    } else if (strcmp(op, ECC_OP_POINT_DOUBLE) == 0) {
+        dispatch->point_double = (ecc_point_double_fn) backend->fn;
+        dispatch->point_double_name = backend->name;
+    } else if (strcmp(op, ECC_OP_POINT_ADD) == 0) {
+        dispatch->point_add = (ecc_point_add_fn) backend->fn;
+        dispatch->point_add_name = backend->name;
+    } else if (strcmp(op, ECC_OP_POINT_MUL) == 0) {
+        dispatch->point_mul = (ecc_point_mul_fn) backend->fn;
+        dispatch->point_mul_name = backend->name;
+    }
+}
+
+// Select a backend for an operation by name. Returns 0 if the operation or
+// backend is unknown, or the backend is not supported on this host.
+int ecc_dispatch_select(ecc_dispatch_t *dispatch, const char *op, const char *name) {
+    const backend_t *backend = backends_for(op);
+    if (!backend) {
+        return 0;
+    }
+
+    for (; backend->name; backend++) {
+        if (strcmp(backend->name, name) == 0) {
+            if (backend->supported && !backend->supported()) {
+                return 0;
+            }
+            dispatch_set(dispatch, op, backend);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// List the backends available on this host for an operation. Returns the
+// number of backends, at most |max| names are written.
+size_t ecc_dispatch_backends(const char *op, const char **names, const size_t max) {
+    const backend_t *backend = backends_for(op);
+    size_t count = 0;
+
+    for (; backend && backend->name; backend++) {
+        if (backend->supported && !backend->supported()) {
+            continue;
+        }
+        if (count < max) {
+            names[count] = backend->name;
+        }
+        count++;
+    }
+    return count;
+}
+
+// --- autotuner ---
+
+#define AUTOTUNE_SAMPLES 4
+
+static double autotune_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Random field element
+static void autotune_element(eccint_t *a, const curve_t *curve) {
+    eccint_set(a, 0, KEYSIZE);
+    eccint_urand(a, curve->words);
+    for (size_t i = curve->m; i < 8 * curve->words; i++) {
+        eccint_setbit(a, i, 0);
+    }
+    if (eccint_testzero(a, curve->words)) {
+        a[0] = 1;
+    }
+}
+
+// Run one operation with the backend installed in |curve|, on the inputs for
+// sample |i|. The output is written to |out|, which holds two points.
+static void autotune_run(const char *op, const curve_t *curve, const eccint_t (*in)[KEYSIZE], const eccint_point_t *points, size_t i, eccint_t *out) {
+    const ecc_dispatch_t *d = curve->dispatch;
+    eccint_t product[2 * KEYSIZE];
+    eccint_point_t *pres = (eccint_point_t *) out;
+
+    if (strcmp(op, ECC_OP_MUL) == 0) {
+        d->mul(in[2 * i], in[2 * i + 1], out, curve);
+    } else if (strcmp(op, ECC_OP_REDUCE) == 0) {
+        eccint_shiftnadd_mul(in[2 * i], in[2 * i + 1], product, curve);
+        d->reduce(product, out, curve);
+    } else if (strcmp(op, ECC_OP_DIV_MOD) == 0) {
+        d->div_mod(in[2 * i], in[2 * i + 1], curve->q, out, curve);
+    } else if (strcmp(op, ECC_OP_POINT_DOUBLE) == 0) {
+        d->point_double(&points[i], pres, curve);
+    } else if (strcmp(op, ECC_OP_POINT_ADD) == 0) {
+        d->point_add(&points[i], &points[(i + 1) % AUTOTUNE_SAMPLES], pres, curve);
+    } else if (strcmp(op, ECC_OP_POINT_MUL) == 0) {
+        d->point_mul(in[2 * i], &curve->P, pres, curve);
+    }
+}
+
+static size_t autotune_outsize(const char *op, const curve_t *curve) {
+    if (strcmp(op, ECC_OP_MUL) == 0) {
+        return 2 * curve->words;
+    } else if (strncmp(op, "point_", 6) == 0) {
+        return sizeof(eccint_point_t);
+    }
+    return curve->words;
+}
+
+static void autotune_op(ecc_dispatch_t *dispatch, curve_t *tuning, const char *op, const eccint_t (*in)[KEYSIZE], const eccint_point_t *points) {
+    const backend_t *backend = backends_for(op);
+    const size_t outsize = autotune_outsize(op, tuning);
+    eccint_t expected[AUTOTUNE_SAMPLES][sizeof(eccint_point_t)];
+    eccint_t out[sizeof(eccint_point_t)];
+    const backend_t *best = NULL;
+    double besttime = 0;
+
+    for (const backend_t *cur = backend; cur->name; cur++) {
+        if (cur->supported && !cur->supported()) {
+            continue;
+        }
+        dispatch_set(dispatch, op, cur);
+
+        // Check the candidate against the reference before timing it
+        int correct = 1;
+        for (size_t i = 0; i < AUTOTUNE_SAMPLES; i++) {
+            eccint_set(out, 0, sizeof(out));
+            autotune_run(op, tuning, in, points, i, out);
+            if (cur == backend) {
+                memcpy(expected[i], out, outsize);
+            } else if (memcmp(expected[i], out, outsize) != 0) {
+                correct = 0;
+            }
+        }
+        if (!correct) {
+            continue;
+        }
+
+        // Time until at least 5ms have passed, take the time per run
+        size_t runs = 0;
+        double start = autotune_now();
+        double elapsed;
+        do {
+            autotune_run(op, tuning, in, points, runs % AUTOTUNE_SAMPLES, out);
+            runs++;
+            elapsed = autotune_now() - start;
+        } while (elapsed < 0.005);
+
+        if (!best || elapsed / runs < besttime) {
+            best = cur;
+            besttime = elapsed / runs;
+        }
+    }
+
+    dispatch_set(dispatch, op, best);
+}
+
+// Micro-benchmark the backends for each operation on this curve and fill
+// |dispatch| with the fastest correct ones. Field operations are tuned first,
+// so the point operations are timed on top of the chosen field arithmetic.
+// Install the result by pointing curve->dispatch at it.
+void ecc_dispatch_autotune(ecc_dispatch_t *dispatch, const curve_t *curve) {
+    static const char *ops[] = {
+        ECC_OP_MUL, ECC_OP_REDUCE, ECC_OP_DIV_MOD,
+        ECC_OP_POINT_DOUBLE, ECC_OP_POINT_ADD, ECC_OP_POINT_MUL
+    };
+    eccint_t in[2 * AUTOTUNE_SAMPLES][KEYSIZE];
+    eccint_point_t points[AUTOTUNE_SAMPLES];
+    curve_t tuning = *curve;
+
+    *dispatch = *ecc_dispatch(curve);
+    tuning.dispatch = dispatch;
+
+    for (size_t i = 0; i < 2 * AUTOTUNE_SAMPLES; i++) {
+        autotune_element(in[i], curve);
+    }
+    for (size_t i = 0; i < AUTOTUNE_SAMPLES; i++) {
+        eccint_point_mul(in[i], &curve->P, &points[i], &tuning);
+    }
+
+    for (size_t i = 0; i < sizeof(ops) / sizeof(ops[0]); i++) {
+        autotune_op(dispatch, &tuning, ops[i], (const eccint_t (*)[KEYSIZE]) in, points);
+    }
+}
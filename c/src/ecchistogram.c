@@ -0,0 +1,264 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+
+#include "ecchistogram.h"
+
+// Each thread records into its own histograms, which are linked into a list
+// so snapshots can merge them. Only the owning thread writes to them; the
+// counts are read and written with relaxed atomics so snapshots from other
+// threads see whole values.
+typedef struct _thread_histograms_t {
+    ecc_histogram_t phases[ECC_PHASES];
+    struct _thread_histograms_t *next;
+} thread_histograms_t;
+
+static int histogram_enabled = 0;
+
+static pthread_mutex_t histogram_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t histogram_once = PTHREAD_ONCE_INIT;
+static pthread_key_t histogram_key;
+
+static thread_histograms_t *histogram_threads = NULL;
+
+// Counts of threads that have exited
+static ecc_histogram_t histogram_retired[ECC_PHASES];
+
+static _Thread_local thread_histograms_t *histogram_local = NULL;
+
+static void histogram_add(ecc_histogram_t *dst, const ecc_histogram_t *src) {
+    dst->count += __atomic_load_n(&src->count, __ATOMIC_RELAXED);
+    dst->sum += __atomic_load_n(&src->sum, __ATOMIC_RELAXED);
+
+    uint64_t max = __atomic_load_n(&src->max, __ATOMIC_RELAXED);
+    if (max > dst->max) {
+        dst->max = max;
+    }
+    for (size_t i = 0; i < ECC_HISTOGRAM_BUCKETS; i++) {
+        dst->buckets[i] += __atomic_load_n(&src->buckets[i], __ATOMIC_RELAXED);
+    }
+}
+
+// Fold the histograms of an exiting thread into the retired counts
+static void histogram_thread_exit(void *data) {
+    thread_histograms_t *local = data;
+
+    pthread_mutex_lock(&histogram_lock);
+    for (thread_histograms_t **it = &histogram_threads; *it; it = &(*it)->next) {
+        if (*it == local) {
+            *it = local->next;
+            break;
+        }
+    }
+    for (size_t p = 0; p < ECC_PHASES; p++) {
+        histogram_add(&histogram_retired[p], &local->phases[p]);
+    }
+    pthread_mutex_unlock(&histogram_lock);
+
+    free(local);
+}
+
+static void histogram_init(void) {
+    pthread_key_create(&histogram_key, histogram_thread_exit);
+}
+
+static thread_histograms_t *histogram_thread(void) {
+    if (histogram_local) {
+        return histogram_local;
+    }
+
+    pthread_once(&histogram_once, histogram_init);
+
+    thread_histograms_t *local = calloc(1, sizeof(thread_histograms_t));
+    if (!local) {
+        return NULL;
+    }
+
+    pthread_mutex_lock(&histogram_lock);
+    local->next = histogram_threads;
+    histogram_threads = local;
+    pthread_mutex_unlock(&histogram_lock);
+
+    pthread_setspecific(histogram_key, local);
+    histogram_local = local;
+    return local;
+}
+
+static size_t histogram_bucket(uint64_t value) {
+    const uint64_t limit = (UINT64_C(1) << (ECC_HISTOGRAM_MAX_EXP + 1)) - 1;
+
+    if (value < (1 << ECC_HISTOGRAM_SUB_BITS)) {
+        return value;
+    }
+    if (value > limit) {
+        value = limit;
+    }
+
+    // The exponent selects the power of two, the bits below the leading one
+    // the bucket inside it
+    int exp = 63 - __builtin_clzll(value);
+    size_t sub = (value >> (exp - ECC_HISTOGRAM_SUB_BITS)) & ((1 << ECC_HISTOGRAM_SUB_BITS) - 1);
+    return ((exp - ECC_HISTOGRAM_SUB_BITS + 1) << ECC_HISTOGRAM_SUB_BITS) + sub;
+}
+
+// Largest value that falls into the bucket
+static uint64_t histogram_bucket_value(const size_t bucket) {
+    if (bucket < (1 << ECC_HISTOGRAM_SUB_BITS)) {
+        return bucket;
+    }
+
+    int exp = (bucket >> ECC_HISTOGRAM_SUB_BITS) + ECC_HISTOGRAM_SUB_BITS - 1;
+    uint64_t sub = bucket & ((1 << ECC_HISTOGRAM_SUB_BITS) - 1);
+    uint64_t low = ((UINT64_C(1) << ECC_HISTOGRAM_SUB_BITS) + sub) << (exp - ECC_HISTOGRAM_SUB_BITS);
+    return low + (UINT64_C(1) << (exp - ECC_HISTOGRAM_SUB_BITS)) - 1;
+}
+
+// Turn recording on or off for all threads. It is off by default, then the
+// phases only cost a load and a branch.
+void ecc_histogram_enable(const int enable) {
+    __atomic_store_n(&histogram_enabled, enable, __ATOMIC_RELAXED);
+}
+
+int ecc_histogram_enabled(void) {
+    return __atomic_load_n(&histogram_enabled, __ATOMIC_RELAXED);
+}
+
+// Start of a phase in nanoseconds, or 0 if recording is off
+uint64_t ecc_histogram_now(void) {
+    struct timespec ts;
+
+    if (!ecc_histogram_enabled()) {
+        return 0;
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Record the time since |start| for |phase| and return the current time, so
+// consecutive phases can be chained. Does nothing if |start| is 0.
+uint64_t ecc_histogram_lap(const ecc_phase_t phase, const uint64_t start) {
+    if (!start) {
+        return 0;
+    }
+
+    uint64_t now = ecc_histogram_now();
+    thread_histograms_t *local = histogram_thread();
+    if (!now || !local) {
+        return now;
+    }
+
+    ecc_histogram_t *h = &local->phases[phase];
+    uint64_t value = now - start;
+    size_t bucket = histogram_bucket(value);
+
+    __atomic_store_n(&h->buckets[bucket], h->buckets[bucket] + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->count, h->count + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&h->sum, h->sum + value, __ATOMIC_RELAXED);
+    if (value > h->max) {
+        __atomic_store_n(&h->max, value, __ATOMIC_RELAXED);
+    }
+    return now;
+}
+
+// Merge the histograms of all threads, including those that have exited.
+// Phases being recorded while the snapshot is taken may be partly included.
+void ecc_histogram_snapshot(ecc_histogram_snapshot_t *snapshot) {
+    memset(snapshot, 0, sizeof(*snapshot));
+
+    pthread_mutex_lock(&histogram_lock);
+    for (size_t p = 0; p < ECC_PHASES; p++) {
+        histogram_add(&snapshot->phases[p], &histogram_retired[p]);
+    }
+    for (thread_histograms_t *it = histogram_threads; it; it = it->next) {
+        for (size_t p = 0; p < ECC_PHASES; p++) {
+            histogram_add(&snapshot->phases[p], &it->phases[p]);
+        }
+    }
+    pthread_mutex_unlock(&histogram_lock);
+}
+
+// Clear all histograms. Values recorded concurrently may survive the reset.
+void ecc_histogram_reset(void) {
+    pthread_mutex_lock(&histogram_lock);
+    memset(histogram_retired, 0, sizeof(histogram_retired));
+    for (thread_histograms_t *it = histogram_threads; it; it = it->next) {
+        for (size_t p = 0; p < ECC_PHASES; p++) {
+            ecc_histogram_t *h = &it->phases[p];
+            __atomic_store_n(&h->count, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&h->sum, 0, __ATOMIC_RELAXED);
+            __atomic_store_n(&h->max, 0, __ATOMIC_RELAXED);
+            for (size_t i = 0; i < ECC_HISTOGRAM_BUCKETS; i++) {
+                __atomic_store_n(&h->buckets[i], 0, __ATOMIC_RELAXED);
+            }
+        }
+    }
+    pthread_mutex_unlock(&histogram_lock);
+}
+
+// Value at |percentile| (0 to 100), accurate to the bucket width. Returns 0
+// for an empty histogram.
+uint64_t ecc_histogram_percentile(const ecc_histogram_t *histogram, const double percentile) {
+    uint64_t rank = (uint64_t) (percentile / 100.0 * histogram->count + 0.5);
+    uint64_t seen = 0;
+
+    if (!histogram->count) {
+        return 0;
+    }
+    if (rank < 1) {
+        rank = 1;
+    }
+
+    for (size_t i = 0; i < ECC_HISTOGRAM_BUCKETS; i++) {
+        seen += histogram->buckets[i];
+        if (seen >= rank) {
+            uint64_t value = histogram_bucket_value(i);
+            return value < histogram->max ? value : histogram->max;
+        }
+    }
+    return histogram->max;
+}
+
+const char *ecc_histogram_phase_name(const ecc_phase_t phase) {
+    static const char *names[ECC_PHASES] = {
+        "nonce", "kp", "r", "scalar", "inv", "msm", "compare", "sign", "verify"
+    };
+    return phase < ECC_PHASES ? names[phase] : "unknown";
+}
+
+// Write the snapshot as text in the Prometheus exposition format, one summary
+// per phase. Returns the length of the full text like snprintf, so a result
+// of |size| or more means it was cut off.
+size_t ecc_histogram_format(const ecc_histogram_snapshot_t *snapshot, char *buf, const size_t size) {
+    static const double quantiles[] = { 50, 90, 99, 99.9 };
+    size_t len = 0;
+
+#define APPEND(...) do { \
+        int n = snprintf(buf + (len < size ? len : size), len < size ? size - len : 0, __VA_ARGS__); \
+        len += n > 0 ? n : 0; \
+    } while (0)
+
+    APPEND("# HELP ecc_phase_latency_ns Latency of the phases of ECDSA sign and verify\n");
+    APPEND("# TYPE ecc_phase_latency_ns summary\n");
+    for (size_t p = 0; p < ECC_PHASES; p++) {
+        const ecc_histogram_t *h = &snapshot->phases[p];
+        const char *name = ecc_histogram_phase_name(p);
+
+        for (size_t q = 0; q < sizeof(quantiles) / sizeof(quantiles[0]); q++) {
+            APPEND("ecc_phase_latency_ns{phase=\"%s\",quantile=\"%g\"} %llu\n", name, quantiles[q] / 100,
+                   (unsigned long long) ecc_histogram_percentile(h, quantiles[q]));
+        }
+        APPEND("ecc_phase_latency_ns{phase=\"%s\",quantile=\"1\"} %llu\n", name, (unsigned long long) h->max);
+        APPEND("ecc_phase_latency_ns_sum{phase=\"%s\"} %llu\n", name, (unsigned long long) h->sum);
+        APPEND("ecc_phase_latency_ns_count{phase=\"%s\"} %llu\n", name, (unsigned long long) h->count);
+    }
+
+#undef APPEND
+    return len;
+}
@@ -0,0 +1,129 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "ecctypes.h"
+#include "eccmemory.h"
+#include "ecdsa.h"
+#include "ecckeycache.h"
+
+#define FNV_OFFSET 0xCBF29CE484222325ULL
+#define FNV_PRIME 0x100000001B3ULL
+
+// |tag| is the key hash with the low bit set, zero marks an empty entry
+typedef struct {
+    uint64_t tag;
+    eccint_point_t key;
+} keycache_entry_t;
+
+typedef struct {
+    keycache_entry_t entries[ECC_KEYCACHE_WAYS];
+    size_t next;
+} keycache_set_t;
+
+struct _ecc_keycache_t {
+    pthread_mutex_t lock;
+    keycache_set_t *sets;
+    size_t mask;
+    uint64_t hits;
+    uint64_t misses;
+    const curve_t *curve;
+};
+
+static uint64_t keycache_hash(const eccint_point_t *key, const size_t words) {
+    uint64_t hash = FNV_OFFSET;
+    for (size_t i = 0; i < words; i++) {
+        hash = (hash ^ key->x[i]) * FNV_PRIME;
+    }
+    for (size_t i = 0; i < words; i++) {
+        hash = (hash ^ key->y[i]) * FNV_PRIME;
+    }
+    return hash | 1;
+}
+
+// Create a cache for at least |capacity| keys
+ecc_keycache_t *ecc_keycache_create(const size_t capacity, const curve_t *curve) {
+    size_t sets = 1;
+
+    while (sets * ECC_KEYCACHE_WAYS < capacity) {
+        sets <<= 1;
+    }
+
+    ecc_keycache_t *cache = calloc(1, sizeof(ecc_keycache_t));
+    if (!cache) {
+        return NULL;
+    }
+    cache->sets = calloc(sets, sizeof(keycache_set_t));
+    if (!cache->sets) {
+        free(cache);
+        return NULL;
+    }
+    cache->mask = sets - 1;
+    cache->curve = curve;
+    pthread_mutex_init(&cache->lock, NULL);
+    return cache;
+}
+
+void ecc_keycache_destroy(ecc_keycache_t *cache) {
+    if (!cache) {
+        return;
+    }
+    pthread_mutex_destroy(&cache->lock);
+    free(cache->sets);
+    free(cache);
+}
+
+// Validate a public key, or find it among the keys validated before. The
+// validation itself runs outside the lock, so two threads seeing a new key
+// at the same time may both validate it.
+int ecc_keycache_validate(ecc_keycache_t *cache, const eccint_point_t *publickey) {
+    const size_t words = cache->curve->words;
+    const uint64_t tag = keycache_hash(publickey, words);
+    keycache_set_t *set = &cache->sets[(tag >> 1) & cache->mask];
+
+    pthread_mutex_lock(&cache->lock);
+    for (size_t i = 0; i < ECC_KEYCACHE_WAYS; i++) {
+        const keycache_entry_t *entry = &set->entries[i];
+        if (entry->tag == tag && eccint_point_cmp(&entry->key, publickey, words) == 0) {
+            cache->hits++;
+            pthread_mutex_unlock(&cache->lock);
+            return 1;
+        }
+    }
+    cache->misses++;
+    pthread_mutex_unlock(&cache->lock);
+
+    if (!ecc_validate_publickey(publickey, cache->curve)) {
+        return 0;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    keycache_entry_t *entry = &set->entries[set->next];
+    set->next = (set->next + 1) % ECC_KEYCACHE_WAYS;
+    entry->tag = tag;
+    eccint_point_cpy(&entry->key, publickey, words);
+    pthread_mutex_unlock(&cache->lock);
+    return 1;
+}
+
+// Verify a signature with a key that may not be trusted yet. The key is
+// validated on its first use only.
+int ecc_verify_validated(ecc_keycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature) {
+    return ecc_keycache_validate(cache, publickey) && ecc_verify(publickey, hash, signature, cache->curve);
+}
+
+void ecc_keycache_stats(ecc_keycache_t *cache, uint64_t *hits, uint64_t *misses) {
+    pthread_mutex_lock(&cache->lock);
+    if (hits) {
+        *hits = cache->hits;
+    }
+    if (misses) {
+        *misses = cache->misses;
+    }
+    pthread_mutex_unlock(&cache->lock);
+}
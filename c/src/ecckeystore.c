@@ -0,0 +1,240 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ecctypes.h"
+#include "eccmath.h"
+#include "eccmemory.h"
+#include "eccprecomp.h"
+#include "ecckeystore.h"
+#include "ecdsa.h"
+
+#define KEYSTORE_ALIGN(x) (((x) + 63) & ~((uint64_t) 63))
+
+// Finalizer of splitmix64, spreads sequential ids over the index
+static uint64_t keystore_hash(uint64_t id) {
+    id ^= id >> 30;
+    id *= 0xBF58476D1CE4E5B9ULL;
+    id ^= id >> 27;
+    id *= 0x94D049BB133111EBULL;
+    id ^= id >> 31;
+    return id;
+}
+
+// Fill in the header for |count| keys, returns 0 if that many don't fit the
+// index. The count of a mapped file is checked here before anything else.
+static int keystore_layout(ecc_keystore_header_t *header, const uint64_t count, const curve_t *curve) {
+    uint32_t slots = 16;
+
+    if (count > ECC_KEYSTORE_MAX_KEYS) {
+        return 0;
+    }
+
+    // Keep the load factor at or below one half
+    while (slots < 2 * count) {
+        slots <<= 1;
+    }
+
+    memcpy(header->magic, ECC_KEYSTORE_MAGIC, sizeof(header->magic));
+    header->version = ECC_KEYSTORE_VERSION;
+    header->stride = (curve->m + 7) / 8;
+    header->m = curve->m;
+    header->slots = slots;
+    header->count = count;
+    header->curve_id = ecc_curve_fingerprint(curve);
+
+    header->ids_offset = KEYSTORE_ALIGN(sizeof(ecc_keystore_header_t));
+    header->x_offset = KEYSTORE_ALIGN(header->ids_offset + count * sizeof(uint64_t));
+    header->flags_offset = KEYSTORE_ALIGN(header->x_offset + count * header->stride);
+    header->index_offset = KEYSTORE_ALIGN(header->flags_offset + count);
+    return 1;
+}
+
+static size_t keystore_size(const ecc_keystore_header_t *header) {
+    return header->index_offset + header->slots * sizeof(ecc_keystore_slot_t);
+}
+
+// Write a key store with |count| keys to |path|. Every key is validated once
+// here and flagged as trusted if it passes, invalid keys are kept but never
+// returned by a lookup. Duplicate ids are an error.
+int ecc_keystore_write(const char *path, const uint64_t *ids, const eccint_point_t *keys, const size_t count, const curve_t *curve) {
+    ecc_keystore_header_t header;
+
+    memset(&header, 0, sizeof(header));
+    if (!keystore_layout(&header, count, curve)) {
+        return 0;
+    }
+
+    size_t size = keystore_size(&header);
+    uint8_t *data = calloc(1, size);
+    if (!data) {
+        return 0;
+    }
+
+    uint64_t *outids = (uint64_t *) (data + header.ids_offset);
+    eccint_t *outx = data + header.x_offset;
+    uint8_t *outflags = data + header.flags_offset;
+    ecc_keystore_slot_t *index = (ecc_keystore_slot_t *) (data + header.index_offset);
+
+    memcpy(data, &header, sizeof(header));
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t flags = eccint_point_compress(&keys[i], outx + i * header.stride, curve) ? ECC_KEY_YBIT : 0;
+        if (ecc_validate_publickey(&keys[i], curve)) {
+            flags |= ECC_KEY_TRUSTED;
+        }
+
+        outids[i] = ids[i];
+        outflags[i] = flags;
+
+        uint32_t slot = keystore_hash(ids[i]) & (header.slots - 1);
+        while (index[slot].pos != 0) {
+            if (index[slot].id == ids[i]) {
+                free(data);
+                return 0;
+            }
+            slot = (slot + 1) & (header.slots - 1);
+        }
+        index[slot].id = ids[i];
+        index[slot].pos = i + 1;
+        index[slot].flags = flags;
+    }
+
+    size_t pathlen = strlen(path);
+    char tmppath[pathlen + 5];
+    memcpy(tmppath, path, pathlen);
+    memcpy(tmppath + pathlen, ".tmp", 5);
+
+    int fd = open(tmppath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        free(data);
+        return 0;
+    }
+
+    size_t done = 0;
+    while (done < size) {
+        ssize_t written = write(fd, data + done, size - done);
+        if (written <= 0) {
+            break;
+        }
+        done += written;
+    }
+    free(data);
+
+    if (close(fd) != 0 || done != size || rename(tmppath, path) != 0) {
+        unlink(tmppath);
+        return 0;
+    }
+    return 1;
+}
+
+// Generate |count| key pairs with ecc_keygen_batch and write the public keys
+// to a key store at |path|. The private keys are returned in |privatekeys|.
+int ecc_keystore_generate(const char *path, const uint64_t *ids, eccint_keyptr_t *privatekeys, const size_t count, const curve_t *curve) {
+    eccint_point_t *keys = malloc((count ? count : 1) * sizeof(eccint_point_t));
+    int ok = keys && ecc_keygen_batch(keys, privatekeys, count, curve) && ecc_keystore_write(path, ids, keys, count, curve);
+
+    free(keys);
+    return ok;
+}
+
+// Map a key store read-only
+int ecc_keystore_open(ecc_keystore_t *store, const char *path, const curve_t *curve) {
+    ecc_keystore_header_t expected;
+    struct stat st;
+
+    memset(store, 0, sizeof(ecc_keystore_t));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(ecc_keystore_header_t)) {
+        close(fd);
+        return 0;
+    }
+
+    uint8_t *data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return 0;
+    }
+
+    // The layout is fully determined by the count and the curve
+    const ecc_keystore_header_t *header = (const ecc_keystore_header_t *) data;
+    memset(&expected, 0, sizeof(expected));
+    if (!keystore_layout(&expected, header->count, curve) ||
+        memcmp(header, &expected, sizeof(expected)) != 0 || keystore_size(header) != (size_t) st.st_size) {
+        munmap(data, st.st_size);
+        return 0;
+    }
+
+    store->header = header;
+    store->ids = (const uint64_t *) (data + header->ids_offset);
+    store->x = data + header->x_offset;
+    store->flags = data + header->flags_offset;
+    store->index = (const ecc_keystore_slot_t *) (data + header->index_offset);
+    store->data = data;
+    store->size = st.st_size;
+    return 1;
+}
+
+void ecc_keystore_close(ecc_keystore_t *store) {
+    if (store->data) {
+        munmap(store->data, store->size);
+    }
+    memset(store, 0, sizeof(ecc_keystore_t));
+}
+
+static const ecc_keystore_slot_t *keystore_slot(const ecc_keystore_t *store, const uint64_t id) {
+    uint32_t mask = store->header->slots - 1;
+    uint32_t slot = keystore_hash(id) & mask;
+
+    while (store->index[slot].pos != 0) {
+        if (store->index[slot].id == id) {
+            return &store->index[slot];
+        }
+        slot = (slot + 1) & mask;
+    }
+    return NULL;
+}
+
+// Find the position of a key in the store, or -1 if the id is unknown
+ssize_t ecc_keystore_find(const ecc_keystore_t *store, const uint64_t id) {
+    const ecc_keystore_slot_t *slot = keystore_slot(store, id);
+    return slot ? (ssize_t) slot->pos - 1 : -1;
+}
+
+// Look up and decompress a trusted public key. Returns 0 if the id is unknown
+// or the key failed validation at import.
+int ecc_keystore_lookup(const ecc_keystore_t *store, const uint64_t id, eccint_point_t *publickey, const curve_t *curve) {
+    const ecc_keystore_slot_t *slot = keystore_slot(store, id);
+    eccint_t x[curve->words];
+
+    if (!slot || !(slot->flags & ECC_KEY_TRUSTED)) {
+        return 0;
+    }
+
+    eccint_set(x, 0, curve->words);
+    eccint_cpy(x, store->x + (size_t) (slot->pos - 1) * store->header->stride, store->header->stride);
+    return eccint_point_decompress(x, slot->flags & ECC_KEY_YBIT, publickey, curve);
+}
+
+// Verify a signature against a key from the store. The key was validated at
+// import, so this goes straight to ecc_verify.
+int ecc_keystore_verify(const ecc_keystore_t *store, const uint64_t id, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve) {
+    eccint_point_t publickey;
+
+    if (!ecc_keystore_lookup(store, id, &publickey, curve)) {
+        return 0;
+    }
+    return ecc_verify(&publickey, hash, signature, curve);
+}
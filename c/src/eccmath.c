@@ -4,11 +4,18 @@
  * Portions Copyright (C) Philipp Kewisch, 2016 */
 
 #include <stdlib.h>
+#include <string.h>
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
 
 #include "ecctypes.h"
 #include "eccmath.h"
 #include "eccmemory.h"
 #include "eccprint.h"
+#include "ecctables.h"
+#include "eccgenerated.h"
+#include "eccscratch.h"
 
 // Determine the degree of the number passed. The degree is the highest bit set
 // in the number
@@ -49,6 +56,8 @@ eccint_t eccint_shift_left(const eccint_t *in, eccint_t *res, size_t shift, cons
             res[i] = 0;
         }
 
+        // The bit shift continues from the word shifted result
+        in = res;
         shift = shift % 8;
     }
 
@@ -82,6 +91,149 @@ eccint_t eccint_binary_add(const eccint_t *a, const eccint_t *b, eccint_t *res,
     return 0;
 }
 
+// Integer addition with carry, as opposed to the binary add above. Returns the
+// carry out of the top word.
+eccint_t eccint_int_add(const eccint_t *a, const eccint_t *b, eccint_t *res, const size_t size) {
+    ecclong_t carry = 0;
+    for (size_t i = 0; i < size; i++) {
+        carry += (ecclong_t) a[i] + b[i];
+        res[i] = (eccint_t) carry;
+        carry >>= 8;
+    }
+    return carry;
+}
+
+// Integer subtraction with borrow. Returns the borrow out of the top word.
+eccint_t eccint_int_sub(const eccint_t *a, const eccint_t *b, eccint_t *res, const size_t size) {
+    eccint_t borrow = 0;
+    for (size_t i = 0; i < size; i++) {
+        ecclong_t diff = (ecclong_t) a[i] - b[i] - borrow;
+        res[i] = (eccint_t) diff;
+        borrow = (diff >> 8) & 1;
+    }
+    return borrow;
+}
+
+// Integer remainder, res = a mod |mod|, by binary long division. All three
+// are |size| words long.
+void eccint_int_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const size_t size) {
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *rem = ecc_scratch_get(size + 1);
+    eccint_t *modext = ecc_scratch_get(size + 1);
+
+    eccint_set(rem, 0, size + 1);
+    eccint_set(modext, 0, size + 1);
+    eccint_cpy(modext, mod, size);
+
+    for (ssize_t bit = eccint_degree(a, size); bit >= 0; bit--) {
+        // rem <- 2 * rem + a_bit
+        eccint_shift_left(rem, rem, 1, size + 1);
+        rem[0] |= eccint_testbit(a, bit) ? 1 : 0;
+
+        if (eccint_cmp(rem, modext, size + 1) >= 0) {
+            eccint_int_sub(rem, modext, rem, size + 1);
+        }
+    }
+
+    eccint_cpy(res, rem, size);
+    ecc_scratch_end(mark);
+}
+
+// Integer product of two |size| word numbers, |res| is 2 * size words long
+void eccint_int_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const size_t size) {
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *prod = ecc_scratch_get(2 * size);
+
+    eccint_set(prod, 0, 2 * size);
+    for (size_t i = 0; i < size; i++) {
+        ecclong_t carry = 0;
+        for (size_t j = 0; j < size; j++) {
+            carry += (ecclong_t) a[i] * b[j] + prod[i + j];
+            prod[i + j] = (eccint_t) carry;
+            carry >>= 8;
+        }
+        prod[i + size] = (eccint_t) carry;
+    }
+
+    eccint_cpy(res, prod, 2 * size);
+    ecc_scratch_end(mark);
+}
+
+// Integer res = a * b mod |mod|, all |size| words long
+void eccint_int_mul_mod(const eccint_t *a, const eccint_t *b, const eccint_t *mod, eccint_t *res, const size_t size) {
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *prod = ecc_scratch_get(2 * size);
+    eccint_t *modext = ecc_scratch_get(2 * size);
+
+    eccint_set(modext, 0, 2 * size);
+    eccint_cpy(modext, mod, size);
+    eccint_int_mul(a, b, prod, size);
+    eccint_int_mod(prod, modext, prod, 2 * size);
+    eccint_cpy(res, prod, size);
+    ecc_scratch_end(mark);
+}
+
+// Halve x modulo the odd |mod|, x has one spare word for the carry
+static void eccint_int_halve_mod(eccint_t *x, const eccint_t *mod, const size_t size) {
+    if (x[0] & 1) {
+        eccint_int_add(x, mod, x, size);
+    }
+    eccint_shift_right(x, x, 1, size);
+}
+
+// Integer res = a^(-1) mod |mod| for an odd modulus, all |size| words long.
+// Returns 0 if a has no inverse.
+int eccint_int_inv_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const size_t size) {
+    // Book Algorithm 2.22, binary inversion
+    const size_t ext = size + 1;
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *u = ecc_scratch_get(ext);
+    eccint_t *v = ecc_scratch_get(ext);
+    eccint_t *x1 = ecc_scratch_get(ext);
+    eccint_t *x2 = ecc_scratch_get(ext);
+    eccint_t *p = ecc_scratch_get(ext);
+
+    eccint_set(p, 0, ext);
+    eccint_cpy(p, mod, size);
+    eccint_set(u, 0, ext);
+    eccint_int_mod(a, mod, u, size);
+    eccint_cpy(v, p, ext);
+    eccint_set(x1, 0, ext);
+    x1[0] = 1;
+    eccint_set(x2, 0, ext);
+
+    while (!eccint_testnumber(u, 1, ext) && !eccint_testnumber(v, 1, ext)) {
+        // gcd(a, mod) > 1 ends with u = 0 or v = 0
+        if (eccint_testzero(u, ext) || eccint_testzero(v, ext)) {
+            ecc_scratch_end(mark);
+            return 0;
+        }
+        while (eccint_even(u)) {
+            eccint_shift_right(u, u, 1, ext);
+            eccint_int_halve_mod(x1, p, ext);
+        }
+        while (eccint_even(v)) {
+            eccint_shift_right(v, v, 1, ext);
+            eccint_int_halve_mod(x2, p, ext);
+        }
+        if (eccint_cmp(u, v, ext) >= 0) {
+            eccint_int_sub(u, v, u, ext);
+            if (eccint_int_sub(x1, x2, x1, ext)) {
+                eccint_int_add(x1, p, x1, ext);
+            }
+        } else {
+            eccint_int_sub(v, u, v, ext);
+            if (eccint_int_sub(x2, x1, x2, ext)) {
+                eccint_int_add(x2, p, x2, ext);
+            }
+        }
+    }
+
+    eccint_cpy(res, eccint_testnumber(u, 1, ext) ? x1 : x2, size);
+    ecc_scratch_end(mark);
+    return 1;
+}
+
 // Binary multiply with shift and add. Note that |res| must be double the size of a and b.
 void eccint_shiftnadd_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {
     // Book Algorithm 2.33. Better for hardware where shift operation can be
@@ -91,9 +243,10 @@ void eccint_shiftnadd_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, c
     // maximum degree is 2m - 2, e.g. 2 * 163 - 2 = 324
     size_t doublewords = 2 * curve->words;
 
-    eccint_t bcpy[doublewords];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *bcpy = ecc_scratch_get(doublewords);
 
-    eccint_t rz[curve->words];
+    eccint_t *rz = ecc_scratch_get(curve->words);
     eccint_setbit(rz, curve->m, 0);
 
     eccint_cpy(rz, curve->q, curve->words);
@@ -120,14 +273,231 @@ void eccint_shiftnadd_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, c
 
         }
     }
+    ecc_scratch_end(mark);
+}
+
+// Binary multiply with the left-to-right comb method, 4 bits at a time. Note
+// that |res| must be double the size of a and b.
+void eccint_comb_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {
+    // Book Algorithm 2.36 with w = 4. The 16 multiples u(z) * b(z) are
+    // precomputed, then each nibble of a selects one of them.
+    const size_t words = curve->words;
+    const size_t mark = ecc_scratch_begin();
+    eccint_t (*table)[words + 1] = (void *) ecc_scratch_get(16 * (words + 1));
+
+    eccint_set(table[0], 0, words + 1);
+    eccint_cpy(table[1], b, words);
+    table[1][words] = 0;
+    for (size_t u = 2; u < 16; u++) {
+        if (u & 1) {
+            eccint_add(table[u - 1], table[1], table[u], words + 1);
+        } else {
+            eccint_shift_left(table[u / 2], table[u], 1, words + 1);
+        }
+    }
+
+    eccint_set(res, 0, 2 * words);
+
+    for (int k = 1; k >= 0; k--) {
+        for (size_t j = 0; j < words; j++) {
+            eccint_t u = (a[j] >> (4 * k)) & 0x0F;
+            if (u) {
+                eccint_add(res + j, table[u], res + j, words + 1);
+            }
+        }
+        if (k) {
+            eccint_shift_left(res, res, 4, 2 * words);
+        }
+    }
+    ecc_scratch_end(mark);
+}
+
+#if defined(__x86_64__)
+// Binary multiply with the carry-less multiply instruction, on 64 bit limbs.
+// Only use this if the CPU supports PCLMULQDQ, see eccdispatch.c.
+__attribute__((target("pclmul,sse2")))
+void eccint_clmul_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {
+    const size_t words = curve->words;
+    const size_t limbs = (words + 7) / 8;
+    const size_t mark = ecc_scratch_begin();
+    uint64_t *al = (void *) ecc_scratch_get(limbs * 8);
+    uint64_t *bl = (void *) ecc_scratch_get(limbs * 8);
+    uint64_t *rl = (void *) ecc_scratch_get(2 * limbs * 8);
+
+    memset(al, 0, limbs * 8);
+    memset(bl, 0, limbs * 8);
+    memset(rl, 0, 2 * limbs * 8);
+    memcpy(al, a, words);
+    memcpy(bl, b, words);
+
+    for (size_t i = 0; i < limbs; i++) {
+        __m128i ai = _mm_cvtsi64_si128(al[i]);
+        for (size_t j = 0; j < limbs; j++) {
+            __m128i p = _mm_clmulepi64_si128(ai, _mm_cvtsi64_si128(bl[j]), 0x00);
+            rl[i + j] ^= (uint64_t) _mm_cvtsi128_si64(p);
+            rl[i + j + 1] ^= (uint64_t) _mm_cvtsi128_si64(_mm_srli_si128(p, 8));
+        }
+    }
+
+    memcpy(res, rl, 2 * words);
+    ecc_scratch_end(mark);
+}
+
+// res = a * b on two limbs, with three carry-less multiplies
+__attribute__((target("pclmul,sse2")))
+static inline void karatsuba_2(const uint64_t *a, const uint64_t *b, uint64_t *res) {
+    __m128i av = _mm_loadu_si128((const __m128i *) a);
+    __m128i bv = _mm_loadu_si128((const __m128i *) b);
+    __m128i lo = _mm_clmulepi64_si128(av, bv, 0x00);
+    __m128i hi = _mm_clmulepi64_si128(av, bv, 0x11);
+    __m128i mid = _mm_clmulepi64_si128(_mm_xor_si128(av, _mm_srli_si128(av, 8)),
+                                       _mm_xor_si128(bv, _mm_srli_si128(bv, 8)), 0x00);
+
+    mid = _mm_xor_si128(mid, _mm_xor_si128(lo, hi));
+    _mm_storeu_si128((__m128i *) res, _mm_xor_si128(lo, _mm_slli_si128(mid, 8)));
+    _mm_storeu_si128((__m128i *) (res + 2), _mm_xor_si128(hi, _mm_srli_si128(mid, 8)));
+}
+
+// res = a * b on three limbs, with six carry-less multiplies (Weimerskirch
+// and Paar): c1 = d01 + d0 + d1, c2 = d02 + d0 + d1 + d2, c3 = d12 + d1 + d2
+__attribute__((target("pclmul,sse2")))
+static inline void karatsuba_3(const uint64_t *a, const uint64_t *b, uint64_t *res) {
+    __m128i a0 = _mm_cvtsi64_si128(a[0]), a1 = _mm_cvtsi64_si128(a[1]), a2 = _mm_cvtsi64_si128(a[2]);
+    __m128i b0 = _mm_cvtsi64_si128(b[0]), b1 = _mm_cvtsi64_si128(b[1]), b2 = _mm_cvtsi64_si128(b[2]);
+    __m128i d0 = _mm_clmulepi64_si128(a0, b0, 0x00);
+    __m128i d1 = _mm_clmulepi64_si128(a1, b1, 0x00);
+    __m128i d2 = _mm_clmulepi64_si128(a2, b2, 0x00);
+    __m128i d01 = _mm_clmulepi64_si128(_mm_xor_si128(a0, a1), _mm_xor_si128(b0, b1), 0x00);
+    __m128i d02 = _mm_clmulepi64_si128(_mm_xor_si128(a0, a2), _mm_xor_si128(b0, b2), 0x00);
+    __m128i d12 = _mm_clmulepi64_si128(_mm_xor_si128(a1, a2), _mm_xor_si128(b1, b2), 0x00);
+    __m128i c1 = _mm_xor_si128(d01, _mm_xor_si128(d0, d1));
+    __m128i c2 = _mm_xor_si128(d02, _mm_xor_si128(_mm_xor_si128(d0, d1), d2));
+    __m128i c3 = _mm_xor_si128(d12, _mm_xor_si128(d1, d2));
+
+    _mm_storeu_si128((__m128i *) res, _mm_xor_si128(d0, _mm_slli_si128(c1, 8)));
+    _mm_storeu_si128((__m128i *) (res + 2), _mm_xor_si128(c2, _mm_xor_si128(_mm_srli_si128(c1, 8), _mm_slli_si128(c3, 8))));
+    _mm_storeu_si128((__m128i *) (res + 4), _mm_xor_si128(d2, _mm_srli_si128(c3, 8)));
+}
+
+// The largest low part h of the kernels below
+#define KARATSUBA_HALF 5
+
+// One level of Karatsuba-Ofman on n limbs, split into a low part of h limbs
+// and a high part of n - h. With a = a1 z^h + a0 and the same for b,
+// a * b = a1 b1 z^2h + ((a1 + a0)(b1 + b0) + a1 b1 + a0 b0) z^h + a0 b0, three
+// smaller products instead of four. Inlined with constant n and h, so the
+// loops unroll.
+__attribute__((target("pclmul,sse2"), always_inline))
+static inline void karatsuba_split(const uint64_t *a, const uint64_t *b, uint64_t *res, const size_t n, const size_t h,
+                                   void (*lo)(const uint64_t *, const uint64_t *, uint64_t *),
+                                   void (*hi)(const uint64_t *, const uint64_t *, uint64_t *)) {
+    const size_t l = n - h;
+    uint64_t as[KARATSUBA_HALF], bs[KARATSUBA_HALF], mid[2 * KARATSUBA_HALF];
+
+    for (size_t i = 0; i < h; i++) {
+        as[i] = a[i] ^ (i < l ? a[h + i] : 0);
+        bs[i] = b[i] ^ (i < l ? b[h + i] : 0);
+    }
+
+    lo(a, b, res);
+    hi(a + h, b + h, res + 2 * h);
+    lo(as, bs, mid);
+
+    for (size_t i = 0; i < 2 * h; i++) {
+        mid[i] ^= res[i] ^ (i < 2 * l ? res[2 * h + i] : 0);
+    }
+    // The middle product has at most 2h - 1 significant limbs
+    for (size_t i = 0; i < 2 * h && h + i < 2 * n; i++) {
+        res[h + i] ^= mid[i];
+    }
 }
 
+// The products of sect233k1 and sect283k1 (4 and 5 limbs) up to sect571k1
+// (9 limbs). The split points were tuned with `make bench-large`.
+#define KARATSUBA(n, h, lo, hi) \
+    __attribute__((target("pclmul,sse2"))) \
+    static void karatsuba_##n(const uint64_t *a, const uint64_t *b, uint64_t *res) { \
+        karatsuba_split(a, b, res, n, h, lo, hi); \
+    }
+
+KARATSUBA(4, 2, karatsuba_2, karatsuba_2)
+KARATSUBA(5, 3, karatsuba_3, karatsuba_2)
+KARATSUBA(6, 3, karatsuba_3, karatsuba_3)
+KARATSUBA(7, 4, karatsuba_4, karatsuba_3)
+KARATSUBA(8, 4, karatsuba_4, karatsuba_4)
+KARATSUBA(9, 5, karatsuba_5, karatsuba_4)
+
+// res = a * b on n limbs, res has 2n limbs. Larger products than the kernels
+// above split in the middle.
+__attribute__((target("pclmul,sse2")))
+static void karatsuba_limbs(const uint64_t *a, const uint64_t *b, uint64_t *res, const size_t n) {
+    static void (*const kernels[])(const uint64_t *, const uint64_t *, uint64_t *) = {
+        NULL, NULL, karatsuba_2, karatsuba_3, karatsuba_4, karatsuba_5, karatsuba_6, karatsuba_7, karatsuba_8, karatsuba_9
+    };
+
+    if (n == 1) {
+        _mm_storeu_si128((__m128i *) res, _mm_clmulepi64_si128(_mm_cvtsi64_si128(a[0]), _mm_cvtsi64_si128(b[0]), 0x00));
+        return;
+    }
+    if (n < sizeof(kernels) / sizeof(kernels[0])) {
+        kernels[n](a, b, res);
+        return;
+    }
+
+    const size_t h = (n + 1) / 2;
+    const size_t l = n - h;
+    const size_t mark = ecc_scratch_begin();
+    uint64_t *as = (void *) ecc_scratch_get(h * 8);
+    uint64_t *bs = (void *) ecc_scratch_get(h * 8);
+    uint64_t *mid = (void *) ecc_scratch_get(2 * h * 8);
+
+    for (size_t i = 0; i < h; i++) {
+        as[i] = a[i] ^ (i < l ? a[h + i] : 0);
+        bs[i] = b[i] ^ (i < l ? b[h + i] : 0);
+    }
+
+    karatsuba_limbs(a, b, res, h);
+    karatsuba_limbs(a + h, b + h, res + 2 * h, l);
+    karatsuba_limbs(as, bs, mid, h);
+
+    for (size_t i = 0; i < 2 * h; i++) {
+        mid[i] ^= res[i] ^ (i < 2 * l ? res[2 * h + i] : 0);
+    }
+    for (size_t i = 0; i < 2 * h && h + i < 2 * n; i++) {
+        res[h + i] ^= mid[i];
+    }
+    ecc_scratch_end(mark);
+}
+
+// Binary multiply with Karatsuba-Ofman on 64 bit limbs, down to the carry-less
+// multiply instruction. Only use this if the CPU supports PCLMULQDQ.
+void eccint_karatsuba_mul(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {
+    const size_t words = curve->words;
+    const size_t limbs = (words + 7) / 8;
+    const size_t mark = ecc_scratch_begin();
+    uint64_t *al = (void *) ecc_scratch_get(limbs * 8);
+    uint64_t *bl = (void *) ecc_scratch_get(limbs * 8);
+    uint64_t *rl = (void *) ecc_scratch_get(2 * limbs * 8);
+
+    memset(al, 0, limbs * 8);
+    memset(bl, 0, limbs * 8);
+    memcpy(al, a, words);
+    memcpy(bl, b, words);
+
+    karatsuba_limbs(al, bl, rl, limbs);
+
+    memcpy(res, rl, 2 * words);
+    ecc_scratch_end(mark);
+}
+#endif
+
 // General modulo function for polynomials. The polynomial in c is double word
 // size and will be reduced using the polynomial in mod. The result is single
 // word size.
 void eccint_general_mod(eccint_t *c, const eccint_t *mod, eccint_t *res, const curve_t *curve) {
     // Algorithm 2.40
-    eccint_t table[2 * curve->m][2 * curve->words];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t (*table)[2 * curve->words] = (void *) ecc_scratch_get(2 * curve->m * 2 * curve->words);
     int md = eccint_degree(mod, curve->words);
     for (size_t i = 0; i < 2 * curve->m; i++) {
         eccint_set(table[i], 0, 2 * curve->words);
@@ -143,32 +513,128 @@ void eccint_general_mod(eccint_t *c, const eccint_t *mod, eccint_t *res, const c
     }
 
     eccint_cpy(res, c, curve->words);
+    ecc_scratch_end(mark);
+}
+
+// Reduction modulo the field polynomial with the general algorithm
+void eccint_general_reduce(eccint_t *c, eccint_t *res, const curve_t *curve) {
+    eccint_general_mod(c, curve->q, res, curve);
+}
+
+// Reduction modulo the field polynomial using the shifted copies of f(z) from
+// the curve tables, instead of building them on each call
+void eccint_shifted_reduce(eccint_t *c, eccint_t *res, const curve_t *curve) {
+    if (!curve->tables) {
+        eccint_general_mod(c, curve->q, res, curve);
+        return;
+    }
+
+    for (size_t i = 2 * curve->m - 2; i >= curve->m; i--) {
+        if (eccint_testbit(c, i)) {
+            // c <- c + z^(i - m) * f(z)
+            size_t j = i - curve->m;
+            eccint_add(c + j / 8, curve->tables->qshift[j % 8], c + j / 8, curve->words + 1);
+        }
+    }
+
+    eccint_cpy(res, c, curve->words);
+}
+
+// Reduction with the curve's own fast reduction function
+void eccint_fast_reduce(eccint_t *c, eccint_t *res, const curve_t *curve) {
+    curve->mod_fast(c, res, curve);
 }
 
 // Multiply, applying modulus inbetwen. a, b and res are all standard word length
 void eccint_mul_mod(const eccint_t *a, const eccint_t *b, const eccint_t *mod, eccint_t *res, const curve_t *curve) {
-    eccint_t product[2 * curve->words];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *product = ecc_scratch_get(2 * curve->words);
+    if (a == b) {
+        ECC_COUNT(square);
+    } else {
+        ECC_COUNT(mul);
+    }
+    ECC_COUNT(reduce);
     eccint_mul(a, b, product, curve);
-    eccint_general_mod(product, mod, res, curve);
 
+    if (mod == curve->q || eccint_cmp(mod, curve->q, curve->words) == 0) {
+        eccint_reduce(product, res, curve);
+    } else {
+        eccint_general_mod(product, mod, res, curve);
+    }
+    ecc_scratch_end(mark);
 }
 
 // Run the modulo on a standard word size input. This is useful for further reducing a number
 void eccint_mod(const eccint_t *in, const eccint_t *mod, eccint_t *res, const curve_t *curve) {
 
-    eccint_t indbl[curve->words * 2];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *indbl = ecc_scratch_get(curve->words * 2);
 
     eccint_set(indbl, 0, curve->words * 2);
     eccint_cpy(indbl, in, curve->words);
+    ECC_COUNT(reduce);
 
     eccint_general_mod(indbl, mod, res, curve);
+    ecc_scratch_end(mark);
 }
 
 // Fast reduction using the curve's fast reduction function
 void eccint_mul_mod_fast(const eccint_t *a, const eccint_t *b, eccint_t *res, const curve_t *curve) {
-    eccint_t product[2 * curve->words - 1];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *product = ecc_scratch_get(2 * curve->words);
+    ECC_COUNT(mul);
+    ECC_COUNT(reduce);
     eccint_mul(a, b, product, curve);
     curve->mod_fast(product, res, curve);
+    ecc_scratch_end(mark);
+}
+
+// Squaring, res = a^2 mod |mod|. Squaring is linear in GF(2^m), so modulo the
+// field polynomial it is a table lookup per word when the curve has tables.
+void eccint_square_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const curve_t *curve) {
+    if (curve->generated && eccint_cmp(mod, curve->q, curve->words) == 0) {
+        ECC_COUNT(square);
+        curve->generated->square(a, res, curve);
+        return;
+    }
+    if (curve->tables && eccint_cmp(mod, curve->q, curve->words) == 0) {
+        ECC_COUNT(square);
+        eccint_linmap_apply(&curve->tables->square, a, res, curve);
+        return;
+    }
+    eccint_mul_mod(a, a, mod, res, curve);
+}
+
+// Repeated squaring, res = a^(2^k) mod f(z). Uses the largest x^(2^k) tables
+// that fit, so with a table for exactly k this costs a single lookup pass.
+void eccint_multisquare(const eccint_t *a, const size_t k, eccint_t *res, const curve_t *curve) {
+    size_t left = k;
+
+    eccint_cpy(res, a, curve->words);
+
+    if (curve->tables) {
+        const curve_tables_t *tables = curve->tables;
+
+        while (left > 0) {
+            size_t best = 0;
+            for (size_t n = 0; n < tables->multisquare_count; n++) {
+                if (tables->multisquare_k[n] <= left &&
+                    (!best || tables->multisquare_k[n] > tables->multisquare_k[best - 1])) {
+                    best = n + 1;
+                }
+            }
+            if (!best) {
+                break;
+            }
+            eccint_linmap_apply(&tables->multisquare[best - 1], res, res, curve);
+            left -= tables->multisquare_k[best - 1];
+        }
+    }
+
+    for (; left > 0; left--) {
+        eccint_square_mod(res, curve->q, res, curve);
+    }
 }
 
 // Division, by a modulo specified. res = y / x
@@ -184,10 +650,11 @@ void eccint_binary_sun_div_mod(const eccint_t *y, const eccint_t *x, const eccin
         return;
     }
 
-    eccint_t A[curve->words];
-    eccint_t B[curve->words];
-    eccint_t U[curve->words];
-    eccint_t V[curve->words];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *A = ecc_scratch_get(curve->words);
+    eccint_t *B = ecc_scratch_get(curve->words);
+    eccint_t *U = ecc_scratch_get(curve->words);
+    eccint_t *V = ecc_scratch_get(curve->words);
 
 
     eccint_cpy(A, x, curve->words);
@@ -234,6 +701,7 @@ void eccint_binary_sun_div_mod(const eccint_t *y, const eccint_t *x, const eccin
     }
 
     eccint_cpy(res, U, curve->words);
+    ecc_scratch_end(mark);
 }
 
 // Division, by a modulo specified. res = y / x
@@ -249,11 +717,14 @@ void eccint_binary_book_div_mod(const eccint_t *b, const eccint_t *a, const ecci
     }
 
 
-    // Algorithm 2.48, with division
-    eccint_t _u[curve->words];
-    eccint_t _v[curve->words];
-    eccint_t _g1[curve->words];
-    eccint_t _g2[curve->words];
+    // Algorithm 2.48, then multiply by b. Starting with g1 = b instead would
+    // let g1 and g2 grow past m bits.
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *_u = ecc_scratch_get(curve->words);
+    eccint_t *_v = ecc_scratch_get(curve->words);
+    eccint_t *_g1 = ecc_scratch_get(curve->words);
+    eccint_t *_g2 = ecc_scratch_get(curve->words);
+    eccint_t *t1 = ecc_scratch_get(curve->words);
 
     eccint_t *u = _u;
     eccint_t *v = _v;
@@ -265,7 +736,8 @@ void eccint_binary_book_div_mod(const eccint_t *b, const eccint_t *a, const ecci
     eccint_cpy(u, a, curve->words);
     eccint_cpy(v, mod, curve->words);
 
-    eccint_cpy(g1, b, curve->words);
+    eccint_set(g1, 0, curve->words);
+    g1[0] = 1;
     eccint_set(g2, 0, curve->words);
 
     while (eccint_testnumber(u, 1, curve->words) != 1) {
@@ -283,8 +755,6 @@ void eccint_binary_book_div_mod(const eccint_t *b, const eccint_t *a, const ecci
             j = -j;
         }
 
-        eccint_t t1[curve->words];
-
         // u <- u + z^j * v
         eccint_shift_left(v, t1, j, curve->words);
         eccint_add(u, t1, u, curve->words);
@@ -295,16 +765,127 @@ void eccint_binary_book_div_mod(const eccint_t *b, const eccint_t *a, const ecci
 
     }
 
-    eccint_cpy(res, g1, curve->words);
+    eccint_mul_mod(b, g1, mod, res, curve);
+    ecc_scratch_end(mark);
 }
 
 // Inversion of a number, which equals divison 1 / in
 void eccint_inv_mod(const eccint_t *a, const eccint_t *mod, eccint_t *res, const curve_t *curve) {
-    eccint_t g1[curve->words];
+    if (curve->generated && eccint_cmp(mod, curve->q, curve->words) == 0) {
+        // Straight-line Itoh-Tsujii chain, the same for every input
+        ECC_COUNT(inv);
+        curve->generated->inv(a, res, curve);
+        return;
+    }
+
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *g1 = ecc_scratch_get(curve->words);
     eccint_set(g1, 0, curve->words);
     g1[0] = 1;
 
     eccint_div_mod(g1, a, mod, res, curve);
+    ecc_scratch_end(mark);
+}
+
+// Trace of a field element, Tr(a) = a + a^2 + a^4 + ... + a^(2^(m-1)). The
+// result is either 0 or 1.
+int eccint_trace(const eccint_t *a, const curve_t *curve) {
+    if (curve->tables) {
+        // The trace is linear, so it is the parity of the bits selected by
+        // the trace mask
+        eccint_t acc = 0;
+        for (size_t i = 0; i < curve->words; i++) {
+            acc ^= a[i] & curve->tables->tracemask[i];
+        }
+        acc ^= acc >> 4;
+        acc ^= acc >> 2;
+        acc ^= acc >> 1;
+        return acc & 1;
+    }
+
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *t = ecc_scratch_get(curve->words);
+    eccint_t *sum = ecc_scratch_get(curve->words);
+
+    eccint_cpy(t, a, curve->words);
+    eccint_cpy(sum, a, curve->words);
+
+    for (size_t i = 1; i < curve->m; i++) {
+        eccint_square_mod(t, curve->q, t, curve);
+        eccint_add(sum, t, sum, curve->words);
+    }
+
+    int trace = sum[0] & 1;
+    ecc_scratch_end(mark);
+    return trace;
+}
+
+// Half-trace of a field element, H(a) = sum a^(2^(2i)) for i in [0, (m-1)/2].
+// Only defined for odd m. If Tr(a) = 0, z = H(a) solves z^2 + z = a.
+void eccint_halftrace(const eccint_t *a, eccint_t *res, const curve_t *curve) {
+    if (curve->tables && curve->tables->halftrace.table) {
+        eccint_linmap_apply(&curve->tables->halftrace, a, res, curve);
+        return;
+    }
+
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *t = ecc_scratch_get(curve->words);
+    eccint_t *sum = ecc_scratch_get(curve->words);
+
+    eccint_cpy(t, a, curve->words);
+    eccint_cpy(sum, a, curve->words);
+
+    for (size_t i = 1; i <= (curve->m - 1) / 2; i++) {
+        eccint_square_mod(t, curve->q, t, curve);
+        eccint_square_mod(t, curve->q, t, curve);
+        eccint_add(sum, t, sum, curve->words);
+    }
+
+    eccint_cpy(res, sum, curve->words);
+    ecc_scratch_end(mark);
+}
+
+// Square root of a field element, sqrt(a) = a^(2^(m-1))
+void eccint_sqrt(const eccint_t *a, eccint_t *res, const curve_t *curve) {
+    if (curve->tables) {
+        // Split a into its even and odd bits, a = e(z)^2 + z * o(z)^2, so
+        // sqrt(a) = e(z) + sqrt(z) * o(z)
+        const size_t mark = ecc_scratch_begin();
+        eccint_t *even = ecc_scratch_get(curve->words);
+        eccint_t *odd = ecc_scratch_get(curve->words);
+
+        eccint_set(even, 0, curve->words);
+        eccint_set(odd, 0, curve->words);
+
+        for (size_t j = 0; j < curve->words; j++) {
+            eccint_t e = a[j] & 0x55;
+            eccint_t o = (a[j] >> 1) & 0x55;
+
+            // Compress every other bit into a nibble
+            e = (e | (e >> 1)) & 0x33;
+            e = (e | (e >> 2)) & 0x0F;
+            o = (o | (o >> 1)) & 0x33;
+            o = (o | (o >> 2)) & 0x0F;
+
+            even[j / 2] |= e << (4 * (j & 1));
+            odd[j / 2] |= o << (4 * (j & 1));
+        }
+
+        eccint_mul_mod(odd, curve->tables->sqrtz, curve->q, res, curve);
+        eccint_add(res, even, res, curve->words);
+        ecc_scratch_end(mark);
+        return;
+    }
+
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *t = ecc_scratch_get(curve->words);
+
+    eccint_cpy(t, a, curve->words);
+    for (size_t i = 1; i < curve->m; i++) {
+        eccint_square_mod(t, curve->q, t, curve);
+    }
+    eccint_cpy(res, t, curve->words);
+    ecc_scratch_end(mark);
 }
 
 // Checks if a point is on the curve
@@ -314,9 +895,10 @@ int eccint_point_on_curve(const eccint_point_t *in, const curve_t *curve) {
     }
     // Verify that Q satifies the elliptic curve equation
     // E_1: y^2 + xy = x^3 + ax^2 + b (a = 1, b = 1)
-    eccint_t tl[curve->words];
-    eccint_t tr[curve->words];
-    eccint_t t1[curve->words];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *tl = ecc_scratch_get(curve->words);
+    eccint_t *tr = ecc_scratch_get(curve->words);
+    eccint_t *t1 = ecc_scratch_get(curve->words);
 
     // x^3 + ax^2 + b
     eccint_square_mod(in->x, curve->q, tr, curve); // x^2
@@ -331,31 +913,161 @@ int eccint_point_on_curve(const eccint_point_t *in, const curve_t *curve) {
     eccint_mul_mod(in->x, in->y, curve->q, t1, curve); // x * y
     eccint_add(tl, t1, tl, curve->words); // y^2 + xy
 
-    return (eccint_cmp(tl, tr, curve->words) == 0);
+    int res = eccint_cmp(tl, tr, curve->words) == 0;
+    ecc_scratch_end(mark);
+    return res;
 }
 
 
-// Doubles an ECC point into res
-void eccint_book_point_double(const eccint_point_t *p, eccint_point_t *res, const curve_t *curve) {
+// Compress a point to its x-coordinate and the bit y~ = lsb(y / x), which is
+// enough to recover y. Returns y~.
+eccint_t eccint_point_compress(const eccint_point_t *p, eccint_t *x, const curve_t *curve) {
+    eccint_cpy(x, p->x, curve->words);
+
+    if (eccint_testzero(p->x, curve->words)) {
+        return 0;
+    }
+
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *t1 = ecc_scratch_get(curve->words);
+    eccint_div_mod(p->y, p->x, curve->q, t1, curve);
+    eccint_t ybit = t1[0] & 1;
+    ecc_scratch_end(mark);
+    return ybit;
+}
+
+// Recover a point from its x-coordinate and y~, see SEC1 section 2.3.4.
+// Returns 0 if there is no point with this x-coordinate on the curve.
+int eccint_point_decompress(const eccint_t *x, const eccint_t ybit, eccint_point_t *res, const curve_t *curve) {
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *beta = ecc_scratch_get(curve->words);
+    eccint_t *z = ecc_scratch_get(curve->words);
+
+    // x = 0 has the single solution y = sqrt(b)
+    if (eccint_testzero(x, curve->words)) {
+        eccint_set(res->x, 0, curve->words);
+        eccint_sqrt(curve->b, res->y, curve);
+        res->infinity = 0;
+        ecc_scratch_end(mark);
+        return 1;
+    }
+
+    // beta = x + a + b / x^2
+    eccint_square_mod(x, curve->q, z, curve);
+    eccint_div_mod(curve->b, z, curve->q, beta, curve);
+    eccint_add(beta, x, beta, curve->words);
+    eccint_add(beta, curve->a, beta, curve->words);
+
+    // z^2 + z = beta only has a solution if Tr(beta) = 0
+    if (eccint_trace(beta, curve)) {
+        ecc_scratch_end(mark);
+        return 0;
+    }
+    eccint_halftrace(beta, z, curve);
+
+    // The other solution is z + 1, pick the one matching y~
+    if ((z[0] & 1) != (ybit & 1)) {
+        z[0] ^= 1;
+    }
+
+    // y = x * z
+    eccint_mul_mod(x, z, curve->q, res->y, curve);
+    eccint_cpy(res->x, x, curve->words);
+    res->infinity = 0;
+    ecc_scratch_end(mark);
+    return 1;
+}
+
+// Encode a point as SEC1 octet string, either compressed (02/03 || x) or
+// uncompressed (04 || x || y), with big endian coordinates. The point at
+// infinity is the single octet 00. Returns the number of octets written,
+// |out| needs room for 1 + 2 * words.
+size_t eccint_point_encode(const eccint_point_t *p, const int compressed, uint8_t *out, const curve_t *curve) {
+    const size_t len = curve->words;
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *x = ecc_scratch_get(curve->words);
+
     if (eccint_point_testinfinite(p, curve->words)) {
-        eccint_set(res->x, ECCINT_MAX, curve->words);
-        eccint_set(res->y, ECCINT_MAX, curve->words);
-        return;
+        out[0] = 0x00;
+        ecc_scratch_end(mark);
+        return 1;
+    }
 
+    if (compressed) {
+        out[0] = 0x02 | eccint_point_compress(p, x, curve);
+    } else {
+        out[0] = 0x04;
+        eccint_cpy(x, p->x, curve->words);
+        for (size_t i = 0; i < len; i++) {
+            out[1 + len + i] = p->y[len - 1 - i];
+        }
     }
-    if (eccint_testzero(p->x, curve->words)) {
-        eccint_set(res->x, ECCINT_MAX, curve->words);
-        eccint_set(res->y, ECCINT_MAX, curve->words);
+
+    for (size_t i = 0; i < len; i++) {
+        out[1 + i] = x[len - 1 - i];
+    }
+    ecc_scratch_end(mark);
+    return compressed ? 1 + len : 1 + 2 * len;
+}
+
+// Decode a SEC1 octet string into a point. Returns 0 if the encoding is
+// malformed or the point is not on the curve.
+int eccint_point_decode(const uint8_t *in, const size_t inlen, eccint_point_t *res, const curve_t *curve) {
+    const size_t len = curve->words;
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *x = ecc_scratch_get(curve->words);
+
+    if (inlen == 1 && in[0] == 0x00) {
+        eccint_point_set_infinity(res, curve->words);
+        ecc_scratch_end(mark);
+        return 1;
+    }
+
+    if (!((inlen == 1 + len && (in[0] == 0x02 || in[0] == 0x03)) ||
+          (inlen == 1 + 2 * len && in[0] == 0x04))) {
+        ecc_scratch_end(mark);
+        return 0;
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        x[i] = in[len - i];
+    }
+    if (eccint_cmp(x, curve->q, curve->words) >= 0) {
+        ecc_scratch_end(mark);
+        return 0;
+    }
+
+    if (in[0] != 0x04) {
+        int ok = eccint_point_decompress(x, in[0] & 1, res, curve);
+        ecc_scratch_end(mark);
+        return ok;
+    }
+
+    eccint_cpy(res->x, x, curve->words);
+    ecc_scratch_end(mark);
+    for (size_t i = 0; i < len; i++) {
+        res->y[i] = in[2 * len - i];
+    }
+    res->infinity = 0;
+    return eccint_cmp(res->y, curve->q, curve->words) < 0 && eccint_point_on_curve(res, curve);
+}
+
+// Doubles an ECC point into res
+void eccint_book_point_double(const eccint_point_t *p, eccint_point_t *res, const curve_t *curve) {
+    // 2 * \infty = \infty, and (0, sqrt(b)) has order two
+    if (p->infinity || eccint_testzero(p->x, curve->words)) {
+        eccint_point_set_infinity(res, curve->words);
         return;
     }
 
     // Section 3.1, page 81
     // For x^2 + xy = x^3 + ax^2 + b in E/F_{2^m}
-    eccint_t lambda[curve->words];
-    eccint_t t1[curve->words];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *lambda = ecc_scratch_get(curve->words);
+    eccint_t *t1 = ecc_scratch_get(curve->words);
 
-    eccint_t x3[curve->words];
-    eccint_t y3[curve->words];
+    eccint_t *x3 = ecc_scratch_get(curve->words);
+    eccint_t *y3 = ecc_scratch_get(curve->words);
 
     // l = x_1 + (y_1 / x_1)
     eccint_div_mod(p->y, p->x, curve->q, lambda, curve);
@@ -376,36 +1088,21 @@ void eccint_book_point_double(const eccint_point_t *p, eccint_point_t *res, cons
 
     eccint_cpy(res->x, x3, curve->words);
     eccint_cpy(res->y, y3, curve->words);
+    res->infinity = 0;
+    ecc_scratch_end(mark);
 }
 
-// Adds two ECC points on the curve
-void eccint_book_point_add(const eccint_point_t *p, const eccint_point_t *q, eccint_point_t *res, const curve_t *curve) {
-    if (eccint_point_testinfinite(p, curve->words)) {
-        eccint_point_cpy(res, q, curve->words);
-        return;
-    }
-    if (eccint_point_testinfinite(q, curve->words)) {
-        eccint_point_cpy(res, p, curve->words);
-        return;
-    }
-
-    if (eccint_cmp(p->x, q->x, curve->words) == 0) {
-        if (eccint_cmp(p->y, q->y, curve->words) != 0) {
-            eccint_point_set(res, ECCINT_MAX, curve->words);
-        } else {
-            eccint_book_point_double(p, res, curve);
-        }
-        return;
-    }
-
+// P + Q for x_P != x_Q
+static void eccint_book_point_add_distinct(const eccint_point_t *p, const eccint_point_t *q, eccint_point_t *res, const curve_t *curve) {
     // Section 3.1, page 81
     // For x^2 + xy = x^3 + ax^2 + b in E/F_{2^m}
-    eccint_t lambda[curve->words];
-    eccint_t tx[curve->words];
-    eccint_t ty[curve->words];
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *lambda = ecc_scratch_get(curve->words);
+    eccint_t *tx = ecc_scratch_get(curve->words);
+    eccint_t *ty = ecc_scratch_get(curve->words);
 
-    eccint_t x3[curve->words];
-    eccint_t y3[curve->words];
+    eccint_t *x3 = ecc_scratch_get(curve->words);
+    eccint_t *y3 = ecc_scratch_get(curve->words);
 
     // l = (y1 + y2) / (x1 + x2)
     // l = (  ty   ) / (  tx   )
@@ -413,7 +1110,7 @@ void eccint_book_point_add(const eccint_point_t *p, const eccint_point_t *q, ecc
     eccint_add(p->y, q->y, ty, curve->words);
 
     //eccint_div_mod(ty, tx, curve->q, lambda, curve);
-    eccint_t t2[curve->words];
+    eccint_t *t2 = ecc_scratch_get(curve->words);
     eccint_inv_mod(tx, curve->q, t2, curve);
     eccint_mul_mod(ty, t2, curve->q, lambda, curve);
 
@@ -435,20 +1132,362 @@ void eccint_book_point_add(const eccint_point_t *p, const eccint_point_t *q, ecc
 
     eccint_cpy(res->x, x3, curve->words);
     eccint_cpy(res->y, y3, curve->words);
+    res->infinity = 0;
+    ecc_scratch_end(mark);
 }
 
-// Multiplication using the montgomery ladder
-void eccint_montgomery_ladder_point_mul(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve) {
-    if (eccint_testzero(scalar, curve->words) || eccint_testzero(p->x, curve->words)) {
-        eccint_set(res->x, 0, curve->words);
-        eccint_set(res->y, 0, curve->words);
+// Adds two ECC points on the curve. The affine formulas branch on the
+// coordinates anyway, so the infinity flags are checked first and an
+// operand at infinity costs no field operations.
+void eccint_book_point_add(const eccint_point_t *p, const eccint_point_t *q, eccint_point_t *res, const curve_t *curve) {
+    if (p->infinity) {
+        eccint_point_cpy(res, q, curve->words);
+        return;
+    }
+    if (q->infinity) {
+        eccint_point_cpy(res, p, curve->words);
+        return;
+    }
+
+    if (eccint_cmp(p->x, q->x, curve->words) == 0) {
+        if (eccint_cmp(p->y, q->y, curve->words) != 0) {
+            eccint_point_set_infinity(res, curve->words);
+        } else {
+            eccint_book_point_double(p, res, curve);
+        }
+        return;
+    }
+
+    eccint_book_point_add_distinct(p, q, res, curve);
+}
+
+// res = a * t, where a is the curve coefficient, which is mostly 0 or 1
+static void eccint_mul_a(const eccint_t *t, eccint_t *res, const curve_t *curve) {
+    if (eccint_testzero(curve->a, curve->words)) {
+        eccint_set(res, 0, curve->words);
+    } else if (eccint_testnumber(curve->a, 1, curve->words)) {
+        eccint_cpy(res, t, curve->words);
+    } else {
+        eccint_mul_mod(curve->a, t, curve->q, res, curve);
     }
+}
+
+// Double a point in López-Dahab coordinates, no inversion.
+// Z3 = X1^2 Z1^2, X3 = X1^4 + b Z1^4, Y3 = b Z1^4 Z3 + X3 (a Z3 + Y1^2 + b Z1^4)
+void eccint_ld_point_double(const eccint_ld_point_t *p, eccint_ld_point_t *res, const curve_t *curve) {
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *x2 = ecc_scratch_get(curve->words);
+    eccint_t *z2 = ecc_scratch_get(curve->words);
+    eccint_t *bz4 = ecc_scratch_get(curve->words);
+    eccint_t *z3 = ecc_scratch_get(curve->words);
+    eccint_t *x3 = ecc_scratch_get(curve->words);
+    eccint_t *t = ecc_scratch_get(curve->words);
+    eccint_t *u = ecc_scratch_get(curve->words);
+
+    ECC_COUNT(point_double);
+    if (eccint_testzero(p->z, curve->words)) {
+        eccint_cpy(res->x, p->x, curve->words);
+        eccint_cpy(res->y, p->y, curve->words);
+        eccint_set(res->z, 0, curve->words);
+        ecc_scratch_end(mark);
+        return;
+    }
+
+    eccint_square_mod(p->x, curve->q, x2, curve);
+    eccint_square_mod(p->z, curve->q, z2, curve);
+    eccint_mul_mod(x2, z2, curve->q, z3, curve);
+
+    eccint_square_mod(z2, curve->q, t, curve);
+    eccint_mul_mod(curve->b, t, curve->q, bz4, curve);
+    eccint_square_mod(x2, curve->q, t, curve);
+    eccint_add(t, bz4, x3, curve->words);
+
+    eccint_mul_a(z3, t, curve);
+    eccint_square_mod(p->y, curve->q, u, curve);
+    eccint_add(t, u, t, curve->words);
+    eccint_add(t, bz4, t, curve->words);
+    eccint_mul_mod(x3, t, curve->q, u, curve);
+    eccint_mul_mod(bz4, z3, curve->q, t, curve);
+
+    eccint_add(t, u, res->y, curve->words);
+    eccint_cpy(res->x, x3, curve->words);
+    eccint_cpy(res->z, z3, curve->words);
+    ecc_scratch_end(mark);
+}
 
+// Add an affine point to a point in López-Dahab coordinates, no inversion.
+// Hankerson et al, Section 3.2.3 (mixed coordinates).
+void eccint_ld_point_add_affine(const eccint_ld_point_t *p, const eccint_point_t *q, eccint_ld_point_t *res, const curve_t *curve) {
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *a = ecc_scratch_get(curve->words);
+    eccint_t *b = ecc_scratch_get(curve->words);
+    eccint_t *c = ecc_scratch_get(curve->words);
+    eccint_t *d = ecc_scratch_get(curve->words);
+    eccint_t *e = ecc_scratch_get(curve->words);
+    eccint_t *z2 = ecc_scratch_get(curve->words);
+    eccint_t *z3 = ecc_scratch_get(curve->words);
+    eccint_t *x3 = ecc_scratch_get(curve->words);
+    eccint_t *t = ecc_scratch_get(curve->words);
+
+    if (eccint_point_testinfinite(q, curve->words)) {
+        *res = *p;
+        ecc_scratch_end(mark);
+        return;
+    }
+    if (eccint_testzero(p->z, curve->words)) {
+        eccint_cpy(res->x, q->x, curve->words);
+        eccint_cpy(res->y, q->y, curve->words);
+        eccint_set(res->z, 0, curve->words);
+        res->z[0] = 1;
+        ecc_scratch_end(mark);
+        return;
+    }
+    ECC_COUNT(point_add);
+
+    // A = Y1 + y2 Z1^2, B = X1 + x2 Z1, C = Z1 B
+    eccint_square_mod(p->z, curve->q, z2, curve);
+    eccint_mul_mod(q->y, z2, curve->q, t, curve);
+    eccint_add(p->y, t, a, curve->words);
+    eccint_mul_mod(q->x, p->z, curve->q, t, curve);
+    eccint_add(p->x, t, b, curve->words);
+    eccint_mul_mod(p->z, b, curve->q, c, curve);
+
+    if (eccint_testzero(b, curve->words)) {
+        eccint_ld_point_t pq;
+        if (!eccint_testzero(a, curve->words)) {
+            // P = -Q
+            eccint_set(res->x, 0, curve->words);
+            eccint_set(res->y, 0, curve->words);
+            eccint_set(res->z, 0, curve->words);
+            res->x[0] = 1;
+            ecc_scratch_end(mark);
+            return;
+        }
+        eccint_cpy(pq.x, q->x, curve->words);
+        eccint_cpy(pq.y, q->y, curve->words);
+        eccint_set(pq.z, 0, curve->words);
+        pq.z[0] = 1;
+        eccint_ld_point_double(&pq, res, curve);
+        ecc_scratch_end(mark);
+        return;
+    }
+
+    // D = B^2 (C + a Z1^2), Z3 = C^2, E = A C
+    eccint_mul_a(z2, t, curve);
+    eccint_add(c, t, t, curve->words);
+    eccint_square_mod(b, curve->q, d, curve);
+    eccint_mul_mod(d, t, curve->q, d, curve);
+    eccint_square_mod(c, curve->q, z3, curve);
+    eccint_mul_mod(a, c, curve->q, e, curve);
+
+    // X3 = A^2 + D + E
+    eccint_square_mod(a, curve->q, x3, curve);
+    eccint_add(x3, d, x3, curve->words);
+    eccint_add(x3, e, x3, curve->words);
+
+    // Y3 = (E + Z3) (X3 + x2 Z3) + (x2 + y2) Z3^2
+    eccint_mul_mod(q->x, z3, curve->q, t, curve);
+    eccint_add(t, x3, t, curve->words);
+    eccint_add(e, z3, e, curve->words);
+    eccint_mul_mod(e, t, curve->q, d, curve);
+    eccint_square_mod(z3, curve->q, t, curve);
+    eccint_add(q->x, q->y, a, curve->words);
+    eccint_mul_mod(a, t, curve->q, e, curve);
+
+    eccint_add(d, e, res->y, curve->words);
+    eccint_cpy(res->x, x3, curve->words);
+    eccint_cpy(res->z, z3, curve->words);
+    ecc_scratch_end(mark);
+}
+
+// Convert |count| points to affine coordinates with a single inversion
+// (Montgomery's trick): invert the product of all Z and recover each 1/Z
+// from it with three multiplications. Points at infinity become the
+// point at infinity. |scratch| holds |count| field elements.
+void eccint_ld_point_normalize_batch(const eccint_ld_point_t *in, eccint_point_t *res, eccint_keyptr_t *scratch, const size_t count, const curve_t *curve) {
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *acc = ecc_scratch_get(curve->words);
+    eccint_t *inv = ecc_scratch_get(curve->words);
+    eccint_t *zinv = ecc_scratch_get(curve->words);
+    eccint_t *t = ecc_scratch_get(curve->words);
+
+    // scratch[i] = Z_0 * ... * Z_(i-1), skipping Z = 0
+    eccint_set(acc, 0, curve->words);
+    acc[0] = 1;
+    for (size_t i = 0; i < count; i++) {
+        eccint_cpy(scratch[i], acc, curve->words);
+        if (!eccint_testzero(in[i].z, curve->words)) {
+            eccint_mul_mod(acc, in[i].z, curve->q, acc, curve);
+        }
+    }
+
+    eccint_inv_mod(acc, curve->q, inv, curve);
+
+    for (size_t i = count; i-- > 0;) {
+        if (eccint_testzero(in[i].z, curve->words)) {
+            eccint_point_set_infinity(&res[i], curve->words);
+            continue;
+        }
+
+        // 1/Z_i = (1 / (Z_0 ... Z_i)) * (Z_0 ... Z_(i-1))
+        eccint_mul_mod(inv, scratch[i], curve->q, zinv, curve);
+        eccint_mul_mod(inv, in[i].z, curve->q, inv, curve);
+
+        eccint_mul_mod(in[i].x, zinv, curve->q, res[i].x, curve);
+        eccint_square_mod(zinv, curve->q, t, curve);
+        eccint_mul_mod(in[i].y, t, curve->q, res[i].y, curve);
+        res[i].infinity = 0;
+    }
+    ecc_scratch_end(mark);
+}
+
+// Halve a point, res = P / 2, such that res is in the odd order subgroup. P
+// must be in that subgroup too, i.e. Tr(x) = Tr(a) on a curve with h = 2.
+// Costs a half-trace, a square root and two multiplications, no inversion.
+void eccint_point_halve(const eccint_point_t *p, eccint_point_t *res, const curve_t *curve) {
+    ECC_COUNT(point_halve);
+    if (eccint_point_testinfinite(p, curve->words)) {
+        eccint_point_set_infinity(res, curve->words);
+        return;
+    }
+
+    // Hankerson et al, Section 3.6.1
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *lambda = ecc_scratch_get(curve->words);
+    eccint_t *t = ecc_scratch_get(curve->words);
+    eccint_t *u = ecc_scratch_get(curve->words);
+    eccint_t *v = ecc_scratch_get(curve->words);
+
+    // The halves Q and Q + (0, sqrt(b)) have the slopes lambda and
+    // lambda + 1, both solve lambda^2 + lambda = x + a
+    eccint_add(p->x, curve->a, t, curve->words);
+    eccint_halftrace(t, lambda, curve);
+
+    // t = y + x * (lambda + 1), which is u^2 for the correct lambda
+    lambda[0] ^= 1;
+    eccint_mul_mod(p->x, lambda, curve->q, t, curve);
+    lambda[0] ^= 1;
+    eccint_add(t, p->y, t, curve->words);
+
+    // The half in the subgroup satisfies Tr(u) = Tr(a)
+    if (eccint_trace(t, curve) != eccint_trace(curve->a, curve)) {
+        lambda[0] ^= 1;
+        eccint_add(t, p->x, t, curve->words);
+    }
+
+    // u = sqrt(t), v = u * (lambda + u)
+    eccint_sqrt(t, u, curve);
+    eccint_add(lambda, u, t, curve->words);
+    eccint_mul_mod(u, t, curve->q, v, curve);
+
+    eccint_cpy(res->x, u, curve->words);
+    eccint_cpy(res->y, v, curve->words);
+    res->infinity = 0;
+    ecc_scratch_end(mark);
+}
+
+// Recode the scalar for halving, k' = 2^(t-1) * k mod order where t is the bit
+// length of the order, and write k' in non-adjacent form. Then
+// k * P = sum k'_i * P / 2^(t-1-i). Returns t.
+static size_t halving_recode(const eccint_t *scalar, int8_t *naf, const curve_t *curve) {
+    const size_t size = curve->words + 1;
+    size_t t = eccint_degree(curve->order, curve->words) + 1;
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *k = ecc_scratch_get(size);
+    eccint_t *order = ecc_scratch_get(size);
+    eccint_t *one = ecc_scratch_get(size);
+
+    eccint_set(order, 0, size);
+    eccint_cpy(order, curve->order, curve->words);
+    eccint_set(one, 0, size);
+    one[0] = 1;
+
+    eccint_set(k, 0, size);
+    eccint_cpy(k, scalar, curve->words);
+    eccint_int_mod(k, order, k, size);
+
+    for (size_t i = 1; i < t; i++) {
+        eccint_shift_left(k, k, 1, size);
+        if (eccint_cmp(k, order, size) >= 0) {
+            eccint_int_sub(k, order, k, size);
+        }
+    }
+
+    // Knudsen's recoding uses the NAF, which has at most t + 1 digits
+    memset(naf, 0, t + 1);
+    for (size_t i = 0; !eccint_testzero(k, size); i++) {
+        if (k[0] & 1) {
+            if (k[0] & 2) {
+                naf[i] = -1;
+                eccint_int_add(k, one, k, size);
+            } else {
+                naf[i] = 1;
+                eccint_int_sub(k, one, k, size);
+            }
+        }
+        eccint_shift_right(k, k, 1, size);
+    }
+
+    ecc_scratch_end(mark);
+    return t;
+}
+
+// Multiplication using halve-and-add, for curves with cofactor 2. Points
+// outside the odd order subgroup and other curves use double-and-add.
+void eccint_halving_point_mul(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve) {
+    if (curve->h != 2 || eccint_testzero(curve->order, curve->words) ||
+        eccint_point_testinfinite(p, curve->words) ||
+        eccint_trace(p->x, curve) != eccint_trace(curve->a, curve)) {
+        eccint_binary_doublenadd_mul(scalar, p, res, curve);
+        return;
+    }
+
+    // Hankerson et al, Algorithm 3.91 with w = 2
+    const size_t mark = ecc_scratch_begin();
+    int8_t *naf = (void *) ecc_scratch_get(8 * curve->words + 2);
+    eccint_point_t q, negp;
+
+    size_t t = halving_recode(scalar, naf, curve);
+
+    // -P = (x, x + y)
+    eccint_cpy(negp.x, p->x, curve->words);
+    eccint_add(p->x, p->y, negp.y, curve->words);
+    negp.infinity = 0;
+
+    // Q <- \infty
+    eccint_point_set_infinity(&q, curve->words);
+
+    for (size_t i = 0; i < t; i++) {
+        // Q <- Q / 2 + k'_i * P
+        eccint_point_halve(&q, &q, curve);
+
+        if (naf[i] == 1) {
+            eccint_point_add(&q, p, &q, curve);
+        } else if (naf[i] == -1) {
+            eccint_point_add(&q, &negp, &q, curve);
+        }
+    }
+
+    // The NAF may be one digit longer than the order, that digit is 2 * P
+    if (naf[t]) {
+        eccint_point_t p2;
+        eccint_point_double(naf[t] == 1 ? p : &negp, &p2, curve);
+        eccint_point_add(&q, &p2, &q, curve);
+    }
+
+    eccint_point_cpy(res, &q, curve->words);
+    ecc_scratch_end(mark);
+}
+
+// Multiplication using the montgomery ladder
+void eccint_montgomery_ladder_point_mul(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve) {
     eccint_point_t r0, r1;
-    eccint_point_set(&r0, 0, curve->words);
+
+    // R0 <- \infty, R1 <- P
+    eccint_point_set_infinity(&r0, curve->words);
     eccint_point_cpy(&r1, p, curve->words);
 
-    for (ssize_t i = curve->m; i >= 0; i--) {
+    for (ssize_t i = eccint_degree(scalar, curve->words); i >= 0; i--) {
         if (eccint_testbit(scalar, i)) {
             eccint_point_add(&r0, &r1, &r0, curve);
             eccint_point_double(&r1, &r1, curve);
@@ -461,16 +1500,87 @@ void eccint_montgomery_ladder_point_mul(const eccint_t *scalar, const eccint_poi
     eccint_point_cpy(res, &r0, curve->words);
 }
 
+// x-only Montgomery ladder in López-Dahab coordinates, Hankerson et al,
+// Algorithm 3.40. Computes x(kP) = X/Z from x(P) alone, y is never needed.
+// |scalar| has |size| bytes, Z = 0 means kP is infinity.
+void eccint_ld_ladder_x(const eccint_t *scalar, const size_t size, const eccint_t *x, eccint_t *X, eccint_t *Z, const curve_t *curve) {
+    const size_t words = curve->words;
+    const size_t mark = ecc_scratch_begin();
+    eccint_t *x1 = ecc_scratch_get(words);
+    eccint_t *z1 = ecc_scratch_get(words);
+    eccint_t *x2 = ecc_scratch_get(words);
+    eccint_t *z2 = ecc_scratch_get(words);
+    eccint_t *t1 = ecc_scratch_get(words);
+    eccint_t *t2 = ecc_scratch_get(words);
+    eccint_t *t3 = ecc_scratch_get(words);
+    eccint_t *t4 = ecc_scratch_get(words);
+    ssize_t i = eccint_degree(scalar, size);
+
+    if (i < 0 || eccint_testzero(x, words)) {
+        // 0 * P = \infty, and P = (0, sqrt(b)) has order two, so kP = P for
+        // odd k
+        eccint_set(X, 0, words);
+        eccint_set(Z, 0, words);
+        if (i >= 0 && eccint_testbit(scalar, 0)) {
+            Z[0] = 1;
+        } else {
+            X[0] = 1;
+        }
+        ecc_scratch_end(mark);
+        return;
+    }
+
+    // (X1, Z1) = P, (X2, Z2) = 2P
+    eccint_cpy(x1, x, words);
+    eccint_set(z1, 0, words);
+    z1[0] = 1;
+    eccint_square_mod(x, curve->q, z2, curve);
+    eccint_square_mod(z2, curve->q, t1, curve);
+    eccint_add(t1, curve->b, x2, curve->words);
+
+    for (i--; i >= 0; i--) {
+        // With k_i = 1 add into (X1, Z1) and double (X2, Z2), else the
+        // other way around
+        const int bit = eccint_testbit(scalar, i);
+        eccint_t *ax = bit ? x1 : x2;
+        eccint_t *az = bit ? z1 : z2;
+        eccint_t *dx = bit ? x2 : x1;
+        eccint_t *dz = bit ? z2 : z1;
+
+        // Madd: Z = (X1 Z2 + X2 Z1)^2, X = x Z + (X1 Z2)(X2 Z1)
+        eccint_mul_mod(x1, z2, curve->q, t1, curve);
+        eccint_mul_mod(x2, z1, curve->q, t2, curve);
+        eccint_add(t1, t2, t3, words);
+        eccint_mul_mod(t1, t2, curve->q, t4, curve);
+        eccint_square_mod(t3, curve->q, az, curve);
+        eccint_mul_mod(x, az, curve->q, t1, curve);
+        eccint_add(t1, t4, ax, words);
+
+        // Mdouble: Z = X^2 Z^2, X = X^4 + b Z^4
+        eccint_square_mod(dx, curve->q, t1, curve);
+        eccint_square_mod(dz, curve->q, t2, curve);
+        eccint_mul_mod(t1, t2, curve->q, dz, curve);
+        eccint_square_mod(t1, curve->q, t3, curve);
+        eccint_square_mod(t2, curve->q, t4, curve);
+        eccint_mul_mod(curve->b, t4, curve->q, t1, curve);
+        eccint_add(t3, t1, dx, words);
+    }
+
+    eccint_cpy(X, x1, words);
+    eccint_cpy(Z, z1, words);
+    ecc_scratch_end(mark);
+}
+
 // Multiplication using double-and-add
 void eccint_binary_doublenadd_mul(const eccint_t *scalar, const eccint_point_t *p, eccint_point_t *res, const curve_t *curve) {
     // Algorithm 3.27
     eccint_point_t r0;
 
     // Q <- \infty
-    eccint_point_set(&r0, ECCINT_MAX, curve->words);
+    eccint_point_set_infinity(&r0, curve->words);
 
-    // For i from t - 1 downto 0 do
-    for (ssize_t i = eccint_degree(scalar, curve->words) - 1; i >= 0; i--) {
+    // For i from t - 1 downto 0 do, where t - 1 is the degree of the scalar
+    for (ssize_t i = eccint_degree(scalar, curve->words); i >= 0; i--) {
         // Q <- 2Q
         eccint_point_double(&r0, &r0, curve);
 
@@ -483,3 +1593,30 @@ void eccint_binary_doublenadd_mul(const eccint_t *scalar, const eccint_point_t *
 
     eccint_point_cpy(res, &r0, curve->words);
 }
+
+// Computes k * P + l * Q with one shared chain of doublings (Shamir's trick)
+void eccint_shamir_point_mul(const eccint_t *k, const eccint_point_t *p, const eccint_t *l, const eccint_point_t *q, eccint_point_t *res, const curve_t *curve) {
+    // Algorithm 3.48 with w = 1
+    eccint_point_t r0, pq;
+    ssize_t t = eccint_degree(k, curve->words);
+    ssize_t tl = eccint_degree(l, curve->words);
+
+    eccint_point_add(p, q, &pq, curve);
+    eccint_point_set_infinity(&r0, curve->words);
+
+    for (ssize_t i = t > tl ? t : tl; i >= 0; i--) {
+        eccint_point_double(&r0, &r0, curve);
+
+        int bk = eccint_testbit(k, i) ? 1 : 0;
+        int bl = eccint_testbit(l, i) ? 1 : 0;
+        if (bk && bl) {
+            eccint_point_add(&r0, &pq, &r0, curve);
+        } else if (bk) {
+            eccint_point_add(&r0, p, &r0, curve);
+        } else if (bl) {
+            eccint_point_add(&r0, q, &r0, curve);
+        }
+    }
+
+    eccint_point_cpy(res, &r0, curve->words);
+}
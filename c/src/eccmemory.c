@@ -41,16 +41,6 @@ int eccint_testzero(const eccint_t *in, const size_t size) {
     return 1;
 }
 
-// Checks if the eccint number is infinite
-int eccint_testinfinite(const eccint_t *in, const size_t size) {
-    for (size_t i = 0; i < size; i++) {
-        if (in[i] != ECCINT_MAX) {
-            return 0;
-        }
-    }
-    return 1;
-}
-
 // Checks if the eccint point is zero
 int eccint_point_testzero(const eccint_point_t *in, const size_t size) {
     return eccint_testzero(in->x, size) && eccint_testzero(in->y, size);
@@ -58,7 +48,8 @@ int eccint_point_testzero(const eccint_point_t *in, const size_t size) {
 
 // Checks if the eccint point is infinite
 int eccint_point_testinfinite(const eccint_point_t *in, const size_t size) {
-    return eccint_testinfinite(in->x, size) && eccint_testinfinite(in->y, size);
+    (void) size;
+    return in->infinity;
 }
 
 // Checks the eccint number against specific number (in the first word)
@@ -117,8 +108,12 @@ int eccint_cmp(const eccint_t *a, const eccint_t *b, const size_t size) {
     return 0;
 }
 
-// Compares eccint points, the same way
+// Compares eccint points, 0 if they are equal. All points at infinity are
+// equal, whatever their coordinates.
 int eccint_point_cmp(const eccint_point_t *a, const eccint_point_t *b, const size_t size) {
+    if (a->infinity || b->infinity) {
+        return a->infinity != b->infinity;
+    }
     return !(eccint_cmp(a->x, b->x, size) == 0 && eccint_cmp(a->y, b->y, size) == 0);
 }
 
@@ -126,12 +121,21 @@ int eccint_point_cmp(const eccint_point_t *a, const eccint_point_t *b, const siz
 void eccint_point_cpy(eccint_point_t *dst, const eccint_point_t *src, const size_t size) {
     eccint_cpy(dst->x, src->x, size);
     eccint_cpy(dst->y, src->y, size);
+    dst->infinity = src->infinity;
 }
 
-// Sets all point elements to a specific value
+// Sets both coordinates to a specific value, the point is finite
 void eccint_point_set(eccint_point_t *dst, const eccint_t elem, const size_t size) {
     eccint_set(dst->x, elem, size);
     eccint_set(dst->y, elem, size);
+    dst->infinity = 0;
+}
+
+// Sets the point to infinity
+void eccint_point_set_infinity(eccint_point_t *dst, const size_t size) {
+    eccint_set(dst->x, 0, size);
+    eccint_set(dst->y, 0, size);
+    dst->infinity = 1;
 }
 
 // Returns a uint32 number from the eccint number, usually for debugging
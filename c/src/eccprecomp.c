@@ -0,0 +1,223 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ecctypes.h"
+#include "eccmath.h"
+#include "eccmemory.h"
+#include "eccprecomp.h"
+#include "eccgenerated.h"
+
+#define FNV_OFFSET 0xCBF29CE484222325ULL
+#define FNV_PRIME 0x100000001B3ULL
+
+static uint64_t fnv1a(uint64_t hash, const void *data, const size_t size) {
+    const uint8_t *bytes = data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static size_t precomp_offset(void) {
+    size_t size = sizeof(ecc_precomp_header_t);
+    return (size + ECC_PRECOMP_ALIGN - 1) & ~((size_t) ECC_PRECOMP_ALIGN - 1);
+}
+
+static uint64_t precomp_checksum(const ecc_precomp_header_t *header, const eccint_point_t *table) {
+    uint64_t hash = fnv1a(FNV_OFFSET, &header->base, sizeof(eccint_point_t));
+    return fnv1a(hash, table, header->count * sizeof(eccint_point_t));
+}
+
+// Fingerprint of the curve parameters, used to make sure a table matches the
+// curve it is used with
+uint64_t ecc_curve_fingerprint(const curve_t *curve) {
+    uint64_t hash = FNV_OFFSET;
+    uint64_t m = curve->m;
+
+    hash = fnv1a(hash, &m, sizeof(m));
+    hash = fnv1a(hash, curve->q, curve->words);
+    hash = fnv1a(hash, curve->a, curve->words);
+    hash = fnv1a(hash, curve->b, curve->words);
+    hash = fnv1a(hash, curve->P.x, curve->words);
+    hash = fnv1a(hash, curve->P.y, curve->words);
+    hash = fnv1a(hash, curve->n, curve->words);
+    return hash;
+}
+
+// Build a fixed-base table for |base| in memory. The memory block has the same
+// layout as the file, so saving it is a single write.
+int ecc_precomp_build(ecc_precomp_t *pre, const eccint_point_t *base, const uint32_t kind, const curve_t *curve) {
+    size_t offset = precomp_offset();
+    size_t count = 8 * curve->words;
+    size_t size = offset + count * sizeof(eccint_point_t);
+    void *data;
+
+    memset(pre, 0, sizeof(ecc_precomp_t));
+
+    if (posix_memalign(&data, ECC_PRECOMP_ALIGN, size) != 0) {
+        return 0;
+    }
+    memset(data, 0, size);
+
+    ecc_precomp_header_t *header = data;
+    eccint_point_t *table = (eccint_point_t *) ((uint8_t *) data + offset);
+
+    memcpy(header->magic, ECC_PRECOMP_MAGIC, sizeof(header->magic));
+    header->version = ECC_PRECOMP_VERSION;
+    header->kind = kind;
+    header->keysize = KEYSIZE;
+    header->words = curve->words;
+    header->m = curve->m;
+    header->count = count;
+    header->offset = offset;
+    header->curve_id = ecc_curve_fingerprint(curve);
+    eccint_point_cpy(&header->base, base, KEYSIZE);
+
+    // table[i] = 2^i * base, already generated for the curve's base point
+    if (curve->generated && curve->generated->ptable && eccint_point_cmp(base, &curve->P, curve->words) == 0) {
+        memcpy(table, curve->generated->ptable, count * sizeof(eccint_point_t));
+    } else {
+        eccint_point_cpy(&table[0], base, KEYSIZE);
+        for (size_t i = 1; i < count; i++) {
+            eccint_point_double(&table[i - 1], &table[i], curve);
+        }
+    }
+
+    header->checksum = precomp_checksum(header, table);
+
+    pre->header = header;
+    pre->table = table;
+    pre->data = data;
+    pre->size = size;
+    pre->mapped = 0;
+    return 1;
+}
+
+// Write the table to |path|. The file is written under a temporary name and
+// renamed, so concurrent readers never map a partial file.
+int ecc_precomp_save(const ecc_precomp_t *pre, const char *path) {
+    size_t pathlen = strlen(path);
+    char tmppath[pathlen + 5];
+    const uint8_t *data = pre->data;
+    size_t left = pre->size;
+
+    memcpy(tmppath, path, pathlen);
+    memcpy(tmppath + pathlen, ".tmp", 5);
+
+    int fd = open(tmppath, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        return 0;
+    }
+
+    while (left > 0) {
+        ssize_t written = write(fd, data, left);
+        if (written <= 0) {
+            close(fd);
+            unlink(tmppath);
+            return 0;
+        }
+        data += written;
+        left -= written;
+    }
+
+    if (close(fd) != 0 || rename(tmppath, path) != 0) {
+        unlink(tmppath);
+        return 0;
+    }
+    return 1;
+}
+
+// Map a table file read-only. The file has to be a table of |kind| for
+// |base|, so a key table can't stand in for the table of P or the other way
+// round. Only the header is validated, unless ECC_PRECOMP_VERIFY is passed,
+// in which case the whole file is checksummed.
+int ecc_precomp_map(ecc_precomp_t *pre, const char *path, const eccint_point_t *base, const uint32_t kind, const curve_t *curve, const int flags) {
+    struct stat st;
+
+    memset(pre, 0, sizeof(ecc_precomp_t));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    if (fstat(fd, &st) != 0 || (size_t) st.st_size < sizeof(ecc_precomp_header_t)) {
+        close(fd);
+        return 0;
+    }
+
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        return 0;
+    }
+
+    const ecc_precomp_header_t *header = data;
+    const eccint_point_t *table = (const eccint_point_t *) ((const uint8_t *) data + header->offset);
+
+    if (memcmp(header->magic, ECC_PRECOMP_MAGIC, sizeof(header->magic)) != 0 ||
+        header->version != ECC_PRECOMP_VERSION ||
+        header->kind != kind ||
+        header->keysize != KEYSIZE ||
+        header->words != curve->words ||
+        header->m != curve->m ||
+        header->count < 8 * curve->words ||
+        header->offset != precomp_offset() ||
+        header->offset + header->count * sizeof(eccint_point_t) != (size_t) st.st_size ||
+        header->curve_id != ecc_curve_fingerprint(curve) ||
+        eccint_point_cmp(&header->base, base, curve->words) != 0) {
+        munmap(data, st.st_size);
+        return 0;
+    }
+
+    if ((flags & ECC_PRECOMP_VERIFY) && header->checksum != precomp_checksum(header, table)) {
+        munmap(data, st.st_size);
+        return 0;
+    }
+
+    pre->header = header;
+    pre->table = table;
+    pre->data = data;
+    pre->size = st.st_size;
+    pre->mapped = 1;
+    return 1;
+}
+
+// Release a table, regardless of whether it was built or mapped
+void ecc_precomp_free(ecc_precomp_t *pre) {
+    if (pre->data) {
+        if (pre->mapped) {
+            munmap(pre->data, pre->size);
+        } else {
+            free(pre->data);
+        }
+    }
+    memset(pre, 0, sizeof(ecc_precomp_t));
+}
+
+// Fixed-base multiplication, Q = scalar * base. With the doublings
+// precomputed this only needs one point addition per set bit.
+void eccint_precomp_point_mul(const eccint_t *scalar, const ecc_precomp_t *pre, eccint_point_t *res, const curve_t *curve) {
+    eccint_point_t r0;
+
+    // Q <- \infty
+    eccint_point_set_infinity(&r0, curve->words);
+
+    for (ssize_t i = eccint_degree(scalar, curve->words); i >= 0; i--) {
+        if (eccint_testbit(scalar, i)) {
+            // Q <- Q + 2^i * P
+            eccint_point_add(&r0, &pre->table[i], &r0, curve);
+        }
+    }
+
+    eccint_point_cpy(res, &r0, curve->words);
+}
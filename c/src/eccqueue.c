@@ -0,0 +1,249 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/eventfd.h>
+
+#include "ecctypes.h"
+#include "ecdsa.h"
+#include "eccqueue.h"
+
+/**
+ * Bounded multi-producer multi-consumer ring after D. Vyukov. Each cell
+ * carries a sequence number that tells producers and consumers whose turn it
+ * is, so both sides only need one compare-and-swap on their position and
+ * never take a lock. The semaphore counts published requests and lets idle
+ * workers sleep.
+ */
+typedef struct {
+    size_t seq;
+    ecc_sign_request_t *request;
+} ring_cell_t;
+
+struct _ecc_sign_queue_t {
+    ring_cell_t *cells;
+    size_t mask;
+
+    size_t enqueue_pos __attribute__((aligned(64)));
+    size_t dequeue_pos __attribute__((aligned(64)));
+
+    // Completed requests without a callback, newest first
+    ecc_sign_request_t *completed __attribute__((aligned(64)));
+
+    const curve_t *curve;
+    sem_t ready;
+    int event_fd;
+    int stop;
+
+    size_t threads;
+    pthread_t ids[];
+};
+
+static int ring_push(ecc_sign_queue_t *queue, ecc_sign_request_t *request) {
+    size_t pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+
+    for (;;) {
+        ring_cell_t *cell = &queue->cells[pos & queue->mask];
+        size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t) seq - (intptr_t) pos;
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&queue->enqueue_pos, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                cell->request = request;
+                __atomic_store_n(&cell->seq, pos + 1, __ATOMIC_RELEASE);
+                return 1;
+            }
+        } else if (diff < 0) {
+            // Full, the consumers have not caught up with this cell
+            return 0;
+        } else {
+            pos = __atomic_load_n(&queue->enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static ecc_sign_request_t *ring_pop(ecc_sign_queue_t *queue) {
+    size_t pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+
+    for (;;) {
+        ring_cell_t *cell = &queue->cells[pos & queue->mask];
+        size_t seq = __atomic_load_n(&cell->seq, __ATOMIC_ACQUIRE);
+        intptr_t diff = (intptr_t) seq - (intptr_t) (pos + 1);
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&queue->dequeue_pos, &pos, pos + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                ecc_sign_request_t *request = cell->request;
+                __atomic_store_n(&cell->seq, pos + queue->mask + 1, __ATOMIC_RELEASE);
+                return request;
+            }
+        } else if (diff < 0) {
+            // Empty, or the producer of this cell has not published it yet
+            return NULL;
+        } else {
+            pos = __atomic_load_n(&queue->dequeue_pos, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+static void queue_complete(ecc_sign_queue_t *queue, ecc_sign_request_t *request) {
+    if (request->done) {
+        request->done(request);
+        return;
+    }
+
+    ecc_sign_request_t *head = __atomic_load_n(&queue->completed, __ATOMIC_RELAXED);
+    do {
+        request->next = head;
+    } while (!__atomic_compare_exchange_n(&queue->completed, &head, request, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    uint64_t one = 1;
+    while (write(queue->event_fd, &one, sizeof(one)) < 0 && errno == EINTR) {}
+}
+
+static void *queue_worker(void *data) {
+    ecc_sign_queue_t *queue = data;
+
+    for (;;) {
+        while (sem_wait(&queue->ready) != 0) {}
+
+        ecc_sign_request_t *request;
+        while (!(request = ring_pop(queue))) {
+            // Once stopping nothing is submitted any more, so an empty ring
+            // is really empty. Otherwise the request is being published.
+            if (__atomic_load_n(&queue->stop, __ATOMIC_ACQUIRE)) {
+                return NULL;
+            }
+            sched_yield();
+        }
+
+        if (request->deadline && ecc_sign_queue_now() > request->deadline) {
+            request->status = ECC_SIGN_EXPIRED;
+        } else {
+            ecc_sign(request->privatekey, request->hash, &request->signature, queue->curve);
+            request->status = ECC_SIGN_DONE;
+        }
+        queue_complete(queue, request);
+    }
+}
+
+// Monotonic time in nanoseconds, the clock of request deadlines
+uint64_t ecc_sign_queue_now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Create a queue for |curve| that holds up to |capacity| requests, rounded up
+// to a power of two, and signs them on |threads| workers (one per CPU if 0)
+ecc_sign_queue_t *ecc_sign_queue_create(const size_t capacity, const size_t threads, const curve_t *curve) {
+    size_t size = 2;
+    size_t workers = threads;
+
+    while (size < capacity) {
+        size <<= 1;
+    }
+    if (!workers) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = cpus > 0 ? cpus : 1;
+    }
+
+    ecc_sign_queue_t *queue = calloc(1, sizeof(ecc_sign_queue_t) + workers * sizeof(pthread_t));
+    if (!queue) {
+        return NULL;
+    }
+    queue->cells = calloc(size, sizeof(ring_cell_t));
+    queue->event_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (!queue->cells || queue->event_fd < 0) {
+        if (queue->event_fd >= 0) {
+            close(queue->event_fd);
+        }
+        free(queue->cells);
+        free(queue);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < size; i++) {
+        queue->cells[i].seq = i;
+    }
+    queue->mask = size - 1;
+    queue->curve = curve;
+    sem_init(&queue->ready, 0, 0);
+
+    for (size_t t = 0; t < workers; t++) {
+        if (pthread_create(&queue->ids[t], NULL, queue_worker, queue) != 0) {
+            queue->threads = t;
+            ecc_sign_queue_destroy(queue);
+            return NULL;
+        }
+    }
+    queue->threads = workers;
+    return queue;
+}
+
+// Finish all submitted requests and free the queue. Completed requests that
+// were not taken with ecc_sign_queue_completed() are dropped. No thread may
+// submit while this runs.
+void ecc_sign_queue_destroy(ecc_sign_queue_t *queue) {
+    if (!queue) {
+        return;
+    }
+
+    __atomic_store_n(&queue->stop, 1, __ATOMIC_RELEASE);
+    for (size_t t = 0; t < queue->threads; t++) {
+        sem_post(&queue->ready);
+    }
+    for (size_t t = 0; t < queue->threads; t++) {
+        pthread_join(queue->ids[t], NULL);
+    }
+
+    sem_destroy(&queue->ready);
+    close(queue->event_fd);
+    free(queue->cells);
+    free(queue);
+}
+
+// Queue a request without blocking. Returns 0 if the queue is full, the
+// caller then has to back off and submit again later.
+int ecc_sign_queue_submit(ecc_sign_queue_t *queue, ecc_sign_request_t *request) {
+    request->status = ECC_SIGN_PENDING;
+    request->next = NULL;
+
+    if (!ring_push(queue, request)) {
+        return 0;
+    }
+    sem_post(&queue->ready);
+    return 1;
+}
+
+// File descriptor that becomes readable when requests without a callback
+// complete, for use with poll or epoll
+int ecc_sign_queue_fd(const ecc_sign_queue_t *queue) {
+    return queue->event_fd;
+}
+
+// Take all completed requests without a callback, oldest first, linked
+// through |next|. Returns NULL if there are none.
+ecc_sign_request_t *ecc_sign_queue_completed(ecc_sign_queue_t *queue) {
+    uint64_t value;
+
+    // Clear the event first, so completions after the exchange signal again
+    while (read(queue->event_fd, &value, sizeof(value)) < 0 && errno == EINTR) {}
+
+    ecc_sign_request_t *head = __atomic_exchange_n(&queue->completed, NULL, __ATOMIC_ACQUIRE);
+    ecc_sign_request_t *list = NULL;
+    while (head) {
+        ecc_sign_request_t *next = head->next;
+        head->next = list;
+        list = head;
+        head = next;
+    }
+    return list;
+}
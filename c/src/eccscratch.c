@@ -0,0 +1,77 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#include "eccscratch.h"
+
+_Thread_local ecc_scratch_t ecc_scratch;
+
+static pthread_once_t scratch_once = PTHREAD_ONCE_INIT;
+static pthread_key_t scratch_key;
+
+// Highest top of any thread, only kept with ECC_SCRATCH_DEBUG
+static size_t scratch_highwater = 0;
+
+static void scratch_thread_exit(void *data) {
+    free(data);
+}
+
+static void scratch_init(void) {
+    pthread_key_create(&scratch_key, scratch_thread_exit);
+}
+
+// Slow path of ecc_scratch_get: allocate the thread's arena on first use, or
+// give up if it is full
+eccint_t *ecc_scratch_grow(const size_t bytes) {
+    if (!ecc_scratch.base) {
+        pthread_once(&scratch_once, scratch_init);
+
+        ecc_scratch.base = aligned_alloc(ECC_SCRATCH_ALIGN, ECC_SCRATCH_SIZE);
+        if (!ecc_scratch.base) {
+            fprintf(stderr, "ecc_scratch: out of memory\n");
+            abort();
+        }
+        pthread_setspecific(scratch_key, ecc_scratch.base);
+        ecc_scratch.top = 0;
+    }
+
+    if (ecc_scratch.top + bytes > ECC_SCRATCH_SIZE) {
+        fprintf(stderr, "ecc_scratch: %zu of %d bytes used, %zu more requested\n",
+                ecc_scratch.top, ECC_SCRATCH_SIZE, bytes);
+        abort();
+    }
+    return ecc_scratch_get(bytes);
+}
+
+// Record a new peak of this thread
+void ecc_scratch_peak(void) {
+#ifdef ECC_SCRATCH_DEBUG
+    size_t top = ecc_scratch.top;
+    size_t seen = __atomic_load_n(&scratch_highwater, __ATOMIC_RELAXED);
+
+    ecc_scratch.peak = top;
+    while (top > seen && !__atomic_compare_exchange_n(&scratch_highwater, &seen, top, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+    }
+#endif
+}
+
+// The most scratch any thread has used at once, 0 without ECC_SCRATCH_DEBUG
+size_t ecc_scratch_highwater(void) {
+    return __atomic_load_n(&scratch_highwater, __ATOMIC_RELAXED);
+}
+
+void ecc_scratch_report(FILE *out) {
+#ifdef ECC_SCRATCH_DEBUG
+    size_t highwater = ecc_scratch_highwater();
+    fprintf(out, "scratch: %zu of %d bytes per thread (%zu slots of %d)\n",
+            highwater, ECC_SCRATCH_SIZE, highwater / ECC_SCRATCH_ALIGN, ECC_SCRATCH_ALIGN);
+#else
+    fprintf(out, "scratch: %d bytes per thread, build with SCRATCH_DEBUG=1 for the high-water mark\n",
+            ECC_SCRATCH_SIZE);
+#endif
+}
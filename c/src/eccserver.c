@@ -0,0 +1,615 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sys/eventfd.h>
+
+#include "ecctypes.h"
+#include "eccmemory.h"
+#include "ecdsa.h"
+#include "eccbatch.h"
+#include "ecckeycache.h"
+#include "eccverifycache.h"
+#include "eccserver.h"
+
+#define SERVER_BUFFER 4096
+
+// Inline keys that are remembered as validated
+#define SERVER_KEYCACHE 1024
+
+// Valid signatures that are remembered, replays are answered right away
+#define SERVER_VERIFYCACHE 4096
+
+// Queued responses above which a client's requests wait until it reads
+#define SERVER_BACKLOG (16 * SERVER_BUFFER)
+
+typedef struct {
+    int fd;
+    int dead;
+    size_t used;
+    uint8_t in[SERVER_BUFFER];
+
+    /* Responses the socket didn't take yet, sent on POLLOUT by the main
+     * loop so a slow reader never holds up the other clients. */
+    uint8_t *out;
+    size_t out_used;
+    size_t out_size;
+} server_client_t;
+
+struct _ecc_server_t {
+    const curve_t *curve;
+    ecc_server_key_t *keys;
+    size_t count;
+
+    char path[sizeof(((struct sockaddr_un *) 0)->sun_path)];
+    int listen_fd;
+    int stop_fd;
+
+    server_client_t **clients;
+    size_t clients_used;
+    size_t clients_size;
+
+    ecc_pool_t *pool;
+    ecc_keycache_t *keycache;
+    ecc_verifycache_t *verifycache;
+
+    /* Nonces are computed ahead by a background thread, so signing only
+     * costs a few scalar operations. Guarded by nonce_lock. */
+    ecc_nonce_t *nonces;
+    size_t nonces_size;
+    size_t nonces_head;
+    size_t nonces_used;
+    int nonces_stop;
+    int nonces_started;
+    pthread_mutex_t nonce_lock;
+    pthread_cond_t nonce_cond;
+    pthread_t nonce_thread;
+
+    // Verifies of the current round, answered together after one batch
+    size_t batch;
+    server_client_t *owners[ECC_SERVER_BATCH];
+    ecc_server_header_t headers[ECC_SERVER_BATCH];
+    eccint_point_t publickeys[ECC_SERVER_BATCH];
+    eccint_keyptr_t hashes[ECC_SERVER_BATCH];
+    eccint_signature_t signatures[ECC_SERVER_BATCH];
+    int results[ECC_SERVER_BATCH];
+};
+
+// --- nonce pool ---
+
+static void *nonce_worker(void *data) {
+    ecc_server_t *server = data;
+    ecc_nonce_t nonce;
+
+    pthread_mutex_lock(&server->nonce_lock);
+    while (!server->nonces_stop) {
+        if (server->nonces_used == server->nonces_size) {
+            pthread_cond_wait(&server->nonce_cond, &server->nonce_lock);
+            continue;
+        }
+        pthread_mutex_unlock(&server->nonce_lock);
+
+        ecc_nonce_generate(&nonce, server->curve);
+
+        pthread_mutex_lock(&server->nonce_lock);
+        if (server->nonces_used < server->nonces_size) {
+            size_t tail = (server->nonces_head + server->nonces_used) % server->nonces_size;
+            server->nonces[tail] = nonce;
+            server->nonces_used++;
+        }
+    }
+    pthread_mutex_unlock(&server->nonce_lock);
+    return NULL;
+}
+
+// Take a precomputed nonce, or compute one if the pool ran dry
+static void nonce_take(ecc_server_t *server, ecc_nonce_t *nonce) {
+    int found = 0;
+
+    pthread_mutex_lock(&server->nonce_lock);
+    if (server->nonces_used) {
+        *nonce = server->nonces[server->nonces_head];
+        memset(&server->nonces[server->nonces_head], 0, sizeof(ecc_nonce_t));
+        server->nonces_head = (server->nonces_head + 1) % server->nonces_size;
+        server->nonces_used--;
+        found = 1;
+        pthread_cond_signal(&server->nonce_cond);
+    }
+    pthread_mutex_unlock(&server->nonce_lock);
+
+    if (!found) {
+        ecc_nonce_generate(nonce, server->curve);
+    }
+}
+
+// --- clients ---
+
+// Write as much of |data| as the socket takes without blocking, returns how
+// much that was
+static size_t client_write(server_client_t *client, const uint8_t *data, const size_t size) {
+    size_t done = 0;
+
+    while (!client->dead && done < size) {
+        ssize_t n = send(client->fd, data + done, size - done, MSG_NOSIGNAL);
+        if (n > 0) {
+            done += n;
+        } else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        } else if (n < 0 && errno != EINTR) {
+            client->dead = 1;
+        }
+    }
+    return done;
+}
+
+// Send the queued responses, called when the socket is writable
+static void client_flush(server_client_t *client) {
+    size_t done = client_write(client, client->out, client->out_used);
+
+    memmove(client->out, client->out + done, client->out_used - done);
+    client->out_used -= done;
+}
+
+static void client_send(server_client_t *client, const void *data, const size_t size) {
+    size_t done = 0;
+
+    // Nothing may overtake what is already queued
+    if (!client->out_used) {
+        done = client_write(client, data, size);
+    }
+    if (client->dead || done == size) {
+        return;
+    }
+
+    if (client->out_used + size - done > client->out_size) {
+        size_t grow = client->out_size ? 2 * client->out_size : SERVER_BUFFER;
+        while (grow < client->out_used + size - done) {
+            grow *= 2;
+        }
+        uint8_t *out = realloc(client->out, grow);
+        if (!out) {
+            client->dead = 1;
+            return;
+        }
+        client->out = out;
+        client->out_size = grow;
+    }
+    memcpy(client->out + client->out_used, (const uint8_t *) data + done, size - done);
+    client->out_used += size - done;
+}
+
+static void client_respond(server_client_t *client, const ecc_server_header_t *request, const uint8_t status, const eccint_t *payload, const size_t length) {
+    uint8_t buf[sizeof(ecc_server_header_t) + 4 * KEYSIZE];
+    ecc_server_header_t header = *request;
+
+    header.status = status;
+    header.length = length;
+    memcpy(buf, &header, sizeof(header));
+    if (length) {
+        memcpy(buf + sizeof(header), payload, length);
+    }
+    client_send(client, buf, sizeof(header) + length);
+}
+
+// --- requests ---
+
+// Answer the verifies collected so far
+static void server_flush(ecc_server_t *server) {
+    if (!server->batch) {
+        return;
+    }
+
+    ecc_verify_batch_parallel(server->pool, server->publickeys, (const eccint_keyptr_t *) server->hashes, server->signatures, server->results, server->batch, server->curve, NULL, NULL);
+
+    for (size_t i = 0; i < server->batch; i++) {
+        uint8_t status = server->results[i] ? ECC_SERVER_OK : ECC_SERVER_INVALID;
+        if (server->results[i]) {
+            ecc_verifycache_insert(server->verifycache, &server->publickeys[i], server->hashes[i], &server->signatures[i]);
+        }
+        client_respond(server->owners[i], &server->headers[i], status, NULL, 0);
+    }
+    server->batch = 0;
+}
+
+static void server_sign(ecc_server_t *server, server_client_t *client, const ecc_server_header_t *header, const uint8_t *payload) {
+    const size_t words = server->curve->words;
+    eccint_t response[2 * KEYSIZE];
+    eccint_signature_t signature;
+    ecc_nonce_t nonce;
+
+    if (header->key >= server->count) {
+        client_respond(client, header, ECC_SERVER_NOKEY, NULL, 0);
+        return;
+    }
+    if (header->length != words) {
+        client_respond(client, header, ECC_SERVER_BADREQUEST, NULL, 0);
+        return;
+    }
+
+    do {
+        nonce_take(server, &nonce);
+    } while (!ecc_sign_nonce(server->keys[header->key].privatekey, payload, &nonce, &signature, server->curve));
+    memset(&nonce, 0, sizeof(nonce));
+
+    eccint_cpy(response, signature.r, words);
+    eccint_cpy(response + words, signature.s, words);
+    client_respond(client, header, ECC_SERVER_OK, response, 2 * words);
+}
+
+static void server_verify(ecc_server_t *server, server_client_t *client, const ecc_server_header_t *header, const uint8_t *payload) {
+    const size_t words = server->curve->words;
+    const int inline_key = header->key == ECC_SERVER_KEY_INLINE;
+    size_t i = server->batch;
+
+    if (!inline_key && header->key >= server->count) {
+        client_respond(client, header, ECC_SERVER_NOKEY, NULL, 0);
+        return;
+    }
+    if (header->length != (inline_key ? 5 : 3) * words) {
+        client_respond(client, header, ECC_SERVER_BADREQUEST, NULL, 0);
+        return;
+    }
+
+    if (inline_key) {
+        eccint_cpy(server->publickeys[i].x, payload, words);
+        eccint_cpy(server->publickeys[i].y, payload + words, words);
+        server->publickeys[i].infinity = 0;
+        payload += 2 * words;
+
+        // Keys from clients are validated the first time they are seen
+        if (!ecc_keycache_validate(server->keycache, &server->publickeys[i])) {
+            client_respond(client, header, ECC_SERVER_INVALID, NULL, 0);
+            return;
+        }
+    } else {
+        server->publickeys[i] = server->keys[header->key].publickey;
+    }
+    eccint_cpy(server->hashes[i], payload, words);
+    eccint_cpy(server->signatures[i].r, payload + words, words);
+    eccint_cpy(server->signatures[i].s, payload + 2 * words, words);
+
+    // A replay of a valid signature doesn't wait for the batch
+    if (ecc_verifycache_lookup(server->verifycache, &server->publickeys[i], server->hashes[i], &server->signatures[i])) {
+        client_respond(client, header, ECC_SERVER_OK, NULL, 0);
+        return;
+    }
+    server->owners[i] = client;
+    server->headers[i] = *header;
+
+    if (++server->batch == ECC_SERVER_BATCH) {
+        server_flush(server);
+    }
+}
+
+static void server_request(ecc_server_t *server, server_client_t *client, const ecc_server_header_t *header, const uint8_t *payload) {
+    const size_t words = server->curve->words;
+    eccint_t response[2 * KEYSIZE];
+
+    switch (header->op) {
+        case ECC_SERVER_SIGN:
+            server_sign(server, client, header, payload);
+            break;
+        case ECC_SERVER_VERIFY:
+            server_verify(server, client, header, payload);
+            break;
+        case ECC_SERVER_PUBKEY:
+            if (header->key >= server->count) {
+                client_respond(client, header, ECC_SERVER_NOKEY, NULL, 0);
+                break;
+            }
+            eccint_cpy(response, server->keys[header->key].publickey.x, words);
+            eccint_cpy(response + words, server->keys[header->key].publickey.y, words);
+            client_respond(client, header, ECC_SERVER_OK, response, 2 * words);
+            break;
+        default:
+            client_respond(client, header, ECC_SERVER_BADREQUEST, NULL, 0);
+            break;
+    }
+}
+
+// Read what the client sent and handle every complete request in it
+static void server_read(ecc_server_t *server, server_client_t *client) {
+    ssize_t n = recv(client->fd, client->in + client->used, SERVER_BUFFER - client->used, 0);
+
+    if (n == 0 || (n < 0 && errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)) {
+        client->dead = 1;
+        return;
+    }
+    if (n < 0) {
+        return;
+    }
+    client->used += n;
+
+    size_t pos = 0;
+    while (!client->dead && client->used - pos >= sizeof(ecc_server_header_t)) {
+        ecc_server_header_t header;
+        memcpy(&header, client->in + pos, sizeof(header));
+
+        // A broken stream can't be resynchronized
+        if (header.magic != ECC_SERVER_MAGIC || header.length > SERVER_BUFFER - sizeof(header)) {
+            client->dead = 1;
+            return;
+        }
+        if (client->used - pos < sizeof(header) + header.length) {
+            break;
+        }
+
+        server_request(server, client, &header, client->in + pos + sizeof(header));
+        pos += sizeof(header) + header.length;
+    }
+
+    // The payload of queued verifies was copied, so the buffer can move
+    memmove(client->in, client->in + pos, client->used - pos);
+    client->used -= pos;
+}
+
+static void server_accept(ecc_server_t *server) {
+    for (;;) {
+        int fd = accept4(server->listen_fd, NULL, NULL, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return;
+        }
+
+        // Only processes of the server's own user may sign
+        struct ucred cred;
+        socklen_t len = sizeof(cred);
+        if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &cred, &len) != 0 || (cred.uid != geteuid() && cred.uid != 0)) {
+            close(fd);
+            continue;
+        }
+
+        server_client_t *client = calloc(1, sizeof(server_client_t));
+        if (client && server->clients_used == server->clients_size) {
+            size_t size = server->clients_size ? 2 * server->clients_size : 16;
+            server_client_t **clients = realloc(server->clients, size * sizeof(server_client_t *));
+            if (clients) {
+                server->clients = clients;
+                server->clients_size = size;
+            }
+        }
+        if (!client || server->clients_used == server->clients_size) {
+            free(client);
+            close(fd);
+            continue;
+        }
+
+        client->fd = fd;
+        server->clients[server->clients_used++] = client;
+    }
+}
+
+static void server_reap(ecc_server_t *server) {
+    size_t kept = 0;
+
+    for (size_t c = 0; c < server->clients_used; c++) {
+        server_client_t *client = server->clients[c];
+        if (client->dead) {
+            close(client->fd);
+            free(client->out);
+            free(client);
+        } else {
+            server->clients[kept++] = client;
+        }
+    }
+    server->clients_used = kept;
+}
+
+// --- server ---
+
+// Remove the socket of a server that went away. Anything else at |path|,
+// including the socket of a server that still accepts, is left alone.
+static int server_unlink_stale(const char *path, const struct sockaddr_un *addr) {
+    struct stat st;
+
+    if (lstat(path, &st) != 0) {
+        return errno == ENOENT;
+    }
+    if (!S_ISSOCK(st.st_mode) || st.st_uid != geteuid()) {
+        errno = EEXIST;
+        return 0;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return 0;
+    }
+    int live = connect(fd, (const struct sockaddr *) addr, sizeof(*addr)) == 0;
+    close(fd);
+    if (live) {
+        errno = EADDRINUSE;
+        return 0;
+    }
+    return unlink(path) == 0 || errno == ENOENT;
+}
+
+// Create a server for |keys| listening on the Unix socket |path|. Verifies
+// run on |threads| workers (one per CPU if 0), and up to |nonces| nonces are
+// computed ahead for signing. The keys are copied.
+ecc_server_t *ecc_server_create(const char *path, const ecc_server_key_t *keys, const size_t count, const curve_t *curve, const size_t threads, const size_t nonces) {
+    struct sockaddr_un addr;
+    int err;
+
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        return NULL;
+    }
+
+    ecc_server_t *server = calloc(1, sizeof(ecc_server_t));
+    if (!server) {
+        return NULL;
+    }
+    server->curve = curve;
+    server->listen_fd = -1;
+    server->stop_fd = -1;
+    server->nonces_size = nonces ? nonces : 1;
+    pthread_mutex_init(&server->nonce_lock, NULL);
+    pthread_cond_init(&server->nonce_cond, NULL);
+
+    server->keys = malloc(count * sizeof(ecc_server_key_t));
+    server->nonces = calloc(server->nonces_size, sizeof(ecc_nonce_t));
+    server->pool = ecc_pool_create(threads);
+    server->keycache = ecc_keycache_create(SERVER_KEYCACHE, curve);
+    server->verifycache = ecc_verifycache_create(SERVER_VERIFYCACHE, curve);
+    if ((count && !server->keys) || !server->nonces || !server->pool || !server->keycache || !server->verifycache) {
+        goto fail;
+    }
+    memcpy(server->keys, keys, count * sizeof(ecc_server_key_t));
+    server->count = count;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, path);
+
+    if (!server_unlink_stale(path, &addr)) {
+        goto fail;
+    }
+    server->listen_fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (server->listen_fd < 0 || bind(server->listen_fd, (struct sockaddr *) &addr, sizeof(addr)) != 0) {
+        goto fail;
+    }
+    strcpy(server->path, path);
+
+    // Nobody can connect before listen, so the mode is in place before the
+    // first client whatever the umask was
+    if (chmod(path, 0600) != 0 || listen(server->listen_fd, SOMAXCONN) != 0) {
+        goto fail;
+    }
+
+    server->stop_fd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (server->stop_fd < 0 || pthread_create(&server->nonce_thread, NULL, nonce_worker, server) != 0) {
+        goto fail;
+    }
+    server->nonces_started = 1;
+    return server;
+
+fail:
+    // Keep the reason for the caller
+    err = errno;
+    ecc_server_destroy(server);
+    errno = err;
+    return NULL;
+}
+
+// Serve requests until ecc_server_stop is called. Returns 0 on an error.
+int ecc_server_run(ecc_server_t *server) {
+    struct pollfd *pfds = NULL;
+    size_t pfds_size = 0;
+    int ok = 1;
+
+    for (;;) {
+        if (pfds_size < server->clients_used + 2) {
+            pfds_size = server->clients_used + 2;
+            struct pollfd *grown = realloc(pfds, pfds_size * sizeof(struct pollfd));
+            if (!grown) {
+                ok = 0;
+                break;
+            }
+            pfds = grown;
+        }
+
+        pfds[0] = (struct pollfd) { server->stop_fd, POLLIN, 0 };
+        pfds[1] = (struct pollfd) { server->listen_fd, POLLIN, 0 };
+        for (size_t c = 0; c < server->clients_used; c++) {
+            server_client_t *client = server->clients[c];
+            short events = client->out_used < SERVER_BACKLOG ? POLLIN : 0;
+            if (client->out_used) {
+                events |= POLLOUT;
+            }
+            pfds[c + 2] = (struct pollfd) { client->fd, events, 0 };
+        }
+
+        const size_t polled = server->clients_used;
+        if (poll(pfds, polled + 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            ok = 0;
+            break;
+        }
+        if (pfds[0].revents) {
+            break;
+        }
+
+        // Everything that arrived in this round is handled together, so
+        // verifies of concurrent clients end up in the same batch
+        for (size_t c = 0; c < polled; c++) {
+            if (pfds[c + 2].revents & POLLOUT) {
+                client_flush(server->clients[c]);
+            }
+            if (pfds[c + 2].revents & ~POLLOUT) {
+                server_read(server, server->clients[c]);
+            }
+        }
+        server_flush(server);
+        server_reap(server);
+
+        if (pfds[1].revents) {
+            server_accept(server);
+        }
+    }
+
+    free(pfds);
+    return ok;
+}
+
+// Make ecc_server_run return. Safe to call from a signal handler.
+void ecc_server_stop(ecc_server_t *server) {
+    uint64_t one = 1;
+    while (write(server->stop_fd, &one, sizeof(one)) < 0 && errno == EINTR) {}
+}
+
+void ecc_server_destroy(ecc_server_t *server) {
+    if (!server) {
+        return;
+    }
+
+    if (server->nonces_started) {
+        pthread_mutex_lock(&server->nonce_lock);
+        server->nonces_stop = 1;
+        pthread_cond_signal(&server->nonce_cond);
+        pthread_mutex_unlock(&server->nonce_lock);
+        pthread_join(server->nonce_thread, NULL);
+    }
+    if (server->stop_fd >= 0) {
+        close(server->stop_fd);
+    }
+
+    for (size_t c = 0; c < server->clients_used; c++) {
+        close(server->clients[c]->fd);
+        free(server->clients[c]->out);
+        free(server->clients[c]);
+    }
+    if (server->listen_fd >= 0) {
+        close(server->listen_fd);
+    }
+    if (server->path[0]) {
+        unlink(server->path);
+    }
+
+    ecc_pool_destroy(server->pool);
+    ecc_keycache_destroy(server->keycache);
+    ecc_verifycache_destroy(server->verifycache);
+    if (server->keys) {
+        memset(server->keys, 0, server->count * sizeof(ecc_server_key_t));
+    }
+    if (server->nonces) {
+        memset(server->nonces, 0, server->nonces_size * sizeof(ecc_nonce_t));
+    }
+    free(server->keys);
+    free(server->nonces);
+    free(server->clients);
+    pthread_cond_destroy(&server->nonce_cond);
+    pthread_mutex_destroy(&server->nonce_lock);
+    free(server);
+}
@@ -0,0 +1,222 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+
+#include "ecctypes.h"
+#include "eccmath.h"
+#include "eccmemory.h"
+#include "ecctables.h"
+#include "eccgenerated.h"
+
+static int linmap_alloc(eccint_linmap_t *map, const curve_t *curve) {
+    map->table = calloc(256 * curve->words, curve->words);
+    return map->table != NULL;
+}
+
+static void linmap_free(eccint_linmap_t *map) {
+    free(map->table);
+    map->table = NULL;
+}
+
+// Fill the byte tables of a linear map from the images of the basis elements
+// z^i, i in [0, m). |basis| holds m field elements.
+static void linmap_from_basis(eccint_linmap_t *map, const eccint_t *basis, const curve_t *curve) {
+    const size_t words = curve->words;
+
+    for (size_t j = 0; j < words; j++) {
+        eccint_t *row = map->table + j * 256 * words;
+        eccint_set(row, 0, words);
+
+        for (size_t v = 1; v < 256; v++) {
+            // f(v) = f(v without its lowest bit) + f(lowest bit)
+            size_t low = 0;
+            while (!(v & (1 << low))) {
+                low++;
+            }
+
+            eccint_t *entry = row + v * words;
+            eccint_cpy(entry, row + (v & (v - 1)) * words, words);
+            if (8 * j + low < curve->m) {
+                eccint_add(entry, basis + (8 * j + low) * words, entry, words);
+            }
+        }
+    }
+}
+
+// Apply a linear map, res = f(a). Costs one table lookup and add per word.
+void eccint_linmap_apply(const eccint_linmap_t *map, const eccint_t *a, eccint_t *res, const curve_t *curve) {
+    const size_t words = curve->words;
+    eccint_t sum[words];
+
+    eccint_set(sum, 0, words);
+    for (size_t j = 0; j < words; j++) {
+        if (a[j]) {
+            eccint_add(sum, map->table + (j * 256 + a[j]) * words, sum, words);
+        }
+    }
+    eccint_cpy(res, sum, words);
+}
+
+// Images of the basis under squaring, z^i -> z^(2i) mod f(z)
+static void square_basis(eccint_t *basis, const curve_t *curve) {
+    eccint_t wide[2 * curve->words];
+
+    for (size_t i = 0; i < curve->m; i++) {
+        eccint_set(wide, 0, 2 * curve->words);
+        eccint_setbit(wide, 2 * i, 1);
+        eccint_general_mod(wide, curve->q, basis + i * curve->words, curve);
+    }
+}
+
+// Precompute the curve's tables. Call once before sharing the curve, the
+// arithmetic falls back to the generic code for curves without tables.
+int ecc_curve_init(curve_t *curve) {
+    const size_t words = curve->words;
+    curve_tables_t *tables;
+    eccint_t *basis;
+    eccint_t t[words];
+    eccint_t sum[words];
+
+    if (curve->tables) {
+        return 1;
+    }
+
+    tables = calloc(1, sizeof(curve_tables_t));
+    basis = calloc(curve->m, words);
+    if (!tables || !basis || !linmap_alloc(&tables->square, curve)) {
+        free(tables);
+        free(basis);
+        return 0;
+    }
+
+    for (size_t i = 0; i < 8; i++) {
+        eccint_set(tables->qshift[i], 0, words + 1);
+        eccint_cpy(tables->qshift[i], curve->q, words);
+        eccint_shift_left(tables->qshift[i], tables->qshift[i], i, words + 1);
+    }
+
+    square_basis(basis, curve);
+    linmap_from_basis(&tables->square, basis, curve);
+
+    // Tr(z^i) = z^i + z^(2i) + ... is the constant term of the sum, unless
+    // the generator already has the mask
+    if (curve->generated) {
+        eccint_cpy(tables->tracemask, curve->generated->tracemask, words);
+    }
+    for (size_t i = 0; i < curve->m && !curve->generated; i++) {
+        eccint_set(t, 0, words);
+        eccint_setbit(t, i, 1);
+        eccint_cpy(sum, t, words);
+        for (size_t k = 1; k < curve->m; k++) {
+            eccint_linmap_apply(&tables->square, t, t, curve);
+            eccint_add(sum, t, sum, words);
+        }
+        eccint_setbit(tables->tracemask, i, sum[0] & 1);
+    }
+
+    // sqrt(z) = z^(2^(m-1))
+    eccint_set(tables->sqrtz, 0, words);
+    eccint_setbit(tables->sqrtz, 1, 1);
+    for (size_t k = 1; k < curve->m; k++) {
+        eccint_linmap_apply(&tables->square, tables->sqrtz, tables->sqrtz, curve);
+    }
+
+    // H(z^i) = z^i + z^(4i) + z^(16i) + ..., (m - 1) / 2 times
+    if (curve->m & 1) {
+        if (!linmap_alloc(&tables->halftrace, curve)) {
+            linmap_free(&tables->square);
+            free(tables);
+            free(basis);
+            return 0;
+        }
+
+        // The generator already has the basis
+        if (curve->generated) {
+            eccint_cpy(basis, curve->generated->halftrace, curve->m * words);
+        }
+
+        for (size_t i = 0; i < curve->m && !curve->generated; i++) {
+            eccint_set(t, 0, words);
+            eccint_setbit(t, i, 1);
+            eccint_cpy(sum, t, words);
+            for (size_t k = 1; k <= (curve->m - 1) / 2; k++) {
+                eccint_linmap_apply(&tables->square, t, t, curve);
+                eccint_linmap_apply(&tables->square, t, t, curve);
+                eccint_add(sum, t, sum, words);
+            }
+            eccint_cpy(basis + i * words, sum, words);
+        }
+        linmap_from_basis(&tables->halftrace, basis, curve);
+    }
+
+    free(basis);
+
+    curve->tables = tables;
+    return 1;
+}
+
+// Add tables for x -> x^(2^k) for each of the |count| values in |k|. The
+// curve must have been initialized with ecc_curve_init, and this must happen
+// before the curve is shared. Each table costs 256 * words^2 bytes. A k of 0
+// is rejected, eccint_multisquare would never finish with it.
+int ecc_curve_init_multisquare(curve_t *curve, const size_t *k, const size_t count) {
+    curve_tables_t *tables = (curve_tables_t *) curve->tables;
+    const size_t words = curve->words;
+
+    if (!tables || tables->multisquare_count + count > ECC_MULTISQUARE_MAX) {
+        return 0;
+    }
+    for (size_t n = 0; n < count; n++) {
+        if (k[n] == 0) {
+            return 0;
+        }
+    }
+
+    eccint_t *basis = calloc(curve->m, words);
+    if (!basis) {
+        return 0;
+    }
+
+    for (size_t n = 0; n < count; n++) {
+        eccint_linmap_t *map = &tables->multisquare[tables->multisquare_count];
+
+        if (!linmap_alloc(map, curve)) {
+            free(basis);
+            return 0;
+        }
+
+        // (z^i)^(2^k), using the squaring table k times per basis element
+        for (size_t i = 0; i < curve->m; i++) {
+            eccint_t *elem = basis + i * words;
+            eccint_set(elem, 0, words);
+            eccint_setbit(elem, i, 1);
+            for (size_t j = 0; j < k[n]; j++) {
+                eccint_linmap_apply(&tables->square, elem, elem, curve);
+            }
+        }
+        linmap_from_basis(map, basis, curve);
+
+        tables->multisquare_k[tables->multisquare_count++] = k[n];
+    }
+
+    free(basis);
+    return 1;
+}
+
+// Release the tables built by ecc_curve_init
+void ecc_curve_free(curve_t *curve) {
+    curve_tables_t *tables = (curve_tables_t *) curve->tables;
+
+    if (tables) {
+        linmap_free(&tables->halftrace);
+        linmap_free(&tables->square);
+        for (size_t n = 0; n < tables->multisquare_count; n++) {
+            linmap_free(&tables->multisquare[n]);
+        }
+        free(tables);
+    }
+    curve->tables = NULL;
+}
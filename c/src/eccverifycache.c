@@ -0,0 +1,206 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "ecctypes.h"
+#include "ecdsa.h"
+#include "eccverifycache.h"
+
+// The tuple x, y, hash, r, s packed into 64 bit words
+#define VERIFYCACHE_DATA ((5 * KEYSIZE + 7) / 8)
+
+/**
+ * |seq| is odd while a writer changes the entry. |tag| is the tuple hash with
+ * the low bit set, zero marks an empty entry. All fields are accessed
+ * atomically, since readers run concurrently with writers.
+ */
+typedef struct {
+    uint32_t seq;
+    uint8_t referenced;
+    uint64_t tag;
+    uint64_t data[VERIFYCACHE_DATA];
+} verifycache_entry_t;
+
+typedef struct {
+    verifycache_entry_t entries[ECC_VERIFYCACHE_WAYS];
+    size_t hand;
+} verifycache_set_t;
+
+typedef struct {
+    pthread_mutex_t lock;
+    verifycache_set_t *sets;
+} __attribute__((aligned(64))) verifycache_shard_t;
+
+struct _ecc_verifycache_t {
+    verifycache_shard_t shards[ECC_VERIFYCACHE_SHARDS];
+    size_t mask;
+    const curve_t *curve;
+};
+
+// Pack the tuple and hash it, a multiply and xor-shift per word
+static uint64_t verifycache_pack(const ecc_verifycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, uint64_t *data) {
+    const size_t words = cache->curve->words;
+    uint8_t bytes[8 * VERIFYCACHE_DATA];
+    uint64_t h = 0x9E3779B97F4A7C15ULL;
+
+    memset(bytes, 0, sizeof(bytes));
+    memcpy(bytes, publickey->x, words);
+    memcpy(bytes + words, publickey->y, words);
+    memcpy(bytes + 2 * words, hash, words);
+    memcpy(bytes + 3 * words, signature->r, words);
+    memcpy(bytes + 4 * words, signature->s, words);
+    memcpy(data, bytes, sizeof(bytes));
+
+    for (size_t i = 0; i < VERIFYCACHE_DATA; i++) {
+        h = (h ^ data[i]) * 0xFF51AFD7ED558CCDULL;
+        h ^= h >> 32;
+    }
+    return h | 1;
+}
+
+static verifycache_set_t *verifycache_set(ecc_verifycache_t *cache, const uint64_t tag, verifycache_shard_t **shard) {
+    *shard = &cache->shards[(tag >> 1) % ECC_VERIFYCACHE_SHARDS];
+    return &(*shard)->sets[(tag >> 8) & cache->mask];
+}
+
+// Reader side of the sequence lock, returns 1 if the entry holds the tuple
+static int verifycache_match(verifycache_entry_t *entry, const uint64_t tag, const uint64_t *data) {
+    uint32_t seq = __atomic_load_n(&entry->seq, __ATOMIC_ACQUIRE);
+    int match = !(seq & 1) && __atomic_load_n(&entry->tag, __ATOMIC_RELAXED) == tag;
+
+    for (size_t i = 0; match && i < VERIFYCACHE_DATA; i++) {
+        match = __atomic_load_n(&entry->data[i], __ATOMIC_RELAXED) == data[i];
+    }
+
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return match && __atomic_load_n(&entry->seq, __ATOMIC_RELAXED) == seq;
+}
+
+// Create a cache for at least |capacity| results. The curve must outlive it.
+ecc_verifycache_t *ecc_verifycache_create(const size_t capacity, const curve_t *curve) {
+    size_t sets = 1;
+
+    while (sets * ECC_VERIFYCACHE_WAYS * ECC_VERIFYCACHE_SHARDS < capacity) {
+        sets <<= 1;
+    }
+
+    // Shards sit on their own cache lines
+    ecc_verifycache_t *cache = aligned_alloc(64, sizeof(ecc_verifycache_t));
+    if (!cache) {
+        return NULL;
+    }
+    memset(cache, 0, sizeof(ecc_verifycache_t));
+    cache->mask = sets - 1;
+    cache->curve = curve;
+
+    for (size_t i = 0; i < ECC_VERIFYCACHE_SHARDS; i++) {
+        pthread_mutex_init(&cache->shards[i].lock, NULL);
+        cache->shards[i].sets = calloc(sets, sizeof(verifycache_set_t));
+        if (!cache->shards[i].sets) {
+            ecc_verifycache_destroy(cache);
+            return NULL;
+        }
+    }
+    return cache;
+}
+
+void ecc_verifycache_destroy(ecc_verifycache_t *cache) {
+    if (!cache) {
+        return;
+    }
+    for (size_t i = 0; i < ECC_VERIFYCACHE_SHARDS; i++) {
+        pthread_mutex_destroy(&cache->shards[i].lock);
+        free(cache->shards[i].sets);
+    }
+    free(cache);
+}
+
+// Returns 1 if the signature was found valid before. Takes no lock.
+int ecc_verifycache_lookup(ecc_verifycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature) {
+    uint64_t data[VERIFYCACHE_DATA];
+    const uint64_t tag = verifycache_pack(cache, publickey, hash, signature, data);
+    verifycache_shard_t *shard;
+    verifycache_set_t *set = verifycache_set(cache, tag, &shard);
+
+    for (size_t i = 0; i < ECC_VERIFYCACHE_WAYS; i++) {
+        verifycache_entry_t *entry = &set->entries[i];
+        if (verifycache_match(entry, tag, data)) {
+            // Skip the store if the mark is set, so hits don't bounce the line
+            if (!__atomic_load_n(&entry->referenced, __ATOMIC_RELAXED)) {
+                __atomic_store_n(&entry->referenced, 1, __ATOMIC_RELAXED);
+            }
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Remember that the signature is valid. Must only be called after it was
+// verified.
+void ecc_verifycache_insert(ecc_verifycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature) {
+    uint64_t data[VERIFYCACHE_DATA];
+    const uint64_t tag = verifycache_pack(cache, publickey, hash, signature, data);
+    verifycache_shard_t *shard;
+    verifycache_set_t *set = verifycache_set(cache, tag, &shard);
+    verifycache_entry_t *victim = NULL;
+
+    pthread_mutex_lock(&shard->lock);
+    for (size_t i = 0; i < ECC_VERIFYCACHE_WAYS; i++) {
+        verifycache_entry_t *entry = &set->entries[i];
+        if (verifycache_match(entry, tag, data)) {
+            pthread_mutex_unlock(&shard->lock);
+            return;
+        }
+        if (!victim && !__atomic_load_n(&entry->tag, __ATOMIC_RELAXED)) {
+            victim = entry;
+        }
+    }
+
+    // CLOCK, give marked entries a second chance
+    while (!victim) {
+        verifycache_entry_t *entry = &set->entries[set->hand];
+        set->hand = (set->hand + 1) % ECC_VERIFYCACHE_WAYS;
+        if (__atomic_load_n(&entry->referenced, __ATOMIC_RELAXED)) {
+            __atomic_store_n(&entry->referenced, 0, __ATOMIC_RELAXED);
+        } else {
+            victim = entry;
+        }
+    }
+
+    // Writer side of the sequence lock
+    uint32_t seq = __atomic_load_n(&victim->seq, __ATOMIC_RELAXED);
+    __atomic_store_n(&victim->seq, seq + 1, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    __atomic_store_n(&victim->tag, tag, __ATOMIC_RELAXED);
+    for (size_t i = 0; i < VERIFYCACHE_DATA; i++) {
+        __atomic_store_n(&victim->data[i], data[i], __ATOMIC_RELAXED);
+    }
+    __atomic_store_n(&victim->referenced, 0, __ATOMIC_RELAXED);
+    __atomic_store_n(&victim->seq, seq + 2, __ATOMIC_RELEASE);
+    pthread_mutex_unlock(&shard->lock);
+}
+
+// ecc_verify in front of the cache. Without a cache this is ecc_verify.
+// Entries don't record their curve, so with a cache |curve| has to be the
+// one the cache was created for, otherwise the signature is rejected.
+int ecc_verify_cached(ecc_verifycache_t *cache, const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve) {
+    if (!cache) {
+        return ecc_verify(publickey, hash, signature, curve);
+    }
+    if (curve != cache->curve) {
+        return 0;
+    }
+    if (ecc_verifycache_lookup(cache, publickey, hash, signature)) {
+        return 1;
+    }
+    if (!ecc_verify(publickey, hash, signature, curve)) {
+        return 0;
+    }
+    ecc_verifycache_insert(cache, publickey, hash, signature);
+    return 1;
+}
@@ -0,0 +1,109 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ecctypes.h"
+#include "eccmemory.h"
+#include "eccmath.h"
+#include "ecdh.h"
+
+// k = h * d as an integer, one byte longer than d
+static void ecdh_scalar(const eccint_t *privatekey, eccint_t *k, const curve_t *curve) {
+    unsigned int carry = 0;
+
+    for (size_t i = 0; i < curve->words; i++) {
+        unsigned int v = privatekey[i] * curve->h + carry;
+        k[i] = v & 0xFF;
+        carry = v >> 8;
+    }
+    k[curve->words] = carry;
+}
+
+// Decode the peer key and compute x(h d Q) = X / Z. Multiplying by the
+// cofactor maps a point from a small subgroup to infinity, so such keys fail
+// instead of leaking bits of d. Returns 0 if the key or the result is invalid.
+static int ecdh_ladder(const eccint_t *privatekey, const uint8_t *peer, const size_t peerlen, eccint_t *X, eccint_t *Z, const curve_t *curve) {
+    eccint_t k[curve->words + 1];
+    eccint_point_t q;
+
+    if (!eccint_point_decode(peer, peerlen, &q, curve) || eccint_point_testinfinite(&q, curve->words)) {
+        return 0;
+    }
+
+    ecdh_scalar(privatekey, k, curve);
+    eccint_ld_ladder_x(k, curve->words + 1, q.x, X, Z, curve);
+    memset(k, 0, sizeof(k));
+    return !eccint_testzero(Z, curve->words);
+}
+
+// Shared secret of |privatekey| and the peer's public key, encoded compressed
+// or uncompressed as by eccint_point_encode. Only the x-coordinate of
+// h * d * Q is computed and written to |shared|. Returns 0 if the peer key
+// is invalid.
+int ecc_ecdh(const eccint_t *privatekey, const uint8_t *peer, const size_t peerlen, eccint_t *shared, const curve_t *curve) {
+    eccint_t X[curve->words];
+    eccint_t Z[curve->words];
+    eccint_t zinv[curve->words];
+
+    if (!ecdh_ladder(privatekey, peer, peerlen, X, Z, curve)) {
+        return 0;
+    }
+
+    eccint_inv_mod(Z, curve->q, zinv, curve);
+    eccint_mul_mod(X, zinv, curve->q, shared, curve);
+    return 1;
+}
+
+// Shared secrets of one private key with |count| peers. The ladders end in
+// projective coordinates and share a single inversion. results[i] is set to
+// whether peer i was valid. Returns the number of valid peers.
+size_t ecc_ecdh_batch(const eccint_t *privatekey, const uint8_t *const *peers, const size_t *peerlens, eccint_keyptr_t *shared, int *results, const size_t count, const curve_t *curve) {
+    const size_t words = curve->words;
+    eccint_keyptr_t *Z = malloc((count ? count : 1) * sizeof(eccint_keyptr_t));
+    eccint_keyptr_t *prefix = malloc((count ? count : 1) * sizeof(eccint_keyptr_t));
+    eccint_t acc[words];
+    eccint_t inv[words];
+    eccint_t zinv[words];
+    size_t valid = 0;
+
+    if (!Z || !prefix) {
+        free(Z);
+        free(prefix);
+        for (size_t i = 0; i < count; i++) {
+            results[i] = ecc_ecdh(privatekey, peers[i], peerlens[i], shared[i], curve);
+            valid += results[i];
+        }
+        return valid;
+    }
+
+    // X goes to |shared| until it is scaled, prefix[i] = Z_0 ... Z_(i-1)
+    eccint_set(acc, 0, words);
+    acc[0] = 1;
+    for (size_t i = 0; i < count; i++) {
+        results[i] = ecdh_ladder(privatekey, peers[i], peerlens[i], shared[i], Z[i], curve);
+        eccint_cpy(prefix[i], acc, words);
+        if (results[i]) {
+            eccint_mul_mod(acc, Z[i], curve->q, acc, curve);
+            valid++;
+        }
+    }
+
+    eccint_inv_mod(acc, curve->q, inv, curve);
+    for (size_t i = count; i-- > 0;) {
+        if (!results[i]) {
+            eccint_set(shared[i], 0, words);
+            continue;
+        }
+        eccint_mul_mod(inv, prefix[i], curve->q, zinv, curve);
+        eccint_mul_mod(inv, Z[i], curve->q, inv, curve);
+        eccint_mul_mod(shared[i], zinv, curve->q, shared[i], curve);
+    }
+
+    free(Z);
+    free(prefix);
+    return valid;
+}
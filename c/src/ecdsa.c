@@ -5,64 +5,231 @@
 
 #include <unistd.h>
 #include <fcntl.h>
+#include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "ecctypes.h"
 #include "eccprint.h"
 #include "eccmemory.h"
 #include "eccmath.h"
+#include "eccprecomp.h"
+#include "ecccounters.h"
+#include "ecchistogram.h"
+#include "ecdsa.h"
 
 
-// --- ecsda static k ---
-
-static eccint_t KK[21] = {
-          //0x03,0x35,0x5B,0xF8,0x3C,0x49,0x7F,0x92,0x2F,0xFA,0xEC,0x53,0xC7,0x31,0x5B,0x34,0x8F,0xAF,0xB4,0xDA,0x2F
-          //0x00,0xCD,0x06,0x20,0x32,0x60,0xEE,0xE9,0x54,0x93,0x51,0xBD,0x29,0x73,0x3E,0x7D,0x1E,0x2E,0xD4,0x9D,0x88
-          //0x2F,0xDA,0xB4,0xAF,0x8F,0x34,0x5B,0x31,0xC7,0x53,0xEC,0xFA,0x2F,0x92,0x7F,0x49,0x3C,0xF8,0x5B,0x35,0x03 // swapped
-          0x88,0x9D,0xD4,0x2E,0x1E,0x7D,0x3E,0x73,0x29,0xBD,0x51,0x93,0x54,0xE9,0xEE,0x60,0x32,0x20,0x06,0xCD,0x00 // swapped
-          //0x05,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00 // swapped
-          //0x00,0xCD,0x96,0xCC,0x43,0xDC,0xFC,0x8C,0xD9,0x42,0xF7,0x5C,0xFC,0x0D,0x3D,0x4C,0x08,0x8C,0xF2,0xDC,0x83 // swapped
-}; // K=163
-
-/*static eccint_t KK[2] = {
-          0b01101001, 0b00000000
-};*/ // K=9
-
 // --- ecsda funcs ---
 
-// Generate random bytes into dst
+// Generate random bytes into dst. Safe to call from several threads, each
+// call opens and closes its own descriptor.
 void eccint_urand(void *dst, const ssize_t size) {
-    int randfd = open("/dev/urandom", O_RDONLY);
-    if (read(randfd, dst, size) != size) {
+    int randfd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+    ssize_t done = 0;
+
+    while (randfd >= 0 && done < size) {
+        ssize_t n = read(randfd, (uint8_t *) dst + done, size - done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        done += n;
+    }
+    if (randfd >= 0) {
+        close(randfd);
+    }
+
+    if (done != size) {
         printf("Failed to get random bytes.\n");
         abort();
     }
 }
 
-// Generate ECC keypair
-int ecc_keygen(eccint_point_t *publickey, eccint_t *privatekey, const curve_t *curve) {
+// Multiply the base point, using the curve's fixed-base table if there is one
+static void ecc_base_point_mul(const eccint_t *scalar, eccint_point_t *res, const curve_t *curve) {
+    if (curve->precomp) {
+        eccint_precomp_point_mul(scalar, curve->precomp, res, curve);
+    } else {
+        eccint_point_mul(scalar, &curve->P, res, curve);
+    }
+}
 
-    // Generate a random key candidate
-    eccint_urand(privatekey, curve->words);
+// Mask that cuts random bytes to the bit length of the order. |top| is set
+// to the index of the highest non-zero byte of the order.
+static eccint_t ecc_scalar_mask(size_t *top, const curve_t *curve) {
+    size_t t = curve->words - 1;
+    eccint_t mask;
 
-    // Book Algorithm 4.24
-    eccint_mod(privatekey, curve->n, privatekey, curve);
+    while (t > 0 && !curve->order[t]) {
+        t--;
+    }
+    mask = curve->order[t];
+    mask |= mask >> 1;
+    mask |= mask >> 2;
+    mask |= mask >> 4;
+    *top = t;
+    return mask;
+}
 
-    if (eccint_testzero(privatekey, curve->words)) {
-        return 0;
+// Cut random bytes to a scalar candidate, returns 1 if it is in
+// [1, order - 1]. Rejecting the rest keeps the scalars uniform.
+static int ecc_scalar_accept(eccint_t *k, const size_t top, const eccint_t mask, const curve_t *curve) {
+    memset(k + top + 1, 0, curve->words - top - 1);
+    k[top] &= mask;
+    return !eccint_testzero(k, curve->words) && eccint_cmp(k, curve->order, curve->words) < 0;
+}
+
+// Signature scalars are integers modulo the order of P. Checks that |in| is
+// in [1, order - 1].
+static int ecc_scalar_valid(const eccint_t *in, const curve_t *curve) {
+    return !eccint_testzero(in, curve->words) && eccint_cmp(in, curve->order, curve->words) < 0;
+}
+
+// r = x_R mod order for the nonce point R = kP. Returns the recovery id:
+// bit 0 is y~ of R, the higher bits count how often the order was subtracted
+// from x_R, which is what ecc_recover_publickey needs to find R again.
+static eccint_t ecc_nonce_point(const eccint_point_t *point, eccint_t *r, const curve_t *curve) {
+    eccint_t recid = eccint_point_compress(point, r, curve);
+
+    while (eccint_cmp(r, curve->order, curve->words) >= 0) {
+        eccint_int_sub(r, curve->order, r, curve->words);
+        recid += 2;
+    }
+    return recid;
+}
+
+// s = k^(-1) * (e + d * r) mod order. |dr| and |edr| are set to d * r and
+// e + d * r. Sets s to zero if k has no inverse.
+static void ecc_sign_scalar(const eccint_t *privatekey, const eccint_t *hash, const eccint_t *k, const eccint_t *r, eccint_t *s, eccint_t *dr, eccint_t *edr, const curve_t *curve) {
+    const size_t words = curve->words;
+    eccint_t e[words];
+    eccint_t d[words];
+    eccint_t kinv[words];
+
+    eccint_int_mod(hash, curve->order, e, words);
+    eccint_int_mod(privatekey, curve->order, d, words);
+    eccint_int_mul_mod(d, r, curve->order, dr, words);
+    if (eccint_int_add(e, dr, edr, words) || eccint_cmp(edr, curve->order, words) >= 0) {
+        eccint_int_sub(edr, curve->order, edr, words);
+    }
+
+    if (eccint_int_inv_mod(k, curve->order, kinv, words)) {
+        eccint_int_mul_mod(edr, kinv, curve->order, s, words);
+    } else {
+        eccint_set(s, 0, words);
+    }
+    memset(d, 0, sizeof(d));
+    memset(kinv, 0, sizeof(kinv));
+}
+
+// Print the operation counts of the last |op|, if they are collected
+static void ecc_print_counters(const char *prefix, const ecc_counters_op_t op) {
+    ecc_counters_t last;
+    if (ecc_counters_get(op, &last, NULL, NULL)) {
+        ecc_counters_print(prefix, &last);
     }
+}
+
+// Generate ECC keypair
+static int ecc_keygen_internal(eccint_point_t *publickey, eccint_t *privatekey, const curve_t *curve) {
+    size_t top;
+    const eccint_t mask = ecc_scalar_mask(&top, curve);
+
+    // Book Algorithm 4.24, select d \in [1, n - 1] as ecc_keygen_batch does
+    do {
+        eccint_urand(privatekey, curve->words);
+    } while (!ecc_scalar_accept(privatekey, top, mask, curve));
 
     // Compute Q = d * P <=> publickey = privatekey * D(P)
-    eccint_point_mul(privatekey, &curve->P, publickey, curve);
+    ecc_base_point_mul(privatekey, publickey, curve);
     return 1;
 }
+int ecc_keygen(eccint_point_t *publickey, eccint_t *privatekey, const curve_t *curve) {
+    ECC_COUNTERS_BEGIN(start);
+    int ok = ecc_keygen_internal(publickey, privatekey, curve);
+    ECC_COUNTERS_END(ECC_COUNTERS_KEYGEN, start);
+    return ok;
+}
+
+// Generate |count| key pairs. Randomness is read in bulk, d * P is computed
+// in López-Dahab coordinates from the fixed-base table of P, so there are
+// no doublings and no inversions, and the points are made affine in rounds
+// of ECC_KEYGEN_ROUND keys that share one inversion. Uses the curve's table
+// if it has one, otherwise builds one for the call. Returns 0 if memory for
+// the table or the round buffers can't be allocated.
+int ecc_keygen_batch(eccint_point_t *publickeys, eccint_keyptr_t *privatekeys, const size_t count, const curve_t *curve) {
+    const size_t words = curve->words;
+    ecc_precomp_t built;
+    const ecc_precomp_t *pre = curve->precomp;
+    size_t top;
+    const eccint_t mask = ecc_scalar_mask(&top, curve);
+    int ok = 0;
+
+    memset(&built, 0, sizeof(built));
+    if (!pre) {
+        if (!ecc_precomp_build(&built, &curve->P, ECC_PRECOMP_CURVE, curve)) {
+            return 0;
+        }
+        pre = &built;
+    }
+
+    const size_t round = count < ECC_KEYGEN_ROUND ? count : ECC_KEYGEN_ROUND;
+    eccint_ld_point_t *points = malloc((round ? round : 1) * sizeof(eccint_ld_point_t));
+    eccint_keyptr_t *scratch = malloc((round ? round : 1) * sizeof(eccint_keyptr_t));
+    eccint_t *random = malloc((round ? round : 1) * words);
+    if (!points || !scratch || !random) {
+        goto out;
+    }
+
+    ECC_COUNTERS_BEGIN(start);
+    for (size_t first = 0; first < count; first += round) {
+        const size_t n = count - first < round ? count - first : round;
+
+        eccint_urand(random, n * words);
+        for (size_t i = 0; i < n; i++) {
+            eccint_t *d = privatekeys[first + i];
+            eccint_cpy(d, random + i * words, words);
+            while (!ecc_scalar_accept(d, top, mask, curve)) {
+                eccint_urand(d, words);
+            }
+
+            // Q = sum of 2^j P over the set bits j of d
+            eccint_ld_point_t *q = &points[i];
+            eccint_set(q->x, 0, words);
+            eccint_set(q->y, 0, words);
+            eccint_set(q->z, 0, words);
+            q->x[0] = 1;
+            for (ssize_t j = eccint_degree(d, words); j >= 0; j--) {
+                if (eccint_testbit(d, j)) {
+                    eccint_ld_point_add_affine(q, &pre->table[j], q, curve);
+                }
+            }
+        }
+
+        eccint_ld_point_normalize_batch(points, publickeys + first, scratch, n, curve);
+    }
+    ECC_COUNTERS_END(ECC_COUNTERS_KEYGEN, start);
+    ok = 1;
+
+out:
+    if (random) {
+        memset(random, 0, round * words);
+    }
+    free(random);
+    free(scratch);
+    free(points);
+    ecc_precomp_free(&built);
+    return ok;
+}
 
 // Validate the public key to see if it is correct
 int ecc_validate_publickey(const eccint_point_t *publickey, const curve_t *curve) {
     // Algorithm 4.25
 
     // Verify that Q != \infty
-    if (eccint_testnumber(publickey->x, ECCINT_MAX, curve->words) || eccint_testnumber(publickey->y, ECCINT_MAX, curve->words)) {
+    if (eccint_point_testinfinite(publickey, curve->words)) {
         return 0;
     }
 
@@ -74,51 +241,63 @@ int ecc_validate_publickey(const eccint_point_t *publickey, const curve_t *curve
         return 0;
     }
 
-    //eccint_point_t nQ;
-    //eccint_point_mul(curve->n, publickey, &nQ, curve);
-    //if (!eccint_point_testinfinite(&nQ, curve->words)) {
-    //    return 0;
-    //}
+    if (!eccint_point_on_curve(publickey, curve)) {
+        return 0;
+    }
 
-    return eccint_point_on_curve(publickey, curve);
+    // Verify that nQ = \infty. With cofactor 2 the points of odd order are
+    // the halves of other points, which are those with Tr(x) = Tr(a), so this
+    // costs a trace instead of a point multiplication. It only applies if P
+    // is one of them; testcurve9's P generates the whole group.
+    if (curve->h == 2) {
+        int tr = eccint_trace(curve->a, curve);
+        return eccint_trace(curve->P.x, curve) != tr || eccint_trace(publickey->x, curve) == tr;
+    }
+    if (!eccint_testzero(curve->order, curve->words)) {
+        eccint_point_t nQ;
+        eccint_point_mul(curve->order, publickey, &nQ, curve);
+        return eccint_point_testinfinite(&nQ, curve->words);
+    }
+    return 1;
 }
 
 // Sign a hash using the passed private key
 void ecc_sign_verbose(const eccint_t *privatekey, const eccint_t *hash, eccint_signature_t *signature, const curve_t *curve, eccint_t verbose) {
     // Algorithm 4.29
-    //eccint_t k[curve->words];
-    eccint_t * k = KK;
+    eccint_t k[curve->words];
     eccint_t t1[curve->words];
     eccint_t t2[curve->words];
     eccint_point_t point;
+    size_t top;
+    const eccint_t mask = ecc_scalar_mask(&top, curve);
+    ECC_COUNTERS_BEGIN(start);
+    const uint64_t begin = ecc_histogram_now();
+    uint64_t lap = begin;
 
     do {
         do {
-            // Select k \in [1, n - 1]
-            // -- ENABLE THIS CODE FOR RANDOM K --
-            //do {
-            //    eccint_urand(k, curve->words);
-            //} while (eccint_testzero(k, curve->words));
-            //eccint_mod(k, curve->n, k, curve);
+            // Select a random k \in [1, n - 1], a fresh one for every
+            // signature. Two signatures with the same k give away the key.
+            do {
+                eccint_urand(k, curve->words);
+            } while (!ecc_scalar_accept(k, top, mask, curve));
+            lap = ecc_histogram_lap(ECC_PHASE_NONCE, lap);
 
             // Compute kP = (x_1, y_1) and convert x_1 to integer
-            eccint_point_mul(k, &curve->P, &point, curve); 
-             
+            ecc_base_point_mul(k, &point, curve);
+            lap = ecc_histogram_lap(ECC_PHASE_KP, lap);
+
             // Compute r = x_1 mod n
-            eccint_mod(point.x, curve->n, signature->r, curve);
+            signature->recid = ecc_nonce_point(&point, signature->r, curve);
+            lap = ecc_histogram_lap(ECC_PHASE_R, lap);
 
             // If r=0 then goto step 1.
         } while (eccint_testzero(signature->r, curve->words));
 
         // e = hash = H(m)
-        // Compute s = k^(-1) * (e + d * r) mod n
-        //         s =         ((e +  t1  ) / k) mod n
-        
-        // t1 = d * r
-        eccint_mul_mod(privatekey, signature->r, curve->n, t2, curve);
-
-        eccint_add(hash, t2, t1, curve->words); // t1 = e + d * r
-        eccint_div_mod(t1, k, curve->n, signature->s, curve);
+        // Compute s = k^(-1) * (e + d * r) mod n, t2 = d * r, t1 = e + d * r
+        ecc_sign_scalar(privatekey, hash, k, signature->r, signature->s, t2, t1, curve);
+        lap = ecc_histogram_lap(ECC_PHASE_SCALAR, lap);
         
         if (verbose) {
             printf("# SIGN: da = \n    ");
@@ -142,16 +321,66 @@ void ecc_sign_verbose(const eccint_t *privatekey, const eccint_t *hash, eccint_s
 
         // If s=0 then goto step 1.
     } while (eccint_testzero(signature->s, curve->words));
+
+    memset(k, 0, sizeof(k));
+    ecc_histogram_lap(ECC_PHASE_SIGN, begin);
+    ECC_COUNTERS_END(ECC_COUNTERS_SIGN, start);
+    if (verbose) {
+        ecc_print_counters("# SIGN: counts = ", ECC_COUNTERS_SIGN);
+    }
 }
 void ecc_sign(const eccint_t *privatekey, const eccint_t *hash, eccint_signature_t *signature, const curve_t *curve) {
     ecc_sign_verbose(privatekey, hash, signature, curve, 0);
 }
 
-// Verify the signature of the hash based on the public key
-int ecc_verify_verbose(const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve, eccint_t verbose) {
+// Compute the message independent part of a signature for the nonce |k|,
+// r = (kP)_x mod n. Returns 0 if r is zero, then |k| can't be used.
+int ecc_nonce_compute(const eccint_t *k, ecc_nonce_t *nonce, const curve_t *curve) {
+    eccint_point_t point;
+
+    eccint_int_mod(k, curve->order, nonce->k, curve->words);
+    ecc_base_point_mul(nonce->k, &point, curve);
+    nonce->recid = ecc_nonce_point(&point, nonce->r, curve);
+    return !eccint_testzero(nonce->r, curve->words);
+}
+
+// Compute a nonce for a random k \in [1, n - 1]
+void ecc_nonce_generate(ecc_nonce_t *nonce, const curve_t *curve) {
+    eccint_t k[curve->words];
+    size_t top;
+    const eccint_t mask = ecc_scalar_mask(&top, curve);
+
+    do {
+        eccint_urand(k, curve->words);
+    } while (!ecc_scalar_accept(k, top, mask, curve) || !ecc_nonce_compute(k, nonce, curve));
+}
+
+// Sign a hash with a nonce from ecc_nonce_compute, which costs no point
+// multiplication. Each nonce must only be used once. Returns 0 if s is zero,
+// then the hash has to be signed with another nonce.
+int ecc_sign_nonce(const eccint_t *privatekey, const eccint_t *hash, const ecc_nonce_t *nonce, eccint_signature_t *signature, const curve_t *curve) {
+    eccint_t t1[curve->words];
+    eccint_t t2[curve->words];
+    ECC_COUNTERS_BEGIN(start);
+    const uint64_t begin = ecc_histogram_now();
+
+    // s = ((e + d * r) / k) mod n
+    eccint_cpy(signature->r, nonce->r, curve->words);
+    signature->recid = nonce->recid;
+    ecc_sign_scalar(privatekey, hash, nonce->k, signature->r, signature->s, t2, t1, curve);
+
+    ecc_histogram_lap(ECC_PHASE_SCALAR, begin);
+    ECC_COUNTERS_END(ECC_COUNTERS_SIGN, start);
+    return !eccint_testzero(signature->s, curve->words);
+}
+
+// Verify the signature of the hash based on the public key. If |keytable| is
+// passed, it is used to compute u_2 * Q without doublings.
+static int ecc_verify_compute(const eccint_point_t *publickey, const ecc_precomp_t *keytable, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve, eccint_t verbose) {
     // Algorithm 4.30
     eccint_t v[curve->words];
     eccint_t w[curve->words];
+    eccint_t e[curve->words];
     eccint_t u1[curve->words];
     eccint_t u2[curve->words];
     eccint_point_t X, X1, X2;
@@ -160,30 +389,35 @@ int ecc_verify_verbose(const eccint_point_t *publickey, const eccint_t *hash, co
     const eccint_t *r = signature->r;
 
     // Verify that r and s are integers in the interval [1, n − 1].
-    if (eccint_testzero(r, curve->words) || eccint_testzero(r, curve->words)) {
-        return 0;
-    }
-    if (eccint_cmp(r, curve->n, curve->words) >= 0) {
-        return 0;
-    }
-    if (eccint_cmp(s, curve->n, curve->words) >= 0) {
+    if (!ecc_scalar_valid(r, curve) || !ecc_scalar_valid(s, curve)) {
         return 0;
     }
 
     // Compute w = s^(-1) mod n
-    eccint_inv_mod(signature->s, curve->n, w, curve);
+    uint64_t lap = ecc_histogram_now();
+    if (!eccint_int_inv_mod(s, curve->order, w, curve->words)) {
+        return 0;
+    }
+    lap = ecc_histogram_lap(ECC_PHASE_INV, lap);
 
     // Compute u_1 = e * w mod n
-    eccint_mul_mod(hash, w, curve->n, u1, curve);
+    eccint_int_mod(hash, curve->order, e, curve->words);
+    eccint_int_mul_mod(e, w, curve->order, u1, curve->words);
 
     // ...and u_2 = r * w mod n
-    eccint_mul_mod(signature->r, w, curve->n, u2, curve);
+    eccint_int_mul_mod(r, w, curve->order, u2, curve->words);
+    lap = ecc_histogram_lap(ECC_PHASE_SCALAR, lap);
 
     // Compute X = u_1 * P + u_2 * Q
     //         X =    X1   +     X2
-    eccint_point_mul(u1, &curve->P, &X1, curve);
-    eccint_point_mul(u2, publickey, &X2, curve);
+    ecc_base_point_mul(u1, &X1, curve);
+    if (keytable) {
+        eccint_precomp_point_mul(u2, keytable, &X2, curve);
+    } else {
+        eccint_point_mul(u2, publickey, &X2, curve);
+    }
     eccint_point_add(&X1, &X2, &X, curve);
+    lap = ecc_histogram_lap(ECC_PHASE_MSM, lap);
 
     // If X = \infty then reject
     if (eccint_point_testinfinite(&X, curve->words)) {
@@ -192,7 +426,12 @@ int ecc_verify_verbose(const eccint_point_t *publickey, const eccint_t *hash, co
 
     // Convert the x-coordinate of X to an integer
     // Compute v = x_1 mod n
-    eccint_mod(X.x, curve->n, v, curve);
+    eccint_int_mod(X.x, curve->order, v, curve->words);
+
+    // If v = r then accept
+    //return (eccint_cmp(v, r, curve->words) != 0);    //WRONG!!!
+    int ok = (eccint_cmp(v, r, curve->words) == 0);
+    ecc_histogram_lap(ECC_PHASE_COMPARE, lap);
 
     if (verbose) {
         printf("# VERIFY: hash = \n    ");
@@ -214,11 +453,85 @@ int ecc_verify_verbose(const eccint_point_t *publickey, const eccint_t *hash, co
         printf("\n");
     }
 
-    // If v = r then accept
-    //return (eccint_cmp(v, r, curve->words) != 0);    //WRONG!!!
-    return (eccint_cmp(v, r, curve->words) == 0);
+    return ok;
 }
 
+static int ecc_verify_internal(const eccint_point_t *publickey, const ecc_precomp_t *keytable, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve, eccint_t verbose) {
+    ECC_COUNTERS_BEGIN(start);
+    const uint64_t begin = ecc_histogram_now();
+    int ok = ecc_verify_compute(publickey, keytable, hash, signature, curve, verbose);
+    ecc_histogram_lap(ECC_PHASE_VERIFY, begin);
+    ECC_COUNTERS_END(ECC_COUNTERS_VERIFY, start);
+    if (verbose) {
+        ecc_print_counters("# VERIFY: counts = ", ECC_COUNTERS_VERIFY);
+    }
+    return ok;
+}
+
+int ecc_verify_verbose(const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve, eccint_t verbose) {
+    return ecc_verify_internal(publickey, NULL, hash, signature, curve, verbose);
+}
 int ecc_verify(const eccint_point_t *publickey, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve) {
-    return ecc_verify_verbose(publickey, hash, signature, curve, 0);
+    return ecc_verify_internal(publickey, NULL, hash, signature, curve, 0);
+}
+
+// Verify using a per-key table built with ecc_precomp_build(..., ECC_PRECOMP_KEY, ...)
+int ecc_verify_precomp(const ecc_precomp_t *keytable, const eccint_t *hash, const eccint_signature_t *signature, const curve_t *curve) {
+    // The table of P would accept signatures made with the private key 1
+    if (keytable->header->kind != ECC_PRECOMP_KEY) {
+        return 0;
+    }
+    return ecc_verify_internal(&keytable->header->base, keytable, hash, signature, curve, 0);
+}
+
+// Recover the public key from a signature made by ecc_sign, using its
+// recovery id: R is decompressed from r and Q = r^(-1) * (s * R - e * P).
+// The recovered key always verifies the signature, so comparing it to a
+// known key or key hash is the verification. Returns 0 if there is no
+// such key.
+int ecc_recover_publickey(const eccint_t *hash, const eccint_signature_t *signature, eccint_point_t *publickey, const curve_t *curve) {
+    const size_t words = curve->words;
+    eccint_t x[words];
+    eccint_t e[words];
+    eccint_t w[words];
+    eccint_t u1[words];
+    eccint_t u2[words];
+    eccint_point_t R;
+
+    if (!ecc_scalar_valid(signature->r, curve) || !ecc_scalar_valid(signature->s, curve)) {
+        return 0;
+    }
+
+    // x_R = r + j * order, which has to be a field element
+    eccint_cpy(x, signature->r, words);
+    for (eccint_t j = signature->recid >> 1; j > 0; j--) {
+        if (eccint_int_add(x, curve->order, x, words)) {
+            return 0;
+        }
+    }
+    if (eccint_degree(x, words) >= (int) curve->m) {
+        return 0;
+    }
+
+    // R has to be in the subgroup of P, for cofactor 2 that is Tr(x) = Tr(a)
+    if (curve->h == 2 && eccint_trace(x, curve) != eccint_trace(curve->a, curve)) {
+        return 0;
+    }
+    if (!eccint_point_decompress(x, signature->recid & 1, &R, curve)) {
+        return 0;
+    }
+
+    // u_1 = s / r and u_2 = -e / r mod n
+    if (!eccint_int_inv_mod(signature->r, curve->order, w, words)) {
+        return 0;
+    }
+    eccint_int_mod(hash, curve->order, e, words);
+    if (!eccint_testzero(e, words)) {
+        eccint_int_sub(curve->order, e, e, words);
+    }
+    eccint_int_mul_mod(signature->s, w, curve->order, u1, words);
+    eccint_int_mul_mod(e, w, curve->order, u2, words);
+
+    eccint_shamir_point_mul(u1, &R, u2, &curve->P, publickey, curve);
+    return !eccint_point_testinfinite(publickey, words);
 }
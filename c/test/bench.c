@@ -0,0 +1,791 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+// Microbenchmarks for each layer of the arithmetic, run with `make bench`.
+//
+// Each result is the time of one call, taken from samples of a batch of calls
+// that is long enough to hide the timer overhead. Samples outside the Tukey
+// fences (3 * IQR) are dropped before the percentiles are taken. On x86 the
+// unit is TSC ticks, which count at the nominal clock rate and not the actual
+// core clock; disable turbo for stable numbers. Elsewhere, or with -t, the
+// unit is nanoseconds from CLOCK_MONOTONIC_RAW.
+//
+// Built with `make bench-cxx`, the operations of the compile-time specialized
+// C++ layer (eccfield.hpp) are timed as the backend "cxx" where there is one
+// for the curve, and sect283k1 is added to the curves. `make bench-large`
+// builds with KEYSIZE=72 for sect409k1 and sect571k1.
+//
+// With -s, sign and verify throughput is measured instead, with one thread up
+// to one thread per CPU sharing the same curve.
+//
+// Usage: bench [-j] [-t] [-s] [-d seconds] [-n samples] [-c cpu] [-f filter] [-o file]
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/utsname.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAVE_TSC 1
+#endif
+
+#include "ecctypes.h"
+#include "eccmemory.h"
+#include "eccmath.h"
+#include "ecctables.h"
+#include "eccdispatch.h"
+#include "eccprecomp.h"
+#include "ecdsa.h"
+
+#include "curves/sect163k1.h"
+#include "curves/sect283k1.h"
+#include "curves/sect409k1.h"
+#include "curves/sect571k1.h"
+#include "curves/testcurve2x9.h"
+
+#ifdef ECC_BENCH_CXX
+#include "bench_cxx.h"
+#endif
+
+// Inputs are cycled through so the branches don't train on a single value
+#define BENCH_INPUTS 16
+
+// A sample times at least this many ticks worth of calls
+#define BENCH_SAMPLE_TICKS 20000
+
+// Stop sampling a benchmark after this many seconds, if there are enough
+// samples to take percentiles from
+#define BENCH_BUDGET 2.0
+#define BENCH_MIN_SAMPLES 11
+
+typedef struct {
+    curve_t curve;
+    ecc_dispatch_t dispatch;
+
+    eccint_t a[BENCH_INPUTS][2 * KEYSIZE];
+    eccint_t b[BENCH_INPUTS][2 * KEYSIZE];
+    eccint_t wide[BENCH_INPUTS][2 * KEYSIZE];
+    eccint_t k[BENCH_INPUTS][KEYSIZE];
+    eccint_point_t p[BENCH_INPUTS];
+    eccint_point_t q[BENCH_INPUTS];
+
+    eccint_t privatekey[KEYSIZE];
+    eccint_point_t publickey;
+    eccint_signature_t signature[BENCH_INPUTS];
+    ecc_precomp_t precomp;
+
+    eccint_t scratch[2 * KEYSIZE];
+    eccint_t out[2 * KEYSIZE];
+    eccint_point_t pout;
+
+#ifdef ECC_BENCH_CXX
+    const bench_cxx_t *cxx;
+#endif
+} bench_ctx_t;
+
+typedef struct {
+    const char *layer;
+    const char *name;
+
+    /* Dispatch operation the benchmark is run for with each backend, NULL to
+     * only run it with the default backends */
+    const char *op;
+
+    void (*run)(bench_ctx_t *ctx, const size_t i);
+
+    /* The same with the C++ layer, NULL if it has none */
+    void (*cxx)(bench_ctx_t *ctx, const size_t i);
+} bench_t;
+
+typedef struct {
+    size_t samples;
+    size_t kept;
+    double min, p50, p90, p99, max, mean;
+} bench_stats_t;
+
+static int use_tsc = 0;
+
+// --- timer ---
+
+static inline uint64_t bench_ticks(void) {
+#ifdef BENCH_HAVE_TSC
+    if (use_tsc) {
+        // Keep earlier instructions from moving past the read and later ones
+        // from starting before it
+        _mm_lfence();
+        uint64_t t = __rdtsc();
+        _mm_lfence();
+        return t;
+    }
+#endif
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+static double bench_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Smallest time between two timer reads
+static uint64_t bench_overhead(void) {
+    uint64_t best = UINT64_MAX;
+    for (size_t i = 0; i < 1000; i++) {
+        uint64_t start = bench_ticks();
+        uint64_t stop = bench_ticks();
+        if (stop - start < best) {
+            best = stop - start;
+        }
+    }
+    return best;
+}
+
+// --- benchmarks ---
+
+static void run_add(bench_ctx_t *ctx, const size_t i) {
+    eccint_add(ctx->a[i], ctx->b[i], ctx->out, ctx->curve.words);
+}
+
+static void run_mul(bench_ctx_t *ctx, const size_t i) {
+    eccint_mul(ctx->a[i], ctx->b[i], ctx->out, &ctx->curve);
+}
+
+static void run_mul_mod(bench_ctx_t *ctx, const size_t i) {
+    eccint_mul_mod(ctx->a[i], ctx->b[i], ctx->curve.q, ctx->out, &ctx->curve);
+}
+
+static void run_square(bench_ctx_t *ctx, const size_t i) {
+    eccint_square_mod(ctx->a[i], ctx->curve.q, ctx->out, &ctx->curve);
+}
+
+static void run_reduce(bench_ctx_t *ctx, const size_t i) {
+    // The reduction works in place, so it gets a fresh copy of the product
+    eccint_cpy(ctx->scratch, ctx->wide[i], 2 * ctx->curve.words);
+    eccint_reduce(ctx->scratch, ctx->out, &ctx->curve);
+}
+
+static void run_invert(bench_ctx_t *ctx, const size_t i) {
+    eccint_inv_mod(ctx->a[i], ctx->curve.q, ctx->out, &ctx->curve);
+}
+
+static void run_sqrt(bench_ctx_t *ctx, const size_t i) {
+    eccint_sqrt(ctx->a[i], ctx->out, &ctx->curve);
+}
+
+static void run_trace(bench_ctx_t *ctx, const size_t i) {
+    ctx->out[0] = eccint_trace(ctx->a[i], &ctx->curve);
+}
+
+static void run_halftrace(bench_ctx_t *ctx, const size_t i) {
+    eccint_halftrace(ctx->a[i], ctx->out, &ctx->curve);
+}
+
+static void run_point_add(bench_ctx_t *ctx, const size_t i) {
+    eccint_point_add(&ctx->p[i], &ctx->q[i], &ctx->pout, &ctx->curve);
+}
+
+static void run_point_double(bench_ctx_t *ctx, const size_t i) {
+    eccint_point_double(&ctx->p[i], &ctx->pout, &ctx->curve);
+}
+
+static void run_point_halve(bench_ctx_t *ctx, const size_t i) {
+    eccint_point_halve(&ctx->p[i], &ctx->pout, &ctx->curve);
+}
+
+static void run_point_mul(bench_ctx_t *ctx, const size_t i) {
+    eccint_point_mul(ctx->k[i], &ctx->curve.P, &ctx->pout, &ctx->curve);
+}
+
+static void run_precomp_mul(bench_ctx_t *ctx, const size_t i) {
+    eccint_precomp_point_mul(ctx->k[i], &ctx->precomp, &ctx->pout, &ctx->curve);
+}
+
+static void run_keygen(bench_ctx_t *ctx, const size_t i) {
+    (void) i;
+    ecc_keygen(&ctx->pout, ctx->out, &ctx->curve);
+}
+
+static void run_sign(bench_ctx_t *ctx, const size_t i) {
+    ecc_sign(ctx->privatekey, ctx->a[i], &ctx->signature[i], &ctx->curve);
+}
+
+static void run_verify(bench_ctx_t *ctx, const size_t i) {
+    ctx->out[0] = ecc_verify(&ctx->publickey, ctx->a[i], &ctx->signature[i], &ctx->curve);
+}
+
+#ifdef ECC_BENCH_CXX
+static void run_cxx_mul_mod(bench_ctx_t *ctx, const size_t i) {
+    ctx->cxx->mul_mod(ctx->a[i], ctx->b[i], ctx->out);
+}
+
+static void run_cxx_square(bench_ctx_t *ctx, const size_t i) {
+    ctx->cxx->square(ctx->a[i], ctx->out);
+}
+
+static void run_cxx_invert(bench_ctx_t *ctx, const size_t i) {
+    ctx->cxx->invert(ctx->a[i], ctx->out);
+}
+
+static void run_cxx_point_add(bench_ctx_t *ctx, const size_t i) {
+    ctx->cxx->point_add(&ctx->p[i], &ctx->q[i], &ctx->pout);
+}
+
+static void run_cxx_point_double(bench_ctx_t *ctx, const size_t i) {
+    ctx->cxx->point_double(&ctx->p[i], &ctx->pout);
+}
+
+static void run_cxx_point_mul(bench_ctx_t *ctx, const size_t i) {
+    ctx->cxx->point_mul(ctx->k[i], &ctx->curve.P, &ctx->pout);
+}
+#else
+#define run_cxx_mul_mod NULL
+#define run_cxx_square NULL
+#define run_cxx_invert NULL
+#define run_cxx_point_add NULL
+#define run_cxx_point_double NULL
+#define run_cxx_point_mul NULL
+#endif
+
+static const bench_t benchmarks[] = {
+    { "field", "add", NULL, run_add },
+    { "field", "mul", ECC_OP_MUL, run_mul },
+    { "field", "reduce", ECC_OP_REDUCE, run_reduce },
+    { "field", "mul_mod", NULL, run_mul_mod, run_cxx_mul_mod },
+    { "field", "square", NULL, run_square, run_cxx_square },
+    { "field", "invert", ECC_OP_DIV_MOD, run_invert, run_cxx_invert },
+    { "field", "sqrt", NULL, run_sqrt },
+    { "field", "trace", NULL, run_trace },
+    { "field", "halftrace", NULL, run_halftrace },
+
+    { "point", "add", ECC_OP_POINT_ADD, run_point_add, run_cxx_point_add },
+    { "point", "double", ECC_OP_POINT_DOUBLE, run_point_double, run_cxx_point_double },
+    { "point", "halve", NULL, run_point_halve },
+
+    { "scalar", "mul", ECC_OP_POINT_MUL, run_point_mul, run_cxx_point_mul },
+    { "scalar", "precomp", NULL, run_precomp_mul },
+
+    { "ecdsa", "keygen", NULL, run_keygen },
+    { "ecdsa", "sign", NULL, run_sign },
+    { "ecdsa", "verify", NULL, run_verify },
+};
+
+// testcurve9's order is not prime, whether sign and verify return early
+// depends on the nonce, so its ECDSA timings are left out
+static const struct {
+    const char *name;
+    const curve_t *curve;
+    int ecdsa;
+} curves[] = {
+    { "testcurve9", &testcurve9, 0 },
+    { "sect163k1", &sect163k1, 1 },
+#if KEYSIZE >= 36
+    { "sect283k1", &sect283k1, 1 },
+#endif
+#if KEYSIZE >= 52
+    { "sect409k1", &sect409k1, 1 },
+#endif
+#if KEYSIZE >= 72
+    { "sect571k1", &sect571k1, 1 },
+#endif
+};
+
+// Inputs are the same in every run, the time of a scalar multiplication
+// depends on the scalar. SplitMix64 with a fixed seed.
+static uint64_t bench_seed = 0x9E3779B97F4A7C15ull;
+
+static void bench_rand(eccint_t *dst, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        uint64_t z = (bench_seed += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        dst[i] = (eccint_t) (z ^ (z >> 31));
+    }
+}
+
+// Pseudo-random field element of the curve
+static void bench_element(eccint_t *a, const curve_t *curve) {
+    eccint_set(a, 0, 2 * KEYSIZE);
+    bench_rand(a, curve->words);
+    for (size_t i = curve->m; i < 8 * curve->words; i++) {
+        eccint_setbit(a, i, 0);
+    }
+    if (eccint_testzero(a, curve->words)) {
+        a[0] = 1;
+    }
+}
+
+static int bench_ctx_init(bench_ctx_t *ctx, const curve_t *curve) {
+    memset(ctx, 0, sizeof(*ctx));
+    ctx->curve = *curve;
+    if (!ecc_curve_init(&ctx->curve)) {
+        return 0;
+    }
+    ctx->dispatch = *ecc_dispatch_default();
+    ctx->curve.dispatch = &ctx->dispatch;
+
+    for (size_t i = 0; i < BENCH_INPUTS; i++) {
+        bench_element(ctx->a[i], curve);
+        bench_element(ctx->b[i], curve);
+        eccint_shiftnadd_mul(ctx->a[i], ctx->b[i], ctx->wide[i], curve);
+        bench_rand(ctx->k[i], curve->words);
+
+        eccint_point_mul(ctx->k[i], &curve->P, &ctx->p[i], &ctx->curve);
+        eccint_point_double(&ctx->p[i], &ctx->q[i], &ctx->curve);
+    }
+
+    while (!ecc_keygen(&ctx->publickey, ctx->privatekey, &ctx->curve)) {}
+    for (size_t i = 0; i < BENCH_INPUTS; i++) {
+        ecc_sign(ctx->privatekey, ctx->a[i], &ctx->signature[i], &ctx->curve);
+    }
+
+#ifdef ECC_BENCH_CXX
+    // Timing the C++ layer is pointless if it computes something else
+    ctx->cxx = bench_cxx_ops(&ctx->curve);
+    if (ctx->cxx && !bench_cxx_check(ctx->cxx, &ctx->curve)) {
+        return 0;
+    }
+#endif
+
+    return ecc_precomp_build(&ctx->precomp, &curve->P, ECC_PRECOMP_CURVE, &ctx->curve);
+}
+
+static void bench_ctx_free(bench_ctx_t *ctx) {
+    ecc_precomp_free(&ctx->precomp);
+    ecc_curve_free(&ctx->curve);
+}
+
+// --- statistics ---
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *) a;
+    double y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+// Nearest rank percentile of sorted values
+static double percentile(const double *sorted, const size_t count, const double p) {
+    size_t rank = (size_t) (p / 100.0 * count + 0.5);
+    if (rank < 1) {
+        rank = 1;
+    }
+    if (rank > count) {
+        rank = count;
+    }
+    return sorted[rank - 1];
+}
+
+static void bench_stats(double *values, const size_t count, bench_stats_t *stats) {
+    qsort(values, count, sizeof(double), cmp_double);
+
+    // Tukey fences, the sorted values in between are kept
+    double q1 = percentile(values, count, 25);
+    double q3 = percentile(values, count, 75);
+    double lo = q1 - 3 * (q3 - q1);
+    double hi = q3 + 3 * (q3 - q1);
+    size_t first = 0, last = count;
+    while (first < last && values[first] < lo) {
+        first++;
+    }
+    while (last > first && values[last - 1] > hi) {
+        last--;
+    }
+
+    const double *kept = values + first;
+    const size_t n = last - first;
+    double sum = 0;
+    for (size_t i = 0; i < n; i++) {
+        sum += kept[i];
+    }
+
+    stats->samples = count;
+    stats->kept = n;
+    stats->min = kept[0];
+    stats->p50 = percentile(kept, n, 50);
+    stats->p90 = percentile(kept, n, 90);
+    stats->p99 = percentile(kept, n, 99);
+    stats->max = kept[n - 1];
+    stats->mean = sum / n;
+}
+
+// --- runner ---
+
+static void bench_run(const bench_t *bench, bench_ctx_t *ctx, const size_t samples, const uint64_t overhead, bench_stats_t *stats) {
+    double values[samples];
+    size_t batch = 1;
+    size_t input = 0;
+
+    // Warm up caches and branch predictors, and double the batch until one
+    // batch is long enough to time
+    for (;;) {
+        uint64_t start = bench_ticks();
+        for (size_t j = 0; j < batch; j++) {
+            bench->run(ctx, input);
+            input = (input + 1) % BENCH_INPUTS;
+        }
+        uint64_t elapsed = bench_ticks() - start;
+        if (elapsed >= BENCH_SAMPLE_TICKS || batch >= (1 << 20)) {
+            break;
+        }
+        batch *= 2;
+    }
+
+    size_t count = 0;
+    double deadline = bench_seconds() + BENCH_BUDGET;
+    while (count < samples) {
+        uint64_t start = bench_ticks();
+        for (size_t j = 0; j < batch; j++) {
+            bench->run(ctx, input);
+            input = (input + 1) % BENCH_INPUTS;
+        }
+        uint64_t elapsed = bench_ticks() - start;
+
+        elapsed = elapsed > overhead ? elapsed - overhead : 0;
+        values[count++] = (double) elapsed / batch;
+
+        if (count >= BENCH_MIN_SAMPLES && bench_seconds() > deadline) {
+            break;
+        }
+    }
+
+    bench_stats(values, count, stats);
+}
+
+static void print_result(FILE *out, const int json, int *first, const char *curve, const bench_t *bench, const char *backend, const char *unit, const bench_stats_t *stats) {
+    if (json) {
+        fprintf(out, "%s\n    {\"curve\": \"%s\", \"layer\": \"%s\", \"op\": \"%s\", \"backend\": \"%s\", \"unit\": \"%s\", "
+                "\"samples\": %zu, \"kept\": %zu, \"min\": %.1f, \"p50\": %.1f, \"p90\": %.1f, \"p99\": %.1f, \"max\": %.1f, \"mean\": %.1f}",
+                *first ? "" : ",", curve, bench->layer, bench->name, backend, unit,
+                stats->samples, stats->kept, stats->min, stats->p50, stats->p90, stats->p99, stats->max, stats->mean);
+    } else {
+        fprintf(out, "%s,%s,%s,%s,%s,%zu,%zu,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f\n",
+                curve, bench->layer, bench->name, backend, unit,
+                stats->samples, stats->kept, stats->min, stats->p50, stats->p90, stats->p99, stats->max, stats->mean);
+    }
+    *first = 0;
+    fflush(out);
+}
+
+// Model name of the first CPU in /proc/cpuinfo
+static void cpu_model(char *model, const size_t size) {
+    char line[256];
+    FILE *fp = fopen("/proc/cpuinfo", "r");
+
+    snprintf(model, size, "unknown");
+    while (fp && fgets(line, sizeof(line), fp)) {
+        char *value = strchr(line, ':');
+        if (strncmp(line, "model name", 10) == 0 && value) {
+            value += 2;
+            value[strcspn(value, "\n")] = 0;
+            snprintf(model, size, "%s", value);
+            break;
+        }
+    }
+    if (fp) {
+        fclose(fp);
+    }
+}
+
+// Host description, so results from different machines aren't compared by
+// accident. Quotes are dropped to keep the JSON valid.
+static void print_host(FILE *out, const char *unit, const uint64_t overhead) {
+    struct utsname uts;
+    char model[128];
+    char date[32];
+    time_t now = time(NULL);
+
+    uname(&uts);
+    cpu_model(model, sizeof(model));
+    strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", gmtime(&now));
+    for (char *c = model; *c; c++) {
+        if (*c == '"' || *c == '\\') {
+            *c = ' ';
+        }
+    }
+
+    fprintf(out, "  \"host\": {\"hostname\": \"%s\", \"cpu\": \"%s\", \"cpus\": %ld, \"kernel\": \"%s %s\", "
+            "\"arch\": \"%s\", \"compiler\": \"%s\", \"keysize\": %d, \"date\": \"%s\"},\n",
+            uts.nodename, model, sysconf(_SC_NPROCESSORS_ONLN), uts.sysname, uts.release,
+            uts.machine, __VERSION__, KEYSIZE, date);
+    fprintf(out, "  \"unit\": \"%s\",\n  \"timer_overhead\": %llu,\n", unit, (unsigned long long) overhead);
+}
+
+// --- multi-threaded scaling ---
+
+typedef struct {
+    const curve_t *curve;
+    int verify;
+    int cpu;
+    double seconds;
+    pthread_barrier_t *barrier;
+    uint64_t ops;
+} scaling_worker_t;
+
+// Sign or verify in a loop on one shared, read-only curve, each thread with
+// its own keys and buffers
+static void *scaling_worker(void *arg) {
+    scaling_worker_t *w = arg;
+    const curve_t *curve = w->curve;
+    eccint_t privatekey[KEYSIZE];
+    eccint_t hash[KEYSIZE];
+    eccint_point_t publickey;
+    eccint_signature_t signature;
+    volatile int sink = 0;
+
+    if (w->cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(w->cpu, &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+
+    while (!ecc_keygen(&publickey, privatekey, curve)) {}
+    eccint_urand(hash, curve->words);
+    ecc_sign(privatekey, hash, &signature, curve);
+
+    pthread_barrier_wait(w->barrier);
+
+    double deadline = bench_seconds() + w->seconds;
+    do {
+        for (size_t i = 0; i < 4; i++) {
+            if (w->verify) {
+                sink += ecc_verify(&publickey, hash, &signature, curve);
+            } else {
+                ecc_sign(privatekey, hash, &signature, curve);
+            }
+        }
+        w->ops += 4;
+    } while (bench_seconds() < deadline);
+
+    (void) sink;
+    return NULL;
+}
+
+// Throughput of sign and verify with 1, 2, 4, ... threads up to the number of
+// CPUs, each thread pinned to its own CPU
+static int bench_scaling(FILE *out, const int json, const char *filter, const double seconds) {
+    const long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    static const char *ops[] = { "sign", "verify" };
+    int first = 1;
+
+    if (json) {
+        fprintf(out, "{\n");
+        print_host(out, "ops/s", 0);
+        fprintf(out, "  \"scaling\": [");
+    } else {
+        fprintf(out, "curve,op,threads,ops,seconds,ops_per_sec,speedup,efficiency\n");
+    }
+
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); c++) {
+        curve_t curve = *curves[c].curve;
+        if (!ecc_curve_init(&curve)) {
+            fprintf(stderr, "Failed to set up %s\n", curves[c].name);
+            return 1;
+        }
+
+        for (size_t o = 0; o < 2; o++) {
+            char label[64];
+            double single = 0;
+
+            snprintf(label, sizeof(label), "%s/scaling/%s", curves[c].name, ops[o]);
+            if (filter && !strstr(label, filter)) {
+                continue;
+            }
+
+            for (long threads = 1; threads <= cpus; threads = threads * 2 <= cpus || threads == cpus ? threads * 2 : cpus) {
+                scaling_worker_t workers[threads];
+                pthread_t ids[threads];
+                pthread_barrier_t barrier;
+                uint64_t total = 0;
+
+                pthread_barrier_init(&barrier, NULL, threads);
+                for (long t = 0; t < threads; t++) {
+                    workers[t] = (scaling_worker_t) { &curve, (int) o, (int) t, seconds, &barrier, 0 };
+                    pthread_create(&ids[t], NULL, scaling_worker, &workers[t]);
+                }
+                for (long t = 0; t < threads; t++) {
+                    pthread_join(ids[t], NULL);
+                    total += workers[t].ops;
+                }
+                pthread_barrier_destroy(&barrier);
+
+                double rate = total / seconds;
+                if (threads == 1) {
+                    single = rate;
+                }
+
+                if (json) {
+                    fprintf(out, "%s\n    {\"curve\": \"%s\", \"op\": \"%s\", \"threads\": %ld, \"ops\": %llu, \"seconds\": %.2f, "
+                            "\"ops_per_sec\": %.1f, \"speedup\": %.2f, \"efficiency\": %.2f}",
+                            first ? "" : ",", curves[c].name, ops[o], threads, (unsigned long long) total, seconds,
+                            rate, rate / single, rate / single / threads);
+                } else {
+                    fprintf(out, "%s,%s,%ld,%llu,%.2f,%.1f,%.2f,%.2f\n", curves[c].name, ops[o], threads,
+                            (unsigned long long) total, seconds, rate, rate / single, rate / single / threads);
+                }
+                first = 0;
+                fflush(out);
+
+                if (threads == cpus) {
+                    break;
+                }
+            }
+        }
+
+        ecc_curve_free(&curve);
+    }
+
+    if (json) {
+        fprintf(out, "\n  ]\n}\n");
+    }
+    return 0;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-j] [-t] [-s] [-d seconds] [-n samples] [-c cpu] [-f filter] [-o file]\n", name);
+    fprintf(stderr, "  -j  write JSON instead of CSV\n");
+    fprintf(stderr, "  -t  use clock_gettime instead of the TSC\n");
+    fprintf(stderr, "  -s  measure sign/verify throughput with 1 thread up to one per CPU\n");
+    fprintf(stderr, "  -d  seconds per thread count with -s (default 1)\n");
+    fprintf(stderr, "  -n  samples per benchmark (default 101)\n");
+    fprintf(stderr, "  -c  pin to this CPU (default 0, -1 to not pin)\n");
+    fprintf(stderr, "  -f  only run benchmarks whose curve/layer/op/backend contains filter\n");
+    fprintf(stderr, "  -o  write results to file instead of stdout\n");
+}
+
+int main(int argc, char **argv) {
+    int json = 0;
+    size_t samples = 101;
+    int cpu = 0;
+    const char *filter = NULL;
+    FILE *out = stdout;
+    int scaling = 0;
+    double seconds = 1.0;
+    int opt;
+
+#ifdef BENCH_HAVE_TSC
+    use_tsc = 1;
+#endif
+
+    while ((opt = getopt(argc, argv, "jtsd:n:c:f:o:h")) != -1) {
+        switch (opt) {
+            case 'j': json = 1; break;
+            case 't': use_tsc = 0; break;
+            case 's': scaling = 1; break;
+            case 'd': seconds = atof(optarg); break;
+            case 'n': samples = strtoul(optarg, NULL, 10); break;
+            case 'c': cpu = atoi(optarg); break;
+            case 'f': filter = optarg; break;
+            case 'o':
+                out = fopen(optarg, "w");
+                if (!out) {
+                    perror(optarg);
+                    return 1;
+                }
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (samples < BENCH_MIN_SAMPLES) {
+        samples = BENCH_MIN_SAMPLES;
+    }
+
+    if (scaling) {
+        int ret = bench_scaling(out, json, filter, seconds > 0 ? seconds : 1.0);
+        if (out != stdout) {
+            fclose(out);
+        }
+        return ret;
+    }
+
+    // Pinning keeps the thread from migrating between cores mid-sample
+    if (cpu >= 0) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+            perror("sched_setaffinity");
+        }
+    }
+
+    const char *unit = use_tsc ? "cycles" : "ns";
+    const uint64_t overhead = bench_overhead();
+    int first = 1;
+
+    if (json) {
+        fprintf(out, "{\n");
+        print_host(out, unit, overhead);
+        fprintf(out, "  \"results\": [");
+    } else {
+        fprintf(out, "curve,layer,op,backend,unit,samples,kept,min,p50,p90,p99,max,mean\n");
+    }
+
+    for (size_t c = 0; c < sizeof(curves) / sizeof(curves[0]); c++) {
+        bench_ctx_t *ctx = malloc(sizeof(bench_ctx_t));
+        if (!ctx || !bench_ctx_init(ctx, curves[c].curve)) {
+            fprintf(stderr, "Failed to set up %s\n", curves[c].name);
+            return 1;
+        }
+
+        for (size_t b = 0; b < sizeof(benchmarks) / sizeof(benchmarks[0]); b++) {
+            const bench_t *bench = &benchmarks[b];
+            const char *backends[9] = { "default" };
+            size_t count = 1;
+
+            if (!curves[c].ecdsa && strcmp(bench->layer, "ecdsa") == 0) {
+                continue;
+            }
+            if (bench->op) {
+                count = ecc_dispatch_backends(bench->op, backends, 8);
+            }
+#ifdef ECC_BENCH_CXX
+            if (bench->cxx && ctx->cxx) {
+                backends[count++] = "cxx";
+            }
+#endif
+
+            for (size_t i = 0; i < count; i++) {
+                char label[128];
+                bench_stats_t stats;
+
+                snprintf(label, sizeof(label), "%s/%s/%s/%s", curves[c].name, bench->layer, bench->name, backends[i]);
+                if (filter && !strstr(label, filter)) {
+                    continue;
+                }
+
+                bench_t run = *bench;
+                ctx->dispatch = *ecc_dispatch_default();
+                if (strcmp(backends[i], "cxx") == 0) {
+                    run.run = bench->cxx;
+                } else if (bench->op) {
+                    ecc_dispatch_select(&ctx->dispatch, bench->op, backends[i]);
+                }
+
+                bench_run(&run, ctx, samples, overhead, &stats);
+                print_result(out, json, &first, curves[c].name, bench, backends[i], unit, &stats);
+            }
+        }
+
+        bench_ctx_free(ctx);
+        free(ctx);
+    }
+
+    if (json) {
+        fprintf(out, "\n  ]\n}\n");
+    }
+    if (out != stdout) {
+        fclose(out);
+    }
+    return 0;
+}
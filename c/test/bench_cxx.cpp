@@ -0,0 +1,151 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+// The C++ side of `make bench-cxx`, see bench_cxx.h
+
+#include <cstdio>
+#include <cstring>
+
+#include "eccfield.hpp"
+
+extern "C" {
+#include "eccmemory.h"
+#include "eccmath.h"
+#include "eccdispatch.h"
+#include "bench_cxx.h"
+}
+
+namespace {
+
+template<typename C>
+struct ops {
+    using F = typename C::field;
+
+    static void mul_mod(const eccint_t *a, const eccint_t *b, eccint_t *res) {
+        (F::from_bytes(a) * F::from_bytes(b)).to_bytes(res);
+    }
+
+    static void square(const eccint_t *a, eccint_t *res) {
+        sqr(F::from_bytes(a)).to_bytes(res);
+    }
+
+    static void invert(const eccint_t *a, eccint_t *res) {
+        inv(F::from_bytes(a)).to_bytes(res);
+    }
+
+    static void point_add(const eccint_point_t *p, const eccint_point_t *q, eccint_point_t *res) {
+        C::to_c(C::add(C::from_c(p), C::from_c(q)), res);
+    }
+
+    static void point_double(const eccint_point_t *p, eccint_point_t *res) {
+        C::to_c(C::dbl(C::from_c(p)), res);
+    }
+
+    static void point_mul(const eccint_t *k, const eccint_point_t *p, eccint_point_t *res) {
+        C::to_c(C::mul(k, F::bytes, C::from_c(p)), res);
+    }
+
+    static constexpr bench_cxx_t table = { mul_mod, square, invert, point_add, point_double, point_mul };
+};
+
+// Random element below z^m
+void random_element(eccint_t *a, const curve_t *curve) {
+    eccint_set(a, 0, KEYSIZE);
+    eccint_urand(a, curve->words);
+    a[curve->words - 1] &= (1 << (curve->m % 8)) - 1;
+}
+
+int check_field(const char *op, const eccint_t *expect, const eccint_t *got, const curve_t *curve) {
+    if (memcmp(expect, got, curve->words) != 0) {
+        fprintf(stderr, "bench_cxx: %s differs from the C code on the %zu bit curve\n", op, curve->m);
+        return 0;
+    }
+    return 1;
+}
+
+int check_point(const char *op, const eccint_point_t *expect, const eccint_point_t *got, const curve_t *curve) {
+    if (eccint_point_cmp(expect, got, curve->words) != 0) {
+        fprintf(stderr, "bench_cxx: %s differs from the C code on the %zu bit curve\n", op, curve->m);
+        return 0;
+    }
+    return 1;
+}
+
+int check_infinity(const char *op, const eccint_point_t *got, const curve_t *curve) {
+    if (!got->infinity) {
+        fprintf(stderr, "bench_cxx: %s is not infinity on the %zu bit curve\n", op, curve->m);
+        return 0;
+    }
+    return 1;
+}
+
+} // namespace
+
+extern "C" const bench_cxx_t *bench_cxx_ops(const curve_t *curve) {
+    if (ecc::sect163k1_curve::is_curve_of(curve)) {
+        return &ops<ecc::sect163k1_curve>::table;
+    }
+#if KEYSIZE >= 36
+    if (ecc::sect283k1_curve::is_curve_of(curve)) {
+        return &ops<ecc::sect283k1_curve>::table;
+    }
+#endif
+    return nullptr;
+}
+
+extern "C" int bench_cxx_check(const bench_cxx_t *cxx, const curve_t *curve) {
+    eccint_t a[2 * KEYSIZE], b[2 * KEYSIZE], k[KEYSIZE];
+    eccint_t expect[2 * KEYSIZE], got[2 * KEYSIZE];
+    eccint_point_t p, q, pexpect, pgot;
+    int ok = 1;
+
+    for (int i = 0; i < 32 && ok; i++) {
+        random_element(a, curve);
+        random_element(b, curve);
+        eccint_urand(k, curve->words);
+
+        eccint_mul_mod(a, b, curve->q, expect, curve);
+        cxx->mul_mod(a, b, got);
+        ok &= check_field("mul_mod", expect, got, curve);
+
+        eccint_square_mod(a, curve->q, expect, curve);
+        cxx->square(a, got);
+        ok &= check_field("square", expect, got, curve);
+
+        eccint_inv_mod(a, curve->q, expect, curve);
+        cxx->invert(a, got);
+        ok &= check_field("invert", expect, got, curve);
+
+        eccint_point_mul(k, &curve->P, &p, curve);
+        eccint_point_mul(b, &curve->P, &q, curve);
+        cxx->point_mul(k, &curve->P, &pgot);
+        ok &= check_point("point_mul", &p, &pgot, curve);
+
+        eccint_point_add(&p, &q, &pexpect, curve);
+        cxx->point_add(&p, &q, &pgot);
+        ok &= check_point("point_add", &pexpect, &pgot, curve);
+
+        eccint_point_double(&p, &pexpect, curve);
+        cxx->point_double(&p, &pgot);
+        ok &= check_point("point_double", &pexpect, &pgot, curve);
+    }
+
+    // Edge cases of the ladder and the addition
+    eccint_set(k, 0, KEYSIZE);
+    cxx->point_mul(k, &curve->P, &pgot);
+    ok &= check_infinity("0 * P", &pgot, curve);
+    eccint_cpy(k, curve->order, curve->words);
+    cxx->point_mul(k, &curve->P, &pgot);
+    ok &= check_infinity("n * P", &pgot, curve);
+    eccint_point_set_infinity(&q, curve->words);
+    cxx->point_add(&curve->P, &q, &pgot);
+    ok &= check_point("point_add", &curve->P, &pgot, curve);
+    eccint_point_cpy(&q, &curve->P, curve->words);
+    eccint_add(q.y, q.x, q.y, curve->words);
+    cxx->point_add(&curve->P, &q, &pgot);
+    ok &= check_infinity("P - P", &pgot, curve);
+
+    return ok;
+}
@@ -0,0 +1,40 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#ifndef __BENCH_CXX_H
+#define __BENCH_CXX_H
+
+#include "ecctypes.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Operations of the compile-time specialized C++ layer (eccfield.hpp) on the
+ * eccint_t layout, so bench.c can time them next to the C code. Built with
+ * `make bench-cxx`.
+ */
+typedef struct {
+    void (*mul_mod)(const eccint_t *a, const eccint_t *b, eccint_t *res);
+    void (*square)(const eccint_t *a, eccint_t *res);
+    void (*invert)(const eccint_t *a, eccint_t *res);
+    void (*point_add)(const eccint_point_t *p, const eccint_point_t *q, eccint_point_t *res);
+    void (*point_double)(const eccint_point_t *p, eccint_point_t *res);
+    void (*point_mul)(const eccint_t *k, const eccint_point_t *p, eccint_point_t *res);
+} bench_cxx_t;
+
+// The operations for |curve|, NULL if there is no specialization for it
+const bench_cxx_t *bench_cxx_ops(const curve_t *curve);
+
+// Compare the operations against the C code on random inputs, returns 1 if
+// they agree
+int bench_cxx_check(const bench_cxx_t *ops, const curve_t *curve);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
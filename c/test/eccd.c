@@ -0,0 +1,162 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+
+#include "ecctypes.h"
+#include "eccmemory.h"
+#include "eccmath.h"
+#include "ecctables.h"
+#include "ecdsa.h"
+#include "eccprecomp.h"
+#include "eccserver.h"
+
+#include "curves/sect163k1.h"
+#include "curves/testcurve2x9.h"
+
+// Most keys the daemon serves
+#define ECCD_KEYS 64
+
+static ecc_server_t *server = NULL;
+
+static void eccd_signal(int sig) {
+    (void) sig;
+    if (server) {
+        ecc_server_stop(server);
+    }
+}
+
+// Load a private key file, or create it with a new key if it doesn't exist
+static int eccd_load_key(const char *path, ecc_server_key_t *key, const curve_t *curve) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+
+    if (fd >= 0) {
+        ssize_t n = read(fd, key->privatekey, curve->words);
+        close(fd);
+        if (n != (ssize_t) curve->words || eccint_testzero(key->privatekey, curve->words) ||
+            eccint_cmp(key->privatekey, curve->order, curve->words) >= 0) {
+            fprintf(stderr, "%s: not a private key for this curve\n", path);
+            return 0;
+        }
+        eccint_point_mul(key->privatekey, &curve->P, &key->publickey, curve);
+        return 1;
+    }
+
+    while (!ecc_keygen(&key->publickey, key->privatekey, curve)) {}
+
+    fd = open(path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+    if (fd < 0 || write(fd, key->privatekey, curve->words) != (ssize_t) curve->words) {
+        perror(path);
+        if (fd >= 0) {
+            close(fd);
+        }
+        return 0;
+    }
+    close(fd);
+    fprintf(stderr, "%s: created a new key\n", path);
+    return 1;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-s socket] [-c curve] [-t threads] [-n nonces] -k keyfile...\n", name);
+    fprintf(stderr, "  -s  path of the Unix socket (default $XDG_RUNTIME_DIR/eccd.sock)\n");
+    fprintf(stderr, "  -c  sect163k1 (default) or testcurve9\n");
+    fprintf(stderr, "  -t  verify threads (default one per CPU)\n");
+    fprintf(stderr, "  -n  nonces computed ahead for signing (default 1024)\n");
+    fprintf(stderr, "  -k  private key file, created if it doesn't exist; the first\n");
+    fprintf(stderr, "      key is slot 0, the next slot 1 and so on\n");
+}
+
+int main(int argc, char **argv) {
+    const char *path = NULL;
+    char runtime_path[4096];
+    const char *keyfiles[ECCD_KEYS];
+    size_t count = 0;
+    size_t threads = 0;
+    size_t nonces = 1024;
+    curve_t curve = sect163k1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:c:t:n:k:h")) != -1) {
+        switch (opt) {
+            case 's': path = optarg; break;
+            case 't': threads = strtoul(optarg, NULL, 10); break;
+            case 'n': nonces = strtoul(optarg, NULL, 10); break;
+            case 'c':
+                if (strcmp(optarg, "testcurve9") == 0) {
+                    curve = testcurve9;
+                } else if (strcmp(optarg, "sect163k1") != 0) {
+                    fprintf(stderr, "Unknown curve %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 'k':
+                if (count == ECCD_KEYS) {
+                    fprintf(stderr, "At most %d keys\n", ECCD_KEYS);
+                    return 1;
+                }
+                keyfiles[count++] = optarg;
+                break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (!count) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    // The socket signs for anyone who can connect, so by default it lives
+    // in the user's private runtime directory rather than in /tmp
+    if (!path) {
+        const char *runtime = getenv("XDG_RUNTIME_DIR");
+        if (!runtime || !*runtime ||
+            snprintf(runtime_path, sizeof(runtime_path), "%s/eccd.sock", runtime) >= (int) sizeof(runtime_path)) {
+            fprintf(stderr, "XDG_RUNTIME_DIR is not set, give the socket path with -s\n");
+            return 1;
+        }
+        path = runtime_path;
+    }
+
+    // The tables are built once here instead of in every client process.
+    // With the fixed-base table of P the nonce thread computes kP without
+    // doublings.
+    ecc_precomp_t precomp;
+    if (!ecc_curve_init(&curve) || !ecc_precomp_build(&precomp, &curve.P, ECC_PRECOMP_CURVE, &curve)) {
+        fprintf(stderr, "Failed to build the curve tables\n");
+        return 1;
+    }
+    curve.precomp = &precomp;
+
+    ecc_server_key_t keys[ECCD_KEYS];
+    for (size_t i = 0; i < count; i++) {
+        if (!eccd_load_key(keyfiles[i], &keys[i], &curve)) {
+            return 1;
+        }
+    }
+
+    server = ecc_server_create(path, keys, count, &curve, threads, nonces);
+    memset(keys, 0, sizeof(keys));
+    if (!server) {
+        perror(path);
+        return 1;
+    }
+
+    signal(SIGINT, eccd_signal);
+    signal(SIGTERM, eccd_signal);
+    fprintf(stderr, "Serving %zu keys on %s\n", count, path);
+
+    int ok = ecc_server_run(server);
+    ecc_server_destroy(server);
+    ecc_precomp_free(&precomp);
+    ecc_curve_free(&curve);
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,563 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "ecctypes.h"
+#include "eccmemory.h"
+#include "eccmath.h"
+#include "ecctables.h"
+#include "ecdsa.h"
+#include "eccbatch.h"
+#include "sha256.h"
+
+#include "curves/sect163k1.h"
+#include "curves/testcurve2x9.h"
+
+// Version 2 turns the digest into e as SEC1 does, see hash_file
+#define MANIFEST_HEADER "# ecdsa manifest 2"
+
+// Files hashed and signed per round, bounds the memory for huge file sets
+#define CLI_ROUND 65536
+
+typedef struct {
+    char **paths;
+    size_t count;
+    size_t size;
+} file_list_t;
+
+typedef struct {
+    char **paths;
+    eccint_keyptr_t *hashes;
+    int *ok;
+    size_t count;
+    size_t next;
+    const curve_t *curve;
+} hash_job_t;
+
+static const char *curve_names[] = { "sect163k1", "testcurve9" };
+static const curve_t *curves[] = { &sect163k1, &testcurve9 };
+
+static const curve_t *curve_by_name(const char *name) {
+    for (size_t i = 0; i < sizeof(curves) / sizeof(curves[0]); i++) {
+        if (strcmp(name, curve_names[i]) == 0) {
+            return curves[i];
+        }
+    }
+    return NULL;
+}
+
+static const char *curve_name(const curve_t *curve) {
+    for (size_t i = 0; i < sizeof(curves) / sizeof(curves[0]); i++) {
+        if (curves[i] == curve) {
+            return curve_names[i];
+        }
+    }
+    return "unknown";
+}
+
+// --- files ---
+
+static int list_add(file_list_t *list, const char *path) {
+    if (list->count == list->size) {
+        size_t size = list->size ? 2 * list->size : 1024;
+        char **paths = realloc(list->paths, size * sizeof(char *));
+        if (!paths) {
+            return 0;
+        }
+        list->paths = paths;
+        list->size = size;
+    }
+    list->paths[list->count] = strdup(path);
+    return list->paths[list->count++] != NULL;
+}
+
+// Add one path per line of |name|, or of stdin for "-"
+static int list_read(file_list_t *list, const char *name) {
+    FILE *fp = strcmp(name, "-") == 0 ? stdin : fopen(name, "r");
+    char *line = NULL;
+    size_t size = 0;
+    ssize_t len;
+    int ok = 1;
+
+    if (!fp) {
+        perror(name);
+        return 0;
+    }
+    while (ok && (len = getline(&line, &size, fp)) > 0) {
+        if (line[len - 1] == '\n') {
+            line[--len] = '\0';
+        }
+        if (len) {
+            ok = list_add(list, line);
+        }
+    }
+    free(line);
+    if (fp != stdin) {
+        fclose(fp);
+    }
+    return ok;
+}
+
+static void list_free(file_list_t *list) {
+    for (size_t i = 0; i < list->count; i++) {
+        free(list->paths[i]);
+    }
+    free(list->paths);
+}
+
+// Hash a file into the message hash e for |curve|. As in SEC1 4.1.3, e is
+// the leftmost m bits of the SHA-256 digest read as an integer, reduced
+// mod the group order.
+static int hash_file(const char *path, eccint_t *hash, const curve_t *curve) {
+    unsigned char digest[SHA256_BLOCK_SIZE];
+    SHA256_CTX ctx;
+    struct stat st;
+
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return 0;
+    }
+
+    sha256_init(&ctx);
+    if (st.st_size > 0) {
+        void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED) {
+            close(fd);
+            return 0;
+        }
+        madvise(data, st.st_size, MADV_SEQUENTIAL);
+        sha256_update(&ctx, data, st.st_size);
+        munmap(data, st.st_size);
+    }
+    close(fd);
+    sha256_final(&ctx, digest);
+
+    // The digest is big endian, eccint_t little endian
+    eccint_t e[SHA256_BLOCK_SIZE];
+    for (size_t i = 0; i < SHA256_BLOCK_SIZE; i++) {
+        e[i] = digest[SHA256_BLOCK_SIZE - 1 - i];
+    }
+
+    // Keep the leftmost m bits, dropping whole bytes first
+    const size_t drop = curve->m < 8 * SHA256_BLOCK_SIZE ? 8 * SHA256_BLOCK_SIZE - curve->m : 0;
+    const size_t bytes = SHA256_BLOCK_SIZE - drop / 8;
+    eccint_shift_right(e + drop / 8, e + drop / 8, drop % 8, bytes);
+
+    memset(hash, 0, KEYSIZE);
+    eccint_cpy(hash, e + drop / 8, curve->words < bytes ? curve->words : bytes);
+    eccint_int_mod(hash, curve->order, hash, curve->words);
+    return 1;
+}
+
+static void *hash_worker(void *data) {
+    hash_job_t *job = data;
+    size_t i;
+
+    while ((i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED)) < job->count) {
+        job->ok[i] = hash_file(job->paths[i], job->hashes[i], job->curve);
+    }
+    return NULL;
+}
+
+// Hash |count| files on |threads| threads
+static void hash_files(char **paths, eccint_keyptr_t *hashes, int *ok, const size_t count, const size_t threads, const curve_t *curve) {
+    hash_job_t job = { paths, hashes, ok, count, 0, curve };
+    pthread_t ids[threads];
+    size_t started = 0;
+
+    while (started < threads - 1 && pthread_create(&ids[started], NULL, hash_worker, &job) == 0) {
+        started++;
+    }
+    hash_worker(&job);
+    for (size_t t = 0; t < started; t++) {
+        pthread_join(ids[t], NULL);
+    }
+}
+
+// --- keys ---
+
+static int read_exact(const char *path, void *data, const size_t size) {
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    ssize_t n = fd >= 0 ? read(fd, data, size) : -1;
+
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (n != (ssize_t) size) {
+        fprintf(stderr, "%s: can't read %zu bytes\n", path, size);
+        return 0;
+    }
+    return 1;
+}
+
+static int write_exact(const char *path, const void *data, const size_t size, const mode_t mode) {
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, mode);
+    ssize_t n = fd >= 0 ? write(fd, data, size) : -1;
+
+    if (fd >= 0) {
+        close(fd);
+    }
+    if (n != (ssize_t) size) {
+        perror(path);
+        return 0;
+    }
+    return 1;
+}
+
+static void print_hex(FILE *out, const eccint_t *data, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        fprintf(out, "%02x", data[i]);
+    }
+}
+
+static int parse_hex(const char *hex, eccint_t *data, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        unsigned int byte;
+        if (sscanf(hex + 2 * i, "%2x", &byte) != 1) {
+            return 0;
+        }
+        data[i] = byte;
+    }
+    return 1;
+}
+
+// --- commands ---
+
+static int cmd_keygen(const char *keyfile, const curve_t *curve) {
+    eccint_t privatekey[KEYSIZE];
+    eccint_t pub[2 * KEYSIZE];
+    eccint_point_t publickey;
+    char pubfile[4096];
+
+    snprintf(pubfile, sizeof(pubfile), "%s.pub", keyfile);
+    while (!ecc_keygen(&publickey, privatekey, curve)) {}
+
+    eccint_cpy(pub, publickey.x, curve->words);
+    eccint_cpy(pub + curve->words, publickey.y, curve->words);
+    int ok = write_exact(keyfile, privatekey, curve->words, 0600) && write_exact(pubfile, pub, 2 * curve->words, 0644);
+    memset(privatekey, 0, sizeof(privatekey));
+    return ok ? 0 : 1;
+}
+
+static int cmd_sign(const char *keyfile, file_list_t *files, FILE *out, ecc_pool_t *pool, const size_t threads, const curve_t *base) {
+    curve_t tables = *base;
+    const curve_t *curve = &tables;
+    const size_t words = curve->words;
+    const size_t round = files->count < CLI_ROUND ? files->count : CLI_ROUND;
+    eccint_t privatekey[KEYSIZE];
+    eccint_point_t publickey;
+    int failed = 0;
+
+    if (!read_exact(keyfile, privatekey, words)) {
+        return 1;
+    }
+    // The key has to be in [1, order - 1]
+    eccint_t zero[KEYSIZE] = { 0 };
+    if (eccint_cmp(privatekey, zero, words) == 0 || eccint_cmp(privatekey, curve->order, words) >= 0) {
+        fprintf(stderr, "%s: invalid private key\n", keyfile);
+        memset(privatekey, 0, sizeof(privatekey));
+        return 1;
+    }
+    if (!ecc_curve_init(&tables)) {
+        return 1;
+    }
+    eccint_point_mul(privatekey, &curve->P, &publickey, curve);
+
+    eccint_keyptr_t *hashes = calloc(round ? round : 1, sizeof(eccint_keyptr_t));
+    eccint_signature_t *signatures = calloc(round ? round : 1, sizeof(eccint_signature_t));
+    int *ok = calloc(round ? round : 1, sizeof(int));
+    if (!hashes || !signatures || !ok) {
+        fprintf(stderr, "Out of memory\n");
+        failed = 1;
+        goto out;
+    }
+
+    fprintf(out, "%s %s ", MANIFEST_HEADER, curve_name(base));
+    print_hex(out, publickey.x, words);
+    print_hex(out, publickey.y, words);
+    fprintf(out, "\n");
+
+    for (size_t first = 0; first < files->count; first += round) {
+        size_t count = files->count - first < round ? files->count - first : round;
+
+        hash_files(files->paths + first, hashes, ok, count, threads, curve);
+        // Every file gets its own nonce in the batch, so r never repeats.
+        // A failed batch would leave the last round's signatures behind.
+        if (!ecc_sign_batch(pool, privatekey, (const eccint_keyptr_t *) hashes, signatures, count, curve, NULL, NULL)) {
+            fprintf(stderr, "Out of memory\n");
+            failed = 1;
+            goto out;
+        }
+
+        for (size_t i = 0; i < count; i++) {
+            if (!ok[i]) {
+                fprintf(stderr, "%s: can't read\n", files->paths[first + i]);
+                failed = 1;
+                continue;
+            }
+            print_hex(out, signatures[i].r, words);
+            print_hex(out, signatures[i].s, words);
+            fprintf(out, "  %s\n", files->paths[first + i]);
+        }
+    }
+
+out:
+    memset(privatekey, 0, sizeof(privatekey));
+    ecc_curve_free(&tables);
+    free(hashes);
+    free(signatures);
+    free(ok);
+    return failed;
+}
+
+static int cmd_verify(const char *pubfile, const char *manifest, ecc_pool_t *pool, const size_t threads, int quiet) {
+    eccint_t pub[2 * KEYSIZE];
+    eccint_point_t publickey;
+    file_list_t files = { NULL, 0, 0 };
+    eccint_signature_t *signatures = NULL;
+    size_t signatures_size = 0;
+    const curve_t *curve = NULL;
+    curve_t tables;
+    char *line = NULL;
+    size_t size = 0;
+    ssize_t len;
+    size_t bad = 0, unreadable = 0;
+    int failed = 0;
+
+    FILE *fp = strcmp(manifest, "-") == 0 ? stdin : fopen(manifest, "r");
+    if (!fp) {
+        perror(manifest);
+        return 1;
+    }
+
+    while ((len = getline(&line, &size, fp)) > 0) {
+        if (line[len - 1] == '\n') {
+            line[--len] = '\0';
+        }
+        if (strncmp(line, MANIFEST_HEADER " ", sizeof(MANIFEST_HEADER)) == 0) {
+            char name[32];
+            if (sscanf(line + sizeof(MANIFEST_HEADER), "%31s", name) != 1 || !(curve = curve_by_name(name))) {
+                fprintf(stderr, "%s: unknown curve\n", manifest);
+                failed = 1;
+                break;
+            }
+            continue;
+        }
+        if (!curve || line[0] == '#' || !len) {
+            continue;
+        }
+
+        // <r><s>, two spaces, path
+        const size_t hexlen = 4 * curve->words;
+        eccint_signature_t signature;
+        if ((size_t) len < hexlen + 3 || strncmp(line + hexlen, "  ", 2) != 0 ||
+            !parse_hex(line, signature.r, curve->words) || !parse_hex(line + hexlen / 2, signature.s, curve->words)) {
+            fprintf(stderr, "%s: malformed line %s\n", manifest, line);
+            failed = 1;
+            continue;
+        }
+
+        if (files.count == signatures_size) {
+            signatures_size = signatures_size ? 2 * signatures_size : 1024;
+            eccint_signature_t *grown = realloc(signatures, signatures_size * sizeof(eccint_signature_t));
+            if (!grown) {
+                failed = 1;
+                break;
+            }
+            signatures = grown;
+        }
+        signatures[files.count] = signature;
+        if (!list_add(&files, line + hexlen + 2)) {
+            failed = 1;
+            break;
+        }
+    }
+    free(line);
+    if (fp != stdin) {
+        fclose(fp);
+    }
+
+    if (!curve) {
+        fprintf(stderr, "%s: not a manifest\n", manifest);
+        failed = 1;
+    }
+    if (failed || !read_exact(pubfile, pub, 2 * curve->words)) {
+        list_free(&files);
+        free(signatures);
+        return 1;
+    }
+    eccint_cpy(publickey.x, pub, curve->words);
+    eccint_cpy(publickey.y, pub + curve->words, curve->words);
+    publickey.infinity = 0;
+    if (!ecc_validate_publickey(&publickey, curve)) {
+        fprintf(stderr, "%s: invalid public key\n", pubfile);
+        list_free(&files);
+        free(signatures);
+        return 1;
+    }
+
+    tables = *curve;
+    curve = &tables;
+    if (!ecc_curve_init(&tables)) {
+        list_free(&files);
+        free(signatures);
+        return 1;
+    }
+
+    const size_t round = files.count < CLI_ROUND ? files.count : CLI_ROUND;
+    eccint_keyptr_t *hashes = calloc(round ? round : 1, sizeof(eccint_keyptr_t));
+    eccint_point_t *publickeys = calloc(round ? round : 1, sizeof(eccint_point_t));
+    int *ok = calloc(round ? round : 1, sizeof(int));
+    int *results = calloc(round ? round : 1, sizeof(int));
+    if (!hashes || !publickeys || !ok || !results) {
+        fprintf(stderr, "Out of memory\n");
+        failed = 1;
+        goto out;
+    }
+    for (size_t i = 0; i < round; i++) {
+        publickeys[i] = publickey;
+    }
+
+    for (size_t first = 0; first < files.count; first += round) {
+        size_t count = files.count - first < round ? files.count - first : round;
+
+        hash_files(files.paths + first, hashes, ok, count, threads, curve);
+        ecc_verify_batch_parallel(pool, publickeys, (const eccint_keyptr_t *) hashes, signatures + first, results, count, curve, NULL, NULL);
+
+        for (size_t i = 0; i < count; i++) {
+            if (!ok[i]) {
+                printf("%s: FAILED open or read\n", files.paths[first + i]);
+                unreadable++;
+            } else if (!results[i]) {
+                printf("%s: FAILED\n", files.paths[first + i]);
+                bad++;
+            } else if (!quiet) {
+                printf("%s: OK\n", files.paths[first + i]);
+            }
+        }
+    }
+
+    if (unreadable) {
+        fprintf(stderr, "WARNING: %zu listed files could not be read\n", unreadable);
+    }
+    if (bad) {
+        fprintf(stderr, "WARNING: %zu of %zu signatures did NOT match\n", bad, files.count);
+    }
+    failed = bad || unreadable;
+
+out:
+    ecc_curve_free(&tables);
+    list_free(&files);
+    free(signatures);
+    free(hashes);
+    free(publickeys);
+    free(ok);
+    free(results);
+    return failed;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s keygen [-c curve] keyfile\n", name);
+    fprintf(stderr, "       %s sign [-c curve] [-t threads] [-l list] [-o manifest] keyfile [file...]\n", name);
+    fprintf(stderr, "       %s verify [-t threads] [-q] pubfile manifest\n", name);
+    fprintf(stderr, "  -c  sect163k1 (default) or testcurve9\n");
+    fprintf(stderr, "  -t  threads for hashing and signing (default one per CPU)\n");
+    fprintf(stderr, "  -l  also sign the files listed in this file, one per line, - for stdin\n");
+    fprintf(stderr, "  -o  write the manifest here instead of stdout\n");
+    fprintf(stderr, "  -q  only print files that fail\n");
+    fprintf(stderr, "keygen writes the private key to keyfile and the public key to keyfile.pub\n");
+}
+
+int main(int argc, char **argv) {
+    const curve_t *base = &sect163k1;
+    file_list_t files = { NULL, 0, 0 };
+    const char *output = NULL;
+    size_t threads = 0;
+    int quiet = 0;
+    int opt;
+
+    if (argc < 2) {
+        usage(argv[0]);
+        return 1;
+    }
+    const char *command = argv[1];
+    optind = 2;
+
+    while ((opt = getopt(argc, argv, "c:t:l:o:qh")) != -1) {
+        switch (opt) {
+            case 'c':
+                if (!(base = curve_by_name(optarg))) {
+                    fprintf(stderr, "Unknown curve %s\n", optarg);
+                    return 1;
+                }
+                break;
+            case 't': threads = strtoul(optarg, NULL, 10); break;
+            case 'l':
+                if (!list_read(&files, optarg)) {
+                    return 1;
+                }
+                break;
+            case 'o': output = optarg; break;
+            case 'q': quiet = 1; break;
+            default:
+                usage(argv[0]);
+                return opt == 'h' ? 0 : 1;
+        }
+    }
+    if (!threads) {
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cpus > 0 ? cpus : 1;
+    }
+
+    if (strcmp(command, "keygen") == 0 && optind + 1 == argc) {
+        return cmd_keygen(argv[optind], base);
+    }
+
+    ecc_pool_t *pool = ecc_pool_create(threads);
+    int ret = 1;
+    if (!pool) {
+        fprintf(stderr, "Failed to start %zu threads\n", threads);
+        goto out;
+    }
+
+    if (strcmp(command, "sign") == 0 && optind < argc) {
+        for (int i = optind + 1; i < argc; i++) {
+            if (!list_add(&files, argv[i])) {
+                goto out;
+            }
+        }
+        FILE *out = output ? fopen(output, "w") : stdout;
+        if (!out) {
+            perror(output);
+            goto out;
+        }
+        ret = cmd_sign(argv[optind], &files, out, pool, threads, base);
+        if (out != stdout && fclose(out) != 0) {
+            perror(output);
+            ret = 1;
+        }
+    } else if (strcmp(command, "verify") == 0 && optind + 2 == argc) {
+        // The manifest names the curve
+        ret = cmd_verify(argv[optind], argv[optind + 1], pool, threads, quiet);
+    } else {
+        usage(argv[0]);
+    }
+
+out:
+    list_free(&files);
+    ecc_pool_destroy(pool);
+    return ret;
+}
@@ -7,6 +7,7 @@
 #include "eccprint.h"
 #include "eccmemory.h"
 #include "ecdsa.h"
+#include "eccscratch.h"
 
 #include "curves/sect163k1.h"
 //#include "curves/testcurve2x9.h"
@@ -181,4 +182,5 @@ main(int argc, char** argv)
         
         //fclose(fp);
     }
+    ecc_scratch_report(stdout);
 }
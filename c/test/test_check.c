@@ -5,6 +5,15 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <string.h>
+#include <pthread.h>
+#include <poll.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
 
 #define CUTEST_NO_FORK
 #define CUTEST_PADDING 50
@@ -14,9 +23,24 @@
 #include "eccprint.h"
 #include "eccmemory.h"
 #include "ecdsa.h"
+#include "eccprecomp.h"
+#include "ecckeystore.h"
+#include "ecctables.h"
+#include "ecccounters.h"
+#include "ecchistogram.h"
+#include "eccbatch.h"
+#include "eccqueue.h"
+#include "eccserver.h"
+#include "ecdh.h"
+#include "ecckeycache.h"
+#include "eccverifycache.h"
+#include "eccscratch.h"
 
 #include "cutest.h"
 #include "curves/sect163k1.h"
+#include "curves/sect283k1.h"
+#include "curves/sect409k1.h"
+#include "curves/sect571k1.h"
 #include "curves/testcurve2x9.h"
 #include "sha256.h"
 
@@ -253,7 +277,7 @@ void test_eccint_mul_mod(void) {
 
 void test_eccint_point_addition(void) {
     // Values match rye.js solution
-    eccint_point_t INFTY    = { { ECCINT_MAX, ECCINT_MAX }, { ECCINT_MAX, ECCINT_MAX } };
+    eccint_point_t INFTY    = { { 0 }, { 0 }, 1 };
     eccint_point_t P        = { { 0b00000010, 0b00000000 }, { 0b00001111, 0b00000000 } };
     eccint_point_t P2       = { { 0b00000010, 0b00000000 }, { 0b00001111, 0b00001111 } };
     eccint_point_t Q        = { { 0b00001100, 0b00000000 }, { 0b00001100, 0b00000000 } };
@@ -271,12 +295,22 @@ void test_eccint_point_addition(void) {
 
     eccint_point_add(&P, &P2, &res, &testcurve9);
     TEST_CHECK(eccint_point_testinfinite(&res, testcurve9.words));
+
+    // Only the flag makes a point infinite, not its coordinates
+    eccint_point_t FLAGGED  = { { 0b00001100, 0b00000000 }, { 0b00001100, 0b00000000 }, 1 };
+    eccint_point_add(&FLAGGED, &Q, &res, &testcurve9);
+    TEST_CHECK(eccint_point_cmp(&res, &Q, testcurve9.words) == 0);
+    TEST_CHECK(!res.infinity);
+    eccint_point_add(&Q, &FLAGGED, &res, &testcurve9);
+    TEST_CHECK(eccint_point_cmp(&res, &Q, testcurve9.words) == 0);
+    eccint_point_add(&INFTY, &INFTY, &res, &testcurve9);
+    TEST_CHECK(eccint_point_testinfinite(&res, testcurve9.words));
 }
 
 void test_eccint_point_doubling(void) {
     // Values match rye.js solution
     eccint_point_t ZERO     = { { 0b00000000, 0b00000000 }, { 0b00000000, 0b00000000 } };
-    eccint_point_t INFTY    = { { ECCINT_MAX, ECCINT_MAX }, { ECCINT_MAX, ECCINT_MAX } };
+    eccint_point_t INFTY    = { { 0 }, { 0 }, 1 };
     eccint_point_t in       = { { 0b00000010, 0b00000000 }, { 0b00001111, 0b00000000 } };
     eccint_point_t expected = { { 0b10010101, 0b00000000 }, { 0b00011000, 0b00000001 } };
     eccint_point_t res;
@@ -292,18 +326,1407 @@ void test_eccint_point_doubling(void) {
 }
 
 void test_eccint_point_multiply(void) {
-    eccint_point_t expected = { { 0b11010011, 0b00000000 }, { 0b00100111, 0b00000001 } };
+    eccint_point_t expected = { { 0b10000101, 0b00000000 }, { 0b00110101, 0b00000000 } };
     eccint_t k[testcurve9.words];
     eccint_point_t in, res;
 
     eccint_from_number(511, k, testcurve9.words);
     eccint_from_number(511, in.x, testcurve9.words);
     eccint_from_number(447, in.y, testcurve9.words);
+    in.infinity = 0;
 
     eccint_point_mul(k, &in, &res, &testcurve9);
     TEST_CHECK(eccint_point_cmp(&res, &expected, testcurve9.words) == 0);
 }
 
+void test_eccint_precomp_point_mul(void) {
+    const curve_t *curve = &testcurve9;
+    ecc_precomp_t pre;
+    eccint_t k[curve->words];
+    eccint_point_t expected, res;
+
+    TEST_CHECK(ecc_precomp_build(&pre, &curve->P, ECC_PRECOMP_CURVE, curve));
+
+    for (uint32_t num = 0; num < (1 << curve->m); num += 7) {
+        eccint_from_number(num, k, curve->words);
+        eccint_point_mul(k, &curve->P, &expected, curve);
+        eccint_precomp_point_mul(k, &pre, &res, curve);
+        TEST_CHECK_(eccint_point_cmp(&res, &expected, curve->words) == 0, "%u * P", num);
+    }
+
+    ecc_precomp_free(&pre);
+}
+
+void test_ecc_precomp_file(void) {
+    const curve_t *curve = &testcurve9;
+    char path[] = "/tmp/ecc_precomp_XXXXXX";
+    ecc_precomp_t built, mapped;
+    eccint_t k[curve->words];
+    eccint_point_t expected, res;
+
+    int fd = mkstemp(path);
+    TEST_CHECK(fd >= 0);
+    close(fd);
+
+    TEST_CHECK(ecc_precomp_build(&built, &curve->P, ECC_PRECOMP_CURVE, curve));
+    TEST_CHECK(ecc_precomp_save(&built, path));
+
+    TEST_CHECK(ecc_precomp_map(&mapped, path, &curve->P, ECC_PRECOMP_CURVE, curve, ECC_PRECOMP_VERIFY));
+    TEST_CHECK(mapped.mapped);
+    TEST_CHECK(memcmp(mapped.data, built.data, built.size) == 0);
+
+    eccint_from_number(300, k, curve->words);
+    eccint_point_mul(k, &curve->P, &expected, curve);
+    eccint_precomp_point_mul(k, &mapped, &res, curve);
+    TEST_CHECK(eccint_point_cmp(&res, &expected, curve->words) == 0);
+    ecc_precomp_free(&mapped);
+
+    // A table for a different curve must be rejected
+    TEST_CHECK(!ecc_precomp_map(&mapped, path, &sect163k1.P, ECC_PRECOMP_CURVE, &sect163k1, 0));
+
+    // So must a table of another kind or for another point
+    TEST_CHECK(!ecc_precomp_map(&mapped, path, &curve->P, ECC_PRECOMP_KEY, curve, 0));
+    TEST_CHECK(!ecc_precomp_map(&mapped, path, &expected, ECC_PRECOMP_CURVE, curve, 0));
+
+    // Corrupt the last table entry, which only the checksum catches
+    fd = open(path, O_WRONLY);
+    TEST_CHECK(fd >= 0);
+    TEST_CHECK(pwrite(fd, "\x5A", 1, built.size - 1) == 1);
+    close(fd);
+    TEST_CHECK(ecc_precomp_map(&mapped, path, &curve->P, ECC_PRECOMP_CURVE, curve, 0));
+    ecc_precomp_free(&mapped);
+    TEST_CHECK(!ecc_precomp_map(&mapped, path, &curve->P, ECC_PRECOMP_CURVE, curve, ECC_PRECOMP_VERIFY));
+    ecc_precomp_free(&built);
+
+    // A key table is not accepted as the table of P, and the table of P
+    // doesn't verify as a key table
+    eccint_point_t publickey;
+    eccint_signature_t signature;
+    eccint_from_number(77, k, curve->words);
+    eccint_point_mul(k, &curve->P, &publickey, curve);
+    TEST_CHECK(ecc_precomp_build(&built, &publickey, ECC_PRECOMP_KEY, curve));
+    TEST_CHECK(ecc_precomp_save(&built, path));
+    TEST_CHECK(!ecc_precomp_map(&mapped, path, &curve->P, ECC_PRECOMP_CURVE, curve, 0));
+    TEST_CHECK(!ecc_precomp_map(&mapped, path, &publickey, ECC_PRECOMP_CURVE, curve, 0));
+    TEST_CHECK(ecc_precomp_map(&mapped, path, &publickey, ECC_PRECOMP_KEY, curve, ECC_PRECOMP_VERIFY));
+    ecc_precomp_free(&mapped);
+    ecc_precomp_free(&built);
+
+    eccint_t one[KEYSIZE], hash[KEYSIZE];
+    eccint_from_number(1, one, sect163k1.words);
+    eccint_urand(hash, sect163k1.words);
+    ecc_sign(one, hash, &signature, &sect163k1);
+    TEST_CHECK(ecc_verify(&sect163k1.P, hash, &signature, &sect163k1));
+    TEST_CHECK(ecc_precomp_build(&built, &sect163k1.P, ECC_PRECOMP_CURVE, &sect163k1));
+    TEST_CHECK(!ecc_verify_precomp(&built, hash, &signature, &sect163k1));
+    ecc_precomp_free(&built);
+    unlink(path);
+}
+
+void test_eccint_point_compress(void) {
+    const curve_t *curve = &testcurve9;
+    eccint_point_t p, res;
+    eccint_t x[KEYSIZE];
+    eccint_t k[curve->words];
+
+    for (uint32_t num = 1; num < 518; num += 11) {
+        eccint_from_number(num, k, curve->words);
+        eccint_point_mul(k, &curve->P, &p, curve);
+
+        eccint_t ybit = eccint_point_compress(&p, x, curve);
+        TEST_CHECK(eccint_point_decompress(x, ybit, &res, curve));
+        TEST_CHECK_(eccint_point_cmp(&p, &res, curve->words) == 0, "%u * P", num);
+    }
+
+    // x = 0x1E7 is not the x-coordinate of any point
+    eccint_from_number(0x1E7, x, curve->words);
+    TEST_CHECK(!eccint_point_decompress(x, 0, &res, curve));
+
+    eccint_t ybit = eccint_point_compress(&sect163k1.P, x, &sect163k1);
+    TEST_CHECK(eccint_point_decompress(x, ybit, &res, &sect163k1));
+    TEST_CHECK(eccint_point_cmp(&sect163k1.P, &res, sect163k1.words) == 0);
+}
+
+void test_eccint_trace_halftrace(void) {
+    curve_t curve = testcurve9;
+    eccint_t a[curve.words];
+    eccint_t h[curve.words];
+    eccint_t hslow[curve.words];
+    eccint_t t[curve.words];
+    int trslow[1 << curve.m];
+
+    for (uint32_t num = 0; num < (1u << curve.m); num++) {
+        eccint_from_number(num, a, curve.words);
+        trslow[num] = eccint_trace(a, &curve);
+    }
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    TEST_CHECK(curve.tables != NULL);
+
+    for (uint32_t num = 0; num < (1u << curve.m); num++) {
+        eccint_from_number(num, a, curve.words);
+        TEST_CHECK_(eccint_trace(a, &curve) == trslow[num], "Tr(%u)", num);
+
+        if (num % 31 == 0) {
+            curve_t slow = testcurve9;
+            eccint_halftrace(a, hslow, &slow);
+            eccint_halftrace(a, h, &curve);
+            TEST_CHECK_(eccint_cmp(h, hslow, curve.words) == 0, "H(%u)", num);
+        }
+
+        // H(a)^2 + H(a) = a for elements with trace zero
+        if (!trslow[num]) {
+            eccint_halftrace(a, h, &curve);
+            eccint_square_mod(h, curve.q, t, &curve);
+            eccint_add(t, h, t, curve.words);
+            TEST_CHECK_(eccint_cmp(t, a, curve.words) == 0, "H(%u)^2 + H(%u)", num, num);
+        }
+    }
+
+    ecc_curve_free(&curve);
+    TEST_CHECK(curve.tables == NULL);
+}
+
+void test_eccint_multisquare_sqrt(void) {
+    curve_t curve = sect163k1;
+    const size_t ks[2] = { 4, 16 };
+    const size_t checks[4] = { 1, 5, 16, 37 };
+    eccint_t a[curve.words];
+    eccint_t expected[curve.words];
+    eccint_t res[curve.words];
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    const size_t zero[2] = { 8, 0 };
+    TEST_CHECK(!ecc_curve_init_multisquare(&curve, zero, 2));
+    TEST_CHECK(curve.tables->multisquare_count == 0);
+    TEST_CHECK(ecc_curve_init_multisquare(&curve, ks, 2));
+
+    for (int round = 0; round < 4; round++) {
+        eccint_urand(a, curve.words);
+        eccint_mod(a, curve.q, a, &curve);
+
+        eccint_square_mod(a, curve.q, res, &curve);
+        eccint_mul_mod(a, a, curve.q, expected, &curve);
+        TEST_CHECK(eccint_cmp(res, expected, curve.words) == 0);
+
+        for (size_t n = 0; n < 4; n++) {
+            eccint_cpy(expected, a, curve.words);
+            for (size_t i = 0; i < checks[n]; i++) {
+                eccint_mul_mod(expected, expected, curve.q, expected, &curve);
+            }
+            eccint_multisquare(a, checks[n], res, &curve);
+            TEST_CHECK_(eccint_cmp(res, expected, curve.words) == 0, "a^(2^%zu)", checks[n]);
+        }
+
+        // sqrt(a)^2 = a, and matches the repeated squaring version
+        eccint_sqrt(a, res, &curve);
+        eccint_mul_mod(res, res, curve.q, expected, &curve);
+        TEST_CHECK(eccint_cmp(expected, a, curve.words) == 0);
+        eccint_sqrt(a, expected, &sect163k1);
+        TEST_CHECK(eccint_cmp(res, expected, curve.words) == 0);
+    }
+
+    ecc_curve_free(&curve);
+}
+
+void test_eccint_point_encode(void) {
+    curve_t curve = sect163k1;
+    // Compressed generator of sect163k1 from SEC2
+    const uint8_t expected[22] = { 0x03, 0x02, 0xFE, 0x13, 0xC0, 0x53, 0x7B, 0xBC, 0x11, 0xAC, 0xAA,
+                                   0x07, 0xD7, 0x93, 0xDE, 0x4E, 0x6D, 0x5E, 0x5C, 0x94, 0xEE, 0xE8 };
+    uint8_t out[1 + 2 * KEYSIZE];
+    eccint_point_t res, infty;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+
+    TEST_CHECK(eccint_point_encode(&curve.P, 1, out, &curve) == 22);
+    TEST_CHECK(memcmp(out, expected, 22) == 0);
+    TEST_CHECK(eccint_point_decode(out, 22, &res, &curve));
+    TEST_CHECK(eccint_point_cmp(&res, &curve.P, curve.words) == 0);
+
+    TEST_CHECK(eccint_point_encode(&curve.P, 0, out, &curve) == 43);
+    TEST_CHECK(out[0] == 0x04);
+    TEST_CHECK(eccint_point_decode(out, 43, &res, &curve));
+    TEST_CHECK(eccint_point_cmp(&res, &curve.P, curve.words) == 0);
+
+    // Uncompressed points must be on the curve
+    out[42] ^= 1;
+    TEST_CHECK(!eccint_point_decode(out, 43, &res, &curve));
+    TEST_CHECK(!eccint_point_decode(out, 42, &res, &curve));
+
+    eccint_point_set_infinity(&infty, curve.words);
+    TEST_CHECK(eccint_point_encode(&infty, 1, out, &curve) == 1);
+    TEST_CHECK(eccint_point_decode(out, 1, &res, &curve));
+    TEST_CHECK(eccint_point_testinfinite(&res, curve.words));
+
+    ecc_curve_free(&curve);
+}
+
+void test_ecc_keystore(void) {
+    const curve_t *curve = &testcurve9;
+    char path[] = "/tmp/ecc_keystore_XXXXXX";
+    ecc_keystore_t store;
+    uint64_t ids[20];
+    eccint_point_t keys[20];
+    eccint_point_t publickey;
+    eccint_t k[curve->words];
+
+    int fd = mkstemp(path);
+    TEST_CHECK(fd >= 0);
+    close(fd);
+
+    for (size_t i = 0; i < 20; i++) {
+        ids[i] = 1000 + 17 * i;
+        eccint_from_number(3 + 5 * i, k, curve->words);
+        eccint_point_mul(k, &curve->P, &keys[i], curve);
+    }
+    // Not on the curve, must not be trusted
+    eccint_from_number(0x15, keys[7].y, curve->words);
+    TEST_CHECK(!ecc_validate_publickey(&keys[7], curve));
+
+    TEST_CHECK(ecc_keystore_write(path, ids, keys, 20, curve));
+    TEST_CHECK(ecc_keystore_open(&store, path, curve));
+
+    for (size_t i = 0; i < 20; i++) {
+        TEST_CHECK(ecc_keystore_find(&store, ids[i]) == (ssize_t) i);
+        if (i == 7) {
+            TEST_CHECK(!ecc_keystore_lookup(&store, ids[i], &publickey, curve));
+        } else {
+            TEST_CHECK(ecc_keystore_lookup(&store, ids[i], &publickey, curve));
+            TEST_CHECK(eccint_point_cmp(&publickey, &keys[i], curve->words) == 0);
+        }
+    }
+    TEST_CHECK(ecc_keystore_find(&store, 999) == -1);
+    TEST_CHECK(!ecc_keystore_lookup(&store, 999, &publickey, curve));
+    ecc_keystore_close(&store);
+
+    TEST_CHECK(!ecc_keystore_open(&store, path, &sect163k1));
+
+    // A truncated file, and a header with a count too large for the index
+    ecc_keystore_header_t header;
+    fd = open(path, O_RDWR);
+    TEST_CHECK(fd >= 0 && pread(fd, &header, sizeof(header), 0) == sizeof(header));
+    TEST_CHECK(ftruncate(fd, sizeof(header) + 8) == 0);
+    TEST_CHECK(!ecc_keystore_open(&store, path, curve));
+    header.count = (uint64_t) 1 << 31;
+    TEST_CHECK(pwrite(fd, &header, sizeof(header), 0) == sizeof(header));
+    TEST_CHECK(!ecc_keystore_open(&store, path, curve));
+    header.count = UINT64_MAX;
+    TEST_CHECK(pwrite(fd, &header, sizeof(header), 0) == sizeof(header));
+    TEST_CHECK(!ecc_keystore_open(&store, path, curve));
+    close(fd);
+
+    // Duplicate ids are rejected
+    ids[3] = ids[4];
+    TEST_CHECK(!ecc_keystore_write(path, ids, keys, 20, curve));
+
+    unlink(path);
+}
+
+void test_eccint_point_halving(void) {
+    curve_t curve = testcurve9;
+    eccint_t k[curve.words];
+    eccint_point_t g, q, half, res, expected;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+
+    // 2P generates the subgroup of order 259
+    eccint_point_double(&curve.P, &g, &curve);
+
+    for (uint32_t num = 1; num < 259; num++) {
+        eccint_from_number(num, k, curve.words);
+        eccint_point_mul(k, &g, &q, &curve);
+
+        eccint_point_halve(&q, &half, &curve);
+        eccint_point_double(&half, &res, &curve);
+        TEST_CHECK_(eccint_point_cmp(&res, &q, curve.words) == 0, "2 * (%u * G / 2)", num);
+        TEST_CHECK(eccint_trace(half.x, &curve) == eccint_trace(curve.a, &curve));
+    }
+
+    for (uint32_t num = 0; num < 600; num += 3) {
+        eccint_from_number(num, k, curve.words);
+        eccint_binary_doublenadd_mul(k, &g, &expected, &curve);
+        eccint_halving_point_mul(k, &g, &res, &curve);
+        TEST_CHECK_(eccint_point_cmp(&res, &expected, curve.words) == 0, "%u * G", num);
+    }
+
+    // P is not in the subgroup, this falls back to double-and-add
+    eccint_from_number(300, k, curve.words);
+    eccint_binary_doublenadd_mul(k, &curve.P, &expected, &curve);
+    eccint_halving_point_mul(k, &curve.P, &res, &curve);
+    TEST_CHECK(eccint_point_cmp(&res, &expected, curve.words) == 0);
+
+    ecc_curve_free(&curve);
+
+    curve = sect163k1;
+    TEST_CHECK(ecc_curve_init(&curve));
+    eccint_t k163[curve.words];
+    eccint_urand(k163, curve.words);
+    eccint_binary_doublenadd_mul(k163, &curve.P, &expected, &curve);
+    eccint_halving_point_mul(k163, &curve.P, &res, &curve);
+    TEST_CHECK(eccint_point_cmp(&res, &expected, curve.words) == 0);
+    ecc_curve_free(&curve);
+}
+
+// Karatsuba agrees with the comb method for every size of operand up to
+// KEYSIZE, which covers each of its kernels in a build with KEYSIZE=72
+void test_eccint_karatsuba_mul(void) {
+    ecc_dispatch_t dispatch = *ecc_dispatch_default();
+    curve_t curve = sect163k1;
+    eccint_t a[KEYSIZE], b[KEYSIZE];
+    eccint_t expected[2 * KEYSIZE], res[2 * KEYSIZE];
+
+    if (!ecc_dispatch_select(&dispatch, ECC_OP_MUL, "karatsuba")) {
+        // No PCLMULQDQ on this CPU
+        return;
+    }
+
+    for (size_t words = 1; words <= KEYSIZE; words++) {
+        curve.words = words;
+        for (size_t n = 0; n < 4; n++) {
+            eccint_urand(a, words);
+            eccint_urand(b, words);
+            if (n == 0) {
+                eccint_set(a, 0xFF, words);
+            }
+            eccint_comb_mul(a, b, expected, &curve);
+            dispatch.mul(a, b, res, &curve);
+            TEST_CHECK_(eccint_cmp(res, expected, 2 * words) == 0, "%zu words", words);
+        }
+    }
+}
+
+void test_ecc_dispatch(void) {
+    const curve_t *curves[] = { &testcurve9, &sect163k1 };
+    const char *names[8];
+    ecc_dispatch_t dispatch;
+
+    for (size_t c = 0; c < 2; c++) {
+        curve_t curve = *curves[c];
+        const size_t words = curve.words;
+        eccint_t a[words], b[words];
+        eccint_t product[2 * words], expected[2 * words], res[2 * words];
+
+        TEST_CHECK(ecc_curve_init(&curve));
+
+        // Every multiplier and reduction agrees with the reference
+        for (size_t n = 0; n < 16; n++) {
+            eccint_urand(a, words);
+            eccint_urand(b, words);
+            for (size_t i = curve.m; i < 8 * words; i++) {
+                eccint_setbit(a, i, 0);
+                eccint_setbit(b, i, 0);
+            }
+            eccint_shiftnadd_mul(a, b, expected, &curve);
+
+            size_t count = ecc_dispatch_backends(ECC_OP_MUL, names, 8);
+            TEST_CHECK(count >= 2);
+            for (size_t i = 0; i < count; i++) {
+                dispatch = *ecc_dispatch_default();
+                TEST_CHECK(ecc_dispatch_select(&dispatch, ECC_OP_MUL, names[i]));
+                eccint_set(product, 0, 2 * words);
+                dispatch.mul(a, b, product, &curve);
+                TEST_CHECK_(eccint_cmp(product, expected, 2 * words) == 0, "%s mul", names[i]);
+            }
+
+            eccint_cpy(product, expected, 2 * words);
+            eccint_general_reduce(product, res, &curve);
+            count = ecc_dispatch_backends(ECC_OP_REDUCE, names, 8);
+            TEST_CHECK(count == 3);
+            for (size_t i = 0; i < count; i++) {
+                eccint_t out[words];
+                dispatch = *ecc_dispatch_default();
+                TEST_CHECK(ecc_dispatch_select(&dispatch, ECC_OP_REDUCE, names[i]));
+                eccint_cpy(product, expected, 2 * words);
+                dispatch.reduce(product, out, &curve);
+                TEST_CHECK_(eccint_cmp(out, res, words) == 0, "%s reduce", names[i]);
+            }
+        }
+
+        // The tuned table computes the same points as the default one
+        ecc_dispatch_autotune(&dispatch, &curve);
+        TEST_CHECK(dispatch.mul && dispatch.reduce && dispatch.div_mod);
+        TEST_CHECK(dispatch.point_double && dispatch.point_add && dispatch.point_mul);
+        TEST_CHECK(dispatch.mul_name && dispatch.point_mul_name);
+
+        eccint_point_t p, q;
+        eccint_urand(a, words);
+        eccint_point_mul(a, &curve.P, &p, &curve);
+        curve.dispatch = &dispatch;
+        eccint_point_mul(a, &curve.P, &q, &curve);
+        TEST_CHECK(eccint_point_cmp(&p, &q, words) == 0);
+
+        ecc_curve_free(&curve);
+    }
+
+    dispatch = *ecc_dispatch_default();
+    TEST_CHECK(ecc_dispatch_select(&dispatch, ECC_OP_POINT_MUL, "ladder"));
+    TEST_CHECK(dispatch.point_mul == eccint_montgomery_ladder_point_mul);
+    TEST_CHECK(!ecc_dispatch_select(&dispatch, ECC_OP_POINT_MUL, "unknown"));
+    TEST_CHECK(!ecc_dispatch_select(&dispatch, "unknown", "book"));
+    TEST_CHECK(ecc_dispatch_backends("unknown", names, 8) == 0);
+}
+
+void test_ecc_counters(void) {
+    const curve_t *curve = &testcurve9;
+    ecc_counters_t last, total;
+    uint64_t calls;
+    eccint_t k[curve->words];
+    eccint_point_t publickey, res;
+    eccint_t privatekey[curve->words];
+    eccint_signature_t signature;
+
+    ecc_counters_reset();
+#ifdef ECC_COUNTERS
+    // Double-and-add on 0b101101 doubles once per bit and adds once per set bit
+    ecc_counters_t start = ecc_counters;
+    eccint_from_number(0x2D, k, curve->words);
+    eccint_binary_doublenadd_mul(k, &curve->P, &res, curve);
+    TEST_CHECK(ecc_counters.point_double - start.point_double == 6);
+    TEST_CHECK(ecc_counters.point_add - start.point_add == 4);
+
+    // Adding the point at infinity is a copy, no field operation
+    eccint_point_t infty;
+    eccint_point_set_infinity(&infty, curve->words);
+    start = ecc_counters;
+    eccint_book_point_add(&curve->P, &infty, &res, curve);
+    TEST_CHECK(eccint_point_cmp(&res, &curve->P, curve->words) == 0);
+    eccint_book_point_add(&infty, &curve->P, &res, curve);
+    TEST_CHECK(eccint_point_cmp(&res, &curve->P, curve->words) == 0);
+    eccint_book_point_double(&infty, &res, curve);
+    TEST_CHECK(res.infinity);
+    TEST_CHECK(ecc_counters.inv == start.inv && ecc_counters.mul == start.mul && ecc_counters.square == start.square);
+
+    while (!ecc_keygen(&publickey, privatekey, curve)) {}
+    ecc_sign(privatekey, k, &signature, curve);
+    ecc_sign(privatekey, k, &signature, curve);
+
+    TEST_CHECK(ecc_counters_get(ECC_COUNTERS_SIGN, &last, &total, &calls));
+    TEST_CHECK(calls == 2);
+    TEST_CHECK(total.point_double == 2 * last.point_double);
+    TEST_CHECK(last.point_double > 0 && last.inv > 0 && last.mul > 0);
+
+    TEST_CHECK(ecc_counters_get(ECC_COUNTERS_KEYGEN, &last, NULL, &calls));
+    TEST_CHECK(calls >= 1 && last.point_double > 0);
+
+    ecc_verify(&publickey, k, &signature, curve);
+    TEST_CHECK(ecc_counters_get(ECC_COUNTERS_VERIFY, &last, NULL, &calls));
+    TEST_CHECK(calls == 1 && last.point_add > 0);
+
+    ecc_counters_reset();
+    TEST_CHECK(ecc_counters_get(ECC_COUNTERS_SIGN, NULL, &total, &calls));
+    TEST_CHECK(calls == 0 && total.mul == 0);
+#else
+    // Compiled out, the API still works but has nothing to report
+    eccint_from_number(0x2D, k, curve->words);
+    eccint_point_mul(k, &curve->P, &res, curve);
+    while (!ecc_keygen(&publickey, privatekey, curve)) {}
+    ecc_sign(privatekey, k, &signature, curve);
+    TEST_CHECK(!ecc_counters_get(ECC_COUNTERS_SIGN, &last, &total, &calls));
+    TEST_CHECK(calls == 0 && last.mul == 0 && total.point_double == 0);
+#endif
+}
+
+static void *histogram_sign_thread(void *arg) {
+    eccint_signature_t signature;
+    ecc_sign((const eccint_t *) arg, (const eccint_t *) arg, &signature, &sect163k1);
+    return NULL;
+}
+
+void test_ecc_histogram(void) {
+    const curve_t *curve = &sect163k1;
+    eccint_t privatekey[curve->words];
+    eccint_t hash[curve->words];
+    eccint_point_t publickey;
+    eccint_signature_t signature;
+    ecc_histogram_snapshot_t *snapshot = malloc(sizeof(ecc_histogram_snapshot_t));
+    char text[8192];
+    pthread_t thread;
+
+    while (!ecc_keygen(&publickey, privatekey, curve)) {}
+    eccint_urand(hash, curve->words);
+
+    ecc_histogram_enable(1);
+    ecc_histogram_reset();
+    for (size_t i = 0; i < 3; i++) {
+        ecc_sign(privatekey, hash, &signature, curve);
+    }
+    ecc_verify(&publickey, hash, &signature, curve);
+    ecc_verify(&publickey, hash, &signature, curve);
+
+    // Histograms of exited threads are kept
+    TEST_CHECK(pthread_create(&thread, NULL, histogram_sign_thread, privatekey) == 0);
+    pthread_join(thread, NULL);
+
+    ecc_histogram_snapshot(snapshot);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_SIGN].count == 4);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_KP].count >= 4);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_NONCE].count == snapshot->phases[ECC_PHASE_KP].count);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_VERIFY].count == 2);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_INV].count == 2);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_MSM].count == 2);
+
+    const ecc_histogram_t *sign = &snapshot->phases[ECC_PHASE_SIGN];
+    uint64_t p50 = ecc_histogram_percentile(sign, 50);
+    TEST_CHECK(p50 > 0);
+    TEST_CHECK(p50 <= ecc_histogram_percentile(sign, 99));
+    TEST_CHECK(ecc_histogram_percentile(sign, 100) == sign->max);
+    TEST_CHECK(sign->sum >= sign->max && sign->max >= p50);
+
+    size_t len = ecc_histogram_format(snapshot, text, sizeof(text));
+    TEST_CHECK(len < sizeof(text) && strlen(text) == len);
+    TEST_CHECK(strstr(text, "ecc_phase_latency_ns_count{phase=\"sign\"} 4\n") != NULL);
+    TEST_CHECK(strstr(text, "ecc_phase_latency_ns{phase=\"msm\",quantile=\"0.99\"}") != NULL);
+    TEST_CHECK(ecc_histogram_format(snapshot, NULL, 0) == len);
+
+    // Nothing is recorded while disabled
+    ecc_histogram_enable(0);
+    ecc_sign(privatekey, hash, &signature, curve);
+    ecc_histogram_snapshot(snapshot);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_SIGN].count == 4);
+
+    ecc_histogram_reset();
+    ecc_histogram_snapshot(snapshot);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_SIGN].count == 0);
+    free(snapshot);
+}
+
+typedef struct {
+    const curve_t *curve;
+    const eccint_t *privatekey;
+    const eccint_point_t *publickey;
+    const eccint_t (*hashes)[KEYSIZE];
+    eccint_t r[KEYSIZE];
+    int failures;
+} threads_worker_t;
+
+static void *threads_worker(void *arg) {
+    threads_worker_t *w = arg;
+    eccint_signature_t signature;
+
+    for (size_t i = 0; i < 32; i++) {
+        ecc_sign(w->privatekey, w->hashes[i % 8], &signature, w->curve);
+        if (!ecc_verify(w->publickey, w->hashes[i % 8], &signature, w->curve)) {
+            w->failures++;
+        }
+        if (i == 0) {
+            eccint_cpy(w->r, signature.r, w->curve->words);
+        }
+    }
+    return NULL;
+}
+
+void test_ecc_threads(void) {
+    curve_t curve = sect163k1;
+    eccint_t privatekey[KEYSIZE];
+    eccint_t hashes[8][KEYSIZE];
+    eccint_point_t publickey;
+    threads_worker_t workers[4];
+    pthread_t ids[4];
+
+    // The curve and its tables are shared read-only by all threads
+    TEST_CHECK(ecc_curve_init(&curve));
+    while (!ecc_keygen(&publickey, privatekey, &curve)) {}
+    for (size_t i = 0; i < 8; i++) {
+        eccint_urand(hashes[i], curve.words);
+    }
+
+    for (size_t t = 0; t < 4; t++) {
+        workers[t] = (threads_worker_t) { &curve, privatekey, &publickey, (const eccint_t (*)[KEYSIZE]) hashes, { 0 }, 0 };
+        TEST_CHECK(pthread_create(&ids[t], NULL, threads_worker, &workers[t]) == 0);
+    }
+    for (size_t t = 0; t < 4; t++) {
+        pthread_join(ids[t], NULL);
+        TEST_CHECK_(workers[t].failures == 0, "thread %zu", t);
+    }
+
+    // Each signature of the same hash has its own nonce, so its own r
+    for (size_t t = 1; t < 4; t++) {
+        TEST_CHECK_(eccint_cmp(workers[0].r, workers[t].r, curve.words) != 0, "thread %zu", t);
+    }
+
+    ecc_curve_free(&curve);
+}
+
+typedef struct {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    int done;
+    size_t valid;
+} batch_wait_t;
+
+static void batch_done(void *arg, const size_t valid) {
+    batch_wait_t *wait = arg;
+    pthread_mutex_lock(&wait->lock);
+    wait->done = 1;
+    wait->valid = valid;
+    pthread_cond_signal(&wait->cond);
+    pthread_mutex_unlock(&wait->lock);
+}
+
+void test_ecc_batch(void) {
+    curve_t curve = sect163k1;
+    const size_t count = 5 * ECC_BATCH_CHUNK + 3;
+    eccint_t privatekey[KEYSIZE];
+    eccint_point_t publickeys[count];
+    eccint_t hashes[count][KEYSIZE];
+    eccint_signature_t signatures[count];
+    int results[count];
+    size_t valid = 0;
+    batch_wait_t wait = { PTHREAD_MUTEX_INITIALIZER, PTHREAD_COND_INITIALIZER, 0, 0 };
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    while (!ecc_keygen(&publickeys[0], privatekey, &curve)) {}
+    for (size_t i = 0; i < count; i++) {
+        publickeys[i] = publickeys[0];
+        eccint_urand(hashes[i], curve.words);
+    }
+
+    // Blocking, on the shared pool, with every signature in the histograms
+    ecc_histogram_snapshot_t *snapshot = malloc(sizeof(ecc_histogram_snapshot_t));
+    ecc_histogram_enable(1);
+    ecc_histogram_reset();
+    memset(signatures, 0, sizeof(signatures));
+    TEST_CHECK(ecc_sign_batch(NULL, privatekey, (const eccint_keyptr_t *) hashes, signatures, count, &curve, NULL, NULL));
+    ecc_histogram_snapshot(snapshot);
+    ecc_histogram_enable(0);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_SIGN].count == count);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_KP].count >= count);
+    free(snapshot);
+    for (size_t i = 0; i < count; i++) {
+        TEST_CHECK_(ecc_verify(&publickeys[i], hashes[i], &signatures[i], &curve), "item %zu", i);
+    }
+
+    // Every third signature is broken
+    for (size_t i = 0; i < count; i += 3) {
+        signatures[i].s[0] ^= 1;
+    }
+    for (size_t i = 0; i < count; i++) {
+        valid += ecc_verify(&publickeys[i], hashes[i], &signatures[i], &curve) != 0;
+    }
+
+    // With a callback, on more workers than chunks per worker
+    ecc_pool_t *pool = ecc_pool_create(3);
+    TEST_CHECK(pool != NULL);
+    TEST_CHECK(ecc_pool_threads(pool) == 3);
+
+    memset(results, 0xFF, sizeof(results));
+    TEST_CHECK(ecc_verify_batch_parallel(pool, publickeys, (const eccint_keyptr_t *) hashes, signatures, results, count, &curve, batch_done, &wait));
+    pthread_mutex_lock(&wait.lock);
+    while (!wait.done) {
+        pthread_cond_wait(&wait.cond, &wait.lock);
+    }
+    pthread_mutex_unlock(&wait.lock);
+
+    TEST_CHECK_(wait.valid == valid, "%zu valid, expected %zu", wait.valid, valid);
+    for (size_t i = 0; i < count; i++) {
+        int ok = ecc_verify(&publickeys[i], hashes[i], &signatures[i], &curve);
+        TEST_CHECK_(results[i] == ok, "item %zu", i);
+    }
+
+    // Empty batches complete right away
+    TEST_CHECK(ecc_sign_batch(pool, privatekey, NULL, NULL, 0, &curve, NULL, NULL));
+
+    ecc_pool_destroy(pool);
+    ecc_curve_free(&curve);
+}
+
+static void queue_done(ecc_sign_request_t *request) {
+    __atomic_add_fetch((size_t *) request->arg, 1, __ATOMIC_RELEASE);
+}
+
+void test_ecc_sign_queue(void) {
+    curve_t curve = sect163k1;
+    const size_t count = 40;
+    eccint_t privatekey[KEYSIZE];
+    eccint_point_t publickey;
+    eccint_t hashes[count][KEYSIZE];
+    ecc_sign_request_t requests[count];
+    size_t callbacks = 0, polled = 0, full = 0;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    while (!ecc_keygen(&publickey, privatekey, &curve)) {}
+    for (size_t i = 0; i < count; i++) {
+        eccint_urand(hashes[i], curve.words);
+    }
+
+    // A small ring, so submitting has to back off. Every signature shows up
+    // in the histograms.
+    ecc_histogram_snapshot_t *snapshot = malloc(sizeof(ecc_histogram_snapshot_t));
+    ecc_histogram_enable(1);
+    ecc_histogram_reset();
+    ecc_sign_queue_t *queue = ecc_sign_queue_create(8, 2, &curve);
+    TEST_CHECK(queue != NULL);
+
+    memset(requests, 0, sizeof(requests));
+    for (size_t i = 0; i < count; i++) {
+        requests[i].privatekey = privatekey;
+        requests[i].hash = hashes[i];
+        // Odd requests complete through the callback, even ones on the fd
+        if (i & 1) {
+            requests[i].done = queue_done;
+            requests[i].arg = &callbacks;
+        }
+        // One request that is already too late
+        if (i == 10) {
+            requests[i].deadline = 1;
+        }
+        while (!ecc_sign_queue_submit(queue, &requests[i])) {
+            full++;
+            sched_yield();
+        }
+    }
+
+    while (polled < count / 2) {
+        struct pollfd pfd = { ecc_sign_queue_fd(queue), POLLIN, 0 };
+        TEST_CHECK(poll(&pfd, 1, 10000) == 1);
+        for (ecc_sign_request_t *r = ecc_sign_queue_completed(queue); r; r = r->next) {
+            TEST_CHECK(r->done == NULL);
+            polled++;
+        }
+    }
+    while (__atomic_load_n(&callbacks, __ATOMIC_ACQUIRE) < count / 2) {
+        sched_yield();
+    }
+    TEST_CHECK_(full > 0, "submit never reported a full queue");
+    ecc_histogram_snapshot(snapshot);
+    ecc_histogram_enable(0);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_SIGN].count == count - 1);
+    TEST_CHECK(snapshot->phases[ECC_PHASE_KP].count >= count - 1);
+    free(snapshot);
+
+    for (size_t i = 0; i < count; i++) {
+        if (i == 10) {
+            TEST_CHECK(requests[i].status == ECC_SIGN_EXPIRED);
+            continue;
+        }
+        TEST_CHECK_(requests[i].status == ECC_SIGN_DONE, "request %zu", i);
+        TEST_CHECK_(ecc_verify(&publickey, hashes[i], &requests[i].signature, &curve), "request %zu", i);
+    }
+
+    ecc_sign_queue_destroy(queue);
+    ecc_curve_free(&curve);
+}
+
+void test_ecc_sign_nonce(void) {
+    static const eccint_t k[21] = {
+        0x88,0x9D,0xD4,0x2E,0x1E,0x7D,0x3E,0x73,0x29,0xBD,0x51,0x93,0x54,0xE9,0xEE,0x60,0x32,0x20,0x06,0xCD,0x00
+    };
+    const curve_t *curve = &sect163k1;
+    eccint_t privatekey[KEYSIZE];
+    eccint_t hash[KEYSIZE];
+    eccint_point_t publickey;
+    eccint_signature_t expected, signature;
+    ecc_nonce_t nonce;
+
+    while (!ecc_keygen(&publickey, privatekey, curve)) {}
+    eccint_urand(hash, curve->words);
+
+    // A precomputed nonce gives a valid signature with its r
+    TEST_CHECK(ecc_nonce_compute(k, &nonce, curve));
+    TEST_CHECK(ecc_sign_nonce(privatekey, hash, &nonce, &signature, curve));
+    TEST_CHECK(eccint_cmp(signature.r, nonce.r, curve->words) == 0);
+    TEST_CHECK(ecc_verify(&publickey, hash, &signature, curve));
+
+    // Signing directly draws a new nonce every time
+    ecc_sign(privatekey, hash, &expected, curve);
+    ecc_sign(privatekey, hash, &signature, curve);
+    TEST_CHECK(ecc_verify(&publickey, hash, &expected, curve));
+    TEST_CHECK(ecc_verify(&publickey, hash, &signature, curve));
+    TEST_CHECK(eccint_cmp(signature.r, expected.r, curve->words) != 0);
+
+    // Random nonces are in [1, n - 1]
+    for (size_t i = 0; i < 4; i++) {
+        ecc_nonce_generate(&nonce, &testcurve9);
+        TEST_CHECK(!eccint_testzero(nonce.k, testcurve9.words));
+        TEST_CHECK(eccint_cmp(nonce.k, testcurve9.n, testcurve9.words) < 0);
+        TEST_CHECK(!eccint_testzero(nonce.r, testcurve9.words));
+    }
+}
+
+static void *server_thread(void *data) {
+    ecc_server_run(data);
+    return NULL;
+}
+
+static int server_call(const int fd, const uint8_t op, const uint16_t key, const uint32_t id, const void *payload, const size_t length, ecc_server_header_t *header, eccint_t *response) {
+    uint8_t buf[sizeof(ecc_server_header_t) + 5 * KEYSIZE];
+    ecc_server_header_t request = { ECC_SERVER_MAGIC, op, 0, key, length, id };
+
+    memcpy(buf, &request, sizeof(request));
+    if (length) {
+        memcpy(buf + sizeof(request), payload, length);
+    }
+    if (send(fd, buf, sizeof(request) + length, 0) != (ssize_t) (sizeof(request) + length)) {
+        return 0;
+    }
+    if (recv(fd, header, sizeof(*header), MSG_WAITALL) != sizeof(*header)) {
+        return 0;
+    }
+    return !header->length || recv(fd, response, header->length, MSG_WAITALL) == header->length;
+}
+
+void test_ecc_server(void) {
+    curve_t curve = testcurve9;
+    const size_t words = curve.words;
+    char path[64];
+    ecc_server_key_t key;
+    ecc_server_header_t header;
+    eccint_t hash[KEYSIZE];
+    eccint_t response[2 * KEYSIZE];
+    eccint_t payload[5 * KEYSIZE];
+    eccint_signature_t signature;
+    struct sockaddr_un addr = { .sun_family = AF_UNIX };
+    pthread_t thread;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    while (!ecc_keygen(&key.publickey, key.privatekey, &curve)) {}
+    eccint_urand(hash, words);
+
+    snprintf(path, sizeof(path), "/tmp/ecc_server_test.%d", (int) getpid());
+    ecc_server_t *server = ecc_server_create(path, &key, 1, &curve, 2, 4);
+    TEST_CHECK(server != NULL);
+    TEST_CHECK(pthread_create(&thread, NULL, server_thread, server) == 0);
+
+    // Only the owner may connect, and a live socket isn't taken over
+    struct stat st;
+    TEST_CHECK(stat(path, &st) == 0 && S_ISSOCK(st.st_mode) && (st.st_mode & 0777) == 0600);
+    TEST_CHECK(ecc_server_create(path, &key, 1, &curve, 1, 1) == NULL);
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    strcpy(addr.sun_path, path);
+    TEST_CHECK(connect(fd, (struct sockaddr *) &addr, sizeof(addr)) == 0);
+
+    TEST_CHECK(server_call(fd, ECC_SERVER_PUBKEY, 0, 1, NULL, 0, &header, response));
+    TEST_CHECK(header.status == ECC_SERVER_OK && header.id == 1);
+    TEST_CHECK(eccint_cmp(response, key.publickey.x, words) == 0);
+    TEST_CHECK(eccint_cmp(response + words, key.publickey.y, words) == 0);
+
+    TEST_CHECK(server_call(fd, ECC_SERVER_SIGN, 0, 2, hash, words, &header, response));
+    TEST_CHECK(header.status == ECC_SERVER_OK && header.length == 2 * words);
+    eccint_cpy(signature.r, response, words);
+    eccint_cpy(signature.s, response + words, words);
+
+    // The server's answer agrees with verifying here, with the key given inline
+    eccint_cpy(payload, key.publickey.x, words);
+    eccint_cpy(payload + words, key.publickey.y, words);
+    eccint_cpy(payload + 2 * words, hash, words);
+    eccint_cpy(payload + 3 * words, signature.r, words);
+    eccint_cpy(payload + 4 * words, signature.s, words);
+    int ok = ecc_verify(&key.publickey, hash, &signature, &curve);
+    TEST_CHECK(server_call(fd, ECC_SERVER_VERIFY, ECC_SERVER_KEY_INLINE, 3, payload, 5 * words, &header, response));
+    TEST_CHECK(header.status == (ok ? ECC_SERVER_OK : ECC_SERVER_INVALID) && header.id == 3);
+
+    TEST_CHECK(server_call(fd, ECC_SERVER_SIGN, 5, 4, hash, words, &header, response));
+    TEST_CHECK(header.status == ECC_SERVER_NOKEY);
+
+    // A client that doesn't read its responses holds up nobody else, and
+    // still gets all of them once it reads
+    const size_t flood = 20000;
+    ecc_server_header_t *requests = calloc(flood, sizeof(ecc_server_header_t));
+    int slow = socket(AF_UNIX, SOCK_STREAM, 0);
+    TEST_CHECK(connect(slow, (struct sockaddr *) &addr, sizeof(addr)) == 0);
+    for (size_t i = 0; i < flood; i++) {
+        requests[i] = (ecc_server_header_t) { ECC_SERVER_MAGIC, ECC_SERVER_PUBKEY, 0, 0, 0, 100 + i };
+    }
+    ssize_t sent = send(slow, requests, flood * sizeof(ecc_server_header_t), MSG_DONTWAIT | MSG_NOSIGNAL);
+    TEST_CHECK(sent > 0);
+    usleep(100000);
+    TEST_CHECK(server_call(fd, ECC_SERVER_PUBKEY, 0, 5, NULL, 0, &header, response));
+    TEST_CHECK(header.status == ECC_SERVER_OK && header.id == 5);
+
+    size_t answered = 0;
+    while (sent > 0 && answered < flood) {
+        if ((size_t) sent < flood * sizeof(ecc_server_header_t)) {
+            ssize_t n = send(slow, (uint8_t *) requests + sent, flood * sizeof(ecc_server_header_t) - sent, MSG_DONTWAIT | MSG_NOSIGNAL);
+            sent += n > 0 ? n : 0;
+        }
+        if (recv(slow, &header, sizeof(header), MSG_WAITALL) != sizeof(header) ||
+            recv(slow, response, header.length, MSG_WAITALL) != header.length) {
+            break;
+        }
+        TEST_CHECK_(header.id == 100 + answered, "response %zu", answered);
+        answered++;
+    }
+    TEST_CHECK_(answered == flood, "%zu of %zu answered", answered, flood);
+    close(slow);
+    free(requests);
+
+    close(fd);
+    ecc_server_stop(server);
+    pthread_join(thread, NULL);
+    ecc_server_destroy(server);
+    TEST_CHECK(access(path, F_OK) != 0);
+
+    // Something else at the path is left alone
+    int file = open(path, O_WRONLY | O_CREAT | O_EXCL, 0600);
+    TEST_CHECK(file >= 0);
+    close(file);
+    TEST_CHECK(ecc_server_create(path, &key, 1, &curve, 1, 1) == NULL);
+    TEST_CHECK(access(path, F_OK) == 0);
+    unlink(path);
+    ecc_curve_free(&curve);
+}
+
+void test_ecc_keygen_batch(void) {
+    const curve_t *curves[] = { &testcurve9, &sect163k1 };
+    char path[] = "/tmp/ecc_keygen_XXXXXX";
+    eccint_keyptr_t privatekeys[40];
+    eccint_point_t publickeys[40];
+    eccint_point_t expected;
+    uint64_t ids[40];
+
+    for (size_t c = 0; c < 2; c++) {
+        curve_t curve = *curves[c];
+        const size_t count = c ? 10 : 40;
+
+        // Once building a table for the call, once with the curve's table
+        for (size_t pass = 0; pass < 2; pass++) {
+            if (pass) {
+                TEST_CHECK(ecc_curve_init(&curve));
+            }
+            TEST_CHECK(ecc_keygen_batch(publickeys, privatekeys, count, &curve));
+            for (size_t i = 0; i < count; i++) {
+                TEST_CHECK_(!eccint_testzero(privatekeys[i], curve.words), "curve %zu key %zu", c, i);
+                TEST_CHECK_(eccint_cmp(privatekeys[i], curve.order, curve.words) < 0, "curve %zu key %zu", c, i);
+                eccint_point_mul(privatekeys[i], &curve.P, &expected, &curve);
+                TEST_CHECK_(eccint_point_cmp(&publickeys[i], &expected, curve.words) == 0, "curve %zu key %zu", c, i);
+            }
+        }
+
+        // Single keys come from the same range
+        for (size_t i = 0; i < count; i++) {
+            TEST_CHECK(ecc_keygen(&publickeys[i], privatekeys[i], &curve));
+            TEST_CHECK_(!eccint_testzero(privatekeys[i], curve.words), "curve %zu key %zu", c, i);
+            TEST_CHECK_(eccint_cmp(privatekeys[i], curve.order, curve.words) < 0, "curve %zu key %zu", c, i);
+            eccint_point_mul(privatekeys[i], &curve.P, &expected, &curve);
+            TEST_CHECK_(eccint_point_cmp(&publickeys[i], &expected, curve.words) == 0, "curve %zu key %zu", c, i);
+        }
+        ecc_curve_free(&curve);
+    }
+
+    // Doubling in López-Dahab coordinates agrees with the affine formula
+    eccint_ld_point_t ld;
+    eccint_t z[testcurve9.words];
+    eccint_from_number(0x5B, z, testcurve9.words);
+    eccint_mul_mod(testcurve9.P.x, z, testcurve9.q, ld.x, &testcurve9);
+    eccint_mul_mod(z, z, testcurve9.q, ld.z, &testcurve9);
+    eccint_mul_mod(testcurve9.P.y, ld.z, testcurve9.q, ld.y, &testcurve9);
+    eccint_cpy(ld.z, z, testcurve9.words);
+    eccint_ld_point_double(&ld, &ld, &testcurve9);
+    eccint_ld_point_normalize_batch(&ld, &publickeys[0], privatekeys, 1, &testcurve9);
+    eccint_point_double(&testcurve9.P, &expected, &testcurve9);
+    TEST_CHECK(eccint_point_cmp(&publickeys[0], &expected, testcurve9.words) == 0);
+
+    // Straight into a key store
+    ecc_keystore_t store;
+    int fd = mkstemp(path);
+    TEST_CHECK(fd >= 0);
+    close(fd);
+    for (size_t i = 0; i < 10; i++) {
+        ids[i] = 7 * i + 1;
+    }
+    TEST_CHECK(ecc_keystore_generate(path, ids, privatekeys, 10, &sect163k1));
+    TEST_CHECK(ecc_keystore_open(&store, path, &sect163k1));
+    for (size_t i = 0; i < 10; i++) {
+        TEST_CHECK(ecc_keystore_lookup(&store, ids[i], &publickeys[i], &sect163k1));
+        eccint_point_mul(privatekeys[i], &sect163k1.P, &expected, &sect163k1);
+        TEST_CHECK_(eccint_point_cmp(&publickeys[i], &expected, sect163k1.words) == 0, "key %zu", i);
+    }
+    ecc_keystore_close(&store);
+    unlink(path);
+}
+
+void test_ecc_ecdh(void) {
+    const curve_t *curves[] = { &testcurve9, &sect163k1 };
+    eccint_keyptr_t privatekeys[2];
+    eccint_keyptr_t shared[5];
+    eccint_point_t publickeys[2];
+    eccint_point_t expected;
+    eccint_t secret[KEYSIZE];
+    uint8_t enc[5][2 * KEYSIZE + 1];
+    const uint8_t *peers[5];
+    size_t lens[5];
+    int results[5];
+
+    for (size_t c = 0; c < 2; c++) {
+        curve_t curve = *curves[c];
+        TEST_CHECK(ecc_curve_init(&curve));
+
+        for (size_t i = 0; i < 2; i++) {
+            while (!ecc_keygen(&publickeys[i], privatekeys[i], &curve)) {}
+        }
+
+        // Both curves have cofactor 2, so the secret is x(2 dA QB)
+        eccint_point_mul(privatekeys[0], &publickeys[1], &expected, &curve);
+        eccint_point_double(&expected, &expected, &curve);
+
+        for (int compressed = 0; compressed < 2; compressed++) {
+            lens[0] = eccint_point_encode(&publickeys[1], compressed, enc[0], &curve);
+            TEST_CHECK_(ecc_ecdh(privatekeys[0], enc[0], lens[0], secret, &curve), "curve %zu", c);
+            TEST_CHECK_(eccint_cmp(secret, expected.x, curve.words) == 0, "curve %zu compressed %d", c, compressed);
+
+            lens[0] = eccint_point_encode(&publickeys[0], compressed, enc[0], &curve);
+            TEST_CHECK_(ecc_ecdh(privatekeys[1], enc[0], lens[0], secret, &curve), "curve %zu", c);
+            TEST_CHECK_(eccint_cmp(secret, expected.x, curve.words) == 0, "curve %zu compressed %d", c, compressed);
+        }
+
+        // Points off the curve, infinity and bad encodings are rejected
+        lens[2] = eccint_point_encode(&publickeys[1], 0, enc[2], &curve);
+        enc[2][lens[2] - 1] ^= 1;
+        TEST_CHECK(!ecc_ecdh(privatekeys[0], enc[2], lens[2], secret, &curve));
+        enc[4][0] = 0x00;
+        lens[4] = 1;
+        TEST_CHECK(!ecc_ecdh(privatekeys[0], enc[4], lens[4], secret, &curve));
+        enc[3][0] = 0x05;
+        TEST_CHECK(!ecc_ecdh(privatekeys[0], enc[3], lens[0], secret, &curve));
+
+        // The batch agrees with single calls and skips invalid peers
+        lens[0] = eccint_point_encode(&publickeys[1], 1, enc[0], &curve);
+        lens[1] = eccint_point_encode(&publickeys[0], 0, enc[1], &curve);
+        lens[3] = eccint_point_encode(&publickeys[0], 1, enc[3], &curve);
+        for (size_t i = 0; i < 5; i++) {
+            peers[i] = enc[i];
+        }
+        TEST_CHECK_(ecc_ecdh_batch(privatekeys[0], peers, lens, shared, results, 5, &curve) == 3, "curve %zu", c);
+        for (size_t i = 0; i < 5; i++) {
+            int valid = ecc_ecdh(privatekeys[0], enc[i], lens[i], secret, &curve);
+            TEST_CHECK_(results[i] == valid, "curve %zu peer %zu", c, i);
+            TEST_CHECK_(!valid || eccint_cmp(shared[i], secret, curve.words) == 0, "curve %zu peer %zu", c, i);
+        }
+        TEST_CHECK(eccint_cmp(shared[0], expected.x, curve.words) == 0);
+
+        ecc_curve_free(&curve);
+    }
+}
+
+void test_ecc_recover_publickey(void) {
+    curve_t curve = sect163k1;
+    eccint_t privatekey[KEYSIZE];
+    eccint_t hash[KEYSIZE];
+    eccint_point_t publickey, recovered;
+    eccint_signature_t signature;
+    ecc_nonce_t nonce;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    while (!ecc_keygen(&publickey, privatekey, &curve)) {}
+
+    for (size_t i = 0; i < 4; i++) {
+        eccint_urand(hash, curve.words);
+
+        // Through ecc_sign, then with precomputed nonces
+        if (i == 0) {
+            ecc_sign(privatekey, hash, &signature, &curve);
+        } else {
+            do {
+                ecc_nonce_generate(&nonce, &curve);
+            } while (!ecc_sign_nonce(privatekey, hash, &nonce, &signature, &curve));
+        }
+        TEST_CHECK_(ecc_verify(&publickey, hash, &signature, &curve), "signature %zu", i);
+        TEST_CHECK_(ecc_recover_publickey(hash, &signature, &recovered, &curve), "signature %zu", i);
+        TEST_CHECK_(eccint_point_cmp(&recovered, &publickey, curve.words) == 0, "signature %zu", i);
+
+        // Another hash or recovery id gives another key
+        signature.recid ^= 1;
+        TEST_CHECK_(!ecc_recover_publickey(hash, &signature, &recovered, &curve) ||
+                    eccint_point_cmp(&recovered, &publickey, curve.words) != 0, "signature %zu", i);
+        signature.recid ^= 1;
+        hash[0] ^= 1;
+        TEST_CHECK_(!ecc_recover_publickey(hash, &signature, &recovered, &curve) ||
+                    eccint_point_cmp(&recovered, &publickey, curve.words) != 0, "signature %zu", i);
+        TEST_CHECK_(!ecc_verify(&publickey, hash, &signature, &curve), "signature %zu", i);
+    }
+
+    // r and s have to be in [1, order - 1]
+    eccint_cpy(signature.s, curve.order, curve.words);
+    TEST_CHECK(!ecc_recover_publickey(hash, &signature, &recovered, &curve));
+    ecc_curve_free(&curve);
+}
+
+void test_ecc_keycache(void) {
+    curve_t curve = sect163k1;
+    eccint_t privatekey[KEYSIZE];
+    eccint_t hash[KEYSIZE];
+    eccint_t zero[KEYSIZE];
+    eccint_point_t keys[6], T, outside;
+    eccint_signature_t signature;
+    uint64_t hits, misses;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    for (size_t i = 1; i < 6; i++) {
+        while (!ecc_keygen(&keys[i], privatekey, &curve)) {}
+    }
+    while (!ecc_keygen(&keys[0], privatekey, &curve)) {}
+
+    // Q + T for the point T = (0, sqrt(b)) of order 2 is on the curve, but
+    // not in the subgroup of P
+    eccint_set(zero, 0, curve.words);
+    TEST_CHECK(eccint_point_decompress(zero, 0, &T, &curve));
+    eccint_point_add(&keys[0], &T, &outside, &curve);
+    TEST_CHECK(eccint_point_on_curve(&outside, &curve));
+    TEST_CHECK(ecc_validate_publickey(&keys[0], &curve));
+    TEST_CHECK(!ecc_validate_publickey(&outside, &curve));
+    TEST_CHECK(!ecc_validate_publickey(&T, &curve));
+
+    // A coordinate of 0xFF is not the point at infinity
+    eccint_point_t ff;
+    eccint_from_number(0xFF, zero, testcurve9.words);
+    if (eccint_point_decompress(zero, 0, &ff, &testcurve9)) {
+        TEST_CHECK(ecc_validate_publickey(&ff, &testcurve9));
+    }
+
+    // Only the first sighting of a key is validated
+    ecc_keycache_t *cache = ecc_keycache_create(ECC_KEYCACHE_WAYS, &curve);
+    TEST_CHECK(cache != NULL);
+    eccint_urand(hash, curve.words);
+    ecc_sign(privatekey, hash, &signature, &curve);
+    TEST_CHECK(ecc_verify_validated(cache, &keys[0], hash, &signature));
+    TEST_CHECK(ecc_verify_validated(cache, &keys[0], hash, &signature));
+    TEST_CHECK(!ecc_verify_validated(cache, &outside, hash, &signature));
+    TEST_CHECK(!ecc_keycache_validate(cache, &outside));
+    ecc_keycache_stats(cache, &hits, &misses);
+    TEST_CHECK(hits == 1);
+    TEST_CHECK(misses == 3);
+
+    // The cache is bounded, more keys than it holds evict the oldest
+    for (size_t i = 1; i < 6; i++) {
+        TEST_CHECK(ecc_keycache_validate(cache, &keys[i]));
+    }
+    TEST_CHECK(ecc_keycache_validate(cache, &keys[0]));
+    ecc_keycache_stats(cache, &hits, &misses);
+    TEST_CHECK(hits == 1);
+    TEST_CHECK(misses == 9);
+    TEST_CHECK(ecc_keycache_validate(cache, &keys[5]));
+    ecc_keycache_stats(cache, &hits, &misses);
+    TEST_CHECK(hits == 2);
+
+    ecc_keycache_destroy(cache);
+    ecc_curve_free(&curve);
+}
+
+typedef struct {
+    ecc_verifycache_t *cache;
+    const eccint_point_t *publickey;
+    const eccint_t *hash;
+    const eccint_signature_t *signature;
+    int stop;
+    size_t wrong;
+} verifycache_reader_t;
+
+// Looks up a tuple that is never inserted while the cache changes
+static void *verifycache_reader(void *data) {
+    verifycache_reader_t *reader = data;
+    while (!__atomic_load_n(&reader->stop, __ATOMIC_ACQUIRE)) {
+        reader->wrong += ecc_verifycache_lookup(reader->cache, reader->publickey, reader->hash, reader->signature);
+    }
+    return NULL;
+}
+
+void test_ecc_verifycache(void) {
+    curve_t curve = sect163k1;
+    eccint_t privatekey[KEYSIZE];
+    eccint_t hash[KEYSIZE];
+    eccint_t other[KEYSIZE];
+    eccint_point_t publickey;
+    eccint_signature_t signature, broken, fake;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    while (!ecc_keygen(&publickey, privatekey, &curve)) {}
+    eccint_urand(hash, curve.words);
+    eccint_cpy(other, hash, curve.words);
+    other[0] ^= 1;
+    ecc_sign(privatekey, hash, &signature, &curve);
+    broken = signature;
+    broken.s[0] ^= 1;
+
+    // Without a cache this is ecc_verify
+    TEST_CHECK(ecc_verify_cached(NULL, &publickey, hash, &signature, &curve));
+    TEST_CHECK(!ecc_verify_cached(NULL, &publickey, hash, &broken, &curve));
+
+    // Only valid results are cached, and only for the exact tuple
+    ecc_verifycache_t *cache = ecc_verifycache_create(1, &curve);
+    TEST_CHECK(cache != NULL);
+    TEST_CHECK(!ecc_verifycache_lookup(cache, &publickey, hash, &signature));
+    TEST_CHECK(ecc_verify_cached(cache, &publickey, hash, &signature, &curve));
+    TEST_CHECK(ecc_verifycache_lookup(cache, &publickey, hash, &signature));
+    TEST_CHECK(ecc_verify_cached(cache, &publickey, hash, &signature, &curve));
+    TEST_CHECK(!ecc_verify_cached(cache, &publickey, hash, &broken, &curve));
+    TEST_CHECK(!ecc_verifycache_lookup(cache, &publickey, hash, &broken));
+    TEST_CHECK(!ecc_verifycache_lookup(cache, &publickey, other, &signature));
+
+    // A cached result doesn't answer for another curve
+    TEST_CHECK(!ecc_verify_cached(cache, &publickey, hash, &signature, &testcurve9));
+    TEST_CHECK(!ecc_verify_cached(cache, &publickey, hash, &signature, &sect163k1));
+
+    // The cache is bounded, but CLOCK keeps the entry that keeps being hit
+    size_t found = 0;
+    fake = signature;
+    for (uint32_t i = 0; i < 4096; i++) {
+        memcpy(fake.r, &i, sizeof(i));
+        ecc_verifycache_insert(cache, &publickey, other, &fake);
+        TEST_CHECK_(ecc_verifycache_lookup(cache, &publickey, hash, &signature), "insert %u", i);
+    }
+    for (uint32_t i = 0; i < 4096; i++) {
+        memcpy(fake.r, &i, sizeof(i));
+        found += ecc_verifycache_lookup(cache, &publickey, other, &fake);
+    }
+    TEST_CHECK(found > 0);
+    TEST_CHECK(found < ECC_VERIFYCACHE_SHARDS * ECC_VERIFYCACHE_WAYS);
+
+    // Readers never see a tuple that was not inserted
+    verifycache_reader_t readers[2];
+    pthread_t ids[2];
+    for (size_t t = 0; t < 2; t++) {
+        readers[t] = (verifycache_reader_t) { cache, &publickey, hash, &broken, 0, 0 };
+        TEST_CHECK(pthread_create(&ids[t], NULL, verifycache_reader, &readers[t]) == 0);
+    }
+    for (uint32_t i = 0; i < 20000; i++) {
+        memcpy(fake.s, &i, sizeof(i));
+        ecc_verifycache_insert(cache, &publickey, hash, &fake);
+    }
+    for (size_t t = 0; t < 2; t++) {
+        __atomic_store_n(&readers[t].stop, 1, __ATOMIC_RELEASE);
+        pthread_join(ids[t], NULL);
+        TEST_CHECK_(readers[t].wrong == 0, "reader %zu", t);
+    }
+
+    ecc_verifycache_destroy(cache);
+    ecc_curve_free(&curve);
+}
+
+typedef struct {
+    const curve_t *curve;
+    eccint_point_t res;
+    size_t top;
+} scratch_worker_t;
+
+static void *scratch_worker(void *data) {
+    scratch_worker_t *worker = data;
+    eccint_t k[KEYSIZE];
+
+    eccint_set(k, 0xA5, worker->curve->words);
+    eccint_point_mul(k, &worker->curve->P, &worker->res, worker->curve);
+    worker->top = ecc_scratch.top;
+    return NULL;
+}
+
+void test_ecc_scratch(void) {
+    curve_t curve = sect163k1;
+    eccint_t privatekey[KEYSIZE];
+    eccint_t hash[KEYSIZE];
+    eccint_t k[KEYSIZE];
+    eccint_point_t publickey, expected;
+    eccint_signature_t signature;
+    uint8_t out[1 + 2 * KEYSIZE];
+
+    // Slots are aligned and handed out again after ecc_scratch_end
+    size_t mark = ecc_scratch_begin();
+    eccint_t *a = ecc_scratch_get(curve.words);
+    eccint_t *b = ecc_scratch_get(1);
+    TEST_CHECK((uintptr_t) a % ECC_SCRATCH_ALIGN == 0);
+    TEST_CHECK((uintptr_t) b % ECC_SCRATCH_ALIGN == 0);
+    TEST_CHECK(b - a == ECC_SCRATCH_ALIGN);
+    size_t inner = ecc_scratch_begin();
+    eccint_t *c = ecc_scratch_get(2 * curve.words);
+    ecc_scratch_end(inner);
+    TEST_CHECK(ecc_scratch_get(1) == c);
+    ecc_scratch_end(mark);
+    TEST_CHECK(ecc_scratch_get(1) == a);
+    ecc_scratch_end(mark);
+
+    // Every routine gives back what it takes, on all paths
+    TEST_CHECK(ecc_curve_init(&curve));
+    while (!ecc_keygen(&publickey, privatekey, &curve)) {}
+    eccint_urand(hash, curve.words);
+    ecc_sign(privatekey, hash, &signature, &curve);
+    TEST_CHECK(ecc_verify(&publickey, hash, &signature, &curve));
+    TEST_CHECK(eccint_point_decode(out, eccint_point_encode(&publickey, 1, out, &curve), &publickey, &curve));
+    out[0] = 0x05;
+    TEST_CHECK(!eccint_point_decode(out, 22, &publickey, &curve));
+    eccint_int_inv_mod(curve.order, curve.order, k, curve.words);
+    TEST_CHECK(ecc_scratch.top == mark);
+
+    // Worker threads get their own arena, so a small stack is enough
+    scratch_worker_t worker = { &sect163k1, { { 0 } }, 1 };
+    pthread_attr_t attr;
+    pthread_t id;
+    pthread_attr_init(&attr);
+    pthread_attr_setstacksize(&attr, 64 * 1024);
+    TEST_CHECK(pthread_create(&id, &attr, scratch_worker, &worker) == 0);
+    pthread_join(id, NULL);
+    pthread_attr_destroy(&attr);
+    TEST_CHECK(worker.top == 0);
+    eccint_set(k, 0xA5, curve.words);
+    eccint_point_mul(k, &sect163k1.P, &expected, &sect163k1);
+    TEST_CHECK(eccint_point_cmp(&worker.res, &expected, curve.words) == 0);
+
+#ifdef ECC_SCRATCH_DEBUG
+    TEST_CHECK(ecc_scratch_highwater() > 0);
+    TEST_CHECK(ecc_scratch_highwater() <= ECC_SCRATCH_SIZE);
+#endif
+
+    ecc_curve_free(&curve);
+}
+
+// The kernels and tables in generated/ agree with the generic code
+void test_ecc_generated(void) {
+    curve_t generic = sect163k1;
+    curve_t curve = sect163k1;
+    const size_t words = curve.words;
+    eccint_t a[words];
+    eccint_t r1[words];
+    eccint_t r2[words];
+    ecc_precomp_t built, generated;
+
+    generic.generated = NULL;
+    TEST_CHECK(curve.generated != NULL);
+
+    for (size_t i = 0; i < 20; i++) {
+        eccint_urand(a, words);
+        a[words - 1] &= 0x07;
+
+        eccint_square_mod(a, curve.q, r1, &generic);
+        eccint_square_mod(a, curve.q, r2, &curve);
+        TEST_CHECK_(eccint_cmp(r1, r2, words) == 0, "square %zu", i);
+
+        eccint_inv_mod(a, curve.q, r1, &generic);
+        eccint_inv_mod(a, curve.q, r2, &curve);
+        TEST_CHECK_(eccint_cmp(r1, r2, words) == 0, "inv %zu", i);
+
+        eccint_inv_mod(a, curve.q, a, &curve);
+        TEST_CHECK_(eccint_cmp(a, r1, words) == 0, "inv in place %zu", i);
+    }
+
+    // The tables take the trace mask and half-trace basis from the generator
+    TEST_CHECK(ecc_curve_init(&generic));
+    TEST_CHECK(ecc_curve_init(&curve));
+    TEST_CHECK(eccint_cmp(generic.tables->tracemask, curve.tables->tracemask, words) == 0);
+    for (size_t i = 0; i < 20; i++) {
+        eccint_urand(a, words);
+        a[words - 1] &= 0x07;
+        TEST_CHECK(eccint_trace(a, &generic) == eccint_trace(a, &curve));
+        eccint_halftrace(a, r1, &generic);
+        eccint_halftrace(a, r2, &curve);
+        TEST_CHECK_(eccint_cmp(r1, r2, words) == 0, "H %zu", i);
+    }
+
+    // The fixed-base table of P is copied, other bases are still doubled
+    TEST_CHECK(ecc_precomp_build(&built, &curve.P, ECC_PRECOMP_CURVE, &generic));
+    TEST_CHECK(ecc_precomp_build(&generated, &curve.P, ECC_PRECOMP_CURVE, &curve));
+    for (size_t i = 0; i < built.header->count; i++) {
+        TEST_CHECK_(eccint_point_cmp(&built.table[i], &generated.table[i], words) == 0, "2^%zu P", i);
+    }
+    ecc_precomp_free(&generated);
+    TEST_CHECK(ecc_precomp_build(&generated, &built.table[1], ECC_PRECOMP_CURVE, &curve));
+    TEST_CHECK(eccint_point_cmp(&generated.table[0], &built.table[1], words) == 0);
+    TEST_CHECK(eccint_point_cmp(&generated.table[5], &built.table[6], words) == 0);
+    ecc_precomp_free(&generated);
+    ecc_precomp_free(&built);
+
+    ecc_curve_free(&generic);
+    ecc_curve_free(&curve);
+}
+
 void test_ecc_curve_sanity(void) {
     TEST_CHECK(ecc_validate_publickey(&sect163k1.P, &sect163k1));
     TEST_CHECK(eccint_testbit(sect163k1.q, 163));
@@ -317,6 +1740,37 @@ void test_ecc_curve_sanity(void) {
     TEST_CHECK(eccint_testbit(testcurve9.q, 9));
     TEST_CHECK(eccint_testbit(testcurve9.q, 1));
     TEST_CHECK(eccint_testbit(testcurve9.q, 0));
+
+#if KEYSIZE >= 36
+    // Only built with make test KEYSIZE=36
+    eccint_point_t res;
+    TEST_CHECK(ecc_validate_publickey(&sect283k1.P, &sect283k1));
+    TEST_CHECK(eccint_testbit(sect283k1.q, 283));
+    TEST_CHECK(eccint_testbit(sect283k1.q, 12));
+    TEST_CHECK(eccint_testbit(sect283k1.q, 7));
+    TEST_CHECK(eccint_testbit(sect283k1.q, 5));
+    TEST_CHECK(eccint_testbit(sect283k1.q, 0));
+    eccint_montgomery_ladder_point_mul(sect283k1.order, &sect283k1.P, &res, &sect283k1);
+    TEST_CHECK(eccint_point_testinfinite(&res, sect283k1.words));
+#endif
+#if KEYSIZE >= 72
+    // Only built with make test KEYSIZE=72
+    TEST_CHECK(ecc_validate_publickey(&sect409k1.P, &sect409k1));
+    TEST_CHECK(eccint_testbit(sect409k1.q, 409));
+    TEST_CHECK(eccint_testbit(sect409k1.q, 87));
+    TEST_CHECK(eccint_testbit(sect409k1.q, 0));
+    eccint_montgomery_ladder_point_mul(sect409k1.order, &sect409k1.P, &res, &sect409k1);
+    TEST_CHECK(eccint_point_testinfinite(&res, sect409k1.words));
+
+    TEST_CHECK(ecc_validate_publickey(&sect571k1.P, &sect571k1));
+    TEST_CHECK(eccint_testbit(sect571k1.q, 571));
+    TEST_CHECK(eccint_testbit(sect571k1.q, 10));
+    TEST_CHECK(eccint_testbit(sect571k1.q, 5));
+    TEST_CHECK(eccint_testbit(sect571k1.q, 2));
+    TEST_CHECK(eccint_testbit(sect571k1.q, 0));
+    eccint_montgomery_ladder_point_mul(sect571k1.order, &sect571k1.P, &res, &sect571k1);
+    TEST_CHECK(eccint_point_testinfinite(&res, sect571k1.words));
+#endif
 }
 
 #ifdef TEST_VERBOSE
@@ -325,6 +1779,7 @@ void test_eccint_point_on_curve_verbose(void) {
         eccint_point_t p;
         eccint_cpy(p.x, gf_2x9_curve_point[i][0], testcurve9.words);
         eccint_cpy(p.y, gf_2x9_curve_point[i][1], testcurve9.words);
+        p.infinity = 0;
         int ok = eccint_point_on_curve(&p, &testcurve9);
         TEST_CHECK_(ok, "Point (%u %u, %u %u) should be on curve",
                     gf_2x9_curve_point[i][0][0], gf_2x9_curve_point[i][0][1],
@@ -337,6 +1792,7 @@ void test_eccint_point_double_on_curve_verbose(void) {
         eccint_point_t p, p2;
         eccint_cpy(p.x, gf_2x9_curve_point[i][0], testcurve9.words);
         eccint_cpy(p.y, gf_2x9_curve_point[i][1], testcurve9.words);
+        p.infinity = 0;
 
         eccint_point_double(&p, &p2, &testcurve9);
         if (eccint_testzero(p.x, testcurve9.words)) {
@@ -363,6 +1819,7 @@ void test_eccint_point_add_on_curve_verbose(void) {
             eccint_cpy(p.y, gf_2x9_curve_point[_p][1], testcurve9.words);
             eccint_cpy(q.x, gf_2x9_curve_point[_q][0], testcurve9.words);
             eccint_cpy(q.y, gf_2x9_curve_point[_q][1], testcurve9.words);
+            p.infinity = q.infinity = 0;
 
             eccint_point_add(&p, &q, &r, &testcurve9);
 
@@ -385,6 +1842,7 @@ void test_eccint_point_multiply_on_curve_verbose(void) {
 
             eccint_cpy(p.x, gf_2x9_curve_point[i][0], testcurve9.words);
             eccint_cpy(p.y, gf_2x9_curve_point[i][1], testcurve9.words);
+            p.infinity = 0;
             eccint_from_number(num, k, testcurve9.words);
 
             eccint_point_mul(k, &p, &r, &testcurve9);
@@ -519,7 +1977,7 @@ void test_ecc_make_key(void) {
 
 
 void test_ecc_sign_verify(void) {
-    curve_t *curve = &testcurve9;
+    const curve_t *curve = &sect163k1;
     eccint_point_t publickey;
     eccint_t privatekey[curve->words];
     eccint_t hash[curve->words];
@@ -542,7 +2000,7 @@ void test_ecc_sign_verify(void) {
 }
 
 void test_ecc_hash_verify(void) {
-    curve_t *curve = &testcurve9;
+    const curve_t *curve = &sect163k1;
     eccint_point_t publickey;
     eccint_t privatekey[curve->words];
     eccint_t hash[curve->words];
@@ -596,6 +2054,30 @@ TEST_LIST = {
     { "eccint_point_addition", test_eccint_point_addition },
     { "eccint_point_doubling", test_eccint_point_doubling },
     { "eccint_point_multiply", test_eccint_point_multiply },
+    { "eccint_precomp_point_mul", test_eccint_precomp_point_mul },
+    { "ecc_precomp_file", test_ecc_precomp_file },
+    { "eccint_point_compress", test_eccint_point_compress },
+    { "eccint_trace_halftrace", test_eccint_trace_halftrace },
+    { "eccint_multisquare_sqrt", test_eccint_multisquare_sqrt },
+    { "eccint_point_encode", test_eccint_point_encode },
+    { "ecc_keystore", test_ecc_keystore },
+    { "eccint_point_halving", test_eccint_point_halving },
+    { "eccint_karatsuba_mul", test_eccint_karatsuba_mul },
+    { "ecc_dispatch", test_ecc_dispatch },
+    { "ecc_counters", test_ecc_counters },
+    { "ecc_histogram", test_ecc_histogram },
+    { "ecc_threads", test_ecc_threads },
+    { "ecc_batch", test_ecc_batch },
+    { "ecc_sign_queue", test_ecc_sign_queue },
+    { "ecc_sign_nonce", test_ecc_sign_nonce },
+    { "ecc_server", test_ecc_server },
+    { "ecc_keygen_batch", test_ecc_keygen_batch },
+    { "ecc_ecdh", test_ecc_ecdh },
+    { "ecc_recover_publickey", test_ecc_recover_publickey },
+    { "ecc_keycache", test_ecc_keycache },
+    { "ecc_verifycache", test_ecc_verifycache },
+    { "ecc_scratch", test_ecc_scratch },
+    { "ecc_generated", test_ecc_generated },
 
     { "ecc_make_key", test_ecc_make_key },
     { "ecc_curve_sanity", test_ecc_curve_sanity },
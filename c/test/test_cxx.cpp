@@ -0,0 +1,197 @@
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ * Portions Copyright (C) Philipp Kewisch, 2016 */
+
+// Checks the compile-time specialized C++ layer of include/eccfield.hpp
+// against the C code, part of `make test`
+
+#include <cstdio>
+#include <cstring>
+
+#define CUTEST_NO_FORK
+#define CUTEST_PADDING 50
+
+#include "eccfield.hpp"
+
+extern "C" {
+#include "eccmemory.h"
+#include "eccmath.h"
+#include "ecctables.h"
+#include "curves/sect163k1.h"
+#if KEYSIZE >= 36
+#include "curves/sect283k1.h"
+#endif
+}
+
+#include "cutest.h"
+
+namespace {
+
+// Random element below z^m
+void random_element(eccint_t *a, const curve_t *curve) {
+    eccint_set(a, 0, KEYSIZE);
+    eccint_urand(a, curve->words);
+    a[curve->words - 1] &= (1 << (curve->m % 8)) - 1;
+}
+
+template<typename C>
+void check_field(const curve_t *curve) {
+    using F = typename C::field;
+    eccint_t a[2 * KEYSIZE], b[2 * KEYSIZE];
+    eccint_t expect[2 * KEYSIZE], got[2 * KEYSIZE];
+
+    TEST_CHECK(C::is_curve_of(curve));
+
+    for (int i = 0; i < 32; i++) {
+        random_element(a, curve);
+        random_element(b, curve);
+        const F fa = F::from_bytes(a);
+        const F fb = F::from_bytes(b);
+
+        fa.to_bytes(got);
+        TEST_CHECK_(memcmp(a, got, curve->words) == 0, "bytes %d", i);
+
+        eccint_add(a, b, expect, curve->words);
+        (fa + fb).to_bytes(got);
+        TEST_CHECK_(memcmp(expect, got, curve->words) == 0, "add %d", i);
+
+        eccint_mul_mod(a, b, curve->q, expect, curve);
+        (fa * fb).to_bytes(got);
+        TEST_CHECK_(memcmp(expect, got, curve->words) == 0, "mul %d", i);
+
+        eccint_square_mod(a, curve->q, expect, curve);
+        sqr(fa).to_bytes(got);
+        TEST_CHECK_(memcmp(expect, got, curve->words) == 0, "square %d", i);
+
+        eccint_square_mod(expect, curve->q, expect, curve);
+        eccint_square_mod(expect, curve->q, expect, curve);
+        sqr(fa, 3).to_bytes(got);
+        TEST_CHECK_(memcmp(expect, got, curve->words) == 0, "square 3 times %d", i);
+
+        if (!fa.is_zero()) {
+            eccint_inv_mod(a, curve->q, expect, curve);
+            inv(fa).to_bytes(got);
+            TEST_CHECK_(memcmp(expect, got, curve->words) == 0, "invert %d", i);
+            TEST_CHECK_(fa * inv(fa) == F::one(), "invert %d", i);
+        }
+    }
+}
+
+template<typename C>
+void check_ladder(const curve_t *curve) {
+    eccint_t k[KEYSIZE], b[KEYSIZE];
+    eccint_point_t p, q, expect, got;
+
+    for (int i = 0; i < 32; i++) {
+        eccint_urand(k, curve->words);
+        eccint_urand(b, curve->words);
+        eccint_point_mul(k, &curve->P, &p, curve);
+        eccint_point_mul(b, &curve->P, &q, curve);
+
+        // The ladder recovers y from the x coordinates alone
+        C::to_c(C::mul(k, curve->words, C::from_c(&curve->P)), &got);
+        TEST_CHECK_(eccint_point_cmp(&p, &got, curve->words) == 0, "mul %d", i);
+
+        eccint_point_add(&p, &q, &expect, curve);
+        C::to_c(C::add(C::from_c(&p), C::from_c(&q)), &got);
+        TEST_CHECK_(eccint_point_cmp(&expect, &got, curve->words) == 0, "add %d", i);
+
+        eccint_point_double(&p, &expect, curve);
+        C::to_c(C::dbl(C::from_c(&p)), &got);
+        TEST_CHECK_(eccint_point_cmp(&expect, &got, curve->words) == 0, "double %d", i);
+    }
+
+    // 0 * P and n * P end at infinity, (n - 1) * P = -P takes the branch of
+    // the y recovery where the second ladder point is infinity
+    eccint_set(k, 0, KEYSIZE);
+    C::to_c(C::mul(k, curve->words, C::from_c(&curve->P)), &got);
+    TEST_CHECK(got.infinity);
+
+    eccint_cpy(k, curve->order, curve->words);
+    C::to_c(C::mul(k, curve->words, C::from_c(&curve->P)), &got);
+    TEST_CHECK(got.infinity);
+
+    eccint_set(b, 0, KEYSIZE);
+    b[0] = 1;
+    eccint_int_sub(curve->order, b, k, curve->words);
+    eccint_point_cpy(&expect, &curve->P, curve->words);
+    eccint_add(expect.x, expect.y, expect.y, curve->words);
+    C::to_c(C::mul(k, curve->words, C::from_c(&curve->P)), &got);
+    TEST_CHECK(eccint_point_cmp(&expect, &got, curve->words) == 0);
+
+    // P + (-P) and P + infinity
+    C::to_c(C::add(C::from_c(&curve->P), C::from_c(&expect)), &got);
+    TEST_CHECK(got.infinity);
+    eccint_point_set_infinity(&q, curve->words);
+    C::to_c(C::add(C::from_c(&curve->P), C::from_c(&q)), &got);
+    TEST_CHECK(eccint_point_cmp(&curve->P, &got, curve->words) == 0);
+}
+
+template<typename C>
+void check_curve_ref(const curve_t *base) {
+    curve_t curve = *base;
+    eccint_t privatekey[KEYSIZE], hash[KEYSIZE];
+    eccint_point_t publickey, expect;
+    eccint_signature_t signature;
+
+    TEST_CHECK(ecc_curve_init(&curve));
+    const ecc::curve_ref ref(&curve);
+    TEST_CHECK(ref.get() == &curve);
+
+    TEST_CHECK(ref.keygen(&publickey, privatekey));
+    C::to_c(C::mul(privatekey, curve.words, C::from_c(&curve.P)), &expect);
+    TEST_CHECK(eccint_point_cmp(&publickey, &expect, curve.words) == 0);
+
+    for (int i = 0; i < 4; i++) {
+        eccint_urand(hash, curve.words);
+        ref.sign(privatekey, hash, &signature);
+        TEST_CHECK_(ref.verify(&publickey, hash, &signature), "signature %d", i);
+        TEST_CHECK_(ecc_verify(&publickey, hash, &signature, &curve), "signature %d", i);
+
+        hash[0] ^= 1;
+        TEST_CHECK_(!ref.verify(&publickey, hash, &signature), "signature %d", i);
+    }
+
+    ecc_curve_free(&curve);
+}
+
+} // namespace
+
+void test_cxx_field_sect163k1(void) {
+    check_field<ecc::sect163k1_curve>(&sect163k1);
+}
+
+void test_cxx_ladder_sect163k1(void) {
+    check_ladder<ecc::sect163k1_curve>(&sect163k1);
+}
+
+void test_cxx_curve_ref_sect163k1(void) {
+    check_curve_ref<ecc::sect163k1_curve>(&sect163k1);
+}
+
+#if KEYSIZE >= 36
+void test_cxx_field_sect283k1(void) {
+    check_field<ecc::sect283k1_curve>(&sect283k1);
+}
+
+void test_cxx_ladder_sect283k1(void) {
+    check_ladder<ecc::sect283k1_curve>(&sect283k1);
+}
+
+void test_cxx_curve_ref_sect283k1(void) {
+    check_curve_ref<ecc::sect283k1_curve>(&sect283k1);
+}
+#endif
+
+TEST_LIST = {
+    { "cxx_field_sect163k1", test_cxx_field_sect163k1 },
+    { "cxx_ladder_sect163k1", test_cxx_ladder_sect163k1 },
+    { "cxx_curve_ref_sect163k1", test_cxx_curve_ref_sect163k1 },
+#if KEYSIZE >= 36
+    { "cxx_field_sect283k1", test_cxx_field_sect283k1 },
+    { "cxx_ladder_sect283k1", test_cxx_ladder_sect283k1 },
+    { "cxx_curve_ref_sect283k1", test_cxx_curve_ref_sect283k1 },
+#endif
+    { 0 }
+};
@@ -0,0 +1,175 @@
+# Compare benchmark results of c/test/bench.c against a baseline
+#
+# Usage:
+#   python3 compare.py baseline.json current.json [--threshold 25] [--metric min]
+#       [--reference curve/layer/op/backend] [--noisy prefix] [--noisy-threshold 50]
+#   python3 compare.py --merge out.json run1.json run2.json ...
+#   python3 compare.py --table current.json
+#
+# Exits with 1 if any operation got slower than the baseline by more than the
+# threshold (in percent), so it can gate a build. Single runs on a shared
+# machine vary by 25% and more, so compare the fastest of several runs, which
+# --merge takes per benchmark. With --reference, both files are scaled by the
+# time of that benchmark in the same run, so a baseline from one host can be
+# compared with a run on another. Benchmarks starting with a --noisy prefix
+# get --noisy-threshold instead. With --table, prints the backends of each
+# operation side by side, relative to the fastest one.
+import argparse
+import json
+import sys
+
+# Host fields that make results incomparable when they differ
+HOST_KEYS = ("arch", "keysize")
+
+# Host fields that only change the speed, which --reference makes up for
+SPEED_KEYS = ("cpu", "compiler")
+
+
+def load(path):
+    with open(path) as fp:
+        data = json.load(fp)
+    results = {}
+    for r in data["results"]:
+        results[(r["curve"], r["layer"], r["op"], r["backend"])] = r
+    return data, results
+
+
+def label(key):
+    return "/".join(key)
+
+
+def parse_key(text):
+    key = tuple(text.split("/"))
+    if len(key) != 4:
+        raise argparse.ArgumentTypeError("expected curve/layer/op/backend, got '%s'" % text)
+    return key
+
+
+def compare(baseline_path, current_path, threshold, metric, reference=None, noisy=(), noisy_threshold=None):
+    base, base_results = load(baseline_path)
+    cur, cur_results = load(current_path)
+
+    base_host = base.get("host", {})
+    cur_host = cur.get("host", {})
+    for k in HOST_KEYS:
+        if base_host.get(k) != cur_host.get(k):
+            print("error: %s differs, baseline '%s', current '%s'" % (k, base_host.get(k), cur_host.get(k)))
+            return 2
+    for k in SPEED_KEYS:
+        if base_host.get(k) != cur_host.get(k):
+            print("note: %s differs, baseline '%s', current '%s'%s" % (k, base_host.get(k), cur_host.get(k),
+                  "" if reference else ", consider --reference"))
+    if base.get("unit") != cur.get("unit"):
+        print("error: baseline is in %s, current in %s" % (base.get("unit"), cur.get("unit")))
+        return 2
+
+    # The current run in units of the baseline host
+    scale = 1.0
+    if reference:
+        if reference not in base_results or reference not in cur_results:
+            print("error: reference %s is missing" % label(reference))
+            return 2
+        scale = base_results[reference][metric] / cur_results[reference][metric]
+        print("Scaled by %s, current host is %.2fx the baseline's time\n" % (label(reference), 1 / scale))
+
+    regressions = []
+    width = max([len(label(k)) for k in cur_results] + [10])
+    print("%-*s %14s %14s %8s" % (width, "benchmark", "baseline", "current", "change"))
+    for key in sorted(cur_results, key=label):
+        if key not in base_results:
+            print("%-*s %14s %14.1f %8s" % (width, label(key), "-", cur_results[key][metric], "new"))
+            continue
+        old = base_results[key][metric]
+        new = cur_results[key][metric] * scale
+        change = (new - old) / old * 100 if old else 0.0
+        allowed = threshold
+        if noisy_threshold is not None and any(label(key).startswith(p) for p in noisy):
+            allowed = noisy_threshold
+        mark = ""
+        if change > allowed:
+            mark = "  REGRESSION"
+            regressions.append((key, old, new, change))
+        elif change < -allowed:
+            mark = "  faster"
+        print("%-*s %14.1f %14.1f %+7.1f%%%s" % (width, label(key), old, new, change, mark))
+
+    for key in sorted(set(base_results) - set(cur_results), key=label):
+        print("%-*s %14.1f %14s %8s" % (width, label(key), base_results[key][metric], "-", "missing"))
+
+    print("")
+    if regressions:
+        print("%d of %d benchmarks regressed by more than %g%%%s (%s, %s):"
+              % (len(regressions), len(cur_results), threshold,
+                 " (%g%% for %s)" % (noisy_threshold, ", ".join(noisy)) if noisy_threshold is not None and noisy else "",
+                 metric, cur.get("unit")))
+        for key, old, new, change in regressions:
+            print("  %s: %.1f -> %.1f (%+.1f%%)" % (label(key), old, new, change))
+        return 1
+
+    print("No regressions beyond %g%% in %d benchmarks (%s, %s)"
+          % (threshold, len(cur_results), metric, cur.get("unit")))
+    return 0
+
+
+def merge(out_path, paths):
+    # Each statistic is the smallest of any run, the noise only adds time
+    merged, results = load(paths[0])
+    for path in paths[1:]:
+        _, other = load(path)
+        for key in list(results):
+            if key not in other:
+                del results[key]
+                continue
+            for stat in ("min", "p50", "p90", "p99", "max", "mean"):
+                results[key][stat] = min(results[key][stat], other[key][stat])
+
+    merged["runs"] = len(paths)
+    merged["results"] = [r for r in merged["results"] if (r["curve"], r["layer"], r["op"], r["backend"]) in results]
+    with open(out_path, "w") as fp:
+        json.dump(merged, fp, indent=2)
+        fp.write("\n")
+    return 0
+
+
+def table(current_path, metric):
+    cur, results = load(current_path)
+
+    ops = {}
+    for key in sorted(results, key=label):
+        ops.setdefault(key[:3], []).append(key[3])
+
+    for op, backends in sorted(ops.items()):
+        if len(backends) < 2:
+            continue
+        values = [results[op + (b,)][metric] for b in backends]
+        best = min(values)
+        print("%s (%s %s)" % ("/".join(op), metric, cur.get("unit")))
+        for b, v in sorted(zip(backends, values), key=lambda bv: bv[1]):
+            print("  %-12s %14.1f %7.2fx" % (b, v, v / best if best else 0.0))
+        print("")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare benchmark results")
+    parser.add_argument("files", nargs="+", help="baseline.json current.json, or current.json with --table")
+    parser.add_argument("--threshold", type=float, default=25.0, help="allowed slowdown in percent")
+    parser.add_argument("--reference", type=parse_key, help="scale both runs by this benchmark, curve/layer/op/backend")
+    parser.add_argument("--noisy", action="append", default=[], help="prefix of benchmarks with --noisy-threshold")
+    parser.add_argument("--noisy-threshold", type=float, help="allowed slowdown of the --noisy benchmarks")
+    parser.add_argument("--metric", default="min", choices=("min", "p50", "p90", "p99", "mean"))
+    parser.add_argument("--table", action="store_true", help="compare the backends of each operation")
+    parser.add_argument("--merge", metavar="OUT", help="write the fastest of the given runs to OUT")
+    args = parser.parse_args()
+
+    if args.merge:
+        return merge(args.merge, args.files)
+    if args.table:
+        return table(args.files[-1], args.metric)
+    if len(args.files) != 2:
+        parser.error("need a baseline and a current result file")
+    return compare(args.files[0], args.files[1], args.threshold, args.metric, args.reference, args.noisy, args.noisy_threshold)
+
+
+if __name__ == "__main__":
+    sys.exit(main())